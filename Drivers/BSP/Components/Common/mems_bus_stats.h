@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file    mems_bus_stats.h
+  * @author  MEMS Software Solutions Team
+  * @brief   Bus transaction statistics shared by the MEMS component drivers
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MEMS_BUS_STATS_H
+#define MEMS_BUS_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef USE_MEMS_BUS_STATS
+#define USE_MEMS_BUS_STATS  0U
+#endif /* USE_MEMS_BUS_STATS */
+
+/** @defgroup    MEMS_BUS_STATS MEMS bus transaction statistics
+  * @brief       Counters maintained by the register wrappers of the component
+  *              when USE_MEMS_BUS_STATS is 1. The option changes the component
+  *              object, so it has to be defined for the whole project; when
+  *              it is 0 the wrappers are unchanged.
+  * @{
+  *
+  */
+
+typedef uint32_t (*MEMS_BusStats_GetTime_Func)(void);
+
+typedef struct
+{
+  MEMS_BusStats_GetTime_Func GetTime; /* Timestamp hook, the bus time is not counted if NULL */
+  uint32_t Start;                     /* Timestamp of the transaction in progress */
+  uint32_t Reads;                     /* Read transactions */
+  uint32_t Writes;                    /* Write transactions */
+  uint32_t ReadBytes;
+  uint32_t WriteBytes;
+  uint32_t Errors;                    /* Failed transactions */
+  uint32_t BusTime;                   /* Time spent in the transactions, in GetTime units */
+} MEMS_BusStats_t;
+
+#if (USE_MEMS_BUS_STATS == 1U)
+#define MEMS_BUS_STATS_START(Stats) \
+  ((Stats).Start = ((Stats).GetTime != NULL) ? (Stats).GetTime() : 0U)
+#define MEMS_BUS_STATS_END(Stats, Count, Bytes, Length, Ret) \
+  do \
+  { \
+    (Stats).Count++; \
+    (Stats).Bytes += (uint32_t)(Length); \
+    if ((Ret) != 0) \
+    { \
+      (Stats).Errors++; \
+    } \
+    if ((Stats).GetTime != NULL) \
+    { \
+      (Stats).BusTime += (Stats).GetTime() - (Stats).Start; \
+    } \
+  } while (0)
+#else
+#define MEMS_BUS_STATS_START(Stats)                           ((void)0)
+#define MEMS_BUS_STATS_END(Stats, Count, Bytes, Length, Ret)  ((void)0)
+#endif /* USE_MEMS_BUS_STATS */
+
+#define MEMS_BUS_STATS_READ(Stats, Length, Ret)   MEMS_BUS_STATS_END(Stats, Reads, ReadBytes, Length, Ret)
+#define MEMS_BUS_STATS_WRITE(Stats, Length, Ret)  MEMS_BUS_STATS_END(Stats, Writes, WriteBytes, Length, Ret)
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMS_BUS_STATS_H */
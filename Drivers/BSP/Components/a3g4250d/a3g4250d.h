@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "a3g4250d_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -91,6 +92,9 @@ typedef struct
   uint8_t            is_initialized;
   uint8_t            gyro_is_enabled;
   a3g4250d_dr_t      gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } A3G4250D_Object_t;
 
 typedef struct
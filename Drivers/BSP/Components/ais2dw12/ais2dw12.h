@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "ais2dw12_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -113,6 +114,9 @@ typedef struct
   uint8_t                   acc_is_enabled;
   float                     acc_odr;
   AIS2DW12_Operating_Mode_t acc_operating_mode;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } AIS2DW12_Object_t;
 
 typedef struct
@@ -1808,8 +1808,13 @@ static int32_t AIS2IH_ACC_SetOutputDataRate_When_Disabled(AIS2IH_Object_t *pObj,
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   AIS2IH_Object_t *pObj = (AIS2IH_Object_t *)Handle;
+  int32_t ret;
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+
+  return ret;
 }
 
 /**
@@ -1823,8 +1828,13 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   AIS2IH_Object_t *pObj = (AIS2IH_Object_t *)Handle;
+  int32_t ret;
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+
+  return ret;
 }
 
 /**
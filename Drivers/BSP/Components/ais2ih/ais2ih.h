@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "ais2ih_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -121,6 +122,9 @@ typedef struct
   float                   acc_odr;
   AIS2IH_Operating_Mode_t acc_operating_mode;
   AIS2IH_Low_Noise_t      acc_low_noise;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } AIS2IH_Object_t;
 
 typedef struct
@@ -1107,8 +1107,13 @@ static int32_t ASM330LHH_GYRO_SetOutputDataRate_When_Disabled(ASM330LHH_Object_t
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ASM330LHH_Object_t *pObj = (ASM330LHH_Object_t *)Handle;
+  int32_t ret;
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+
+  return ret;
 }
 
 /**
@@ -1122,8 +1127,13 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ASM330LHH_Object_t *pObj = (ASM330LHH_Object_t *)Handle;
+  int32_t ret;
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+
+  return ret;
 }
 
 /**
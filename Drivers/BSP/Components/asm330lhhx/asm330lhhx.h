@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "asm330lhhx_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -106,6 +107,9 @@ typedef struct
   uint8_t             gyro_is_enabled;
   asm330lhhx_odr_xl_t acc_odr;
   asm330lhhx_odr_g_t  gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } ASM330LHHX_Object_t;
 
 typedef struct
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "h3lis331dl_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -91,6 +92,9 @@ typedef struct
   uint8_t            is_initialized;
   uint8_t            acc_is_enabled;
   h3lis331dl_dr_t    acc_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } H3LIS331DL_Object_t;
 
 typedef struct
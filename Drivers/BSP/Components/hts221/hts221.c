@@ -742,16 +742,23 @@ static float Linear_Interpolation(lin_t *Lin, float Coeff)
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   HTS221_Object_t *pObj = (HTS221_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == (uint32_t)HTS221_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
   else /* SPI 3-Wires */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -766,16 +773,23 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   HTS221_Object_t *pObj = (HTS221_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == (uint32_t)HTS221_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
   else /* SPI 3-Wires */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "hts221_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -79,6 +80,9 @@ typedef struct
   uint8_t            is_initialized;
   uint8_t            hum_is_enabled;
   uint8_t            temp_is_enabled;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } HTS221_Object_t;
 
 typedef struct
@@ -66,6 +66,8 @@ IIS2DULPX_ACC_Drv_t IIS2DULPX_ACC_Driver =
 
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t IIS2DULPX_Boot_Start(IIS2DULPX_Object_t *pObj);
+static int32_t IIS2DULPX_Boot_End(IIS2DULPX_Object_t *pObj);
 static int32_t IIS2DULPX_ACC_SetOutputDataRate_When_Enabled(IIS2DULPX_Object_t *pObj, float_t Odr,
     IIS2DULPX_Power_Mode_t Power);
 static int32_t IIS2DULPX_ACC_SetOutputDataRate_When_Disabled(IIS2DULPX_Object_t *pObj, float_t Odr,
@@ -82,9 +84,34 @@ static int32_t IIS2DULPX_ACC_SetOutputDataRate_When_Disabled(IIS2DULPX_Object_t
 /**
   * @brief  Register Component Bus IO operations
   * @param  pObj the device pObj
+  * @param  pIO the bus IO operations
   * @retval 0 in case of success, an error code otherwise
   */
 int32_t IIS2DULPX_RegisterBusIO(IIS2DULPX_Object_t *pObj, IIS2DULPX_IO_t *pIO)
+{
+  int32_t ret = IIS2DULPX_RegisterBusIO_Start(pObj, pIO);
+
+  if ((ret == IIS2DULPX_OK) && (pObj->boot_pending == 1U))
+  {
+    /* Wait for 25 ms based on datasheet */
+    pObj->Ctx.mdelay(IIS2DULPX_BOOT_TIME);
+
+    ret = IIS2DULPX_Boot_End(pObj);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Register Component Bus IO operations and start the exit from deep power down,
+  *         without waiting for the boot time
+  * @param  pObj the device pObj
+  * @param  pIO the bus IO operations
+  * @retval 0 in case of success, an error code otherwise
+  * @note   The component must not be accessed until IIS2DULPX_Boot_Poll reports the end
+  *         of the boot, the other devices can be initialized meanwhile
+  */
+int32_t IIS2DULPX_RegisterBusIO_Start(IIS2DULPX_Object_t *pObj, IIS2DULPX_IO_t *pIO)
 {
   int32_t ret = IIS2DULPX_OK;
 
@@ -119,45 +146,13 @@ int32_t IIS2DULPX_RegisterBusIO(IIS2DULPX_Object_t *pObj, IIS2DULPX_IO_t *pIO)
     }
     else
     {
-      if (pObj->IO.BusType == IIS2DULPX_SPI_3WIRES_BUS) /* SPI 3-Wires */
-      {
-        /* Enable the SPI 3-Wires support only the first time */
-        if (pObj->is_initialized == 0U)
-        {
-          /* Exit from deep power down only the first time in SPI mode */
-          if (IIS2DULPX_ExitDeepPowerDownSPI(pObj) != IIS2DULPX_OK)
-          {
-            ret = IIS2DULPX_ERROR;
-          }
-          /* Enable SPI 3-Wires on the component */
-          uint8_t data = 0x50;
-
-          if (IIS2DULPX_Write_Reg(pObj, IIS2DULPX_CTRL1, data) != IIS2DULPX_OK)
-          {
-            ret = IIS2DULPX_ERROR;
-          }
-        }
-      }
-      else if (pObj->IO.BusType == IIS2DULPX_SPI_4WIRES_BUS)
-      {
-        /* Exit from deep power down only the first time in SPI mode */
-        if (pObj->is_initialized == 0U)
-        {
-          if (IIS2DULPX_ExitDeepPowerDownSPI(pObj) != IIS2DULPX_OK)
-          {
-            ret = IIS2DULPX_ERROR;
-          }
-        }
-      }
-      else if (pObj->IO.BusType == IIS2DULPX_I2C_BUS)
+      if ((pObj->IO.BusType == IIS2DULPX_I2C_BUS) || (pObj->IO.BusType == IIS2DULPX_SPI_4WIRES_BUS) ||
+          (pObj->IO.BusType == IIS2DULPX_SPI_3WIRES_BUS))
       {
-        /* Exit from deep power down only the first time in I2C mode */
+        /* Exit from deep power down only the first time, SPI 3-Wires is enabled at the end of the boot */
         if (pObj->is_initialized == 0U)
         {
-          if (IIS2DULPX_ExitDeepPowerDownI2C(pObj) != IIS2DULPX_OK)
-          {
-            ret = IIS2DULPX_ERROR;
-          }
+          ret = IIS2DULPX_Boot_Start(pObj);
         }
       }
       else
@@ -170,6 +165,41 @@ int32_t IIS2DULPX_RegisterBusIO(IIS2DULPX_Object_t *pObj, IIS2DULPX_IO_t *pIO)
   return ret;
 }
 
+/**
+  * @brief  Check the end of the boot started by IIS2DULPX_RegisterBusIO_Start
+  * @param  pObj the device pObj
+  * @param  Done 1 when the component can be accessed, 0 during the boot time
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t IIS2DULPX_Boot_Poll(IIS2DULPX_Object_t *pObj, uint8_t *Done)
+{
+  int32_t ret = IIS2DULPX_OK;
+
+  *Done = 1U;
+
+  if (pObj->boot_pending == 1U)
+  {
+    if (pObj->IO.GetTick == NULL)
+    {
+      /* No time base, wait for the whole boot time */
+      pObj->Ctx.mdelay(IIS2DULPX_BOOT_TIME);
+
+      ret = IIS2DULPX_Boot_End(pObj);
+    }
+    /* The tick of the start may have been almost over, one more is needed */
+    else if (((uint32_t)pObj->IO.GetTick() - pObj->boot_tick) > IIS2DULPX_BOOT_TIME)
+    {
+      ret = IIS2DULPX_Boot_End(pObj);
+    }
+    else
+    {
+      *Done = 0U;
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Initialize the IIS2DULPX sensor
   * @param  pObj the device pObj
@@ -1660,6 +1690,65 @@ int32_t IIS2DULPX_ACC_Get_6D_Orientation_ZH(IIS2DULPX_Object_t *pObj, uint8_t *Z
   return IIS2DULPX_OK;
 }
 
+/**
+  * @brief  Exit from deep power down, the boot time starts
+  * @param  pObj the device pObj
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t IIS2DULPX_Boot_Start(IIS2DULPX_Object_t *pObj)
+{
+  iis2dulpx_en_device_config_t en_device_config = {0};
+  uint8_t val;
+
+  if (pObj->IO.BusType == IIS2DULPX_I2C_BUS)
+  {
+    /* Perform dummy read in order to exit from deep power down in I2C mode.
+     * NOTE: No return value check - expected first read fail. */
+    (void)iis2dulpx_device_id_get(&(pObj->Ctx), &val);
+  }
+  else
+  {
+    /* Write IF_WAKE_UP register to exit from deep power down in SPI mode,
+     * iis2dulpx_exit_deep_power_down would wait for the boot time */
+    en_device_config.soft_pd = PROPERTY_ENABLE;
+    if (iis2dulpx_write_reg(&(pObj->Ctx), IIS2DULPX_EN_DEVICE_CONFIG,
+                            (uint8_t *)&en_device_config, 1) != IIS2DULPX_OK)
+    {
+      return IIS2DULPX_ERROR;
+    }
+  }
+
+  pObj->boot_tick = (pObj->IO.GetTick != NULL) ? (uint32_t)pObj->IO.GetTick() : 0U;
+  pObj->boot_pending = 1U;
+
+  return IIS2DULPX_OK;
+}
+
+/**
+  * @brief  End of the boot time, the component can be accessed
+  * @param  pObj the device pObj
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t IIS2DULPX_Boot_End(IIS2DULPX_Object_t *pObj)
+{
+  int32_t ret = IIS2DULPX_OK;
+
+  pObj->boot_pending = 0U;
+
+  if (pObj->IO.BusType == IIS2DULPX_SPI_3WIRES_BUS)
+  {
+    /* Enable SPI 3-Wires on the component */
+    uint8_t data = 0x50;
+
+    if (IIS2DULPX_Write_Reg(pObj, IIS2DULPX_CTRL1, data) != IIS2DULPX_OK)
+    {
+      ret = IIS2DULPX_ERROR;
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Wrap Read register component function to Bus IO function
   * @param  Handle the device handler
@@ -1671,8 +1760,13 @@ int32_t IIS2DULPX_ACC_Get_6D_Orientation_ZH(IIS2DULPX_Object_t *pObj, uint8_t *Z
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   IIS2DULPX_Object_t *pObj = (IIS2DULPX_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  return ret;
 }
 
 /**
@@ -1686,8 +1780,13 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   IIS2DULPX_Object_t *pObj = (IIS2DULPX_Object_t *)Handle;
+  int32_t ret;
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+
+  return ret;
 }
 
 /**
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "iis2dulpx_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -113,6 +114,11 @@ typedef struct
   uint8_t                acc_is_enabled;
   float                  acc_odr;
   IIS2DULPX_Power_Mode_t power_mode;
+  uint8_t                boot_pending; /* Exit from deep power down started, boot time not elapsed */
+  uint32_t               boot_tick;    /* IO.GetTick() at the exit from deep power down */
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } IIS2DULPX_Object_t;
 
 typedef struct
@@ -190,6 +196,8 @@ typedef union
 #define IIS2DULPX_SPI_3WIRES_BUS          2U
 #define IIS2DULPX_I3C_BUS                 3U
 
+#define IIS2DULPX_BOOT_TIME              25U  /**< Boot time after the exit from deep power down [ms] */
+
 #define IIS2DULPX_ACC_SENSITIVITY_FOR_FS_2G   0.061f  /**< Sensitivity value for 2g full scale, Low-power1 mode [mg/LSB] */
 #define IIS2DULPX_ACC_SENSITIVITY_FOR_FS_4G   0.122f  /**< Sensitivity value for 4g full scale, Low-power1 mode [mg/LSB] */
 #define IIS2DULPX_ACC_SENSITIVITY_FOR_FS_8G   0.244f  /**< Sensitivity value for 8g full scale, Low-power1 mode [mg/LSB] */
@@ -211,6 +219,8 @@ typedef union
   */
 
 int32_t IIS2DULPX_RegisterBusIO(IIS2DULPX_Object_t *pObj, IIS2DULPX_IO_t *pIO);
+int32_t IIS2DULPX_RegisterBusIO_Start(IIS2DULPX_Object_t *pObj, IIS2DULPX_IO_t *pIO);
+int32_t IIS2DULPX_Boot_Poll(IIS2DULPX_Object_t *pObj, uint8_t *Done);
 int32_t IIS2DULPX_Init(IIS2DULPX_Object_t *pObj);
 int32_t IIS2DULPX_DeInit(IIS2DULPX_Object_t *pObj);
 int32_t IIS2DULPX_ExitDeepPowerDownI2C(IIS2DULPX_Object_t *pObj);
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "iis2iclx_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -103,6 +104,9 @@ typedef struct
   uint8_t             is_initialized;
   uint8_t             acc_is_enabled;
   iis2iclx_odr_xl_t   acc_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } IIS2ICLX_Object_t;
 
 typedef struct
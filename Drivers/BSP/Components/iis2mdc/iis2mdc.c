@@ -520,16 +520,23 @@ int32_t IIS2MDC_MAG_Get_Init_Status(IIS2MDC_Object_t *pObj, uint8_t *Status)
 static int32_t ReadMagRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   IIS2MDC_Object_t *pObj = (IIS2MDC_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == IIS2MDC_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
   else   /* SPI 3-Wires */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -544,16 +551,23 @@ static int32_t ReadMagRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_
 static int32_t WriteMagRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   IIS2MDC_Object_t *pObj = (IIS2MDC_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == IIS2MDC_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
   else   /* SPI 3-Wires */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "iis2mdc_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -85,6 +86,9 @@ typedef struct
   stmdev_ctx_t        Ctx;
   uint8_t             is_initialized;
   uint8_t             mag_is_enabled;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } IIS2MDC_Object_t;
 
 typedef struct
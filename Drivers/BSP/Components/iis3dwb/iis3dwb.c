@@ -1128,8 +1128,13 @@ int32_t IIS3DWB_FIFO_Get_Num_Samples(IIS3DWB_Object_t *pObj, uint16_t *NumSample
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   IIS3DWB_Object_t *pObj = (IIS3DWB_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  return ret;
 }
 
 /**
@@ -1143,8 +1148,13 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   IIS3DWB_Object_t *pObj = (IIS3DWB_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  return ret;
 }
 
 /**
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "iis3dwb_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
  * @{
@@ -98,6 +99,9 @@ typedef struct
   uint8_t             is_initialized;
   uint8_t             acc_is_enabled;
   float               acc_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } IIS3DWB_Object_t;
 
 typedef struct
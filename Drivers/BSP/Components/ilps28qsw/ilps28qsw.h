@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "ilps28qsw_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -72,6 +73,9 @@ typedef struct
   uint8_t             press_is_enabled;
   uint8_t             temp_is_enabled;
   ilps28qsw_md_t        last_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } ILPS28QSW_Object_t;
 
 typedef struct
@@ -1134,16 +1134,23 @@ static int32_t ISM303DAC_ACC_SetOutputDataRate_When_Disabled(ISM303DAC_ACC_Objec
 static int32_t ReadAccRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ISM303DAC_ACC_Object_t *pObj = (ISM303DAC_ACC_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == ISM303DAC_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
   else   /* SPI 3-Wires */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -1158,16 +1165,23 @@ static int32_t ReadAccRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_
 static int32_t WriteAccRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ISM303DAC_ACC_Object_t *pObj = (ISM303DAC_ACC_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == ISM303DAC_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
   else   /* SPI 3-Wires */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -1182,16 +1196,23 @@ static int32_t WriteAccRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16
 static int32_t ReadMagRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ISM303DAC_MAG_Object_t *pObj = (ISM303DAC_MAG_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == ISM303DAC_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
   else   /* SPI 3-Wires */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -1206,16 +1227,23 @@ static int32_t ReadMagRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_
 static int32_t WriteMagRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ISM303DAC_MAG_Object_t *pObj = (ISM303DAC_MAG_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == ISM303DAC_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
   else   /* SPI 3-Wires */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "ism303dac_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -86,6 +87,9 @@ typedef struct
   uint8_t               is_initialized;
   uint8_t               acc_is_enabled;
   ism303dac_xl_odr_t    acc_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } ISM303DAC_ACC_Object_t;
 
 typedef struct
@@ -94,6 +98,9 @@ typedef struct
   stmdev_ctx_t       Ctx;
   uint8_t               is_initialized;
   uint8_t               mag_is_enabled;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } ISM303DAC_MAG_Object_t;
 
 typedef struct
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "ism330bx_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
  * @{
@@ -122,6 +123,9 @@ typedef struct
   uint8_t                 gyro_is_enabled;
   ism330bx_xl_data_rate_t acc_odr;
   ism330bx_gy_data_rate_t gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } ISM330BX_Object_t;
 
 typedef struct
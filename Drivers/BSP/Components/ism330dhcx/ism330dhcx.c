@@ -73,12 +73,49 @@ ISM330DHCX_GYRO_Drv_t ISM330DHCX_GYRO_Driver =
   * @}
   */
 
+#if (USE_MEMS_REG_SHADOW == 1U)
+/** @defgroup ISM330DHCX_Private_Variables ISM330DHCX Private Variables
+  * @{
+  */
+
+#define ISM330DHCX_SHADOW_BANK_MASK       0xC0U /* FUNC_CFG_ACCESS reg_access */
+#define ISM330DHCX_SHADOW_FUNC_CFG_MASK   0xC0U /* FUNC_CFG_ACCESS bits kept: reg_access */
+#define ISM330DHCX_SHADOW_BOOT            0x80U /* CTRL3_C boot */
+#define ISM330DHCX_SHADOW_IF_INC          0x04U /* CTRL3_C if_inc */
+#define ISM330DHCX_SHADOW_SW_RESET        0x01U /* CTRL3_C sw_reset */
+#define ISM330DHCX_SHADOW_RST_COUNTER_BDR 0x40U /* COUNTER_BDR_REG1 rst_counter_bdr */
+
+/* Registers kept in the shadow, one bit per register: the control registers
+   of the main bank written only by the host, and FUNC_CFG_ACCESS, at the same
+   address in all the banks. The status, output and FIFO registers, and the
+   OIS registers written by the auxiliary SPI are always read on the bus.
+     FUNC_CFG_ACCESS, PIN_CTRL, FIFO_CTRL1..4, COUNTER_BDR_REG1..2, INT1_CTRL,
+     INT2_CTRL, CTRL1_XL..CTRL10_C, TAP_CFG0..MD2_CFG, X_OFS_USR..Z_OFS_USR */
+static const uint8_t ISM330DHCX_Shadow_Map[MEMS_REG_SHADOW_SIZE / 8U] =
+{
+  0x86U, 0x7FU, 0xFFU, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U,
+  0x00U, 0x00U, 0xC0U, 0xFFU, 0x00U, 0x00U, 0x38U, 0x00U
+};
+
+/**
+  * @}
+  */
+#endif /* USE_MEMS_REG_SHADOW */
+
 /** @defgroup ISM330DHCX_Private_Function_Prototypes ISM330DHCX Private Function Prototypes
   * @{
   */
 
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t ISM330DHCX_Convert_Axis(int16_t Raw, float_t Sensitivity);
+#if (USE_MEMS_REG_SHADOW == 1U)
+static uint8_t Shadow_Read(MEMS_RegShadow_t *pShadow, uint8_t Reg, uint8_t *pData, uint16_t Length);
+static void Shadow_Update(MEMS_RegShadow_t *pShadow, uint8_t Reg, const uint8_t *pData, uint16_t Length);
+static void Shadow_Lost(MEMS_RegShadow_t *pShadow, uint8_t Reg, uint16_t Length);
+static void Shadow_Ctrl3(MEMS_RegShadow_t *pShadow, uint8_t Val);
+static void Shadow_Store(MEMS_RegShadow_t *pShadow, uint32_t Reg, uint8_t Val);
+#endif /* USE_MEMS_REG_SHADOW */
 static int32_t ISM330DHCX_ACC_SetOutputDataRate_When_Enabled(ISM330DHCX_Object_t *pObj, float Odr);
 static int32_t ISM330DHCX_ACC_SetOutputDataRate_When_Disabled(ISM330DHCX_Object_t *pObj, float Odr);
 static int32_t ISM330DHCX_GYRO_SetOutputDataRate_When_Enabled(ISM330DHCX_Object_t *pObj, float Odr);
@@ -121,6 +158,10 @@ int32_t ISM330DHCX_RegisterBusIO(ISM330DHCX_Object_t *pObj, ISM330DHCX_IO_t *pIO
     pObj->Ctx.mdelay    = pIO->Delay;
     pObj->Ctx.handle   = pObj;
 
+#if (USE_MEMS_REG_SHADOW == 1U)
+    (void)ISM330DHCX_Set_Reg_Shadow(pObj, 1U);
+#endif /* USE_MEMS_REG_SHADOW */
+
     if (pObj->IO.Init == NULL)
     {
       ret = ISM330DHCX_ERROR;
@@ -612,9 +653,9 @@ int32_t ISM330DHCX_ACC_GetAxes(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes_t *Acc
   }
 
   /* Calculate the data. */
-  Acceleration->x = (int32_t)((float)((float)data_raw.i16bit[0] * sensitivity));
-  Acceleration->y = (int32_t)((float)((float)data_raw.i16bit[1] * sensitivity));
-  Acceleration->z = (int32_t)((float)((float)data_raw.i16bit[2] * sensitivity));
+  Acceleration->x = ISM330DHCX_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  Acceleration->y = ISM330DHCX_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  Acceleration->z = ISM330DHCX_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return ISM330DHCX_OK;
 }
@@ -939,9 +980,9 @@ int32_t ISM330DHCX_GYRO_GetAxes(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes_t *An
   }
 
   /* Calculate the data. */
-  AngularRate->x = (int32_t)((float)((float)data_raw.i16bit[0] * sensitivity));
-  AngularRate->y = (int32_t)((float)((float)data_raw.i16bit[1] * sensitivity));
-  AngularRate->z = (int32_t)((float)((float)data_raw.i16bit[2] * sensitivity));
+  AngularRate->x = ISM330DHCX_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  AngularRate->y = ISM330DHCX_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  AngularRate->z = ISM330DHCX_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return ISM330DHCX_OK;
 }
@@ -2088,6 +2129,8 @@ int32_t ISM330DHCX_ACC_Get_6D_Orientation_ZH(ISM330DHCX_Object_t *pObj, uint8_t
 
 /**
   * @brief  Get the status of all hardware events
+  * @note   The source registers and MD1_CFG, MD2_CFG are read in two bursts (one with the
+  *         register shadow)
   * @param  pObj the device pObj
   * @param  Status the status of all hardware events
   * @retval 0 in case of success, an error code otherwise
@@ -2099,39 +2142,28 @@ int32_t ISM330DHCX_ACC_Get_Event_Status(ISM330DHCX_Object_t *pObj, ISM330DHCX_Ev
   ism330dhcx_d6d_src_t d6d_src;
   ism330dhcx_md1_cfg_t md1_cfg;
   ism330dhcx_md2_cfg_t md2_cfg;
-  ism330dhcx_int1_ctrl_t int1_ctrl;
+  uint8_t src[3];
+  uint8_t cfg[2];
 
   (void)memset((void *)Status, 0x0, sizeof(ISM330DHCX_Event_Status_t));
 
-  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_WAKE_UP_SRC, (uint8_t *)&wake_up_src, 1) != ISM330DHCX_OK)
-  {
-    return ISM330DHCX_ERROR;
-  }
-
-  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_TAP_SRC, (uint8_t *)&tap_src, 1) != ISM330DHCX_OK)
-  {
-    return ISM330DHCX_ERROR;
-  }
-
-  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_D6D_SRC, (uint8_t *)&d6d_src, 1) != ISM330DHCX_OK)
-  {
-    return ISM330DHCX_ERROR;
-  }
-
-  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_MD1_CFG, (uint8_t *)&md1_cfg, 1) != ISM330DHCX_OK)
+  /* WAKE_UP_SRC, TAP_SRC, D6D_SRC */
+  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_WAKE_UP_SRC, src, 3) != ISM330DHCX_OK)
   {
     return ISM330DHCX_ERROR;
   }
 
-  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_MD2_CFG, (uint8_t *)&md2_cfg, 1) != ISM330DHCX_OK)
+  /* MD1_CFG, MD2_CFG */
+  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_MD1_CFG, cfg, 2) != ISM330DHCX_OK)
   {
     return ISM330DHCX_ERROR;
   }
 
-  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_INT1_CTRL, (uint8_t *)&int1_ctrl, 1) != ISM330DHCX_OK)
-  {
-    return ISM330DHCX_ERROR;
-  }
+  (void)memcpy((void *)&wake_up_src, (void *)&src[0], 1);
+  (void)memcpy((void *)&tap_src, (void *)&src[1], 1);
+  (void)memcpy((void *)&d6d_src, (void *)&src[2], 1);
+  (void)memcpy((void *)&md1_cfg, (void *)&cfg[0], 1);
+  (void)memcpy((void *)&md2_cfg, (void *)&cfg[1], 1);
 
   if ((md1_cfg.int1_ff == 1U) || (md2_cfg.int2_ff == 1U))
   {
@@ -2691,7 +2723,6 @@ int32_t ISM330DHCX_FIFO_ACC_Get_Axes(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes_
   uint8_t data[6];
   int16_t data_raw[3];
   float sensitivity = 0.0f;
-  float acceleration_float[3];
 
   if (ISM330DHCX_FIFO_Get_Data(pObj, data) != ISM330DHCX_OK)
   {
@@ -2707,13 +2738,9 @@ int32_t ISM330DHCX_FIFO_ACC_Get_Axes(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes_
     return ISM330DHCX_ERROR;
   }
 
-  acceleration_float[0] = (float)data_raw[0] * sensitivity;
-  acceleration_float[1] = (float)data_raw[1] * sensitivity;
-  acceleration_float[2] = (float)data_raw[2] * sensitivity;
-
-  Acceleration->x = (int32_t)acceleration_float[0];
-  Acceleration->y = (int32_t)acceleration_float[1];
-  Acceleration->z = (int32_t)acceleration_float[2];
+  Acceleration->x = ISM330DHCX_Convert_Axis(data_raw[0], sensitivity);
+  Acceleration->y = ISM330DHCX_Convert_Axis(data_raw[1], sensitivity);
+  Acceleration->z = ISM330DHCX_Convert_Axis(data_raw[2], sensitivity);
 
   return ISM330DHCX_OK;
 }
@@ -2729,7 +2756,6 @@ int32_t ISM330DHCX_FIFO_GYRO_Get_Axes(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes
   uint8_t data[6];
   int16_t data_raw[3];
   float sensitivity = 0.0f;
-  float angular_velocity_float[3];
 
   if (ISM330DHCX_FIFO_Get_Data(pObj, data) != ISM330DHCX_OK)
   {
@@ -2745,13 +2771,9 @@ int32_t ISM330DHCX_FIFO_GYRO_Get_Axes(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes
     return ISM330DHCX_ERROR;
   }
 
-  angular_velocity_float[0] = (float)data_raw[0] * sensitivity;
-  angular_velocity_float[1] = (float)data_raw[1] * sensitivity;
-  angular_velocity_float[2] = (float)data_raw[2] * sensitivity;
-
-  AngularVelocity->x = (int32_t)angular_velocity_float[0];
-  AngularVelocity->y = (int32_t)angular_velocity_float[1];
-  AngularVelocity->z = (int32_t)angular_velocity_float[2];
+  AngularVelocity->x = ISM330DHCX_Convert_Axis(data_raw[0], sensitivity);
+  AngularVelocity->y = ISM330DHCX_Convert_Axis(data_raw[1], sensitivity);
+  AngularVelocity->z = ISM330DHCX_Convert_Axis(data_raw[2], sensitivity);
 
   return ISM330DHCX_OK;
 }
@@ -2839,7 +2861,6 @@ int32_t ISM330DHCX_FIFO_ACC_Get_Axis(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes_
   uint8_t data[6];
   int16_t data_raw[3];
   float sensitivity = 0.0f;
-  float acceleration_float[3];
 
   if (ISM330DHCX_FIFO_Get_Data(pObj, data) != ISM330DHCX_OK)
   {
@@ -2855,13 +2876,9 @@ int32_t ISM330DHCX_FIFO_ACC_Get_Axis(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes_
     return ISM330DHCX_ERROR;
   }
 
-  acceleration_float[0] = (float)data_raw[0] * sensitivity;
-  acceleration_float[1] = (float)data_raw[1] * sensitivity;
-  acceleration_float[2] = (float)data_raw[2] * sensitivity;
-
-  Acceleration->x = (int32_t)acceleration_float[0];
-  Acceleration->y = (int32_t)acceleration_float[1];
-  Acceleration->z = (int32_t)acceleration_float[2];
+  Acceleration->x = ISM330DHCX_Convert_Axis(data_raw[0], sensitivity);
+  Acceleration->y = ISM330DHCX_Convert_Axis(data_raw[1], sensitivity);
+  Acceleration->z = ISM330DHCX_Convert_Axis(data_raw[2], sensitivity);
 
   return ISM330DHCX_OK;
 }
@@ -2877,7 +2894,6 @@ int32_t ISM330DHCX_FIFO_GYRO_Get_Axis(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes
   uint8_t data[6];
   int16_t data_raw[3];
   float sensitivity = 0.0f;
-  float angular_velocity_float[3];
 
   if (ISM330DHCX_FIFO_Get_Data(pObj, data) != ISM330DHCX_OK)
   {
@@ -2893,13 +2909,9 @@ int32_t ISM330DHCX_FIFO_GYRO_Get_Axis(ISM330DHCX_Object_t *pObj, ISM330DHCX_Axes
     return ISM330DHCX_ERROR;
   }
 
-  angular_velocity_float[0] = (float)data_raw[0] * sensitivity;
-  angular_velocity_float[1] = (float)data_raw[1] * sensitivity;
-  angular_velocity_float[2] = (float)data_raw[2] * sensitivity;
-
-  AngularVelocity->x = (int32_t)angular_velocity_float[0];
-  AngularVelocity->y = (int32_t)angular_velocity_float[1];
-  AngularVelocity->z = (int32_t)angular_velocity_float[2];
+  AngularVelocity->x = ISM330DHCX_Convert_Axis(data_raw[0], sensitivity);
+  AngularVelocity->y = ISM330DHCX_Convert_Axis(data_raw[1], sensitivity);
+  AngularVelocity->z = ISM330DHCX_Convert_Axis(data_raw[2], sensitivity);
 
   return ISM330DHCX_OK;
 }
@@ -3083,6 +3095,26 @@ int32_t ISM330DHCX_Set_Mem_Bank(ISM330DHCX_Object_t *pObj, uint8_t Val)
   return ret;
 }
 
+#if (USE_MEMS_REG_SHADOW == 1U)
+/**
+  * @brief  Enable or disable the register shadow, its content is discarded
+  * @note   The shadow is enabled by ISM330DHCX_RegisterBusIO. It is used once the
+  *         register bank and the address auto-increment are known, that is
+  *         after ISM330DHCX_Init.
+  * @param  pObj the device pObj
+  * @param  Enable 1 to serve the reads of the control registers from the shadow, 0 to read them on the bus
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t ISM330DHCX_Set_Reg_Shadow(ISM330DHCX_Object_t *pObj, uint8_t Enable)
+{
+  (void)memset(&(pObj->Shadow), 0, sizeof(MEMS_RegShadow_t));
+  pObj->Shadow.Bypass  = MEMS_REG_SHADOW_BANK | MEMS_REG_SHADOW_NO_INC;
+  pObj->Shadow.Enabled = (Enable != 0U) ? 1U : 0U;
+
+  return ISM330DHCX_OK;
+}
+#endif /* USE_MEMS_REG_SHADOW */
+
 /**
   * @}
   */
@@ -3245,8 +3277,27 @@ static int32_t ISM330DHCX_GetActualOutputDataRate(ISM330DHCX_Object_t *pObj, flo
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ISM330DHCX_Object_t *pObj = (ISM330DHCX_Object_t *)Handle;
+  int32_t ret;
+
+#if (USE_MEMS_REG_SHADOW == 1U)
+  if (Shadow_Read(&(pObj->Shadow), Reg, pData, Length) == 1U)
+  {
+    return ISM330DHCX_OK;
+  }
+#endif /* USE_MEMS_REG_SHADOW */
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+
+#if (USE_MEMS_REG_SHADOW == 1U)
+  if (ret == 0)
+  {
+    Shadow_Update(&(pObj->Shadow), Reg, pData, Length);
+  }
+#endif /* USE_MEMS_REG_SHADOW */
+
+  return ret;
 }
 
 /**
@@ -3260,9 +3311,273 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ISM330DHCX_Object_t *pObj = (ISM330DHCX_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+
+#if (USE_MEMS_REG_SHADOW == 1U)
+  if (ret == 0)
+  {
+    Shadow_Update(&(pObj->Shadow), Reg, pData, Length);
+  }
+  else
+  {
+    Shadow_Lost(&(pObj->Shadow), Reg, Length);
+  }
+#endif /* USE_MEMS_REG_SHADOW */
+
+  return ret;
+}
+
+/**
+  * @brief  Convert a raw axis value with the sensitivity
+  * @param  Raw the raw value
+  * @param  Sensitivity the sensitivity
+  * @retval the value truncated toward zero
+  * @note   With USE_MEMS_FIXED_POINT_AXES the product is computed with integers, the 24-bit
+  *         mantissa of the sensitivity as multiplier and its exponent as shift: the result is
+  *         the same as the float path when the float product is exact, and closer to zero by 1
+  *         at most when the float product has been rounded away from zero to the next integer.
+  *         A sensitivity not lower than 4096, or negative, is out of the integer range and
+  *         uses the float product.
+  */
+static int32_t ISM330DHCX_Convert_Axis(int16_t Raw, float_t Sensitivity)
+{
+#if (USE_MEMS_FIXED_POINT_AXES == 1U)
+  uint32_t bits;
+  uint32_t mant;
+  uint32_t shift;
+  uint32_t mag;
+  uint32_t val;
+  uint32_t exp;
+
+  (void)memcpy(&bits, &Sensitivity, sizeof(bits));
+  exp = (bits >> 23) & 0xFFU;
+
+  /* Sensitivity lower than 2^-20: |Raw * Sensitivity| < 1 */
+  if (exp < 107U)
+  {
+    return 0;
+  }
+
+  /* Sensitivity not lower than 4096 or negative: the shift below would wrap */
+  if ((exp > 138U) || ((bits & 0x80000000U) != 0U))
+  {
+    return (int32_t)((float_t)((float_t)Raw * Sensitivity));
+  }
+
+  /* Sensitivity = mant / 2^(shift + 12), 2^23 <= mant < 2^24 */
+  mant = (bits & 0x007FFFFFU) | 0x00800000U;
+  shift = 138U - exp;
+
+  mag = (Raw < 0) ? (uint32_t)(-(int32_t)Raw) : (uint32_t)Raw;
+
+  /* mag * mant split in two products within 32 bits */
+  val = ((mag * (mant >> 12)) + ((mag * (mant & 0xFFFU)) >> 12)) >> shift;
+
+  return (Raw < 0) ? -(int32_t)val : (int32_t)val;
+#else
+  return (int32_t)((float_t)((float_t)Raw * Sensitivity));
+#endif /* USE_MEMS_FIXED_POINT_AXES */
+}
+
+#if (USE_MEMS_REG_SHADOW == 1U)
+/**
+  * @brief  Read registers from the shadow
+  * @param  pShadow the register shadow
+  * @param  Reg the register address
+  * @param  pData the stored data pointer
+  * @param  Length the length
+  * @retval 1 if all the registers are in the shadow and have been copied, 0 otherwise
+  */
+static uint8_t Shadow_Read(MEMS_RegShadow_t *pShadow, uint8_t Reg, uint8_t *pData, uint16_t Length)
+{
+  uint32_t reg;
+  uint16_t i;
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  if ((pShadow->Enabled == 0U) || (Length == 0U)
+      || (((pShadow->Bypass & MEMS_REG_SHADOW_NO_INC) != 0U) && (Length > 1U)))
+  {
+    return 0U;
+  }
+
+  for (i = 0U; i < Length; i++)
+  {
+    reg = (uint32_t)Reg + i;
+
+    /* Only FUNC_CFG_ACCESS while another bank is selected */
+    if ((reg >= MEMS_REG_SHADOW_SIZE) || ((pShadow->Valid[reg >> 3] & (1U << (reg & 7U))) == 0U)
+        || ((pShadow->Bypass != 0U) && (reg != (uint32_t)ISM330DHCX_FUNC_CFG_ACCESS)))
+    {
+      return 0U;
+    }
+  }
+
+  (void)memcpy(pData, &(pShadow->Value[Reg]), Length);
+  pShadow->Hits++;
+
+  return 1U;
+}
+
+/**
+  * @brief  Update the shadow with registers read from or written to the device
+  * @param  pShadow the register shadow
+  * @param  Reg the register address
+  * @param  pData the register values
+  * @param  Length the length
+  * @retval None
+  */
+static void Shadow_Update(MEMS_RegShadow_t *pShadow, uint8_t Reg, const uint8_t *pData, uint16_t Length)
+{
+  uint32_t reg;
+  uint8_t val;
+  uint16_t i;
+
+  if (pShadow->Enabled == 0U)
+  {
+    return;
+  }
+
+  if (((pShadow->Bypass & MEMS_REG_SHADOW_NO_INC) != 0U) && (Length > 1U))
+  {
+    /* The registers accessed depend on the auto-increment */
+    Shadow_Lost(pShadow, Reg, Length);
+    return;
+  }
+
+  for (i = 0U; i < Length; i++)
+  {
+    reg = (uint32_t)Reg + i;
+    val = pData[i];
+
+    if (reg == (uint32_t)ISM330DHCX_FUNC_CFG_ACCESS)
+    {
+      /* Same address in all the banks */
+      if ((val & ISM330DHCX_SHADOW_BANK_MASK) != 0U)
+      {
+        pShadow->Bypass |= MEMS_REG_SHADOW_BANK;
+      }
+      else
+      {
+        pShadow->Bypass &= (uint8_t)~MEMS_REG_SHADOW_BANK;
+      }
+
+      Shadow_Store(pShadow, reg, val & ISM330DHCX_SHADOW_FUNC_CFG_MASK);
+    }
+    else if ((pShadow->Bypass & MEMS_REG_SHADOW_BANK) != 0U)
+    {
+      /* Register of another bank */
+    }
+    else if (reg == (uint32_t)ISM330DHCX_CTRL3_C)
+    {
+      Shadow_Ctrl3(pShadow, val);
+    }
+    else if (pShadow->Bypass == 0U)
+    {
+      Shadow_Store(pShadow, reg, val);
+    }
+    else
+    {
+      /* Shadow not used */
+    }
+  }
+}
+
+/**
+  * @brief  Invalidate the shadow after a failed write or an access to registers not known
+  * @param  pShadow the register shadow
+  * @param  Reg the register address
+  * @param  Length the length
+  * @retval None
+  */
+static void Shadow_Lost(MEMS_RegShadow_t *pShadow, uint8_t Reg, uint16_t Length)
+{
+  uint32_t last = (uint32_t)Reg + Length - 1U;
+
+  if (pShadow->Enabled == 0U)
+  {
+    return;
+  }
+
+  (void)memset(pShadow->Valid, 0, sizeof(pShadow->Valid));
+
+  if (((uint32_t)Reg <= (uint32_t)ISM330DHCX_FUNC_CFG_ACCESS) && (last >= (uint32_t)ISM330DHCX_FUNC_CFG_ACCESS))
+  {
+    pShadow->Bypass |= MEMS_REG_SHADOW_BANK;
+  }
+
+  if (((uint32_t)Reg <= (uint32_t)ISM330DHCX_CTRL3_C) && (last >= (uint32_t)ISM330DHCX_CTRL3_C))
+  {
+    pShadow->Bypass |= MEMS_REG_SHADOW_NO_INC;
+  }
+}
+
+/**
+  * @brief  Update the shadow with the CTRL3_C register value
+  * @param  pShadow the register shadow
+  * @param  Val the register value
+  * @retval None
+  */
+static void Shadow_Ctrl3(MEMS_RegShadow_t *pShadow, uint8_t Val)
+{
+  if ((Val & ISM330DHCX_SHADOW_SW_RESET) != 0U)
+  {
+    /* Software reset: the registers go back to their default value, with auto-increment */
+    (void)memset(pShadow->Valid, 0, sizeof(pShadow->Valid));
+    pShadow->Bypass &= (uint8_t)~MEMS_REG_SHADOW_NO_INC;
+  }
+  else if ((Val & ISM330DHCX_SHADOW_IF_INC) == 0U)
+  {
+    if ((pShadow->Bypass & MEMS_REG_SHADOW_NO_INC) == 0U)
+    {
+      (void)memset(pShadow->Valid, 0, sizeof(pShadow->Valid));
+      pShadow->Bypass |= MEMS_REG_SHADOW_NO_INC;
+    }
+  }
+  else
+  {
+    pShadow->Bypass &= (uint8_t)~MEMS_REG_SHADOW_NO_INC;
+
+    if ((Val & ISM330DHCX_SHADOW_BOOT) != 0U)
+    {
+      /* Reboot of the memory content */
+      (void)memset(pShadow->Valid, 0, sizeof(pShadow->Valid));
+    }
+    else if (pShadow->Bypass == 0U)
+    {
+      Shadow_Store(pShadow, (uint32_t)ISM330DHCX_CTRL3_C, Val);
+    }
+    else
+    {
+      /* Shadow not used */
+    }
+  }
+}
+
+/**
+  * @brief  Store a register value in the shadow if the register is kept in it
+  * @param  pShadow the register shadow
+  * @param  Reg the register address
+  * @param  Val the register value
+  * @retval None
+  */
+static void Shadow_Store(MEMS_RegShadow_t *pShadow, uint32_t Reg, uint8_t Val)
+{
+  if ((Reg < MEMS_REG_SHADOW_SIZE) && ((ISM330DHCX_Shadow_Map[Reg >> 3] & (1U << (Reg & 7U))) != 0U))
+  {
+    if (Reg == (uint32_t)ISM330DHCX_COUNTER_BDR_REG1)
+    {
+      /* rst_counter_bdr is cleared by the device */
+      Val &= (uint8_t)~ISM330DHCX_SHADOW_RST_COUNTER_BDR;
+    }
+
+    pShadow->Value[Reg] = Val;
+    pShadow->Valid[Reg >> 3] |= (uint8_t)(1U << (Reg & 7U));
+  }
 }
+#endif /* USE_MEMS_REG_SHADOW */
 
 /**
   * @}
@@ -28,6 +28,58 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "ism330dhcx_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
+
+#ifndef USE_MEMS_REG_SHADOW
+#define USE_MEMS_REG_SHADOW  0U
+#endif /* USE_MEMS_REG_SHADOW */
+
+#ifndef MEMS_REG_SHADOW_SHARED_TYPES
+#define MEMS_REG_SHADOW_SHARED_TYPES
+
+/** @defgroup    Register shadow
+  * @brief       Copy of the control registers of the main bank kept by the
+  *              register wrappers of the component when USE_MEMS_REG_SHADOW
+  *              is 1: a read of these registers, as the read of the
+  *              read-modify-write of a setter, is served from the copy
+  *              instead of the bus. The copy is updated on each write and
+  *              invalidated on reset. The option changes the component
+  *              object, so it has to be defined for the whole project.
+  * @{
+  *
+  */
+
+#define MEMS_REG_SHADOW_SIZE    0x80U /* Registers 0x00 to 0x7F */
+
+/* Bypass flags, the shadow is neither used nor filled while one is set */
+#define MEMS_REG_SHADOW_BANK    0x01U /* Bank other than the main one selected, or not known */
+#define MEMS_REG_SHADOW_NO_INC  0x02U /* Register address auto-increment disabled, or not known */
+
+typedef struct
+{
+  uint8_t  Enabled;
+  uint8_t  Bypass;                              /* MEMS_REG_SHADOW_xxx flags */
+  uint8_t  Valid[MEMS_REG_SHADOW_SIZE / 8U];    /* One bit per register */
+  uint8_t  Value[MEMS_REG_SHADOW_SIZE];
+  uint32_t Hits;                                /* Reads served from the shadow */
+} MEMS_RegShadow_t;
+
+/**
+  * @}
+  *
+  */
+
+#endif /* MEMS_REG_SHADOW_SHARED_TYPES */
+
+#ifndef USE_MEMS_FIXED_POINT_AXES
+/* Integer conversion of the axes with the sensitivity, by default on the Arm
+   targets without FPU, as the Cortex-M0+, where the float product is emulated */
+#if defined(__ARM_ARCH) && !defined(__ARM_FP) && !defined(__ARMVFP__)
+#define USE_MEMS_FIXED_POINT_AXES  1U
+#else
+#define USE_MEMS_FIXED_POINT_AXES  0U
+#endif /* __ARM_FP */
+#endif /* USE_MEMS_FIXED_POINT_AXES */
 
 /** @addtogroup BSP BSP
   * @{
@@ -114,6 +166,12 @@ typedef struct
   uint8_t                gyro_is_enabled;
   ism330dhcx_odr_xl_t    acc_odr;
   ism330dhcx_odr_g_t     gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
+#if (USE_MEMS_REG_SHADOW == 1U)
+  MEMS_RegShadow_t       Shadow;
+#endif /* USE_MEMS_REG_SHADOW */
 } ISM330DHCX_Object_t;
 
 typedef struct
@@ -332,6 +390,10 @@ int32_t ISM330DHCX_GYRO_GetActualOutputDataRate(ISM330DHCX_Object_t *pObj, float
 
 int32_t ISM330DHCX_Set_Mem_Bank(ISM330DHCX_Object_t *pObj, uint8_t Val);
 
+#if (USE_MEMS_REG_SHADOW == 1U)
+int32_t ISM330DHCX_Set_Reg_Shadow(ISM330DHCX_Object_t *pObj, uint8_t Enable);
+#endif /* USE_MEMS_REG_SHADOW */
+
 /**
   * @}
   */
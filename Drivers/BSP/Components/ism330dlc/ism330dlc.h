@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "ism330dlc_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -105,6 +106,9 @@ typedef struct
   uint8_t               gyro_is_enabled;
   ism330dlc_odr_xl_t    acc_odr;
   ism330dlc_odr_g_t     gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } ISM330DLC_Object_t;
 
 typedef struct
@@ -28,6 +28,17 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "ism330is_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
+
+#ifndef USE_MEMS_FIXED_POINT_AXES
+/* Integer conversion of the axes with the sensitivity, by default on the Arm
+   targets without FPU, as the Cortex-M0+, where the float product is emulated */
+#if defined(__ARM_ARCH) && !defined(__ARM_FP) && !defined(__ARMVFP__)
+#define USE_MEMS_FIXED_POINT_AXES  1U
+#else
+#define USE_MEMS_FIXED_POINT_AXES  0U
+#endif /* __ARM_FP */
+#endif /* USE_MEMS_FIXED_POINT_AXES */
 
 /** @addtogroup BSP BSP
   * @{
@@ -106,6 +117,9 @@ typedef struct
   uint8_t                 gyro_is_enabled;
   ism330is_xl_data_rate_t acc_odr;
   ism330is_gy_data_rate_t gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } ISM330IS_Object_t;
 
 typedef struct
@@ -79,6 +79,7 @@ ISM6HG256X_GYRO_Drv_t ISM6HG256X_GYRO_Driver =
 
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t ISM6HG256X_Convert_Axis(int16_t Raw, float_t Sensitivity);
 static int32_t ISM6HG256X_ACC_SetOutputDataRate_When_Enabled(ISM6HG256X_Object_t *pObj, float_t Odr);
 static int32_t ISM6HG256X_ACC_SetOutputDataRate_When_Disabled(ISM6HG256X_Object_t *pObj, float_t Odr);
 static int32_t ISM6HG256X_ACC_HG_SetOutputDataRate_When_Enabled(ISM6HG256X_Object_t *pObj, float_t Odr);
@@ -732,9 +733,9 @@ int32_t ISM6HG256X_ACC_GetAxes(ISM6HG256X_Object_t *pObj, ISM6HG256X_Axes_t *Acc
   }
 
   /* Calculate the data. */
-  Acceleration->x = (int32_t)((float_t)((float_t)data_raw.i16bit[0] * sensitivity));
-  Acceleration->y = (int32_t)((float_t)((float_t)data_raw.i16bit[1] * sensitivity));
-  Acceleration->z = (int32_t)((float_t)((float_t)data_raw.i16bit[2] * sensitivity));
+  Acceleration->x = ISM6HG256X_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  Acceleration->y = ISM6HG256X_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  Acceleration->z = ISM6HG256X_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return ISM6HG256X_OK;
 }
@@ -2946,9 +2947,9 @@ int32_t ISM6HG256X_ACC_HG_GetAxes(ISM6HG256X_Object_t *pObj, ISM6HG256X_Axes_t *
   }
 
   /* Calculate the data. */
-  Acceleration->x = (int32_t)((float_t)((float_t)data_raw.i16bit[0] * sensitivity));
-  Acceleration->y = (int32_t)((float_t)((float_t)data_raw.i16bit[1] * sensitivity));
-  Acceleration->z = (int32_t)((float_t)((float_t)data_raw.i16bit[2] * sensitivity));
+  Acceleration->x = ISM6HG256X_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  Acceleration->y = ISM6HG256X_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  Acceleration->z = ISM6HG256X_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return ISM6HG256X_OK;
 }
@@ -3171,7 +3172,6 @@ int32_t ISM6HG256X_FIFO_ACC_Get_Axes(ISM6HG256X_Object_t *pObj, ISM6HG256X_Axes_
 {
   ism6hg256x_axis3bit16_t data_raw;
   float_t sensitivity = 0.0f;
-  float_t acceleration_float_t[3];
 
   if (ISM6HG256X_FIFO_Get_Data(pObj, data_raw.u8bit) != ISM6HG256X_OK)
   {
@@ -3182,13 +3182,9 @@ int32_t ISM6HG256X_FIFO_ACC_Get_Axes(ISM6HG256X_Object_t *pObj, ISM6HG256X_Axes_
   {
     return ISM6HG256X_ERROR;
   }
-  acceleration_float_t[0] = (float_t)data_raw.i16bit[0] * sensitivity;
-  acceleration_float_t[1] = (float_t)data_raw.i16bit[1] * sensitivity;
-  acceleration_float_t[2] = (float_t)data_raw.i16bit[2] * sensitivity;
-
-  Acceleration->x = (int32_t)acceleration_float_t[0];
-  Acceleration->y = (int32_t)acceleration_float_t[1];
-  Acceleration->z = (int32_t)acceleration_float_t[2];
+  Acceleration->x = ISM6HG256X_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  Acceleration->y = ISM6HG256X_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  Acceleration->z = ISM6HG256X_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return ISM6HG256X_OK;
 
@@ -3236,7 +3232,6 @@ int32_t ISM6HG256X_FIFO_GYRO_Get_Axes(ISM6HG256X_Object_t *pObj, ISM6HG256X_Axes
 {
   ism6hg256x_axis3bit16_t data_raw;
   float_t sensitivity = 0.0f;
-  float_t angular_velocity_float_t[3];
 
   if (ISM6HG256X_FIFO_Get_Data(pObj, data_raw.u8bit) != ISM6HG256X_OK)
   {
@@ -3248,13 +3243,9 @@ int32_t ISM6HG256X_FIFO_GYRO_Get_Axes(ISM6HG256X_Object_t *pObj, ISM6HG256X_Axes
     return ISM6HG256X_ERROR;
   }
 
-  angular_velocity_float_t[0] = (float_t)data_raw.i16bit[0] * sensitivity;
-  angular_velocity_float_t[1] = (float_t)data_raw.i16bit[1] * sensitivity;
-  angular_velocity_float_t[2] = (float_t)data_raw.i16bit[2] * sensitivity;
-
-  AngularVelocity->x = (int32_t)angular_velocity_float_t[0];
-  AngularVelocity->y = (int32_t)angular_velocity_float_t[1];
-  AngularVelocity->z = (int32_t)angular_velocity_float_t[2];
+  AngularVelocity->x = ISM6HG256X_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  AngularVelocity->y = ISM6HG256X_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  AngularVelocity->z = ISM6HG256X_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return ISM6HG256X_OK;
 }
@@ -3678,9 +3669,9 @@ int32_t ISM6HG256X_GYRO_GetAxes(ISM6HG256X_Object_t *pObj, ISM6HG256X_Axes_t *An
   }
 
   /* Calculate the data. */
-  AngularRate->x = (int32_t)((float_t)((float_t)data_raw.i16bit[0] * sensitivity));
-  AngularRate->y = (int32_t)((float_t)((float_t)data_raw.i16bit[1] * sensitivity));
-  AngularRate->z = (int32_t)((float_t)((float_t)data_raw.i16bit[2] * sensitivity));
+  AngularRate->x = ISM6HG256X_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  AngularRate->y = ISM6HG256X_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  AngularRate->z = ISM6HG256X_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return ISM6HG256X_OK;
 }
@@ -3971,8 +3962,13 @@ static int32_t ISM6HG256X_GYRO_SetOutputDataRate_When_Disabled(ISM6HG256X_Object
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ISM6HG256X_Object_t *pObj = (ISM6HG256X_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  return ret;
 }
 
 /**
@@ -3986,8 +3982,65 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ISM6HG256X_Object_t *pObj = (ISM6HG256X_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+
+  return ret;
+}
+
+/**
+  * @brief  Convert a raw axis value with the sensitivity
+  * @param  Raw the raw value
+  * @param  Sensitivity the sensitivity
+  * @retval the value truncated toward zero
+  * @note   With USE_MEMS_FIXED_POINT_AXES the product is computed with integers, the 24-bit
+  *         mantissa of the sensitivity as multiplier and its exponent as shift: the result is
+  *         the same as the float path when the float product is exact, and closer to zero by 1
+  *         at most when the float product has been rounded away from zero to the next integer.
+  *         A sensitivity not lower than 4096, or negative, is out of the integer range and
+  *         uses the float product.
+  */
+static int32_t ISM6HG256X_Convert_Axis(int16_t Raw, float_t Sensitivity)
+{
+#if (USE_MEMS_FIXED_POINT_AXES == 1U)
+  uint32_t bits;
+  uint32_t mant;
+  uint32_t shift;
+  uint32_t mag;
+  uint32_t val;
+  uint32_t exp;
+
+  (void)memcpy(&bits, &Sensitivity, sizeof(bits));
+  exp = (bits >> 23) & 0xFFU;
+
+  /* Sensitivity lower than 2^-20: |Raw * Sensitivity| < 1 */
+  if (exp < 107U)
+  {
+    return 0;
+  }
+
+  /* Sensitivity not lower than 4096 or negative: the shift below would wrap */
+  if ((exp > 138U) || ((bits & 0x80000000U) != 0U))
+  {
+    return (int32_t)((float_t)((float_t)Raw * Sensitivity));
+  }
+
+  /* Sensitivity = mant / 2^(shift + 12), 2^23 <= mant < 2^24 */
+  mant = (bits & 0x007FFFFFU) | 0x00800000U;
+  shift = 138U - exp;
+
+  mag = (Raw < 0) ? (uint32_t)(-(int32_t)Raw) : (uint32_t)Raw;
+
+  /* mag * mant split in two products within 32 bits */
+  val = ((mag * (mant >> 12)) + ((mag * (mant & 0xFFFU)) >> 12)) >> shift;
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  return (Raw < 0) ? -(int32_t)val : (int32_t)val;
+#else
+  return (int32_t)((float_t)((float_t)Raw * Sensitivity));
+#endif /* USE_MEMS_FIXED_POINT_AXES */
 }
 
 /**
@@ -905,16 +905,23 @@ static int32_t LIS2DH12_SetOutputDataRate_When_Disabled(LIS2DH12_Object_t *pObj,
 static int32_t ReadAccRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   LIS2DH12_Object_t *pObj = (LIS2DH12_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == LIS2DH12_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
   else   /* SPI 3-Wires */
   {
     /* Enable Multi-byte read */
-    return pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -929,16 +936,23 @@ static int32_t ReadAccRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_
 static int32_t WriteAccRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   LIS2DH12_Object_t *pObj = (LIS2DH12_Object_t *)Handle;
+  int32_t ret;
 
   if (pObj->IO.BusType == LIS2DH12_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x80U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
   else   /* SPI 3-Wires */
   {
     /* Enable Multi-byte write */
-    return pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg | 0x40U), pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
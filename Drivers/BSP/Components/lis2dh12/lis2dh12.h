@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lis2dh12_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -86,6 +87,9 @@ typedef struct
   uint8_t               is_initialized;
   uint8_t               acc_is_enabled;
   lis2dh12_odr_t        acc_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LIS2DH12_Object_t;
 
 typedef struct
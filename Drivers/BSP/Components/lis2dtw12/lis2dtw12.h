@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lis2dtw12_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -123,6 +124,9 @@ typedef struct
   LIS2DTW12_Operating_Mode_t acc_operating_mode;
   LIS2DTW12_Low_Noise_t      acc_low_noise;
   float                      temp_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LIS2DTW12_Object_t;
 
 typedef struct
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lis2dux12_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -113,6 +114,11 @@ typedef struct
   uint8_t                acc_is_enabled;
   float                  acc_odr;
   LIS2DUX12_Power_Mode_t power_mode;
+  uint8_t                boot_pending; /* Exit from deep power down started, boot time not elapsed */
+  uint32_t               boot_tick;    /* IO.GetTick() at the exit from deep power down */
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LIS2DUX12_Object_t;
 
 typedef struct
@@ -190,6 +196,8 @@ typedef union
 #define LIS2DUX12_SPI_3WIRES_BUS          2U
 #define LIS2DUX12_I3C_BUS                 3U
 
+#define LIS2DUX12_BOOT_TIME              25U  /**< Boot time after the exit from deep power down [ms] */
+
 #define LIS2DUX12_ACC_SENSITIVITY_FOR_FS_2G   0.061f  /**< Sensitivity value for 2g full scale, Low-power1 mode [mg/LSB] */
 #define LIS2DUX12_ACC_SENSITIVITY_FOR_FS_4G   0.122f  /**< Sensitivity value for 4g full scale, Low-power1 mode [mg/LSB] */
 #define LIS2DUX12_ACC_SENSITIVITY_FOR_FS_8G   0.244f  /**< Sensitivity value for 8g full scale, Low-power1 mode [mg/LSB] */
@@ -204,6 +212,8 @@ typedef union
   */
 
 int32_t LIS2DUX12_RegisterBusIO(LIS2DUX12_Object_t *pObj, LIS2DUX12_IO_t *pIO);
+int32_t LIS2DUX12_RegisterBusIO_Start(LIS2DUX12_Object_t *pObj, LIS2DUX12_IO_t *pIO);
+int32_t LIS2DUX12_Boot_Poll(LIS2DUX12_Object_t *pObj, uint8_t *Done);
 int32_t LIS2DUX12_Init(LIS2DUX12_Object_t *pObj);
 int32_t LIS2DUX12_DeInit(LIS2DUX12_Object_t *pObj);
 int32_t LIS2DUX12_ExitDeepPowerDownI2C(LIS2DUX12_Object_t *pObj);
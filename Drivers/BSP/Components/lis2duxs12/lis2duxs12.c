@@ -66,6 +66,8 @@ LIS2DUXS12_ACC_Drv_t LIS2DUXS12_ACC_Driver =
 
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t LIS2DUXS12_Boot_Start(LIS2DUXS12_Object_t *pObj);
+static int32_t LIS2DUXS12_Boot_End(LIS2DUXS12_Object_t *pObj);
 static int32_t LIS2DUXS12_ACC_SetOutputDataRate_When_Enabled(LIS2DUXS12_Object_t *pObj, float_t Odr,
     LIS2DUXS12_Power_Mode_t Power);
 static int32_t LIS2DUXS12_ACC_SetOutputDataRate_When_Disabled(LIS2DUXS12_Object_t *pObj, float_t Odr,
@@ -82,9 +84,34 @@ static int32_t LIS2DUXS12_ACC_SetOutputDataRate_When_Disabled(LIS2DUXS12_Object_
 /**
   * @brief  Register Component Bus IO operations
   * @param  pObj the device pObj
+  * @param  pIO the bus IO operations
   * @retval 0 in case of success, an error code otherwise
   */
 int32_t LIS2DUXS12_RegisterBusIO(LIS2DUXS12_Object_t *pObj, LIS2DUXS12_IO_t *pIO)
+{
+  int32_t ret = LIS2DUXS12_RegisterBusIO_Start(pObj, pIO);
+
+  if ((ret == LIS2DUXS12_OK) && (pObj->boot_pending == 1U))
+  {
+    /* Wait for 25 ms based on datasheet */
+    pObj->Ctx.mdelay(LIS2DUXS12_BOOT_TIME);
+
+    ret = LIS2DUXS12_Boot_End(pObj);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Register Component Bus IO operations and start the exit from deep power down,
+  *         without waiting for the boot time
+  * @param  pObj the device pObj
+  * @param  pIO the bus IO operations
+  * @retval 0 in case of success, an error code otherwise
+  * @note   The component must not be accessed until LIS2DUXS12_Boot_Poll reports the end
+  *         of the boot, the other devices can be initialized meanwhile
+  */
+int32_t LIS2DUXS12_RegisterBusIO_Start(LIS2DUXS12_Object_t *pObj, LIS2DUXS12_IO_t *pIO)
 {
   int32_t ret = LIS2DUXS12_OK;
 
@@ -119,45 +146,13 @@ int32_t LIS2DUXS12_RegisterBusIO(LIS2DUXS12_Object_t *pObj, LIS2DUXS12_IO_t *pIO
     }
     else
     {
-      if (pObj->IO.BusType == LIS2DUXS12_SPI_3WIRES_BUS) /* SPI 3-Wires */
-      {
-        /* Enable the SPI 3-Wires support only the first time */
-        if (pObj->is_initialized == 0U)
-        {
-          /* Exit from deep power down only the first time in SPI mode */
-          if (LIS2DUXS12_ExitDeepPowerDownSPI(pObj) != LIS2DUXS12_OK)
-          {
-            ret = LIS2DUXS12_ERROR;
-          }
-          /* Enable SPI 3-Wires on the component */
-          uint8_t data = 0x50;
-
-          if (LIS2DUXS12_Write_Reg(pObj, LIS2DUXS12_CTRL1, data) != LIS2DUXS12_OK)
-          {
-            ret = LIS2DUXS12_ERROR;
-          }
-        }
-      }
-      else if (pObj->IO.BusType == LIS2DUXS12_SPI_4WIRES_BUS)
-      {
-        /* Exit from deep power down only the first time in SPI mode */
-        if (pObj->is_initialized == 0U)
-        {
-          if (LIS2DUXS12_ExitDeepPowerDownSPI(pObj) != LIS2DUXS12_OK)
-          {
-            ret = LIS2DUXS12_ERROR;
-          }
-        }
-      }
-      else if (pObj->IO.BusType == LIS2DUXS12_I2C_BUS)
+      if ((pObj->IO.BusType == LIS2DUXS12_I2C_BUS) || (pObj->IO.BusType == LIS2DUXS12_SPI_4WIRES_BUS) ||
+          (pObj->IO.BusType == LIS2DUXS12_SPI_3WIRES_BUS))
       {
-        /* Exit from deep power down only the first time in I2C mode */
+        /* Exit from deep power down only the first time, SPI 3-Wires is enabled at the end of the boot */
         if (pObj->is_initialized == 0U)
         {
-          if (LIS2DUXS12_ExitDeepPowerDownI2C(pObj) != LIS2DUXS12_OK)
-          {
-            ret = LIS2DUXS12_ERROR;
-          }
+          ret = LIS2DUXS12_Boot_Start(pObj);
         }
       }
       else
@@ -170,6 +165,41 @@ int32_t LIS2DUXS12_RegisterBusIO(LIS2DUXS12_Object_t *pObj, LIS2DUXS12_IO_t *pIO
   return ret;
 }
 
+/**
+  * @brief  Check the end of the boot started by LIS2DUXS12_RegisterBusIO_Start
+  * @param  pObj the device pObj
+  * @param  Done 1 when the component can be accessed, 0 during the boot time
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t LIS2DUXS12_Boot_Poll(LIS2DUXS12_Object_t *pObj, uint8_t *Done)
+{
+  int32_t ret = LIS2DUXS12_OK;
+
+  *Done = 1U;
+
+  if (pObj->boot_pending == 1U)
+  {
+    if (pObj->IO.GetTick == NULL)
+    {
+      /* No time base, wait for the whole boot time */
+      pObj->Ctx.mdelay(LIS2DUXS12_BOOT_TIME);
+
+      ret = LIS2DUXS12_Boot_End(pObj);
+    }
+    /* The tick of the start may have been almost over, one more is needed */
+    else if (((uint32_t)pObj->IO.GetTick() - pObj->boot_tick) > LIS2DUXS12_BOOT_TIME)
+    {
+      ret = LIS2DUXS12_Boot_End(pObj);
+    }
+    else
+    {
+      *Done = 0U;
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Initialize the LIS2DUXS12 sensor
   * @param  pObj the device pObj
@@ -1657,6 +1687,61 @@ int32_t LIS2DUXS12_ACC_Get_6D_Orientation_ZH(LIS2DUXS12_Object_t *pObj, uint8_t
   return LIS2DUXS12_OK;
 }
 
+/**
+  * @brief  Exit from deep power down, the boot time starts
+  * @param  pObj the device pObj
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t LIS2DUXS12_Boot_Start(LIS2DUXS12_Object_t *pObj)
+{
+  lis2duxs12_en_device_config_t en_device_config = {0};
+  uint8_t val;
+
+  if (pObj->IO.BusType == LIS2DUXS12_I2C_BUS)
+  {
+    /* Perform dummy read in order to exit from deep power down in I2C mode.
+     * NOTE: No return value check - expected first read fail. */
+    (void)lis2duxs12_device_id_get(&(pObj->Ctx), &val);
+  }
+  else
+  {
+    /* Write IF_WAKE_UP register to exit from deep power down in SPI mode,
+     * lis2duxs12_exit_deep_power_down would wait for the boot time */
+    en_device_config.soft_pd = PROPERTY_ENABLE;
+    (void)lis2duxs12_write_reg(&(pObj->Ctx), LIS2DUXS12_EN_DEVICE_CONFIG, (uint8_t *)&en_device_config, 1);
+  }
+
+  pObj->boot_tick = (pObj->IO.GetTick != NULL) ? (uint32_t)pObj->IO.GetTick() : 0U;
+  pObj->boot_pending = 1U;
+
+  return LIS2DUXS12_OK;
+}
+
+/**
+  * @brief  End of the boot time, the component can be accessed
+  * @param  pObj the device pObj
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t LIS2DUXS12_Boot_End(LIS2DUXS12_Object_t *pObj)
+{
+  int32_t ret = LIS2DUXS12_OK;
+
+  pObj->boot_pending = 0U;
+
+  if (pObj->IO.BusType == LIS2DUXS12_SPI_3WIRES_BUS)
+  {
+    /* Enable SPI 3-Wires on the component */
+    uint8_t data = 0x50;
+
+    if (LIS2DUXS12_Write_Reg(pObj, LIS2DUXS12_CTRL1, data) != LIS2DUXS12_OK)
+    {
+      ret = LIS2DUXS12_ERROR;
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Wrap Read register component function to Bus IO function
   * @param  Handle the device handler
@@ -1668,8 +1753,13 @@ int32_t LIS2DUXS12_ACC_Get_6D_Orientation_ZH(LIS2DUXS12_Object_t *pObj, uint8_t
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   LIS2DUXS12_Object_t *pObj = (LIS2DUXS12_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  return ret;
 }
 
 /**
@@ -1683,8 +1773,13 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   LIS2DUXS12_Object_t *pObj = (LIS2DUXS12_Object_t *)Handle;
+  int32_t ret;
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+
+  return ret;
 }
 
 /**
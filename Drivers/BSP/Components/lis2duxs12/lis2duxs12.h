@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lis2duxs12_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -113,6 +114,11 @@ typedef struct
   uint8_t                 acc_is_enabled;
   float                   acc_odr;
   LIS2DUXS12_Power_Mode_t power_mode;
+  uint8_t                 boot_pending; /* Exit from deep power down started, boot time not elapsed */
+  uint32_t                boot_tick;    /* IO.GetTick() at the exit from deep power down */
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LIS2DUXS12_Object_t;
 
 typedef struct
@@ -190,6 +196,8 @@ typedef union
 #define LIS2DUXS12_SPI_3WIRES_BUS          2U
 #define LIS2DUXS12_I3C_BUS                 3U
 
+#define LIS2DUXS12_BOOT_TIME              25U  /**< Boot time after the exit from deep power down [ms] */
+
 #define LIS2DUXS12_ACC_SENSITIVITY_FOR_FS_2G   0.061f  /**< Sensitivity value for 2g full scale, Low-power1 mode [mg/LSB] */
 #define LIS2DUXS12_ACC_SENSITIVITY_FOR_FS_4G   0.122f  /**< Sensitivity value for 4g full scale, Low-power1 mode [mg/LSB] */
 #define LIS2DUXS12_ACC_SENSITIVITY_FOR_FS_8G   0.244f  /**< Sensitivity value for 8g full scale, Low-power1 mode [mg/LSB] */
@@ -211,6 +219,8 @@ typedef union
   */
 
 int32_t LIS2DUXS12_RegisterBusIO(LIS2DUXS12_Object_t *pObj, LIS2DUXS12_IO_t *pIO);
+int32_t LIS2DUXS12_RegisterBusIO_Start(LIS2DUXS12_Object_t *pObj, LIS2DUXS12_IO_t *pIO);
+int32_t LIS2DUXS12_Boot_Poll(LIS2DUXS12_Object_t *pObj, uint8_t *Done);
 int32_t LIS2DUXS12_Init(LIS2DUXS12_Object_t *pObj);
 int32_t LIS2DUXS12_DeInit(LIS2DUXS12_Object_t *pObj);
 int32_t LIS2DUXS12_ExitDeepPowerDownI2C(LIS2DUXS12_Object_t *pObj);
@@ -29,6 +29,8 @@ extern "C"
 #include "lis3mdl_reg.h"
 #include <stddef.h>
 #include <string.h>
+#include "mems_bus_stats.h"
+
 /** @addtogroup BSP
   * @{
   */
@@ -84,6 +86,9 @@ typedef struct
   stmdev_ctx_t        Ctx;
   uint8_t             is_initialized;
   uint8_t             mag_is_enabled;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LIS3MDL_Object_t;
 
 typedef struct
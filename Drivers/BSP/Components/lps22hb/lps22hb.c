@@ -1004,7 +1004,9 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
   {
     for (i = 0; i < Length; i++)
     {
+      MEMS_BUS_STATS_START(pObj->BusStats);
       ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg + i), &pData[i], 1);
+      MEMS_BUS_STATS_READ(pObj->BusStats, 1U, ret);
       if (ret != LPS22HB_OK)
       {
         return LPS22HB_ERROR;
@@ -1015,7 +1017,10 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
   }
   else /* SPI 4-Wires or SPI 3-Wires */
   {
-    return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
@@ -1037,7 +1042,9 @@ static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t
   {
     for (i = 0; i < Length; i++)
     {
+      MEMS_BUS_STATS_START(pObj->BusStats);
       ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg + i), &pData[i], 1);
+      MEMS_BUS_STATS_WRITE(pObj->BusStats, 1U, ret);
       if (ret != LPS22HB_OK)
       {
         return LPS22HB_ERROR;
@@ -1048,7 +1055,10 @@ static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t
   }
   else /* SPI 4-Wires or SPI 3-Wires */
   {
-    return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
 }
 
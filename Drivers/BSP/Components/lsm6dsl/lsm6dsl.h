@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lsm6dsl_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -106,6 +107,9 @@ typedef struct
   uint8_t             gyro_is_enabled;
   lsm6dsl_odr_xl_t    acc_odr;
   lsm6dsl_odr_g_t     gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LSM6DSL_Object_t;
 
 typedef struct
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lsm6dso32_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -119,6 +120,9 @@ typedef struct
   uint8_t             gyro_is_enabled;
   lsm6dso32_odr_xl_t  acc_odr;
   lsm6dso32_odr_g_t   gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LSM6DSO32_Object_t;
 
 typedef struct
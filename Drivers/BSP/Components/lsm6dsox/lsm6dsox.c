@@ -84,6 +84,8 @@ static int32_t LSM6DSOX_ACC_SetOutputDataRate_When_Disabled(LSM6DSOX_Object_t *p
 static int32_t LSM6DSOX_GYRO_SetOutputDataRate_When_Enabled(LSM6DSOX_Object_t *pObj, float Odr);
 static int32_t LSM6DSOX_GYRO_SetOutputDataRate_When_Disabled(LSM6DSOX_Object_t *pObj, float Odr);
 static void LSM6DSOX_Delay(LSM6DSOX_Object_t *pObj, uint32_t msDelay);
+static int32_t LSM6DSOX_Pin_Int1_Route_Set(LSM6DSOX_Object_t *pObj, lsm6dsox_pin_int1_route_t Val);
+static int32_t LSM6DSOX_Pin_Int2_Route_Set(LSM6DSOX_Object_t *pObj, lsm6dsox_pin_int2_route_t Val);
 
 /**
   * @}
@@ -222,6 +224,27 @@ int32_t LSM6DSOX_Init(LSM6DSOX_Object_t *pObj)
     return LSM6DSOX_ERROR;
   }
 
+  /* Keep the routing of the embedded functions interrupts, checked by the event status */
+  if (lsm6dsox_mem_bank_set(&(pObj->Ctx), LSM6DSOX_EMBEDDED_FUNC_BANK) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_EMB_FUNC_INT1, (uint8_t *)&(pObj->emb_func_int1), 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_EMB_FUNC_INT2, (uint8_t *)&(pObj->emb_func_int2), 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_mem_bank_set(&(pObj->Ctx), LSM6DSOX_USER_BANK) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
   pObj->is_initialized = 1;
 
   return LSM6DSOX_OK;
@@ -1295,7 +1318,7 @@ int32_t LSM6DSOX_ACC_Enable_Free_Fall_Detection(LSM6DSOX_Object_t *pObj, LSM6DSO
 
       val1.free_fall = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -1309,7 +1332,7 @@ int32_t LSM6DSOX_ACC_Enable_Free_Fall_Detection(LSM6DSOX_Object_t *pObj, LSM6DSO
 
       val2.free_fall = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -1341,7 +1364,7 @@ int32_t LSM6DSOX_ACC_Disable_Free_Fall_Detection(LSM6DSOX_Object_t *pObj)
 
   val1.free_fall = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -1353,7 +1376,7 @@ int32_t LSM6DSOX_ACC_Disable_Free_Fall_Detection(LSM6DSOX_Object_t *pObj)
 
   val2.free_fall = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -1464,7 +1487,7 @@ int32_t LSM6DSOX_ACC_Enable_Pedometer(LSM6DSOX_Object_t *pObj)
 
   val.step_detector = PROPERTY_ENABLE;
 
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -1490,7 +1513,7 @@ int32_t LSM6DSOX_ACC_Disable_Pedometer(LSM6DSOX_Object_t *pObj)
 
   val1.step_detector = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -1603,7 +1626,7 @@ int32_t LSM6DSOX_ACC_Enable_Tilt_Detection(LSM6DSOX_Object_t *pObj, LSM6DSOX_Sen
 
       val1.tilt = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -1617,7 +1640,7 @@ int32_t LSM6DSOX_ACC_Enable_Tilt_Detection(LSM6DSOX_Object_t *pObj, LSM6DSOX_Sen
 
       val2.tilt = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -1650,7 +1673,7 @@ int32_t LSM6DSOX_ACC_Disable_Tilt_Detection(LSM6DSOX_Object_t *pObj)
 
   val1.tilt = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -1662,7 +1685,7 @@ int32_t LSM6DSOX_ACC_Disable_Tilt_Detection(LSM6DSOX_Object_t *pObj)
 
   val2.tilt = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -1731,7 +1754,7 @@ int32_t LSM6DSOX_ACC_Enable_Wake_Up_Detection(LSM6DSOX_Object_t *pObj, LSM6DSOX_
 
       val1.wake_up = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -1745,7 +1768,7 @@ int32_t LSM6DSOX_ACC_Enable_Wake_Up_Detection(LSM6DSOX_Object_t *pObj, LSM6DSOX_
 
       val2.wake_up = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -1777,7 +1800,7 @@ int32_t LSM6DSOX_ACC_Disable_Wake_Up_Detection(LSM6DSOX_Object_t *pObj)
 
   val1.wake_up = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -1789,7 +1812,7 @@ int32_t LSM6DSOX_ACC_Disable_Wake_Up_Detection(LSM6DSOX_Object_t *pObj)
 
   val2.wake_up = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -1918,7 +1941,7 @@ int32_t LSM6DSOX_ACC_Enable_Single_Tap_Detection(LSM6DSOX_Object_t *pObj, LSM6DS
 
       val1.single_tap = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -1932,7 +1955,7 @@ int32_t LSM6DSOX_ACC_Enable_Single_Tap_Detection(LSM6DSOX_Object_t *pObj, LSM6DS
 
       val2.single_tap = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -1964,7 +1987,7 @@ int32_t LSM6DSOX_ACC_Disable_Single_Tap_Detection(LSM6DSOX_Object_t *pObj)
 
   val1.single_tap = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -1976,7 +1999,7 @@ int32_t LSM6DSOX_ACC_Disable_Single_Tap_Detection(LSM6DSOX_Object_t *pObj)
 
   val2.single_tap = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -2103,7 +2126,7 @@ int32_t LSM6DSOX_ACC_Enable_Double_Tap_Detection(LSM6DSOX_Object_t *pObj, LSM6DS
 
       val1.double_tap = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -2117,7 +2140,7 @@ int32_t LSM6DSOX_ACC_Enable_Double_Tap_Detection(LSM6DSOX_Object_t *pObj, LSM6DS
 
       val2.double_tap = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -2149,7 +2172,7 @@ int32_t LSM6DSOX_ACC_Disable_Double_Tap_Detection(LSM6DSOX_Object_t *pObj)
 
   val1.double_tap = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -2161,7 +2184,7 @@ int32_t LSM6DSOX_ACC_Disable_Double_Tap_Detection(LSM6DSOX_Object_t *pObj)
 
   val2.double_tap = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -2326,7 +2349,7 @@ int32_t LSM6DSOX_ACC_Enable_6D_Orientation(LSM6DSOX_Object_t *pObj, LSM6DSOX_Sen
 
       val1.six_d = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -2340,7 +2363,7 @@ int32_t LSM6DSOX_ACC_Enable_6D_Orientation(LSM6DSOX_Object_t *pObj, LSM6DSOX_Sen
 
       val2.six_d = PROPERTY_ENABLE;
 
-      if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -2372,7 +2395,7 @@ int32_t LSM6DSOX_ACC_Disable_6D_Orientation(LSM6DSOX_Object_t *pObj)
 
   val1.six_d = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -2384,7 +2407,7 @@ int32_t LSM6DSOX_ACC_Disable_6D_Orientation(LSM6DSOX_Object_t *pObj)
 
   val2.six_d = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -2552,78 +2575,60 @@ int32_t LSM6DSOX_ACC_Get_DRDY_Status(LSM6DSOX_Object_t *pObj, uint8_t *Status)
 
 /**
   * @brief  Get the status of all hardware events
+  * @note   The source registers and MD1_CFG, MD2_CFG are read in two bursts and the routing of
+  *         the embedded functions interrupts is taken from the object: EMB_FUNC_STATUS_MAINPAGE,
+  *         the third transaction, is read only with the step detector or tilt routed
   * @param  pObj the device pObj
   * @param  Status the status of all hardware events
   * @retval 0 in case of success, an error code otherwise
   */
 int32_t LSM6DSOX_ACC_Get_Event_Status(LSM6DSOX_Object_t *pObj, LSM6DSOX_Event_Status_t *Status)
 {
-  uint8_t tilt_ia;
+  lsm6dsox_emb_func_status_mainpage_t emb_func_status;
   lsm6dsox_wake_up_src_t wake_up_src;
   lsm6dsox_tap_src_t tap_src;
   lsm6dsox_d6d_src_t d6d_src;
-  lsm6dsox_emb_func_src_t func_src;
   lsm6dsox_md1_cfg_t md1_cfg;
   lsm6dsox_md2_cfg_t md2_cfg;
-  lsm6dsox_emb_func_int1_t int1_ctrl;
-  lsm6dsox_emb_func_int2_t int2_ctrl;
+  uint8_t src[3];
+  uint8_t cfg[2];
+  uint8_t step_route;
+  uint8_t tilt_route;
 
   (void)memset((void *)Status, 0x0, sizeof(LSM6DSOX_Event_Status_t));
 
-  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_WAKE_UP_SRC, (uint8_t *)&wake_up_src, 1) != LSM6DSOX_OK)
-  {
-    return LSM6DSOX_ERROR;
-  }
-
-  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_TAP_SRC, (uint8_t *)&tap_src, 1) != LSM6DSOX_OK)
+  /* WAKE_UP_SRC, TAP_SRC, D6D_SRC */
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_WAKE_UP_SRC, src, 3) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
 
-  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_D6D_SRC, (uint8_t *)&d6d_src, 1) != LSM6DSOX_OK)
+  /* MD1_CFG, MD2_CFG */
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_MD1_CFG, cfg, 2) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
 
-  if (lsm6dsox_mem_bank_set(&(pObj->Ctx), LSM6DSOX_EMBEDDED_FUNC_BANK) != LSM6DSOX_OK)
-  {
-    return LSM6DSOX_ERROR;
-  }
-
-  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_EMB_FUNC_SRC, (uint8_t *)&func_src, 1) != LSM6DSOX_OK)
-  {
-    return LSM6DSOX_ERROR;
-  }
-
-  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_EMB_FUNC_INT1, (uint8_t *)&int1_ctrl, 1) != LSM6DSOX_OK)
-  {
-    return LSM6DSOX_ERROR;
-  }
-
-  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_EMB_FUNC_INT2, (uint8_t *)&int2_ctrl, 1) != LSM6DSOX_OK)
-  {
-    return LSM6DSOX_ERROR;
-  }
-
-  if (lsm6dsox_mem_bank_set(&(pObj->Ctx), LSM6DSOX_USER_BANK) != 0)
-  {
-    return LSM6DSOX_ERROR;
-  }
+  step_route = pObj->emb_func_int1.int1_step_detector;
+  tilt_route = (uint8_t)(pObj->emb_func_int1.int1_tilt | pObj->emb_func_int2.int2_tilt);
 
-  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_MD1_CFG, (uint8_t *)&md1_cfg, 1) != LSM6DSOX_OK)
+  if ((step_route == 1U) || (tilt_route == 1U))
   {
-    return LSM6DSOX_ERROR;
+    if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_EMB_FUNC_STATUS_MAINPAGE, (uint8_t *)&emb_func_status, 1) != LSM6DSOX_OK)
+    {
+      return LSM6DSOX_ERROR;
+    }
   }
-
-  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_MD2_CFG, (uint8_t *)&md2_cfg, 1) != LSM6DSOX_OK)
+  else
   {
-    return LSM6DSOX_ERROR;
+    (void)memset((void *)&emb_func_status, 0x0, sizeof(lsm6dsox_emb_func_status_mainpage_t));
   }
 
-  if (lsm6dsox_tilt_flag_data_ready_get(&(pObj->Ctx), &tilt_ia) != LSM6DSOX_OK)
-  {
-    return LSM6DSOX_ERROR;
-  }
+  (void)memcpy((void *)&wake_up_src, (void *)&src[0], 1);
+  (void)memcpy((void *)&tap_src, (void *)&src[1], 1);
+  (void)memcpy((void *)&d6d_src, (void *)&src[2], 1);
+  (void)memcpy((void *)&md1_cfg, (void *)&cfg[0], 1);
+  (void)memcpy((void *)&md2_cfg, (void *)&cfg[1], 1);
 
   if ((md1_cfg.int1_ff == 1U) || (md2_cfg.int2_ff == 1U))
   {
@@ -2665,17 +2670,17 @@ int32_t LSM6DSOX_ACC_Get_Event_Status(LSM6DSOX_Object_t *pObj, LSM6DSOX_Event_St
     }
   }
 
-  if (int1_ctrl.int1_step_detector == 1U)
+  if (step_route == 1U)
   {
-    if (func_src.step_detected == 1U)
+    if (emb_func_status.is_step_det == 1U)
     {
       Status->StepStatus = 1;
     }
   }
 
-  if ((int1_ctrl.int1_tilt == 1U) || (int2_ctrl.int2_tilt == 1U))
+  if (tilt_route == 1U)
   {
-    if (tilt_ia == 1U)
+    if (emb_func_status.is_tilt == 1U)
     {
       Status->TiltStatus = 1;
     }
@@ -3219,7 +3224,7 @@ int32_t LSM6DSOX_ACC_Enable_DRDY_Interrupt(LSM6DSOX_Object_t *pObj)
   }
   pin_int1_route.drdy_xl = 1;
   pin_int1_route.drdy_g = 0;
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), pin_int1_route) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, pin_int1_route) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -3243,7 +3248,7 @@ int32_t LSM6DSOX_GYRO_Enable_DRDY_Interrupt(LSM6DSOX_Object_t *pObj)
   }
   pin_int2_route.drdy_xl = 0;
   pin_int2_route.drdy_g = 1;
-  if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, pin_int2_route) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int2_Route_Set(pObj, pin_int2_route) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -3421,7 +3426,7 @@ int32_t LSM6DSOX_ACC_Enable_Inactivity_Detection(LSM6DSOX_Object_t *pObj, lsm6ds
       }
 
       val1.sleep_change = PROPERTY_ENABLE;
-      if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -3434,7 +3439,7 @@ int32_t LSM6DSOX_ACC_Enable_Inactivity_Detection(LSM6DSOX_Object_t *pObj, lsm6ds
       }
 
       val2.sleep_change = PROPERTY_ENABLE;
-      if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+      if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
       {
         return LSM6DSOX_ERROR;
       }
@@ -3465,7 +3470,7 @@ int32_t LSM6DSOX_ACC_Disable_Inactivity_Detection(LSM6DSOX_Object_t *pObj)
 
   val1.sleep_change = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), val1) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int1_Route_Set(pObj, val1) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -3477,7 +3482,7 @@ int32_t LSM6DSOX_ACC_Disable_Inactivity_Detection(LSM6DSOX_Object_t *pObj)
 
   val2.sleep_change = PROPERTY_DISABLE;
 
-  if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, val2) != LSM6DSOX_OK)
+  if (LSM6DSOX_Pin_Int2_Route_Set(pObj, val2) != LSM6DSOX_OK)
   {
     return LSM6DSOX_ERROR;
   }
@@ -3524,8 +3529,13 @@ int32_t LSM6DSOX_ACC_Set_Sleep_Duration(LSM6DSOX_Object_t *pObj, uint8_t Duratio
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   LSM6DSOX_Object_t *pObj = (LSM6DSOX_Object_t *)Handle;
+  int32_t ret;
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+
+  return ret;
 }
 
 /**
@@ -3539,8 +3549,59 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   LSM6DSOX_Object_t *pObj = (LSM6DSOX_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+
+  return ret;
+}
+
+/**
+  * @brief  Route interrupt signals on INT1 pin
+  * @note   The routing of the embedded functions interrupts is also kept in the object,
+  *         checked by LSM6DSOX_ACC_Get_Event_Status
+  * @param  pObj the device pObj
+  * @param  Val the signals routed on INT1 pin
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t LSM6DSOX_Pin_Int1_Route_Set(LSM6DSOX_Object_t *pObj, lsm6dsox_pin_int1_route_t Val)
+{
+  if (lsm6dsox_pin_int1_route_set(&(pObj->Ctx), Val) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  pObj->emb_func_int1.int1_step_detector = Val.step_detector;
+  pObj->emb_func_int1.int1_tilt          = Val.tilt;
+  pObj->emb_func_int1.int1_sig_mot       = Val.sig_mot;
+  pObj->emb_func_int1.int1_fsm_lc        = Val.fsm_lc;
+
+  return LSM6DSOX_OK;
+}
+
+/**
+  * @brief  Route interrupt signals on INT2 pin
+  * @note   The routing of the embedded functions interrupts is also kept in the object,
+  *         checked by LSM6DSOX_ACC_Get_Event_Status
+  * @param  pObj the device pObj
+  * @param  Val the signals routed on INT2 pin
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t LSM6DSOX_Pin_Int2_Route_Set(LSM6DSOX_Object_t *pObj, lsm6dsox_pin_int2_route_t Val)
+{
+  if (lsm6dsox_pin_int2_route_set(&(pObj->Ctx), NULL, Val) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  pObj->emb_func_int2.int2_step_detector = Val.step_detector;
+  pObj->emb_func_int2.int2_tilt          = Val.tilt;
+  pObj->emb_func_int2.int2_sig_mot       = Val.sig_mot;
+  pObj->emb_func_int2.int2_fsm_lc        = Val.fsm_lc;
+
+  return LSM6DSOX_OK;
 }
 
 /**
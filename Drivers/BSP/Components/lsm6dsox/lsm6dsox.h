@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lsm6dsox_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -119,6 +120,11 @@ typedef struct
   uint8_t             gyro_is_enabled;
   lsm6dsox_odr_xl_t   acc_odr;
   lsm6dsox_odr_g_t    gyro_odr;
+  lsm6dsox_emb_func_int1_t emb_func_int1;
+  lsm6dsox_emb_func_int2_t emb_func_int2;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LSM6DSOX_Object_t;
 
 typedef struct
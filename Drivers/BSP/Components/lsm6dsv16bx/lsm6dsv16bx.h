@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lsm6dsv16bx_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
  * @{
@@ -123,6 +124,9 @@ typedef struct
   uint8_t                   gyro_is_enabled;
   lsm6dsv16bx_xl_data_rate_t acc_odr;
   lsm6dsv16bx_gy_data_rate_t gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LSM6DSV16BX_Object_t;
 
 typedef struct
@@ -73,12 +73,50 @@ LSM6DSV16X_GYRO_Drv_t LSM6DSV16X_GYRO_Driver =
   * @}
   */
 
+#if (USE_MEMS_REG_SHADOW == 1U)
+/** @defgroup LSM6DSV16X_Private_Variables LSM6DSV16X Private Variables
+  * @{
+  */
+
+#define LSM6DSV16X_SHADOW_BANK_MASK     0xC0U /* FUNC_CFG_ACCESS emb_func_reg_access, shub_reg_access */
+#define LSM6DSV16X_SHADOW_FUNC_CFG_MASK 0xC9U /* FUNC_CFG_ACCESS bits kept: ois_ctrl_from_ui, fsm_wr_ctrl_en and the bank bits */
+#define LSM6DSV16X_SHADOW_SW_POR        0x04U /* FUNC_CFG_ACCESS sw_por */
+#define LSM6DSV16X_SHADOW_BOOT          0x80U /* CTRL3 boot */
+#define LSM6DSV16X_SHADOW_IF_INC        0x04U /* CTRL3 if_inc */
+#define LSM6DSV16X_SHADOW_SW_RESET      0x01U /* CTRL3 sw_reset */
+
+/* Registers kept in the shadow, one bit per register: the control registers
+   of the main bank written only by the host, and FUNC_CFG_ACCESS, at the same
+   address in all the banks. The status, output and FIFO registers, and the
+   registers shared with the auxiliary SPI are always read on the bus.
+     FUNC_CFG_ACCESS, PIN_CTRL, IF_CFG, ODR_TRIG_CFG, FIFO_CTRL1..4,
+     COUNTER_BDR_REG1..2, INT1_CTRL, INT2_CTRL, CTRL1..10, FUNCTIONS_ENABLE,
+     DEN, INACTIVITY_DUR..MD2_CFG, HAODR_CFG, EMB_FUNC_CFG, X_OFS_USR..Z_OFS_USR */
+static const uint8_t LSM6DSV16X_Shadow_Map[MEMS_REG_SHADOW_SIZE / 8U] =
+{
+  0xCEU, 0x7FU, 0xFFU, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U,
+  0x00U, 0x00U, 0xF3U, 0xFFU, 0x0CU, 0x00U, 0x38U, 0x00U
+};
+
+/**
+  * @}
+  */
+#endif /* USE_MEMS_REG_SHADOW */
+
 /** @defgroup LSM6DSV16X_Private_Function_Prototypes LSM6DSV16X Private Function Prototypes
   * @{
   */
 
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t LSM6DSV16X_Convert_Axis(int16_t Raw, float_t Sensitivity);
+#if (USE_MEMS_REG_SHADOW == 1U)
+static uint8_t Shadow_Read(MEMS_RegShadow_t *pShadow, uint8_t Reg, uint8_t *pData, uint16_t Length);
+static void Shadow_Update(MEMS_RegShadow_t *pShadow, uint8_t Reg, const uint8_t *pData, uint16_t Length);
+static void Shadow_Lost(MEMS_RegShadow_t *pShadow, uint8_t Reg, uint16_t Length);
+static void Shadow_Ctrl3(MEMS_RegShadow_t *pShadow, uint8_t Val);
+static void Shadow_Store(MEMS_RegShadow_t *pShadow, uint32_t Reg, uint8_t Val);
+#endif /* USE_MEMS_REG_SHADOW */
 static int32_t LSM6DSV16X_ACC_SetOutputDataRate_When_Enabled(LSM6DSV16X_Object_t *pObj, float Odr);
 static int32_t LSM6DSV16X_ACC_SetOutputDataRate_When_Disabled(LSM6DSV16X_Object_t *pObj, float Odr);
 static int32_t LSM6DSV16X_GYRO_SetOutputDataRate_When_Enabled(LSM6DSV16X_Object_t *pObj, float Odr);
@@ -120,6 +158,10 @@ int32_t LSM6DSV16X_RegisterBusIO(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_IO_t *pIO
     pObj->Ctx.mdelay    = pIO->Delay;
     pObj->Ctx.handle    = pObj;
 
+#if (USE_MEMS_REG_SHADOW == 1U)
+    (void)LSM6DSV16X_Set_Reg_Shadow(pObj, 1U);
+#endif /* USE_MEMS_REG_SHADOW */
+
     if (pObj->IO.Init == NULL)
     {
       ret = LSM6DSV16X_ERROR;
@@ -226,6 +268,27 @@ int32_t LSM6DSV16X_Init(LSM6DSV16X_Object_t *pObj)
     return LSM6DSV16X_ERROR;
   }
 
+  /* Keep the routing of the embedded functions interrupts, checked by the event status */
+  if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&(pObj->emb_func_int1), 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&(pObj->emb_func_int2), 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
   pObj->is_initialized = 1;
 
   return LSM6DSV16X_OK;
@@ -801,94 +864,54 @@ int32_t LSM6DSV16X_ACC_GetAxes(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Axes_t *Acc
   }
 
   /* Calculate the data */
-  Acceleration->x = (int32_t)((float)((float)data_raw.i16bit[0] * sensitivity));
-  Acceleration->y = (int32_t)((float)((float)data_raw.i16bit[1] * sensitivity));
-  Acceleration->z = (int32_t)((float)((float)data_raw.i16bit[2] * sensitivity));
+  Acceleration->x = LSM6DSV16X_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  Acceleration->y = LSM6DSV16X_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  Acceleration->z = LSM6DSV16X_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return LSM6DSV16X_OK;
 }
 
 /**
   * @brief  Get the status of all hardware events
+  * @note   The source registers, WAKE_UP_SRC to EMB_FUNC_STATUS_MAINPAGE, are read in a single
+  *         burst and the routing of the embedded functions interrupts is taken from the object,
+  *         so that no bank switch is needed: two transactions, MD1_CFG and MD2_CFG being read
+  *         together (one with the register shadow)
   * @param  pObj the device pObj
   * @param  Status the status of all hardware events
   * @retval 0 in case of success, an error code otherwise
   */
 int32_t LSM6DSV16X_ACC_Get_Event_Status(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Event_Status_t *Status)
 {
-
-  lsm6dsv16x_emb_func_status_t emb_func_status;
+  lsm6dsv16x_emb_func_status_mainpage_t emb_func_status;
   lsm6dsv16x_wake_up_src_t wake_up_src;
   lsm6dsv16x_tap_src_t tap_src;
   lsm6dsv16x_d6d_src_t d6d_src;
-  lsm6dsv16x_emb_func_src_t func_src;
-
   lsm6dsv16x_md1_cfg_t md1_cfg;
   lsm6dsv16x_md2_cfg_t md2_cfg;
-
-  lsm6dsv16x_emb_func_int1_t int1_ctrl;
-  lsm6dsv16x_emb_func_int2_t int2_ctrl;
-
+  uint8_t src[5];
+  uint8_t cfg[2];
 
   (void)memset((void *)Status, 0x0, sizeof(LSM6DSV16X_Event_Status_t));
 
-  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_WAKE_UP_SRC, (uint8_t *)&wake_up_src, 1) != LSM6DSV16X_OK)
-  {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_TAP_SRC, (uint8_t *)&tap_src, 1) != LSM6DSV16X_OK)
-  {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_D6D_SRC, (uint8_t *)&d6d_src, 1) != LSM6DSV16X_OK)
-  {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK)
-  {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_SRC, (uint8_t *)&func_src, 1) != LSM6DSV16X_OK)
-  {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&int1_ctrl, 1) != LSM6DSV16X_OK)
-  {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&int2_ctrl, 1) != LSM6DSV16X_OK)
-  {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_STATUS, (uint8_t *)&emb_func_status, 1) != LSM6DSV16X_OK)
-  {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_MAIN_MEM_BANK) != 0)
-  {
-    return LSM6DSV16X_ERROR;
-  }
-
-
-
-  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_MD1_CFG, (uint8_t *)&md1_cfg, 1) != LSM6DSV16X_OK)
+  /* WAKE_UP_SRC, TAP_SRC, D6D_SRC, STATUS_MASTER_MAINPAGE, EMB_FUNC_STATUS_MAINPAGE */
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_WAKE_UP_SRC, src, 5) != LSM6DSV16X_OK)
   {
     return LSM6DSV16X_ERROR;
   }
 
-  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_MD2_CFG, (uint8_t *)&md2_cfg, 1) != LSM6DSV16X_OK)
+  /* MD1_CFG, MD2_CFG */
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_MD1_CFG, cfg, 2) != LSM6DSV16X_OK)
   {
     return LSM6DSV16X_ERROR;
   }
 
+  (void)memcpy((void *)&wake_up_src, (void *)&src[0], 1);
+  (void)memcpy((void *)&tap_src, (void *)&src[1], 1);
+  (void)memcpy((void *)&d6d_src, (void *)&src[2], 1);
+  (void)memcpy((void *)&emb_func_status, (void *)&src[4], 1);
+  (void)memcpy((void *)&md1_cfg, (void *)&cfg[0], 1);
+  (void)memcpy((void *)&md2_cfg, (void *)&cfg[1], 1);
 
   if ((md1_cfg.int1_ff == 1U) || (md2_cfg.int2_ff == 1U))
   {
@@ -930,15 +953,15 @@ int32_t LSM6DSV16X_ACC_Get_Event_Status(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Ev
     }
   }
 
-  if (int1_ctrl.int1_step_detector == 1U || int2_ctrl.int2_step_detector == 1U)
+  if ((pObj->emb_func_int1.int1_step_detector == 1U) || (pObj->emb_func_int2.int2_step_detector == 1U))
   {
-    if (func_src.step_detected == 1U)
+    if (emb_func_status.is_step_det == 1U)
     {
       Status->StepStatus = 1;
     }
   }
 
-  if ((int1_ctrl.int1_tilt == 1U) || (int2_ctrl.int2_tilt == 1U))
+  if ((pObj->emb_func_int1.int1_tilt == 1U) || (pObj->emb_func_int2.int2_tilt == 1U))
   {
     if (emb_func_status.is_tilt == 1U)
     {
@@ -1235,6 +1258,8 @@ int32_t LSM6DSV16X_ACC_Enable_Tilt_Detection(LSM6DSV16X_Object_t *pObj, LSM6DSV1
         return LSM6DSV16X_ERROR;
       }
 
+      pObj->emb_func_int1 = emb_func_int1;
+
       /* Disable access to embedded functions registers */
       if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK)
       {
@@ -1288,6 +1313,8 @@ int32_t LSM6DSV16X_ACC_Enable_Tilt_Detection(LSM6DSV16X_Object_t *pObj, LSM6DSV1
         return LSM6DSV16X_ERROR;
       }
 
+      pObj->emb_func_int2 = emb_func_int2;
+
       /* Disable access to embedded functions registers */
       if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK)
       {
@@ -1389,6 +1416,8 @@ int32_t LSM6DSV16X_ACC_Disable_Tilt_Detection(LSM6DSV16X_Object_t *pObj)
     return LSM6DSV16X_ERROR;
   }
 
+  pObj->emb_func_int1 = emb_func_int1;
+
   /* Reset interrupt driven to INT2 pin */
   if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK)
   {
@@ -1402,6 +1431,8 @@ int32_t LSM6DSV16X_ACC_Disable_Tilt_Detection(LSM6DSV16X_Object_t *pObj)
     return LSM6DSV16X_ERROR;
   }
 
+  pObj->emb_func_int2 = emb_func_int2;
+
   /* Disable access to embedded functions registers */
   if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK)
   {
@@ -1475,6 +1506,8 @@ int32_t LSM6DSV16X_ACC_Enable_Pedometer(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Se
         return LSM6DSV16X_ERROR;
       }
 
+      pObj->emb_func_int1 = emb_func_int1;
+
       /* Disable access to embedded functions registers */
       if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK)
       {
@@ -1514,6 +1547,8 @@ int32_t LSM6DSV16X_ACC_Enable_Pedometer(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Se
         return LSM6DSV16X_ERROR;
       }
 
+      pObj->emb_func_int2 = emb_func_int2;
+
       /* Disable access to embedded functions registers */
       if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK)
       {
@@ -1616,6 +1651,8 @@ int32_t LSM6DSV16X_ACC_Disable_Pedometer(LSM6DSV16X_Object_t *pObj)
     return LSM6DSV16X_ERROR;
   }
 
+  pObj->emb_func_int1 = emb_func_int1;
+
   /* Reset interrupt driven to INT2 pin */
   if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK)
   {
@@ -1629,6 +1666,8 @@ int32_t LSM6DSV16X_ACC_Disable_Pedometer(LSM6DSV16X_Object_t *pObj)
     return LSM6DSV16X_ERROR;
   }
 
+  pObj->emb_func_int2 = emb_func_int2;
+
   /* Disable access to embedded functions registers */
   if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK)
   {
@@ -2953,7 +2992,6 @@ int32_t LSM6DSV16X_FIFO_ACC_Get_Axes(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Axes_
 {
   lsm6dsv16x_axis3bit16_t data_raw;
   float_t sensitivity = 0.0f;
-  float_t acceleration_float_t[3];
 
   if (LSM6DSV16X_FIFO_Get_Data(pObj, data_raw.u8bit) != LSM6DSV16X_OK)
   {
@@ -2964,13 +3002,9 @@ int32_t LSM6DSV16X_FIFO_ACC_Get_Axes(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Axes_
   {
     return LSM6DSV16X_ERROR;
   }
-  acceleration_float_t[0] = (float_t)data_raw.i16bit[0] * sensitivity;
-  acceleration_float_t[1] = (float_t)data_raw.i16bit[1] * sensitivity;
-  acceleration_float_t[2] = (float_t)data_raw.i16bit[2] * sensitivity;
-
-  Acceleration->x = (int32_t)acceleration_float_t[0];
-  Acceleration->y = (int32_t)acceleration_float_t[1];
-  Acceleration->z = (int32_t)acceleration_float_t[2];
+  Acceleration->x = LSM6DSV16X_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  Acceleration->y = LSM6DSV16X_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  Acceleration->z = LSM6DSV16X_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return LSM6DSV16X_OK;
 }
@@ -3017,7 +3051,6 @@ int32_t LSM6DSV16X_FIFO_GYRO_Get_Axes(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Axes
 {
   lsm6dsv16x_axis3bit16_t data_raw;
   float_t sensitivity = 0.0f;
-  float_t angular_velocity_float_t[3];
 
   if (LSM6DSV16X_FIFO_Get_Data(pObj, data_raw.u8bit) != LSM6DSV16X_OK)
   {
@@ -3029,13 +3062,9 @@ int32_t LSM6DSV16X_FIFO_GYRO_Get_Axes(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Axes
     return LSM6DSV16X_ERROR;
   }
 
-  angular_velocity_float_t[0] = (float_t)data_raw.i16bit[0] * sensitivity;
-  angular_velocity_float_t[1] = (float_t)data_raw.i16bit[1] * sensitivity;
-  angular_velocity_float_t[2] = (float_t)data_raw.i16bit[2] * sensitivity;
-
-  AngularVelocity->x = (int32_t)angular_velocity_float_t[0];
-  AngularVelocity->y = (int32_t)angular_velocity_float_t[1];
-  AngularVelocity->z = (int32_t)angular_velocity_float_t[2];
+  AngularVelocity->x = LSM6DSV16X_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  AngularVelocity->y = LSM6DSV16X_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  AngularVelocity->z = LSM6DSV16X_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return LSM6DSV16X_OK;
 }
@@ -3539,9 +3568,9 @@ int32_t LSM6DSV16X_GYRO_GetAxes(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Axes_t *An
   }
 
   /* Calculate the data */
-  AngularRate->x = (int32_t)((float)((float)data_raw.i16bit[0] * sensitivity));
-  AngularRate->y = (int32_t)((float)((float)data_raw.i16bit[1] * sensitivity));
-  AngularRate->z = (int32_t)((float)((float)data_raw.i16bit[2] * sensitivity));
+  AngularRate->x = LSM6DSV16X_Convert_Axis(data_raw.i16bit[0], sensitivity);
+  AngularRate->y = LSM6DSV16X_Convert_Axis(data_raw.i16bit[1], sensitivity);
+  AngularRate->z = LSM6DSV16X_Convert_Axis(data_raw.i16bit[2], sensitivity);
 
   return LSM6DSV16X_OK;
 }
@@ -3960,6 +3989,26 @@ int32_t LSM6DSV16X_Set_Mem_Bank(LSM6DSV16X_Object_t *pObj, uint8_t Val)
   return ret;
 }
 
+#if (USE_MEMS_REG_SHADOW == 1U)
+/**
+  * @brief  Enable or disable the register shadow, its content is discarded
+  * @note   The shadow is enabled by LSM6DSV16X_RegisterBusIO. It is used once the
+  *         register bank and the address auto-increment are known, that is
+  *         after LSM6DSV16X_Init.
+  * @param  pObj the device pObj
+  * @param  Enable 1 to serve the reads of the control registers from the shadow, 0 to read them on the bus
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t LSM6DSV16X_Set_Reg_Shadow(LSM6DSV16X_Object_t *pObj, uint8_t Enable)
+{
+  (void)memset(&(pObj->Shadow), 0, sizeof(MEMS_RegShadow_t));
+  pObj->Shadow.Bypass  = MEMS_REG_SHADOW_BANK | MEMS_REG_SHADOW_NO_INC;
+  pObj->Shadow.Enabled = (Enable != 0U) ? 1U : 0U;
+
+  return LSM6DSV16X_OK;
+}
+#endif /* USE_MEMS_REG_SHADOW */
+
 /**
   * @}
   */
@@ -4089,8 +4138,27 @@ static int32_t LSM6DSV16X_GYRO_SetOutputDataRate_When_Disabled(LSM6DSV16X_Object
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   LSM6DSV16X_Object_t *pObj = (LSM6DSV16X_Object_t *)Handle;
+  int32_t ret;
+
+#if (USE_MEMS_REG_SHADOW == 1U)
+  if (Shadow_Read(&(pObj->Shadow), Reg, pData, Length) == 1U)
+  {
+    return LSM6DSV16X_OK;
+  }
+#endif /* USE_MEMS_REG_SHADOW */
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+
+#if (USE_MEMS_REG_SHADOW == 1U)
+  if (ret == 0)
+  {
+    Shadow_Update(&(pObj->Shadow), Reg, pData, Length);
+  }
+#endif /* USE_MEMS_REG_SHADOW */
+
+  return ret;
 }
 
 /**
@@ -4104,9 +4172,276 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   LSM6DSV16X_Object_t *pObj = (LSM6DSV16X_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+
+#if (USE_MEMS_REG_SHADOW == 1U)
+  if (ret == 0)
+  {
+    Shadow_Update(&(pObj->Shadow), Reg, pData, Length);
+  }
+  else
+  {
+    Shadow_Lost(&(pObj->Shadow), Reg, Length);
+  }
+#endif /* USE_MEMS_REG_SHADOW */
+
+  return ret;
+}
+
+/**
+  * @brief  Convert a raw axis value with the sensitivity
+  * @param  Raw the raw value
+  * @param  Sensitivity the sensitivity
+  * @retval the value truncated toward zero
+  * @note   With USE_MEMS_FIXED_POINT_AXES the product is computed with integers, the 24-bit
+  *         mantissa of the sensitivity as multiplier and its exponent as shift: the result is
+  *         the same as the float path when the float product is exact, and closer to zero by 1
+  *         at most when the float product has been rounded away from zero to the next integer.
+  *         A sensitivity not lower than 4096, or negative, is out of the integer range and
+  *         uses the float product.
+  */
+static int32_t LSM6DSV16X_Convert_Axis(int16_t Raw, float_t Sensitivity)
+{
+#if (USE_MEMS_FIXED_POINT_AXES == 1U)
+  uint32_t bits;
+  uint32_t mant;
+  uint32_t shift;
+  uint32_t mag;
+  uint32_t val;
+  uint32_t exp;
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  (void)memcpy(&bits, &Sensitivity, sizeof(bits));
+  exp = (bits >> 23) & 0xFFU;
+
+  /* Sensitivity lower than 2^-20: |Raw * Sensitivity| < 1 */
+  if (exp < 107U)
+  {
+    return 0;
+  }
+
+  /* Sensitivity not lower than 4096 or negative: the shift below would wrap */
+  if ((exp > 138U) || ((bits & 0x80000000U) != 0U))
+  {
+    return (int32_t)((float_t)((float_t)Raw * Sensitivity));
+  }
+
+  /* Sensitivity = mant / 2^(shift + 12), 2^23 <= mant < 2^24 */
+  mant = (bits & 0x007FFFFFU) | 0x00800000U;
+  shift = 138U - exp;
+
+  mag = (Raw < 0) ? (uint32_t)(-(int32_t)Raw) : (uint32_t)Raw;
+
+  /* mag * mant split in two products within 32 bits */
+  val = ((mag * (mant >> 12)) + ((mag * (mant & 0xFFFU)) >> 12)) >> shift;
+
+  return (Raw < 0) ? -(int32_t)val : (int32_t)val;
+#else
+  return (int32_t)((float_t)((float_t)Raw * Sensitivity));
+#endif /* USE_MEMS_FIXED_POINT_AXES */
+}
+
+#if (USE_MEMS_REG_SHADOW == 1U)
+/**
+  * @brief  Read registers from the shadow
+  * @param  pShadow the register shadow
+  * @param  Reg the register address
+  * @param  pData the stored data pointer
+  * @param  Length the length
+  * @retval 1 if all the registers are in the shadow and have been copied, 0 otherwise
+  */
+static uint8_t Shadow_Read(MEMS_RegShadow_t *pShadow, uint8_t Reg, uint8_t *pData, uint16_t Length)
+{
+  uint32_t reg;
+  uint16_t i;
+
+  if ((pShadow->Enabled == 0U) || (Length == 0U)
+      || (((pShadow->Bypass & MEMS_REG_SHADOW_NO_INC) != 0U) && (Length > 1U)))
+  {
+    return 0U;
+  }
+
+  for (i = 0U; i < Length; i++)
+  {
+    reg = (uint32_t)Reg + i;
+
+    /* Only FUNC_CFG_ACCESS while another bank is selected */
+    if ((reg >= MEMS_REG_SHADOW_SIZE) || ((pShadow->Valid[reg >> 3] & (1U << (reg & 7U))) == 0U)
+        || ((pShadow->Bypass != 0U) && (reg != (uint32_t)LSM6DSV16X_FUNC_CFG_ACCESS)))
+    {
+      return 0U;
+    }
+  }
+
+  (void)memcpy(pData, &(pShadow->Value[Reg]), Length);
+  pShadow->Hits++;
+
+  return 1U;
+}
+
+/**
+  * @brief  Update the shadow with registers read from or written to the device
+  * @param  pShadow the register shadow
+  * @param  Reg the register address
+  * @param  pData the register values
+  * @param  Length the length
+  * @retval None
+  */
+static void Shadow_Update(MEMS_RegShadow_t *pShadow, uint8_t Reg, const uint8_t *pData, uint16_t Length)
+{
+  uint32_t reg;
+  uint8_t val;
+  uint16_t i;
+
+  if (pShadow->Enabled == 0U)
+  {
+    return;
+  }
+
+  if (((pShadow->Bypass & MEMS_REG_SHADOW_NO_INC) != 0U) && (Length > 1U))
+  {
+    /* The registers accessed depend on the auto-increment */
+    Shadow_Lost(pShadow, Reg, Length);
+    return;
+  }
+
+  for (i = 0U; i < Length; i++)
+  {
+    reg = (uint32_t)Reg + i;
+    val = pData[i];
+
+    if (reg == (uint32_t)LSM6DSV16X_FUNC_CFG_ACCESS)
+    {
+      /* Same address in all the banks */
+      if ((val & LSM6DSV16X_SHADOW_BANK_MASK) != 0U)
+      {
+        pShadow->Bypass |= MEMS_REG_SHADOW_BANK;
+      }
+      else
+      {
+        pShadow->Bypass &= (uint8_t)~MEMS_REG_SHADOW_BANK;
+      }
+
+      if ((val & LSM6DSV16X_SHADOW_SW_POR) != 0U)
+      {
+        /* Power-on reset: main bank and address auto-increment */
+        (void)memset(pShadow->Valid, 0, sizeof(pShadow->Valid));
+        pShadow->Bypass = 0U;
+      }
+      else
+      {
+        Shadow_Store(pShadow, reg, val & LSM6DSV16X_SHADOW_FUNC_CFG_MASK);
+      }
+    }
+    else if ((pShadow->Bypass & MEMS_REG_SHADOW_BANK) != 0U)
+    {
+      /* Register of another bank */
+    }
+    else if (reg == (uint32_t)LSM6DSV16X_CTRL3)
+    {
+      Shadow_Ctrl3(pShadow, val);
+    }
+    else if (pShadow->Bypass == 0U)
+    {
+      Shadow_Store(pShadow, reg, val);
+    }
+    else
+    {
+      /* Shadow not used */
+    }
+  }
+}
+
+/**
+  * @brief  Invalidate the shadow after a failed write or an access to registers not known
+  * @param  pShadow the register shadow
+  * @param  Reg the register address
+  * @param  Length the length
+  * @retval None
+  */
+static void Shadow_Lost(MEMS_RegShadow_t *pShadow, uint8_t Reg, uint16_t Length)
+{
+  uint32_t last = (uint32_t)Reg + Length - 1U;
+
+  if (pShadow->Enabled == 0U)
+  {
+    return;
+  }
+
+  (void)memset(pShadow->Valid, 0, sizeof(pShadow->Valid));
+
+  if (((uint32_t)Reg <= (uint32_t)LSM6DSV16X_FUNC_CFG_ACCESS) && (last >= (uint32_t)LSM6DSV16X_FUNC_CFG_ACCESS))
+  {
+    pShadow->Bypass |= MEMS_REG_SHADOW_BANK;
+  }
+
+  if (((uint32_t)Reg <= (uint32_t)LSM6DSV16X_CTRL3) && (last >= (uint32_t)LSM6DSV16X_CTRL3))
+  {
+    pShadow->Bypass |= MEMS_REG_SHADOW_NO_INC;
+  }
+}
+
+/**
+  * @brief  Update the shadow with the CTRL3 register value
+  * @param  pShadow the register shadow
+  * @param  Val the register value
+  * @retval None
+  */
+static void Shadow_Ctrl3(MEMS_RegShadow_t *pShadow, uint8_t Val)
+{
+  if ((Val & LSM6DSV16X_SHADOW_SW_RESET) != 0U)
+  {
+    /* Software reset: the registers go back to their default value, with auto-increment */
+    (void)memset(pShadow->Valid, 0, sizeof(pShadow->Valid));
+    pShadow->Bypass &= (uint8_t)~MEMS_REG_SHADOW_NO_INC;
+  }
+  else if ((Val & LSM6DSV16X_SHADOW_IF_INC) == 0U)
+  {
+    if ((pShadow->Bypass & MEMS_REG_SHADOW_NO_INC) == 0U)
+    {
+      (void)memset(pShadow->Valid, 0, sizeof(pShadow->Valid));
+      pShadow->Bypass |= MEMS_REG_SHADOW_NO_INC;
+    }
+  }
+  else
+  {
+    pShadow->Bypass &= (uint8_t)~MEMS_REG_SHADOW_NO_INC;
+
+    if ((Val & LSM6DSV16X_SHADOW_BOOT) != 0U)
+    {
+      /* Reboot of the memory content */
+      (void)memset(pShadow->Valid, 0, sizeof(pShadow->Valid));
+    }
+    else if (pShadow->Bypass == 0U)
+    {
+      Shadow_Store(pShadow, (uint32_t)LSM6DSV16X_CTRL3, Val);
+    }
+    else
+    {
+      /* Shadow not used */
+    }
+  }
+}
+
+/**
+  * @brief  Store a register value in the shadow if the register is kept in it
+  * @param  pShadow the register shadow
+  * @param  Reg the register address
+  * @param  Val the register value
+  * @retval None
+  */
+static void Shadow_Store(MEMS_RegShadow_t *pShadow, uint32_t Reg, uint8_t Val)
+{
+  if ((Reg < MEMS_REG_SHADOW_SIZE) && ((LSM6DSV16X_Shadow_Map[Reg >> 3] & (1U << (Reg & 7U))) != 0U))
+  {
+    pShadow->Value[Reg] = Val;
+    pShadow->Valid[Reg >> 3] |= (uint8_t)(1U << (Reg & 7U));
+  }
 }
+#endif /* USE_MEMS_REG_SHADOW */
 
 /**
   * @}
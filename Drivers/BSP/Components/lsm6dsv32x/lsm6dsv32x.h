@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lsm6dsv32x_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -124,6 +125,9 @@ typedef struct
   uint8_t                   gyro_is_enabled;
   lsm6dsv32x_data_rate_t acc_odr;
   lsm6dsv32x_data_rate_t gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LSM6DSV32X_Object_t;
 
 typedef struct
@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "lsm6dsv80x_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -127,6 +128,9 @@ typedef struct
   lsm6dsv80x_data_rate_t       acc_odr;
   lsm6dsv80x_hg_xl_data_rate_t acc_hg_odr;
   lsm6dsv80x_data_rate_t       gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } LSM6DSV80X_Object_t;
 
 typedef struct
@@ -31,6 +31,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "mis2du12_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -114,6 +115,9 @@ typedef struct
   uint8_t                    acc_is_enabled;
   float                      acc_odr;
   MIS2DU12_Ultra_Low_Power_t acc_ultra_low_power;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } MIS2DU12_Object_t;
 
 typedef struct
@@ -368,11 +368,15 @@ static int32_t GetData(SGP40_Object_t *pObj, float_t *ht_data)
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   SGP40_Object_t *pObj = (SGP40_Object_t *)Handle;
+  int32_t ret;
   (void)Reg;
 
   if (pObj->IO.BusType == (uint32_t)SGP40_I2C_BUS) /* I2C */
   {
-    return pObj->IO.Read(pObj->IO.Address, pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.Read(pObj->IO.Address, pData, Length);
+    MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
+    return ret;
   }
   else
   {
@@ -391,11 +395,15 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   SGP40_Object_t *pObj = (SGP40_Object_t *)Handle;
+  int32_t ret;
   (void)Reg;
 
   if (pObj->IO.BusType == (uint32_t)SGP40_I2C_BUS) /* I2C */
   {
-    return pObj->IO.Write(pObj->IO.Address, pData, Length);
+    MEMS_BUS_STATS_START(pObj->BusStats);
+    ret = pObj->IO.Write(pObj->IO.Address, pData, Length);
+    MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+    return ret;
   }
   else
   {
@@ -66,6 +66,8 @@ ST1VAFE3BX_ACC_Drv_t ST1VAFE3BX_ACC_Driver =
 
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t ST1VAFE3BX_Boot_Start(ST1VAFE3BX_Object_t *pObj);
+static int32_t ST1VAFE3BX_Boot_End(ST1VAFE3BX_Object_t *pObj);
 static int32_t ST1VAFE3BX_ACC_SetOutputDataRate_When_Enabled(ST1VAFE3BX_Object_t *pObj, float_t Odr,
     ST1VAFE3BX_Power_Mode_t Power);
 static int32_t ST1VAFE3BX_ACC_SetOutputDataRate_When_Disabled(ST1VAFE3BX_Object_t *pObj, float_t Odr,
@@ -82,9 +84,34 @@ static int32_t ST1VAFE3BX_ACC_SetOutputDataRate_When_Disabled(ST1VAFE3BX_Object_
 /**
   * @brief  Register Component Bus IO operations
   * @param  pObj the device pObj
+  * @param  pIO the bus IO operations
   * @retval 0 in case of success, an error code otherwise
   */
 int32_t ST1VAFE3BX_RegisterBusIO(ST1VAFE3BX_Object_t *pObj, ST1VAFE3BX_IO_t *pIO)
+{
+  int32_t ret = ST1VAFE3BX_RegisterBusIO_Start(pObj, pIO);
+
+  if ((ret == ST1VAFE3BX_OK) && (pObj->boot_pending == 1U))
+  {
+    /* Wait for 25 ms based on datasheet */
+    pObj->Ctx.mdelay(ST1VAFE3BX_BOOT_TIME);
+
+    ret = ST1VAFE3BX_Boot_End(pObj);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Register Component Bus IO operations and start the exit from deep power down,
+  *         without waiting for the boot time
+  * @param  pObj the device pObj
+  * @param  pIO the bus IO operations
+  * @retval 0 in case of success, an error code otherwise
+  * @note   The component must not be accessed until ST1VAFE3BX_Boot_Poll reports the end
+  *         of the boot, the other devices can be initialized meanwhile
+  */
+int32_t ST1VAFE3BX_RegisterBusIO_Start(ST1VAFE3BX_Object_t *pObj, ST1VAFE3BX_IO_t *pIO)
 {
   int32_t ret = ST1VAFE3BX_OK;
 
@@ -118,45 +145,13 @@ int32_t ST1VAFE3BX_RegisterBusIO(ST1VAFE3BX_Object_t *pObj, ST1VAFE3BX_IO_t *pIO
     }
     else
     {
-      if (pObj->IO.BusType == ST1VAFE3BX_SPI_3WIRES_BUS) /* SPI 3-Wires */
-      {
-        /* Enable the SPI 3-Wires support only the first time */
-        if (pObj->is_initialized == 0U)
-        {
-          /* Exit from deep power down only the first time in SPI mode */
-          if (ST1VAFE3BX_ExitDeepPowerDownSPI(pObj) != ST1VAFE3BX_OK)
-          {
-            ret = ST1VAFE3BX_ERROR;
-          }
-          /* Enable SPI 3-Wires on the component */
-          uint8_t data = 0x50;
-
-          if (ST1VAFE3BX_Write_Reg(pObj, ST1VAFE3BX_CTRL1, data) != ST1VAFE3BX_OK)
-          {
-            ret = ST1VAFE3BX_ERROR;
-          }
-        }
-      }
-      else if (pObj->IO.BusType == ST1VAFE3BX_SPI_4WIRES_BUS)
-      {
-        /* Exit from deep power down only the first time in SPI mode */
-        if (pObj->is_initialized == 0U)
-        {
-          if (ST1VAFE3BX_ExitDeepPowerDownSPI(pObj) != ST1VAFE3BX_OK)
-          {
-            ret = ST1VAFE3BX_ERROR;
-          }
-        }
-      }
-      else if (pObj->IO.BusType == ST1VAFE3BX_I2C_BUS)
+      if ((pObj->IO.BusType == ST1VAFE3BX_I2C_BUS) || (pObj->IO.BusType == ST1VAFE3BX_SPI_4WIRES_BUS) ||
+          (pObj->IO.BusType == ST1VAFE3BX_SPI_3WIRES_BUS))
       {
-        /* Exit from deep power down only the first time in I2C mode */
+        /* Exit from deep power down only the first time, SPI 3-Wires is enabled at the end of the boot */
         if (pObj->is_initialized == 0U)
         {
-          if (ST1VAFE3BX_ExitDeepPowerDownI2C(pObj) != ST1VAFE3BX_OK)
-          {
-            ret = ST1VAFE3BX_ERROR;
-          }
+          ret = ST1VAFE3BX_Boot_Start(pObj);
         }
       }
       else
@@ -169,6 +164,41 @@ int32_t ST1VAFE3BX_RegisterBusIO(ST1VAFE3BX_Object_t *pObj, ST1VAFE3BX_IO_t *pIO
   return ret;
 }
 
+/**
+  * @brief  Check the end of the boot started by ST1VAFE3BX_RegisterBusIO_Start
+  * @param  pObj the device pObj
+  * @param  Done 1 when the component can be accessed, 0 during the boot time
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t ST1VAFE3BX_Boot_Poll(ST1VAFE3BX_Object_t *pObj, uint8_t *Done)
+{
+  int32_t ret = ST1VAFE3BX_OK;
+
+  *Done = 1U;
+
+  if (pObj->boot_pending == 1U)
+  {
+    if (pObj->IO.GetTick == NULL)
+    {
+      /* No time base, wait for the whole boot time */
+      pObj->Ctx.mdelay(ST1VAFE3BX_BOOT_TIME);
+
+      ret = ST1VAFE3BX_Boot_End(pObj);
+    }
+    /* The tick of the start may have been almost over, one more is needed */
+    else if (((uint32_t)pObj->IO.GetTick() - pObj->boot_tick) > ST1VAFE3BX_BOOT_TIME)
+    {
+      ret = ST1VAFE3BX_Boot_End(pObj);
+    }
+    else
+    {
+      *Done = 0U;
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Initialize the ST1VAFE3BX sensor
   * @param  pObj the device pObj
@@ -1593,6 +1623,65 @@ int32_t ST1VAFE3BX_ACC_Get_6D_Orientation_ZH(ST1VAFE3BX_Object_t *pObj, uint8_t
   return ST1VAFE3BX_OK;
 }
 
+/**
+  * @brief  Exit from deep power down, the boot time starts
+  * @param  pObj the device pObj
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t ST1VAFE3BX_Boot_Start(ST1VAFE3BX_Object_t *pObj)
+{
+  st1vafe3bx_en_device_config_t en_device_config = {0};
+  uint8_t val;
+
+  if (pObj->IO.BusType == ST1VAFE3BX_I2C_BUS)
+  {
+    /* Perform dummy read in order to exit from deep power down in I2C mode.
+     * NOTE: No return value check - expected first read fail. */
+    (void)st1vafe3bx_device_id_get(&(pObj->Ctx), &val);
+  }
+  else
+  {
+    /* Write IF_WAKE_UP register to exit from deep power down in SPI mode,
+     * st1vafe3bx_exit_deep_power_down would wait for the boot time */
+    en_device_config.en_dev_conf = PROPERTY_ENABLE;
+    if (st1vafe3bx_write_reg(&(pObj->Ctx), ST1VAFE3BX_EN_DEVICE_CONFIG,
+                             (uint8_t *)&en_device_config, 1) != ST1VAFE3BX_OK)
+    {
+      return ST1VAFE3BX_ERROR;
+    }
+  }
+
+  pObj->boot_tick = (pObj->IO.GetTick != NULL) ? (uint32_t)pObj->IO.GetTick() : 0U;
+  pObj->boot_pending = 1U;
+
+  return ST1VAFE3BX_OK;
+}
+
+/**
+  * @brief  End of the boot time, the component can be accessed
+  * @param  pObj the device pObj
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t ST1VAFE3BX_Boot_End(ST1VAFE3BX_Object_t *pObj)
+{
+  int32_t ret = ST1VAFE3BX_OK;
+
+  pObj->boot_pending = 0U;
+
+  if (pObj->IO.BusType == ST1VAFE3BX_SPI_3WIRES_BUS)
+  {
+    /* Enable SPI 3-Wires on the component */
+    uint8_t data = 0x50;
+
+    if (ST1VAFE3BX_Write_Reg(pObj, ST1VAFE3BX_CTRL1, data) != ST1VAFE3BX_OK)
+    {
+      ret = ST1VAFE3BX_ERROR;
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Wrap Read register component function to Bus IO function
   * @param  Handle the device handler
@@ -1604,8 +1693,13 @@ int32_t ST1VAFE3BX_ACC_Get_6D_Orientation_ZH(ST1VAFE3BX_Object_t *pObj, uint8_t
 static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ST1VAFE3BX_Object_t *pObj = (ST1VAFE3BX_Object_t *)Handle;
+  int32_t ret;
+
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_READ(pObj->BusStats, Length, ret);
 
-  return pObj->IO.ReadReg(pObj->IO.Address, Reg, pData, Length);
+  return ret;
 }
 
 /**
@@ -1619,8 +1713,13 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t Length)
 {
   ST1VAFE3BX_Object_t *pObj = (ST1VAFE3BX_Object_t *)Handle;
+  int32_t ret;
 
-  return pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_START(pObj->BusStats);
+  ret = pObj->IO.WriteReg(pObj->IO.Address, Reg, pData, Length);
+  MEMS_BUS_STATS_WRITE(pObj->BusStats, Length, ret);
+
+  return ret;
 }
 
 
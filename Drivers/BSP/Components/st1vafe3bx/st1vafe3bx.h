@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "st1vafe3bx_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -112,6 +113,11 @@ typedef struct
   uint8_t                 acc_is_enabled;
   float                   acc_odr;
   ST1VAFE3BX_Power_Mode_t power_mode;
+  uint8_t                 boot_pending; /* Exit from deep power down started, boot time not elapsed */
+  uint32_t                boot_tick;    /* IO.GetTick() at the exit from deep power down */
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } ST1VAFE3BX_Object_t;
 
 typedef struct
@@ -189,6 +195,8 @@ typedef union
 #define ST1VAFE3BX_SPI_3WIRES_BUS          2U
 #define ST1VAFE3BX_I3C_BUS                 3U
 
+#define ST1VAFE3BX_BOOT_TIME              25U  /**< Boot time after the exit from deep power down [ms] */
+
 #define ST1VAFE3BX_ACC_SENSITIVITY_FOR_FS_2G   0.061f  /**< Sensitivity value for 2g full scale, Low-power1 mode [mg/LSB] */
 #define ST1VAFE3BX_ACC_SENSITIVITY_FOR_FS_4G   0.122f  /**< Sensitivity value for 4g full scale, Low-power1 mode [mg/LSB] */
 #define ST1VAFE3BX_ACC_SENSITIVITY_FOR_FS_8G   0.244f  /**< Sensitivity value for 8g full scale, Low-power1 mode [mg/LSB] */
@@ -210,6 +218,8 @@ typedef union
   */
 
 int32_t ST1VAFE3BX_RegisterBusIO(ST1VAFE3BX_Object_t *pObj, ST1VAFE3BX_IO_t *pIO);
+int32_t ST1VAFE3BX_RegisterBusIO_Start(ST1VAFE3BX_Object_t *pObj, ST1VAFE3BX_IO_t *pIO);
+int32_t ST1VAFE3BX_Boot_Poll(ST1VAFE3BX_Object_t *pObj, uint8_t *Done);
 int32_t ST1VAFE3BX_Init(ST1VAFE3BX_Object_t *pObj);
 int32_t ST1VAFE3BX_DeInit(ST1VAFE3BX_Object_t *pObj);
 int32_t ST1VAFE3BX_ExitDeepPowerDownI2C(ST1VAFE3BX_Object_t *pObj);
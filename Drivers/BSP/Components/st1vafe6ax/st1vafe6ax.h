@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "st1vafe6ax_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
  * @{
@@ -124,6 +125,9 @@ typedef struct
   uint8_t                   gyro_is_enabled;
   st1vafe6ax_xl_data_rate_t acc_odr;
   st1vafe6ax_gy_data_rate_t gyro_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } ST1VAFE6AX_Object_t;
 
 typedef struct
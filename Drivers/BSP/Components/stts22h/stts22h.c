@@ -583,7 +583,9 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
   {
     for (i = 0; i < Length; i++)
     {
+      MEMS_BUS_STATS_START(pObj->BusStats);
       ret = pObj->IO.ReadReg(pObj->IO.Address, (Reg + i), &pData[i], 1);
+      MEMS_BUS_STATS_READ(pObj->BusStats, 1U, ret);
       if (ret != STTS22H_OK)
       {
         return STTS22H_ERROR;
@@ -612,7 +614,9 @@ static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t
   {
     for (i = 0; i < Length; i++)
     {
+      MEMS_BUS_STATS_START(pObj->BusStats);
       ret = pObj->IO.WriteReg(pObj->IO.Address, (Reg + i), &pData[i], 1);
+      MEMS_BUS_STATS_WRITE(pObj->BusStats, 1U, ret);
       if (ret != STTS22H_OK)
       {
         return STTS22H_ERROR;
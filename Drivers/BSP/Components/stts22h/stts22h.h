@@ -28,6 +28,7 @@ extern "C"
 /* Includes ------------------------------------------------------------------*/
 #include "stts22h_reg.h"
 #include <string.h>
+#include "mems_bus_stats.h"
 
 /** @addtogroup BSP BSP
   * @{
@@ -71,6 +72,9 @@ typedef struct
   uint8_t            is_initialized;
   uint8_t            temp_is_enabled;
   float              temp_odr;
+#if (USE_MEMS_BUS_STATS == 1U)
+  MEMS_BusStats_t        BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 } STTS22H_Object_t;
 
 typedef struct
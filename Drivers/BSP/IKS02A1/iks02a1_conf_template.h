@@ -43,6 +43,10 @@ extern "C" {
 #define IKS02A1_I2C_WRITE_REG BSP_I2C1_WriteReg
 #define IKS02A1_GET_TICK BSP_GetTick
 
+/* Bus statistics time source, used only if USE_MEMS_BUS_STATS is defined to 1U:
+   a free running microsecond or cycle counter, bus time is not measured if not defined */
+/* #define IKS02A1_BUS_STATS_GET_TIME BSP_GetBusStatsTime */
+
 /* The N_MS value defines the number of millisecond to be processed at each AudioProcess call,
 that must be consistent with the N_MS_PER_INTERRUPT defined in the audio driver
 (cca02m1_audio.h).
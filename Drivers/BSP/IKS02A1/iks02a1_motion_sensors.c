@@ -53,6 +53,12 @@ static uint32_t FunctionIndex[] = {0, 0, 1, 1, 2, 2, 2, 2, 3};
 static MOTION_SENSOR_FuncDrv_t *MotionFuncDrv[IKS02A1_MOTION_INSTANCES_NBR][IKS02A1_MOTION_FUNCTIONS_NBR];
 static MOTION_SENSOR_CommonDrv_t *MotionDrv[IKS02A1_MOTION_INSTANCES_NBR];
 static IKS02A1_MOTION_SENSOR_Ctx_t MotionCtx[IKS02A1_MOTION_INSTANCES_NBR];
+#if (USE_MEMS_BUS_STATS == 1U)
+static MEMS_BusStats_t *MotionBusStats[IKS02A1_MOTION_INSTANCES_NBR];
+#endif /* USE_MEMS_BUS_STATS */
+#if (USE_IKS02A1_MOTION_SENSOR_IIS2DULPX_0 == 1)
+static IIS2DULPX_Object_t iis2dulpx_obj_0;
+#endif
 
 /**
   * @}
@@ -88,6 +94,8 @@ static int32_t ISM330BX_0_Probe(uint32_t Functions);
 
 #if (USE_IKS02A1_MOTION_SENSOR_IIS2DULPX_0 == 1)
 static int32_t IIS2DULPX_0_Probe(uint32_t Functions);
+static int32_t IIS2DULPX_0_Start(void);
+static int32_t IIS2DULPX_0_Boot(void);
 #endif
 
 /**
@@ -317,6 +325,35 @@ int32_t IKS02A1_MOTION_SENSOR_Init(uint32_t Instance, uint32_t Functions)
   return ret;
 }
 
+/**
+  * @brief  Starts the boot of a motion sensor, completed by IKS02A1_MOTION_SENSOR_Init
+  * @param  Instance Motion sensor instance
+  * @retval BSP status
+  * @note   The sensors exiting from deep power down need a boot time before the first
+  *         access. Started for all the sensors first, the boot times run together and
+  *         along with the init of the other sensors, instead of one after the other.
+  *         Nothing is done for the sensors without a boot time.
+  */
+int32_t IKS02A1_MOTION_SENSOR_Init_Start(uint32_t Instance)
+{
+  int32_t ret;
+
+  switch (Instance)
+  {
+#if (USE_IKS02A1_MOTION_SENSOR_IIS2DULPX_0 == 1)
+    case IKS02A1_IIS2DULPX_0:
+      ret = IIS2DULPX_0_Start();
+      break;
+#endif
+
+    default:
+      ret = (Instance < IKS02A1_MOTION_INSTANCES_NBR) ? BSP_ERROR_NONE : BSP_ERROR_WRONG_PARAM;
+      break;
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Deinitialize Motion sensor
   * @param  Instance Motion sensor instance
@@ -755,6 +792,43 @@ int32_t IKS02A1_MOTION_SENSOR_SetFullScale(uint32_t Instance, uint32_t Function,
   return ret;
 }
 
+#if (USE_MEMS_BUS_STATS == 1U)
+/**
+  * @brief  Get the bus transaction statistics of all the instances and reset them
+  * @param  Stats array of IKS02A1_MOTION_INSTANCES_NBR statistics, zeroed for the instances not initialized
+  * @retval BSP status
+  */
+int32_t IKS02A1_MOTION_SENSOR_SnapshotBusStats(MEMS_BusStats_t *Stats)
+{
+  MEMS_BusStats_GetTime_Func get_time;
+  uint32_t i;
+
+  if (Stats == NULL)
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  for (i = 0; i < IKS02A1_MOTION_INSTANCES_NBR; i++)
+  {
+    if (MotionBusStats[i] == NULL)
+    {
+      (void)memset(&Stats[i], 0, sizeof(MEMS_BusStats_t));
+    }
+    else
+    {
+      Stats[i] = *MotionBusStats[i];
+
+      /* The timestamp hook is kept */
+      get_time = MotionBusStats[i]->GetTime;
+      (void)memset(MotionBusStats[i], 0, sizeof(MEMS_BusStats_t));
+      MotionBusStats[i]->GetTime = get_time;
+    }
+  }
+
+  return BSP_ERROR_NONE;
+}
+#endif /* USE_MEMS_BUS_STATS */
+
 /**
   * @}
   */
@@ -808,6 +882,10 @@ static int32_t ISM330DHCX_0_Probe(uint32_t Functions)
     MotionCtx[IKS02A1_ISM330DHCX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS02A1_ISM330DHCX_0] = &ism330dhcx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism330dhcx_obj_0.BusStats.GetTime = IKS02A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS02A1_ISM330DHCX_0] = &ism330dhcx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS02A1_ISM330DHCX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM330DHCX_COMMON_Driver;
 
@@ -891,6 +969,10 @@ static int32_t IIS2DLPC_0_Probe(uint32_t Functions)
     MotionCtx[IKS02A1_IIS2DLPC_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS02A1_IIS2DLPC_0] = &iis2dlpc_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2dlpc_obj_0.BusStats.GetTime = IKS02A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS02A1_IIS2DLPC_0] = &iis2dlpc_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS02A1_IIS2DLPC_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2DLPC_COMMON_Driver;
 
@@ -965,6 +1047,10 @@ static int32_t IIS2MDC_0_Probe(uint32_t Functions)
     MotionCtx[IKS02A1_IIS2MDC_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS02A1_IIS2MDC_0] = &iis2mdc_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2mdc_obj_0.BusStats.GetTime = IKS02A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS02A1_IIS2MDC_0] = &iis2mdc_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS02A1_IIS2MDC_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2MDC_COMMON_Driver;
 
@@ -1043,6 +1129,10 @@ static int32_t IIS2ICLX_0_Probe(uint32_t Functions)
     MotionCtx[IKS02A1_IIS2ICLX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS02A1_IIS2ICLX_0] = &iis2iclx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2iclx_obj_0.BusStats.GetTime = IKS02A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS02A1_IIS2ICLX_0] = &iis2iclx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS02A1_IIS2ICLX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2ICLX_COMMON_Driver;
 
@@ -1121,6 +1211,10 @@ static int32_t ASM330LHHX_0_Probe(uint32_t Functions)
     MotionCtx[IKS02A1_ASM330LHHX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS02A1_ASM330LHHX_0] = &asm330lhhx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    asm330lhhx_obj_0.BusStats.GetTime = IKS02A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS02A1_ASM330LHHX_0] = &asm330lhhx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS02A1_ASM330LHHX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ASM330LHHX_COMMON_Driver;
 
@@ -1208,6 +1302,10 @@ static int32_t ISM330BX_0_Probe(uint32_t Functions)
     MotionCtx[IKS02A1_ISM330BX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS02A1_ISM330BX_0] = &ism330bx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism330bx_obj_0.BusStats.GetTime = IKS02A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS02A1_ISM330BX_0] = &ism330bx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS02A1_ISM330BX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM330BX_COMMON_Driver;
 
@@ -1251,15 +1349,12 @@ static int32_t ISM330BX_0_Probe(uint32_t Functions)
 
 #if (USE_IKS02A1_MOTION_SENSOR_IIS2DULPX_0  == 1)
 /**
-  * @brief  Register Bus IOs for instance 0 if component ID is OK
+  * @brief  Register Bus IOs for IIS2DULPX instance and start its boot
   * @retval BSP status
   */
-static int32_t IIS2DULPX_0_Probe(uint32_t Functions)
+static int32_t IIS2DULPX_0_Start(void)
 {
-  IIS2DULPX_IO_t            io_ctx;
-  uint8_t                   id;
-  static IIS2DULPX_Object_t iis2dulpx_obj_0;
-  IIS2DULPX_Capabilities_t  cap;
+  IIS2DULPX_IO_t io_ctx;
   int32_t ret = BSP_ERROR_NONE;
 
   /* Configure the accelero driver */
@@ -1272,7 +1367,51 @@ static int32_t IIS2DULPX_0_Probe(uint32_t Functions)
   io_ctx.GetTick     = IKS02A1_GET_TICK;
   io_ctx.Delay       = IKS02A1_DELAY;
 
-  if (IIS2DULPX_RegisterBusIO(&iis2dulpx_obj_0, &io_ctx) != IIS2DULPX_OK)
+  if (IIS2DULPX_RegisterBusIO_Start(&iis2dulpx_obj_0, &io_ctx) != IIS2DULPX_OK)
+  {
+    ret = BSP_ERROR_UNKNOWN_COMPONENT;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Wait for the end of the boot of IIS2DULPX instance, started here if
+  *         IKS02A1_MOTION_SENSOR_Init_Start was not called before
+  * @retval BSP status
+  */
+static int32_t IIS2DULPX_0_Boot(void)
+{
+  uint8_t done = 0;
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (iis2dulpx_obj_0.boot_pending == 0U)
+  {
+    ret = IIS2DULPX_0_Start();
+  }
+
+  while ((ret == BSP_ERROR_NONE) && (done == 0U))
+  {
+    if (IIS2DULPX_Boot_Poll(&iis2dulpx_obj_0, &done) != IIS2DULPX_OK)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Register Bus IOs for instance 0 if component ID is OK
+  * @retval BSP status
+  */
+static int32_t IIS2DULPX_0_Probe(uint32_t Functions)
+{
+  uint8_t                   id;
+  IIS2DULPX_Capabilities_t  cap;
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (IIS2DULPX_0_Boot() != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_UNKNOWN_COMPONENT;
   }
@@ -1294,6 +1433,10 @@ static int32_t IIS2DULPX_0_Probe(uint32_t Functions)
     MotionCtx[IKS02A1_IIS2DULPX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS02A1_IIS2DULPX_0] = &iis2dulpx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2dulpx_obj_0.BusStats.GetTime = IKS02A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS02A1_IIS2DULPX_0] = &iis2dulpx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS02A1_IIS2DULPX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2DULPX_COMMON_Driver;
 
@@ -217,6 +217,7 @@ typedef struct
   */
 
 int32_t IKS02A1_MOTION_SENSOR_Init(uint32_t Instance, uint32_t Functions);
+int32_t IKS02A1_MOTION_SENSOR_Init_Start(uint32_t Instance);
 int32_t IKS02A1_MOTION_SENSOR_DeInit(uint32_t Instance);
 int32_t IKS02A1_MOTION_SENSOR_GetCapabilities(uint32_t Instance, IKS02A1_MOTION_SENSOR_Capabilities_t *Capabilities);
 int32_t IKS02A1_MOTION_SENSOR_ReadID(uint32_t Instance, uint8_t *Id);
@@ -229,6 +230,12 @@ int32_t IKS02A1_MOTION_SENSOR_GetOutputDataRate(uint32_t Instance, uint32_t Func
 int32_t IKS02A1_MOTION_SENSOR_SetOutputDataRate(uint32_t Instance, uint32_t Function, float Odr);
 int32_t IKS02A1_MOTION_SENSOR_GetFullScale(uint32_t Instance, uint32_t Function, int32_t *Fullscale);
 int32_t IKS02A1_MOTION_SENSOR_SetFullScale(uint32_t Instance, uint32_t Function, int32_t Fullscale);
+#if (USE_MEMS_BUS_STATS == 1U)
+#ifndef IKS02A1_BUS_STATS_GET_TIME
+#define IKS02A1_BUS_STATS_GET_TIME  NULL /* Timestamp hook of the bus transaction statistics */
+#endif /* IKS02A1_BUS_STATS_GET_TIME */
+int32_t IKS02A1_MOTION_SENSOR_SnapshotBusStats(MEMS_BusStats_t *Stats);
+#endif /* USE_MEMS_BUS_STATS */
 
 /**
   * @}
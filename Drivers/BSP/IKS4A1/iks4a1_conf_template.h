@@ -50,6 +50,10 @@ extern "C" {
 #define IKS4A1_GET_TICK BSP_GetTick
 #define IKS4A1_DELAY HAL_Delay
 
+/* Bus statistics time source, used only if USE_MEMS_BUS_STATS is defined to 1U:
+   a free running microsecond or cycle counter, bus time is not measured if not defined */
+/* #define IKS4A1_BUS_STATS_GET_TIME BSP_GetBusStatsTime */
+
 #ifdef __cplusplus
 }
 #endif
@@ -53,6 +53,9 @@ static uint32_t FunctionIndex[] = {0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
 static ENV_SENSOR_FuncDrv_t *EnvFuncDrv[IKS4A1_ENV_INSTANCES_NBR][IKS4A1_ENV_FUNCTIONS_NBR];
 static ENV_SENSOR_CommonDrv_t *EnvDrv[IKS4A1_ENV_INSTANCES_NBR];
 static IKS4A1_ENV_SENSOR_Ctx_t EnvCtx[IKS4A1_ENV_INSTANCES_NBR];
+#if (USE_MEMS_BUS_STATS == 1U)
+static MEMS_BusStats_t *EnvBusStats[IKS4A1_ENV_INSTANCES_NBR];
+#endif /* USE_MEMS_BUS_STATS */
 
 /**
   * @}
@@ -851,6 +854,43 @@ int32_t IKS4A1_ENV_SENSOR_GetValue(uint32_t Instance, uint32_t Function, float_t
   return ret;
 }
 
+#if (USE_MEMS_BUS_STATS == 1U)
+/**
+  * @brief  Get the bus transaction statistics of all the instances and reset them
+  * @param  Stats array of IKS4A1_ENV_INSTANCES_NBR statistics, zeroed for the instances not initialized
+  * @retval BSP status
+  */
+int32_t IKS4A1_ENV_SENSOR_SnapshotBusStats(MEMS_BusStats_t *Stats)
+{
+  MEMS_BusStats_GetTime_Func get_time;
+  uint32_t i;
+
+  if (Stats == NULL)
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  for (i = 0; i < IKS4A1_ENV_INSTANCES_NBR; i++)
+  {
+    if (EnvBusStats[i] == NULL)
+    {
+      (void)memset(&Stats[i], 0, sizeof(MEMS_BusStats_t));
+    }
+    else
+    {
+      Stats[i] = *EnvBusStats[i];
+
+      /* The timestamp hook is kept */
+      get_time = EnvBusStats[i]->GetTime;
+      (void)memset(EnvBusStats[i], 0, sizeof(MEMS_BusStats_t));
+      EnvBusStats[i]->GetTime = get_time;
+    }
+  }
+
+  return BSP_ERROR_NONE;
+}
+#endif /* USE_MEMS_BUS_STATS */
+
 /**
   * @}
   */
@@ -906,6 +946,10 @@ static int32_t HTS221_0_Probe(uint32_t Functions)
                                        | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_HTS221_0] = &hts221_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    hts221_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_HTS221_0] = &hts221_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_HTS221_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&HTS221_COMMON_Driver;
 
@@ -1000,6 +1044,10 @@ static int32_t LPS22HH_0_Probe(uint32_t Functions)
                                        | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_LPS22HH_0] = &lps22hh_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lps22hh_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_LPS22HH_0] = &lps22hh_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_LPS22HH_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&LPS22HH_COMMON_Driver;
 
@@ -1094,6 +1142,10 @@ static int32_t STTS751_0_Probe(uint32_t Functions)
                                        | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_STTS751_0] = &stts751_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    stts751_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_STTS751_0] = &stts751_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_STTS751_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&STTS751_COMMON_Driver;
 
@@ -1179,6 +1231,10 @@ static int32_t LPS33HW_0_Probe(uint32_t Functions)
                                        | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_LPS33HW_0] = &lps33hw_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lps33hw_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_LPS33HW_0] = &lps33hw_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_LPS33HW_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&LPS33HW_COMMON_Driver;
 
@@ -1273,6 +1329,10 @@ static int32_t STTS22H_0_Probe(uint32_t Functions)
                                        | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_STTS22H_0] = &stts22h_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    stts22h_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_STTS22H_0] = &stts22h_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_STTS22H_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&STTS22H_COMMON_Driver;
 
@@ -1358,6 +1418,10 @@ static int32_t LPS33K_0_Probe(uint32_t Functions)
                                        | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_LPS33K_0] = &lps33k_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lps33k_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_LPS33K_0] = &lps33k_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_LPS33K_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&LPS33K_COMMON_Driver;
 
@@ -1452,6 +1516,10 @@ static int32_t LPS22CH_0_Probe(uint32_t Functions)
                                        | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_LPS22CH_0] = &lps22ch_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lps22ch_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_LPS22CH_0] = &lps22ch_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_LPS22CH_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&LPS22CH_COMMON_Driver;
 
@@ -1546,6 +1614,10 @@ static int32_t LPS27HHTW_0_Probe(uint32_t Functions)
                                          | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_LPS27HHTW_0] = &lps27hhtw_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lps27hhtw_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_LPS27HHTW_0] = &lps27hhtw_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_LPS27HHTW_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&LPS27HHTW_COMMON_Driver;
 
@@ -1640,6 +1712,10 @@ static int32_t LPS22DF_0_Probe(uint32_t Functions)
                                        | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_LPS22DF_0] = &lps22df_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lps22df_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_LPS22DF_0] = &lps22df_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_LPS22DF_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&LPS22DF_COMMON_Driver;
 
@@ -1734,6 +1810,10 @@ static int32_t ILPS22QS_0_Probe(uint32_t Functions)
                                         | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_ILPS22QS_0] = &ilps22qs_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ilps22qs_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_ILPS22QS_0] = &ilps22qs_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_ILPS22QS_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&ILPS22QS_COMMON_Driver;
 
@@ -1828,6 +1908,10 @@ static int32_t ILPS28QSW_0_Probe(uint32_t Functions)
                                          | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_ILPS28QSW_0] = &ilps28qsw_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ilps28qsw_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_ILPS28QSW_0] = &ilps28qsw_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_ILPS28QSW_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&ILPS28QSW_COMMON_Driver;
 
@@ -1922,6 +2006,10 @@ static int32_t LPS28DFW_0_Probe(uint32_t Functions)
                                         | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_LPS28DFW_0] = &lps28dfw_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lps28dfw_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_LPS28DFW_0] = &lps28dfw_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_LPS28DFW_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&LPS28DFW_COMMON_Driver;
 
@@ -2016,6 +2104,10 @@ static int32_t SHT40AD1B_0_Probe(uint32_t Functions)
                                          | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_SHT40AD1B_0] = &sht40ad1b_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    sht40ad1b_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_SHT40AD1B_0] = &sht40ad1b_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_SHT40AD1B_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&SHT40AD1B_COMMON_Driver;
 
@@ -2114,6 +2206,10 @@ static int32_t STHS34PF80_0_Probe(uint32_t Functions)
                                           | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS4A1_STHS34PF80_0] = &sths34pf80_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    sths34pf80_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS4A1_STHS34PF80_0] = &sths34pf80_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS4A1_STHS34PF80_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&STHS34PF80_COMMON_Driver;
 
@@ -54,6 +54,9 @@ static HYBRID_MOTION_SENSOR_FuncDrv_t
 static HYBRID_SENSOR_CommonDrv_t *HybridDrv[IKS4A1_HYBRID_INSTANCES_NBR];
 static IKS4A1_HYBRID_ENV_SENSOR_Ctx_t HybridEnvCtx[IKS4A1_HYBRID_INSTANCES_NBR];
 static IKS4A1_HYBRID_MOTION_SENSOR_Ctx_t HybridMotionCtx[IKS4A1_HYBRID_INSTANCES_NBR];
+#if (USE_MEMS_BUS_STATS == 1U)
+static MEMS_BusStats_t *HybridBusStats[IKS4A1_HYBRID_INSTANCES_NBR];
+#endif /* USE_MEMS_BUS_STATS */
 
 /**
   * @}
@@ -660,6 +663,43 @@ int32_t IKS4A1_HYBRID_ENV_SENSOR_GetValue(uint32_t Instance, uint32_t Function,
   return BSP_ERROR_NONE;
 }
 
+#if (USE_MEMS_BUS_STATS == 1U)
+/**
+  * @brief  Get the bus transaction statistics of all the instances and reset them
+  * @param  Stats array of IKS4A1_HYBRID_INSTANCES_NBR statistics, zeroed for the instances not initialized
+  * @retval BSP status
+  */
+int32_t IKS4A1_HYBRID_SENSOR_SnapshotBusStats(MEMS_BusStats_t *Stats)
+{
+  MEMS_BusStats_GetTime_Func get_time;
+  uint32_t i;
+
+  if (Stats == NULL)
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  for (i = 0; i < IKS4A1_HYBRID_INSTANCES_NBR; i++)
+  {
+    if (HybridBusStats[i] == NULL)
+    {
+      (void)memset(&Stats[i], 0, sizeof(MEMS_BusStats_t));
+    }
+    else
+    {
+      Stats[i] = *HybridBusStats[i];
+
+      /* The timestamp hook is kept */
+      get_time = HybridBusStats[i]->GetTime;
+      (void)memset(HybridBusStats[i], 0, sizeof(MEMS_BusStats_t));
+      HybridBusStats[i]->GetTime = get_time;
+    }
+  }
+
+  return BSP_ERROR_NONE;
+}
+#endif /* USE_MEMS_BUS_STATS */
+
 /**
   * @}
   */
@@ -728,6 +768,10 @@ static int32_t LIS2DTW12_0_Probe(uint32_t Functions)
                                                | ((cap.Gas         == 1U) ? HYBRID_GAS         : 0U);
 
   HybridCompObj[IKS4A1_LIS2DTW12_0] = &lis2dtw12_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+  lis2dtw12_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+  HybridBusStats[IKS4A1_LIS2DTW12_0] = &lis2dtw12_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
 
   /* The second cast (void *) is added to bypass Misra R11.3 rule */
   HybridDrv[IKS4A1_LIS2DTW12_0] = (HYBRID_SENSOR_CommonDrv_t *)(void *)&LIS2DTW12_COMMON_Driver;
@@ -189,6 +189,12 @@ int32_t IKS4A1_HYBRID_ENV_SENSOR_Disable(uint32_t Instance, uint32_t Function);
 int32_t IKS4A1_HYBRID_ENV_SENSOR_GetOutputDataRate(uint32_t Instance, uint32_t Function, float_t *Odr);
 int32_t IKS4A1_HYBRID_ENV_SENSOR_SetOutputDataRate(uint32_t Instance, uint32_t Function, float_t Odr);
 int32_t IKS4A1_HYBRID_ENV_SENSOR_GetValue(uint32_t Instance, uint32_t Function, float_t *Value);
+#if (USE_MEMS_BUS_STATS == 1U)
+#ifndef IKS4A1_BUS_STATS_GET_TIME
+#define IKS4A1_BUS_STATS_GET_TIME  NULL /* Timestamp hook of the bus transaction statistics */
+#endif /* IKS4A1_BUS_STATS_GET_TIME */
+int32_t IKS4A1_HYBRID_SENSOR_SnapshotBusStats(MEMS_BusStats_t *Stats);
+#endif /* USE_MEMS_BUS_STATS */
 
 /**
   * @}
@@ -53,6 +53,18 @@ static uint32_t FunctionIndex[] = {0, 0, 1, 1, 2, 2, 2, 2};
 static MOTION_SENSOR_FuncDrv_t *MotionFuncDrv[IKS4A1_MOTION_INSTANCES_NBR][IKS4A1_MOTION_FUNCTIONS_NBR];
 static MOTION_SENSOR_CommonDrv_t *MotionDrv[IKS4A1_MOTION_INSTANCES_NBR];
 static IKS4A1_MOTION_SENSOR_Ctx_t MotionCtx[IKS4A1_MOTION_INSTANCES_NBR];
+#if (USE_MEMS_BUS_STATS == 1U)
+static MEMS_BusStats_t *MotionBusStats[IKS4A1_MOTION_INSTANCES_NBR];
+#endif /* USE_MEMS_BUS_STATS */
+#if (USE_IKS4A1_MOTION_SENSOR_LIS2DUX12_0 == 1)
+static LIS2DUX12_Object_t lis2dux12_obj_0;
+#endif
+#if (USE_IKS4A1_MOTION_SENSOR_LIS2DUXS12_0 == 1)
+static LIS2DUXS12_Object_t lis2duxs12_obj_0;
+#endif
+#if (USE_IKS4A1_MOTION_SENSOR_ST1VAFE3BX_0 == 1)
+static ST1VAFE3BX_Object_t st1vafe3bx_obj_0;
+#endif
 
 /**
   * @}
@@ -188,10 +200,14 @@ static int32_t LSM6DSV16B_0_Probe(uint32_t Functions);
 
 #if (USE_IKS4A1_MOTION_SENSOR_LIS2DUX12_0 == 1)
 static int32_t LIS2DUX12_0_Probe(uint32_t Functions);
+static int32_t LIS2DUX12_0_Start(void);
+static int32_t LIS2DUX12_0_Boot(void);
 #endif
 
 #if (USE_IKS4A1_MOTION_SENSOR_LIS2DUXS12_0 == 1)
 static int32_t LIS2DUXS12_0_Probe(uint32_t Functions);
+static int32_t LIS2DUXS12_0_Start(void);
+static int32_t LIS2DUXS12_0_Boot(void);
 #endif
 
 #if (USE_IKS4A1_MOTION_SENSOR_LSM6DSV32X_0 == 1)
@@ -216,6 +232,8 @@ static int32_t LSM6DSV320X_0_Probe(uint32_t Functions);
 
 #if (USE_IKS4A1_MOTION_SENSOR_ST1VAFE3BX_0 == 1)
 static int32_t ST1VAFE3BX_0_Probe(uint32_t Functions);
+static int32_t ST1VAFE3BX_0_Start(void);
+static int32_t ST1VAFE3BX_0_Boot(void);
 #endif
 
 #if (USE_IKS4A1_MOTION_SENSOR_ST1VAFE6AX_0 == 1)
@@ -1303,6 +1321,47 @@ int32_t IKS4A1_MOTION_SENSOR_Init(uint32_t Instance, uint32_t Functions)
   return ret;
 }
 
+/**
+  * @brief  Starts the boot of a motion sensor, completed by IKS4A1_MOTION_SENSOR_Init
+  * @param  Instance Motion sensor instance
+  * @retval BSP status
+  * @note   The sensors exiting from deep power down need a boot time before the first
+  *         access. Started for all the sensors first, the boot times run together and
+  *         along with the init of the other sensors, instead of one after the other.
+  *         Nothing is done for the sensors without a boot time.
+  */
+int32_t IKS4A1_MOTION_SENSOR_Init_Start(uint32_t Instance)
+{
+  int32_t ret;
+
+  switch (Instance)
+  {
+#if (USE_IKS4A1_MOTION_SENSOR_LIS2DUX12_0 == 1)
+    case IKS4A1_LIS2DUX12_0:
+      ret = LIS2DUX12_0_Start();
+      break;
+#endif
+
+#if (USE_IKS4A1_MOTION_SENSOR_LIS2DUXS12_0 == 1)
+    case IKS4A1_LIS2DUXS12_0:
+      ret = LIS2DUXS12_0_Start();
+      break;
+#endif
+
+#if (USE_IKS4A1_MOTION_SENSOR_ST1VAFE3BX_0 == 1)
+    case IKS4A1_ST1VAFE3BX_0:
+      ret = ST1VAFE3BX_0_Start();
+      break;
+#endif
+
+    default:
+      ret = (Instance < IKS4A1_MOTION_INSTANCES_NBR) ? BSP_ERROR_NONE : BSP_ERROR_WRONG_PARAM;
+      break;
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Deinitialize Motion sensor
   * @param  Instance Motion sensor instance
@@ -1741,6 +1800,43 @@ int32_t IKS4A1_MOTION_SENSOR_SetFullScale(uint32_t Instance, uint32_t Function,
   return ret;
 }
 
+#if (USE_MEMS_BUS_STATS == 1U)
+/**
+  * @brief  Get the bus transaction statistics of all the instances and reset them
+  * @param  Stats array of IKS4A1_MOTION_INSTANCES_NBR statistics, zeroed for the instances not initialized
+  * @retval BSP status
+  */
+int32_t IKS4A1_MOTION_SENSOR_SnapshotBusStats(MEMS_BusStats_t *Stats)
+{
+  MEMS_BusStats_GetTime_Func get_time;
+  uint32_t i;
+
+  if (Stats == NULL)
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  for (i = 0; i < IKS4A1_MOTION_INSTANCES_NBR; i++)
+  {
+    if (MotionBusStats[i] == NULL)
+    {
+      (void)memset(&Stats[i], 0, sizeof(MEMS_BusStats_t));
+    }
+    else
+    {
+      Stats[i] = *MotionBusStats[i];
+
+      /* The timestamp hook is kept */
+      get_time = MotionBusStats[i]->GetTime;
+      (void)memset(MotionBusStats[i], 0, sizeof(MEMS_BusStats_t));
+      MotionBusStats[i]->GetTime = get_time;
+    }
+  }
+
+  return BSP_ERROR_NONE;
+}
+#endif /* USE_MEMS_BUS_STATS */
+
 /**
   * @}
   */
@@ -1796,6 +1892,10 @@ static int32_t LSM6DSO_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSO_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSO_0] = &lsm6dso_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dso_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSO_0] = &lsm6dso_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSO_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSO_COMMON_Driver;
 
@@ -1883,6 +1983,10 @@ static int32_t LIS2DW12_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LIS2DW12_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LIS2DW12_0] = &lis2dw12_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lis2dw12_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LIS2DW12_0] = &lis2dw12_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LIS2DW12_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LIS2DW12_COMMON_Driver;
 
@@ -1960,6 +2064,10 @@ static int32_t LIS2MDL_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LIS2MDL_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LIS2MDL_0] = &lis2mdl_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lis2mdl_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LIS2MDL_0] = &lis2mdl_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LIS2MDL_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LIS2MDL_COMMON_Driver;
 
@@ -2037,6 +2145,10 @@ static int32_t ASM330LHH_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_ASM330LHH_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_ASM330LHH_0] = &asm330lhh_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    asm330lhh_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_ASM330LHH_0] = &asm330lhh_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_ASM330LHH_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ASM330LHH_COMMON_Driver;
 
@@ -2124,6 +2236,10 @@ static int32_t IIS2DLPC_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_IIS2DLPC_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_IIS2DLPC_0] = &iis2dlpc_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2dlpc_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_IIS2DLPC_0] = &iis2dlpc_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_IIS2DLPC_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2DLPC_COMMON_Driver;
 
@@ -2201,6 +2317,10 @@ static int32_t IIS2MDC_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_IIS2MDC_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_IIS2MDC_0] = &iis2mdc_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2mdc_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_IIS2MDC_0] = &iis2mdc_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_IIS2MDC_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2MDC_COMMON_Driver;
 
@@ -2278,6 +2398,10 @@ static int32_t ISM303DAC_ACC_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_ISM303DAC_ACC_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_ISM303DAC_ACC_0] = &ism303dac_acc_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism303dac_acc_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_ISM303DAC_ACC_0] = &ism303dac_acc_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_ISM303DAC_ACC_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM303DAC_ACC_COMMON_Driver;
 
@@ -2355,6 +2479,10 @@ static int32_t ISM303DAC_MAG_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_ISM303DAC_MAG_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_ISM303DAC_MAG_0] = &ism303dac_mag_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism303dac_mag_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_ISM303DAC_MAG_0] = &ism303dac_mag_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_ISM303DAC_MAG_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM303DAC_MAG_COMMON_Driver;
 
@@ -2436,6 +2564,10 @@ static int32_t ISM330DLC_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_ISM330DLC_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_ISM330DLC_0] = &ism330dlc_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism330dlc_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_ISM330DLC_0] = &ism330dlc_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_ISM330DLC_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM330DLC_COMMON_Driver;
 
@@ -2523,6 +2655,10 @@ static int32_t LIS2DH12_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LIS2DH12_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LIS2DH12_0] = &lis2dh12_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lis2dh12_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LIS2DH12_0] = &lis2dh12_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LIS2DH12_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LIS2DH12_COMMON_Driver;
 
@@ -2604,6 +2740,10 @@ static int32_t LSM6DSOX_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSOX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSOX_0] = &lsm6dsox_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsox_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSOX_0] = &lsm6dsox_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSOX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSOX_COMMON_Driver;
 
@@ -2691,6 +2831,10 @@ static int32_t AIS2DW12_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_AIS2DW12_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_AIS2DW12_0] = &ais2dw12_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ais2dw12_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_AIS2DW12_0] = &ais2dw12_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_AIS2DW12_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&AIS2DW12_COMMON_Driver;
 
@@ -2768,6 +2912,10 @@ static int32_t LIS3MDL_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LIS3MDL_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LIS3MDL_0] = &lis3mdl_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lis3mdl_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LIS3MDL_0] = &lis3mdl_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LIS3MDL_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LIS3MDL_COMMON_Driver;
 
@@ -2849,6 +2997,10 @@ static int32_t LSM6DSR_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSR_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSR_0] = &lsm6dsr_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsr_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSR_0] = &lsm6dsr_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSR_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSR_COMMON_Driver;
 
@@ -2936,6 +3088,10 @@ static int32_t A3G4250D_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_A3G4250D_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_A3G4250D_0] = &a3g4250d_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    a3g4250d_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_A3G4250D_0] = &a3g4250d_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_A3G4250D_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&A3G4250D_COMMON_Driver;
 
@@ -3013,6 +3169,10 @@ static int32_t AIS328DQ_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_AIS328DQ_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_AIS328DQ_0] = &ais328dq_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ais328dq_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_AIS328DQ_0] = &ais328dq_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_AIS328DQ_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&AIS328DQ_COMMON_Driver;
 
@@ -3090,6 +3250,10 @@ static int32_t AIS3624DQ_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_AIS3624DQ_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_AIS3624DQ_0] = &ais3624dq_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ais3624dq_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_AIS3624DQ_0] = &ais3624dq_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_AIS3624DQ_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&AIS3624DQ_COMMON_Driver;
 
@@ -3167,6 +3331,10 @@ static int32_t H3LIS331DL_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_H3LIS331DL_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_H3LIS331DL_0] = &h3lis331dl_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    h3lis331dl_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_H3LIS331DL_0] = &h3lis331dl_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_H3LIS331DL_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&H3LIS331DL_COMMON_Driver;
 
@@ -3248,6 +3416,10 @@ static int32_t LSM6DSRX_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSRX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSRX_0] = &lsm6dsrx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsrx_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSRX_0] = &lsm6dsrx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSRX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSRX_COMMON_Driver;
 
@@ -3339,6 +3511,10 @@ static int32_t ISM330DHCX_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_ISM330DHCX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_ISM330DHCX_0] = &ism330dhcx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism330dhcx_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_ISM330DHCX_0] = &ism330dhcx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_ISM330DHCX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM330DHCX_COMMON_Driver;
 
@@ -3430,6 +3606,10 @@ static int32_t LSM6DSO32_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSO32_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSO32_0] = &lsm6dso32_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dso32_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSO32_0] = &lsm6dso32_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSO32_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSO32_COMMON_Driver;
 
@@ -3521,6 +3701,10 @@ static int32_t IIS2ICLX_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_IIS2ICLX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_IIS2ICLX_0] = &iis2iclx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2iclx_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_IIS2ICLX_0] = &iis2iclx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_IIS2ICLX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2ICLX_COMMON_Driver;
 
@@ -3598,6 +3782,10 @@ static int32_t AIS2IH_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_AIS2IH_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_AIS2IH_0] = &ais2ih_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ais2ih_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_AIS2IH_0] = &ais2ih_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_AIS2IH_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&AIS2IH_COMMON_Driver;
 
@@ -3679,6 +3867,10 @@ static int32_t LSM6DSO32X_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSO32X_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSO32X_0] = &lsm6dso32x_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dso32x_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSO32X_0] = &lsm6dso32x_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSO32X_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSO32X_COMMON_Driver;
 
@@ -3766,6 +3958,10 @@ static int32_t LSM6DSOX_SENSORHUB_LIS2MDL_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSOX_SENSORHUB_LIS2MDL_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSOX_SENSORHUB_LIS2MDL_0] = &lis2mdl_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lis2mdl_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSOX_SENSORHUB_LIS2MDL_0] = &lis2mdl_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSOX_SENSORHUB_LIS2MDL_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LIS2MDL_COMMON_Driver;
 
@@ -3844,6 +4040,10 @@ static int32_t LIS2DU12_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LIS2DU12_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LIS2DU12_0] = &lis2du12_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lis2du12_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LIS2DU12_0] = &lis2du12_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LIS2DU12_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LIS2DU12_COMMON_Driver;
 
@@ -3925,6 +4125,10 @@ static int32_t ASM330LHHX_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_ASM330LHHX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_ASM330LHHX_0] = &asm330lhhx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    asm330lhhx_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_ASM330LHHX_0] = &asm330lhhx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_ASM330LHHX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ASM330LHHX_COMMON_Driver;
 
@@ -4016,6 +4220,10 @@ static int32_t LSM6DSV16X_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSV16X_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSV16X_0] = &lsm6dsv16x_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsv16x_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSV16X_0] = &lsm6dsv16x_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSV16X_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSV16X_COMMON_Driver;
 
@@ -4107,6 +4315,10 @@ static int32_t LSM6DSV16BX_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSV16BX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSV16BX_0] = &lsm6dsv16bx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsv16bx_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSV16BX_0] = &lsm6dsv16bx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSV16BX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSV16BX_COMMON_Driver;
 
@@ -4198,6 +4410,10 @@ static int32_t LSM6DSV_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSV_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSV_0] = &lsm6dsv_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsv_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSV_0] = &lsm6dsv_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSV_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSV_COMMON_Driver;
 
@@ -4289,6 +4505,10 @@ static int32_t LSM6DSV16B_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSV16B_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSV16B_0] = &lsm6dsv16b_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsv16b_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSV16B_0] = &lsm6dsv16b_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSV16B_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSV16B_COMMON_Driver;
 
@@ -4335,18 +4555,13 @@ static int32_t LSM6DSV16B_0_Probe(uint32_t Functions)
 
 #if (USE_IKS4A1_MOTION_SENSOR_LIS2DUX12_0 == 1)
 /**
-  * @brief  Register Bus IOs for LIS2DUX12 instance
-  * @param  Functions Motion sensor functions. Could be :
-  *         - MOTION_ACCELERO
+  * @brief  Register Bus IOs for LIS2DUX12 instance and start its boot
   * @retval BSP status
   */
-static int32_t LIS2DUX12_0_Probe(uint32_t Functions)
+static int32_t LIS2DUX12_0_Start(void)
 {
-  LIS2DUX12_IO_t            io_ctx;
-  uint8_t                   id;
-  static LIS2DUX12_Object_t lis2dux12_obj_0;
-  LIS2DUX12_Capabilities_t  cap;
-  int32_t                   ret = BSP_ERROR_NONE;
+  LIS2DUX12_IO_t io_ctx;
+  int32_t ret = BSP_ERROR_NONE;
 
   /* Configure the driver */
   io_ctx.BusType     = LIS2DUX12_I2C_BUS; /* I2C */
@@ -4358,7 +4573,53 @@ static int32_t LIS2DUX12_0_Probe(uint32_t Functions)
   io_ctx.GetTick     = IKS4A1_GET_TICK;
   io_ctx.Delay       = IKS4A1_DELAY;
 
-  if (LIS2DUX12_RegisterBusIO(&lis2dux12_obj_0, &io_ctx) != LIS2DUX12_OK)
+  if (LIS2DUX12_RegisterBusIO_Start(&lis2dux12_obj_0, &io_ctx) != LIS2DUX12_OK)
+  {
+    ret = BSP_ERROR_UNKNOWN_COMPONENT;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Wait for the end of the boot of LIS2DUX12 instance, started here if
+  *         IKS4A1_MOTION_SENSOR_Init_Start was not called before
+  * @retval BSP status
+  */
+static int32_t LIS2DUX12_0_Boot(void)
+{
+  uint8_t done = 0;
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (lis2dux12_obj_0.boot_pending == 0U)
+  {
+    ret = LIS2DUX12_0_Start();
+  }
+
+  while ((ret == BSP_ERROR_NONE) && (done == 0U))
+  {
+    if (LIS2DUX12_Boot_Poll(&lis2dux12_obj_0, &done) != LIS2DUX12_OK)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Register Bus IOs for LIS2DUX12 instance
+  * @param  Functions Motion sensor functions. Could be :
+  *         - MOTION_ACCELERO
+  * @retval BSP status
+  */
+static int32_t LIS2DUX12_0_Probe(uint32_t Functions)
+{
+  uint8_t                   id;
+  LIS2DUX12_Capabilities_t  cap;
+  int32_t                   ret = BSP_ERROR_NONE;
+
+  if (LIS2DUX12_0_Boot() != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_UNKNOWN_COMPONENT;
   }
@@ -4380,6 +4641,10 @@ static int32_t LIS2DUX12_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LIS2DUX12_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LIS2DUX12_0] = &lis2dux12_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lis2dux12_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LIS2DUX12_0] = &lis2dux12_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LIS2DUX12_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LIS2DUX12_COMMON_Driver;
 
@@ -4416,18 +4681,13 @@ static int32_t LIS2DUX12_0_Probe(uint32_t Functions)
 
 #if (USE_IKS4A1_MOTION_SENSOR_LIS2DUXS12_0 == 1)
 /**
-  * @brief  Register Bus IOs for LIS2DUXS12 instance
-  * @param  Functions Motion sensor functions. Could be :
-  *         - MOTION_ACCELERO
+  * @brief  Register Bus IOs for LIS2DUXS12 instance and start its boot
   * @retval BSP status
   */
-static int32_t LIS2DUXS12_0_Probe(uint32_t Functions)
+static int32_t LIS2DUXS12_0_Start(void)
 {
-  LIS2DUXS12_IO_t            io_ctx;
-  uint8_t                    id;
-  static LIS2DUXS12_Object_t lis2duxs12_obj_0;
-  LIS2DUXS12_Capabilities_t  cap;
-  int32_t                    ret = BSP_ERROR_NONE;
+  LIS2DUXS12_IO_t io_ctx;
+  int32_t ret = BSP_ERROR_NONE;
 
   /* Configure the driver */
   io_ctx.BusType     = LIS2DUXS12_I2C_BUS; /* I2C */
@@ -4439,7 +4699,53 @@ static int32_t LIS2DUXS12_0_Probe(uint32_t Functions)
   io_ctx.GetTick     = IKS4A1_GET_TICK;
   io_ctx.Delay       = IKS4A1_DELAY;
 
-  if (LIS2DUXS12_RegisterBusIO(&lis2duxs12_obj_0, &io_ctx) != LIS2DUXS12_OK)
+  if (LIS2DUXS12_RegisterBusIO_Start(&lis2duxs12_obj_0, &io_ctx) != LIS2DUXS12_OK)
+  {
+    ret = BSP_ERROR_UNKNOWN_COMPONENT;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Wait for the end of the boot of LIS2DUXS12 instance, started here if
+  *         IKS4A1_MOTION_SENSOR_Init_Start was not called before
+  * @retval BSP status
+  */
+static int32_t LIS2DUXS12_0_Boot(void)
+{
+  uint8_t done = 0;
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (lis2duxs12_obj_0.boot_pending == 0U)
+  {
+    ret = LIS2DUXS12_0_Start();
+  }
+
+  while ((ret == BSP_ERROR_NONE) && (done == 0U))
+  {
+    if (LIS2DUXS12_Boot_Poll(&lis2duxs12_obj_0, &done) != LIS2DUXS12_OK)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Register Bus IOs for LIS2DUXS12 instance
+  * @param  Functions Motion sensor functions. Could be :
+  *         - MOTION_ACCELERO
+  * @retval BSP status
+  */
+static int32_t LIS2DUXS12_0_Probe(uint32_t Functions)
+{
+  uint8_t                    id;
+  LIS2DUXS12_Capabilities_t  cap;
+  int32_t                    ret = BSP_ERROR_NONE;
+
+  if (LIS2DUXS12_0_Boot() != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_UNKNOWN_COMPONENT;
   }
@@ -4461,6 +4767,10 @@ static int32_t LIS2DUXS12_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LIS2DUXS12_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LIS2DUXS12_0] = &lis2duxs12_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lis2duxs12_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LIS2DUXS12_0] = &lis2duxs12_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LIS2DUXS12_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LIS2DUXS12_COMMON_Driver;
 
@@ -4542,6 +4852,10 @@ static int32_t LSM6DSV32X_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSV32X_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSV32X_0] = &lsm6dsv32x_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsv32x_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSV32X_0] = &lsm6dsv32x_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSV32X_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSV32X_COMMON_Driver;
 
@@ -4633,6 +4947,10 @@ static int32_t LSM6DSO16IS_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSO16IS_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSO16IS_0] = &lsm6dso16is_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dso16is_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSO16IS_0] = &lsm6dso16is_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSO16IS_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSO16IS_COMMON_Driver;
 
@@ -4722,6 +5040,10 @@ static int32_t ISM330BX_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_ISM330BX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_ISM330BX_0] = &ism330bx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism330bx_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_ISM330BX_0] = &ism330bx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_ISM330BX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM330BX_COMMON_Driver;
 
@@ -4810,6 +5132,10 @@ static int32_t LSM6DSV80X_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSV80X_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSV80X_0] = &lsm6dsv80x_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsv80x_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSV80X_0] = &lsm6dsv80x_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSV80X_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSV80X_COMMON_Driver;
 
@@ -4901,6 +5227,10 @@ static int32_t LSM6DSV320X_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_LSM6DSV320X_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_LSM6DSV320X_0] = &lsm6dsv320x_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    lsm6dsv320x_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_LSM6DSV320X_0] = &lsm6dsv320x_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_LSM6DSV320X_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&LSM6DSV320X_COMMON_Driver;
 
@@ -4947,18 +5277,13 @@ static int32_t LSM6DSV320X_0_Probe(uint32_t Functions)
 
 #if (USE_IKS4A1_MOTION_SENSOR_ST1VAFE3BX_0 == 1)
 /**
-  * @brief  Register Bus IOs for ST1VAFE3BX instance
-  * @param  Functions Motion sensor functions. Could be :
-  *         - MOTION_ACCELERO
+  * @brief  Register Bus IOs for ST1VAFE3BX instance and start its boot
   * @retval BSP status
   */
-static int32_t ST1VAFE3BX_0_Probe(uint32_t Functions)
+static int32_t ST1VAFE3BX_0_Start(void)
 {
-  ST1VAFE3BX_IO_t            io_ctx;
-  uint8_t                    id;
-  static ST1VAFE3BX_Object_t st1vafe3bx_obj_0;
-  ST1VAFE3BX_Capabilities_t  cap;
-  int32_t                    ret = BSP_ERROR_NONE;
+  ST1VAFE3BX_IO_t io_ctx;
+  int32_t ret = BSP_ERROR_NONE;
 
   /* Configure the driver */
   io_ctx.BusType     = ST1VAFE3BX_I2C_BUS; /* I2C */
@@ -4970,7 +5295,53 @@ static int32_t ST1VAFE3BX_0_Probe(uint32_t Functions)
   io_ctx.GetTick     = IKS4A1_GET_TICK;
   io_ctx.Delay       = IKS4A1_DELAY;
 
-  if (ST1VAFE3BX_RegisterBusIO(&st1vafe3bx_obj_0, &io_ctx) != ST1VAFE3BX_OK)
+  if (ST1VAFE3BX_RegisterBusIO_Start(&st1vafe3bx_obj_0, &io_ctx) != ST1VAFE3BX_OK)
+  {
+    ret = BSP_ERROR_UNKNOWN_COMPONENT;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Wait for the end of the boot of ST1VAFE3BX instance, started here if
+  *         IKS4A1_MOTION_SENSOR_Init_Start was not called before
+  * @retval BSP status
+  */
+static int32_t ST1VAFE3BX_0_Boot(void)
+{
+  uint8_t done = 0;
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (st1vafe3bx_obj_0.boot_pending == 0U)
+  {
+    ret = ST1VAFE3BX_0_Start();
+  }
+
+  while ((ret == BSP_ERROR_NONE) && (done == 0U))
+  {
+    if (ST1VAFE3BX_Boot_Poll(&st1vafe3bx_obj_0, &done) != ST1VAFE3BX_OK)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Register Bus IOs for ST1VAFE3BX instance
+  * @param  Functions Motion sensor functions. Could be :
+  *         - MOTION_ACCELERO
+  * @retval BSP status
+  */
+static int32_t ST1VAFE3BX_0_Probe(uint32_t Functions)
+{
+  uint8_t                    id;
+  ST1VAFE3BX_Capabilities_t  cap;
+  int32_t                    ret = BSP_ERROR_NONE;
+
+  if (ST1VAFE3BX_0_Boot() != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_UNKNOWN_COMPONENT;
   }
@@ -4992,6 +5363,10 @@ static int32_t ST1VAFE3BX_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_ST1VAFE3BX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_ST1VAFE3BX_0] = &st1vafe3bx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    st1vafe3bx_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_ST1VAFE3BX_0] = &st1vafe3bx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_ST1VAFE3BX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ST1VAFE3BX_COMMON_Driver;
 
@@ -5073,6 +5448,10 @@ static int32_t ST1VAFE6AX_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_ST1VAFE6AX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_ST1VAFE6AX_0] = &st1vafe6ax_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    st1vafe6ax_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_ST1VAFE6AX_0] = &st1vafe6ax_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_ST1VAFE6AX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ST1VAFE6AX_COMMON_Driver;
 
@@ -5160,6 +5539,10 @@ static int32_t MIS2DU12_0_Probe(uint32_t Functions)
     MotionCtx[IKS4A1_MIS2DU12_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS4A1_MIS2DU12_0] = &mis2du12_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    mis2du12_obj_0.BusStats.GetTime = IKS4A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS4A1_MIS2DU12_0] = &mis2du12_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS4A1_MIS2DU12_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&MIS2DU12_COMMON_Driver;
 
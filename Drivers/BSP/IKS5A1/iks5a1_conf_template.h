@@ -48,6 +48,10 @@ extern "C" {
 #define IKS5A1_GET_TICK BSP_GetTick
 #define IKS5A1_DELAY HAL_Delay
 
+/* Bus statistics time source, used only if USE_MEMS_BUS_STATS is defined to 1U:
+   a free running microsecond or cycle counter, bus time is not measured if not defined */
+/* #define IKS5A1_BUS_STATS_GET_TIME BSP_GetBusStatsTime */
+
 #ifdef __cplusplus
 }
 #endif
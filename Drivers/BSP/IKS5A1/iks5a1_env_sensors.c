@@ -55,6 +55,9 @@ static uint32_t FunctionIndex[] = {0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
 static ENV_SENSOR_FuncDrv_t *EnvFuncDrv[IKS5A1_ENV_INSTANCES_NBR][IKS5A1_ENV_FUNCTIONS_NBR];
 static ENV_SENSOR_CommonDrv_t *EnvDrv[IKS5A1_ENV_INSTANCES_NBR];
 static IKS5A1_ENV_SENSOR_Ctx_t EnvCtx[IKS5A1_ENV_INSTANCES_NBR];
+#if (USE_MEMS_BUS_STATS == 1U)
+static MEMS_BusStats_t *EnvBusStats[IKS5A1_ENV_INSTANCES_NBR];
+#endif /* USE_MEMS_BUS_STATS */
 
 /**
   * @}
@@ -457,6 +460,43 @@ int32_t IKS5A1_ENV_SENSOR_GetValue(uint32_t Instance, uint32_t Function, float_t
   return ret;
 }
 
+#if (USE_MEMS_BUS_STATS == 1U)
+/**
+  * @brief  Get the bus transaction statistics of all the instances and reset them
+  * @param  Stats array of IKS5A1_ENV_INSTANCES_NBR statistics, zeroed for the instances not initialized
+  * @retval BSP status
+  */
+int32_t IKS5A1_ENV_SENSOR_SnapshotBusStats(MEMS_BusStats_t *Stats)
+{
+  MEMS_BusStats_GetTime_Func get_time;
+  uint32_t i;
+
+  if (Stats == NULL)
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  for (i = 0; i < IKS5A1_ENV_INSTANCES_NBR; i++)
+  {
+    if (EnvBusStats[i] == NULL)
+    {
+      (void)memset(&Stats[i], 0, sizeof(MEMS_BusStats_t));
+    }
+    else
+    {
+      Stats[i] = *EnvBusStats[i];
+
+      /* The timestamp hook is kept */
+      get_time = EnvBusStats[i]->GetTime;
+      (void)memset(EnvBusStats[i], 0, sizeof(MEMS_BusStats_t));
+      EnvBusStats[i]->GetTime = get_time;
+    }
+  }
+
+  return BSP_ERROR_NONE;
+}
+#endif /* USE_MEMS_BUS_STATS */
+
 /**
   * @}
   */
@@ -512,6 +552,10 @@ static int32_t ILPS22QS_0_Probe(uint32_t Functions)
                                         | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS5A1_ILPS22QS_0] = &ilps22qs_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ilps22qs_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS5A1_ILPS22QS_0] = &ilps22qs_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS5A1_ILPS22QS_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&ILPS22QS_COMMON_Driver;
 
@@ -606,6 +650,10 @@ static int32_t SHT40AD1B_0_Probe(uint32_t Functions)
                                          | ((uint32_t)cap.Gas      << 3);
 
     EnvCompObj[IKS5A1_SHT40AD1B_0] = &sht40ad1b_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    sht40ad1b_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    EnvBusStats[IKS5A1_SHT40AD1B_0] = &sht40ad1b_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     EnvDrv[IKS5A1_SHT40AD1B_0] = (ENV_SENSOR_CommonDrv_t *)(void *)&SHT40AD1B_COMMON_Driver;
 
@@ -54,6 +54,12 @@ static uint32_t FunctionIndex[] = {0, 0, 1, 1, 2, 2, 2, 2};
 static MOTION_SENSOR_FuncDrv_t *MotionFuncDrv[IKS5A1_MOTION_INSTANCES_NBR][IKS5A1_MOTION_FUNCTIONS_NBR];
 static MOTION_SENSOR_CommonDrv_t *MotionDrv[IKS5A1_MOTION_INSTANCES_NBR];
 static IKS5A1_MOTION_SENSOR_Ctx_t MotionCtx[IKS5A1_MOTION_INSTANCES_NBR];
+#if (USE_MEMS_BUS_STATS == 1U)
+static MEMS_BusStats_t *MotionBusStats[IKS5A1_MOTION_INSTANCES_NBR];
+#endif /* USE_MEMS_BUS_STATS */
+#if (USE_IKS5A1_MOTION_SENSOR_IIS2DULPX_0 == 1)
+static IIS2DULPX_Object_t iis2dulpx_obj_0;
+#endif
 
 /**
   * @}
@@ -73,6 +79,8 @@ static int32_t ISM330IS_0_Probe(uint32_t Functions);
 
 #if (USE_IKS5A1_MOTION_SENSOR_IIS2DULPX_0 == 1)
 static int32_t IIS2DULPX_0_Probe(uint32_t Functions);
+static int32_t IIS2DULPX_0_Start(void);
+static int32_t IIS2DULPX_0_Boot(void);
 #endif
 
 #if (USE_IKS5A1_MOTION_SENSOR_IIS2MDC_0 == 1)
@@ -434,6 +442,35 @@ int32_t IKS5A1_MOTION_SENSOR_Init(uint32_t Instance, uint32_t Functions)
   return ret;
 }
 
+/**
+  * @brief  Starts the boot of a motion sensor, completed by IKS5A1_MOTION_SENSOR_Init
+  * @param  Instance Motion sensor instance
+  * @retval BSP status
+  * @note   The sensors exiting from deep power down need a boot time before the first
+  *         access. Started for all the sensors first, the boot times run together and
+  *         along with the init of the other sensors, instead of one after the other.
+  *         Nothing is done for the sensors without a boot time.
+  */
+int32_t IKS5A1_MOTION_SENSOR_Init_Start(uint32_t Instance)
+{
+  int32_t ret;
+
+  switch (Instance)
+  {
+#if (USE_IKS5A1_MOTION_SENSOR_IIS2DULPX_0 == 1)
+    case IKS5A1_IIS2DULPX_0:
+      ret = IIS2DULPX_0_Start();
+      break;
+#endif
+
+    default:
+      ret = (Instance < IKS5A1_MOTION_INSTANCES_NBR) ? BSP_ERROR_NONE : BSP_ERROR_WRONG_PARAM;
+      break;
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Deinitialize Motion sensor
   * @param  Instance Motion sensor instance
@@ -872,6 +909,43 @@ int32_t IKS5A1_MOTION_SENSOR_SetFullScale(uint32_t Instance, uint32_t Function,
   return ret;
 }
 
+#if (USE_MEMS_BUS_STATS == 1U)
+/**
+  * @brief  Get the bus transaction statistics of all the instances and reset them
+  * @param  Stats array of IKS5A1_MOTION_INSTANCES_NBR statistics, zeroed for the instances not initialized
+  * @retval BSP status
+  */
+int32_t IKS5A1_MOTION_SENSOR_SnapshotBusStats(MEMS_BusStats_t *Stats)
+{
+  MEMS_BusStats_GetTime_Func get_time;
+  uint32_t i;
+
+  if (Stats == NULL)
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  for (i = 0; i < IKS5A1_MOTION_INSTANCES_NBR; i++)
+  {
+    if (MotionBusStats[i] == NULL)
+    {
+      (void)memset(&Stats[i], 0, sizeof(MEMS_BusStats_t));
+    }
+    else
+    {
+      Stats[i] = *MotionBusStats[i];
+
+      /* The timestamp hook is kept */
+      get_time = MotionBusStats[i]->GetTime;
+      (void)memset(MotionBusStats[i], 0, sizeof(MEMS_BusStats_t));
+      MotionBusStats[i]->GetTime = get_time;
+    }
+  }
+
+  return BSP_ERROR_NONE;
+}
+#endif /* USE_MEMS_BUS_STATS */
+
 /**
   * @}
   */
@@ -927,6 +1001,10 @@ static int32_t ISM6HG256X_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_ISM6HG256X_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_ISM6HG256X_0] = &ism6hg256x_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism6hg256x_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_ISM6HG256X_0] = &ism6hg256x_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_ISM6HG256X_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM6HG256X_COMMON_Driver;
 
@@ -1016,6 +1094,10 @@ static int32_t ISM330IS_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_ISM330IS_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_ISM330IS_0] = &ism330is_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism330is_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_ISM330IS_0] = &ism330is_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_ISM330IS_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM330IS_COMMON_Driver;
 
@@ -1059,18 +1141,13 @@ static int32_t ISM330IS_0_Probe(uint32_t Functions)
 
 #if (USE_IKS5A1_MOTION_SENSOR_IIS2DULPX_0 == 1)
 /**
-  * @brief  Register Bus IOs for IIS2DULPX instance
-  * @param  Functions Motion sensor functions. Could be :
-  *         - MOTION_ACCELERO
+  * @brief  Register Bus IOs for IIS2DULPX instance and start its boot
   * @retval BSP status
   */
-static int32_t IIS2DULPX_0_Probe(uint32_t Functions)
+static int32_t IIS2DULPX_0_Start(void)
 {
-  IIS2DULPX_IO_t            io_ctx;
-  uint8_t                   id;
-  static IIS2DULPX_Object_t iis2dulpx_obj_0;
-  IIS2DULPX_Capabilities_t  cap;
-  int32_t                   ret = BSP_ERROR_NONE;
+  IIS2DULPX_IO_t io_ctx;
+  int32_t ret = BSP_ERROR_NONE;
 
   /* Configure the driver */
   io_ctx.BusType  = IIS2DULPX_I2C_BUS; /* I2C */
@@ -1082,7 +1159,53 @@ static int32_t IIS2DULPX_0_Probe(uint32_t Functions)
   io_ctx.GetTick  = IKS5A1_GET_TICK;
   io_ctx.Delay    = IKS5A1_DELAY;
 
-  if (IIS2DULPX_RegisterBusIO(&iis2dulpx_obj_0, &io_ctx) != IIS2DULPX_OK)
+  if (IIS2DULPX_RegisterBusIO_Start(&iis2dulpx_obj_0, &io_ctx) != IIS2DULPX_OK)
+  {
+    ret = BSP_ERROR_UNKNOWN_COMPONENT;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Wait for the end of the boot of IIS2DULPX instance, started here if
+  *         IKS5A1_MOTION_SENSOR_Init_Start was not called before
+  * @retval BSP status
+  */
+static int32_t IIS2DULPX_0_Boot(void)
+{
+  uint8_t done = 0;
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (iis2dulpx_obj_0.boot_pending == 0U)
+  {
+    ret = IIS2DULPX_0_Start();
+  }
+
+  while ((ret == BSP_ERROR_NONE) && (done == 0U))
+  {
+    if (IIS2DULPX_Boot_Poll(&iis2dulpx_obj_0, &done) != IIS2DULPX_OK)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Register Bus IOs for IIS2DULPX instance
+  * @param  Functions Motion sensor functions. Could be :
+  *         - MOTION_ACCELERO
+  * @retval BSP status
+  */
+static int32_t IIS2DULPX_0_Probe(uint32_t Functions)
+{
+  uint8_t                   id;
+  IIS2DULPX_Capabilities_t  cap;
+  int32_t                   ret = BSP_ERROR_NONE;
+
+  if (IIS2DULPX_0_Boot() != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_UNKNOWN_COMPONENT;
   }
@@ -1100,6 +1223,10 @@ static int32_t IIS2DULPX_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_IIS2DULPX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_IIS2DULPX_0] = &iis2dulpx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2dulpx_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_IIS2DULPX_0] = &iis2dulpx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_IIS2DULPX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2DULPX_COMMON_Driver;
 
@@ -1177,6 +1304,10 @@ static int32_t IIS2MDC_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_IIS2MDC_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_IIS2MDC_0] = &iis2mdc_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2mdc_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_IIS2MDC_0] = &iis2mdc_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_IIS2MDC_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2MDC_COMMON_Driver;
 
@@ -1254,6 +1385,10 @@ static int32_t AIS2IH_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_AIS2IH_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_AIS2IH_0] = &ais2ih_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ais2ih_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_AIS2IH_0] = &ais2ih_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_AIS2IH_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&AIS2IH_COMMON_Driver;
 
@@ -1335,6 +1470,10 @@ static int32_t ASM330LHHX_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_ASM330LHHX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_ASM330LHHX_0] = &asm330lhhx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    asm330lhhx_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_ASM330LHHX_0] = &asm330lhhx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_ASM330LHHX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ASM330LHHX_COMMON_Driver;
 
@@ -1422,6 +1561,10 @@ static int32_t IIS2DLPC_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_IIS2DLPC_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_IIS2DLPC_0] = &iis2dlpc_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2dlpc_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_IIS2DLPC_0] = &iis2dlpc_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_IIS2DLPC_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2DLPC_COMMON_Driver;
 
@@ -1503,6 +1646,10 @@ static int32_t IIS2ICLX_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_IIS2ICLX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_IIS2ICLX_0] = &iis2iclx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    iis2iclx_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_IIS2ICLX_0] = &iis2iclx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_IIS2ICLX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&IIS2ICLX_COMMON_Driver;
 
@@ -1582,6 +1729,10 @@ static int32_t ISM330BX_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_ISM330BX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_ISM330BX_0] = &ism330bx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism330bx_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_ISM330BX_0] = &ism330bx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_ISM330BX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM330BX_COMMON_Driver;
 
@@ -1670,6 +1821,10 @@ static int32_t ISM330DHCX_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_ISM330DHCX_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_ISM330DHCX_0] = &ism330dhcx_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    ism330dhcx_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_ISM330DHCX_0] = &ism330dhcx_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_ISM330DHCX_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&ISM330DHCX_COMMON_Driver;
 
@@ -1757,6 +1912,10 @@ static int32_t MIS2DU12_0_Probe(uint32_t Functions)
     MotionCtx[IKS5A1_MIS2DU12_0].Functions = ((uint32_t)cap.Gyro) | ((uint32_t)cap.Acc << 1) | ((uint32_t)cap.Magneto << 2);
 
     MotionCompObj[IKS5A1_MIS2DU12_0] = &mis2du12_obj_0;
+#if (USE_MEMS_BUS_STATS == 1U)
+    mis2du12_obj_0.BusStats.GetTime = IKS5A1_BUS_STATS_GET_TIME;
+    MotionBusStats[IKS5A1_MIS2DU12_0] = &mis2du12_obj_0.BusStats;
+#endif /* USE_MEMS_BUS_STATS */
     /* The second cast (void *) is added to bypass Misra R11.3 rule */
     MotionDrv[IKS5A1_MIS2DU12_0] = (MOTION_SENSOR_CommonDrv_t *)(void *)&MIS2DU12_COMMON_Driver;
 
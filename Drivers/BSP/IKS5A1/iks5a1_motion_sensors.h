@@ -300,6 +300,7 @@ typedef struct
   */
 
 int32_t IKS5A1_MOTION_SENSOR_Init(uint32_t Instance, uint32_t Functions);
+int32_t IKS5A1_MOTION_SENSOR_Init_Start(uint32_t Instance);
 int32_t IKS5A1_MOTION_SENSOR_DeInit(uint32_t Instance);
 int32_t IKS5A1_MOTION_SENSOR_GetCapabilities(uint32_t Instance, IKS5A1_MOTION_SENSOR_Capabilities_t *Capabilities);
 int32_t IKS5A1_MOTION_SENSOR_ReadID(uint32_t Instance, uint8_t *Id);
@@ -312,6 +313,12 @@ int32_t IKS5A1_MOTION_SENSOR_GetOutputDataRate(uint32_t Instance, uint32_t Funct
 int32_t IKS5A1_MOTION_SENSOR_SetOutputDataRate(uint32_t Instance, uint32_t Function, float_t Odr);
 int32_t IKS5A1_MOTION_SENSOR_GetFullScale(uint32_t Instance, uint32_t Function, int32_t *Fullscale);
 int32_t IKS5A1_MOTION_SENSOR_SetFullScale(uint32_t Instance, uint32_t Function, int32_t Fullscale);
+#if (USE_MEMS_BUS_STATS == 1U)
+#ifndef IKS5A1_BUS_STATS_GET_TIME
+#define IKS5A1_BUS_STATS_GET_TIME  NULL /* Timestamp hook of the bus transaction statistics */
+#endif /* IKS5A1_BUS_STATS_GET_TIME */
+int32_t IKS5A1_MOTION_SENSOR_SnapshotBusStats(MEMS_BusStats_t *Stats);
+#endif /* USE_MEMS_BUS_STATS */
 
 /**
   * @}
@@ -28,7 +28,11 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include "MotionSP_Config.h"
+#ifdef MOTIONSP_PORTABLE_DSP
+#include "MotionSP_PortableDsp.h"
+#else
 #include "arm_math.h"
+#endif /* MOTIONSP_PORTABLE_DSP */
 
 /** @addtogroup MIDDLEWARES Middlewares
   * @{
@@ -256,6 +260,124 @@ typedef struct
   } FFT_Items;                  //!< FFT counter to build the FFT Average
 } sAccMagResults_t;
 
+/**
+  * @brief  Time domain filter states
+  */
+typedef struct
+{
+  SensorVal_f_t AccDcDstPre;    //!< Previous output of the accelerometer DC removal filter
+  SensorVal_f_t AccDcSrcPre;    //!< Previous input of the accelerometer DC removal filter
+  SensorVal_f_t Speed;          //!< X-Y-Z Speed from acceleration
+  SensorVal_f_t SpeedDcDstPre;  //!< Previous output of the speed DC removal filter
+  SensorVal_f_t SpeedDcSrcPre;  //!< Previous input of the speed DC removal filter
+  SensorVal_f_t SpeedNoDc;      //!< X-Y-Z Speed from acceleration without DC
+  float SpeedRmsWN;             //!< Weight of the speed moving RMS filter
+  float AccRmsWN;               //!< Weight of the accelerometer moving RMS filter
+} sTimeDomainState_t;
+
+/**
+  * @brief  X-Y-Z statistical features evaluated over the FFT window
+  */
+typedef struct
+{
+  SensorVal_f_t Rms;          //!< X-Y-Z RMS without DC
+  SensorVal_f_t Peak;         //!< X-Y-Z Peak without DC
+  SensorVal_f_t CrestFactor;  //!< X-Y-Z Crest factor (Peak / RMS)
+  SensorVal_f_t Kurtosis;     //!< X-Y-Z Kurtosis (3 for a gaussian signal)
+} sFrameFeatures_t;
+
+/**
+  * @brief  Envelope (demodulated) spectrum structure
+  */
+typedef struct
+{
+  uint16_t FftSize;                         //!< Envelope FFT size (FftSize / Decimation), 0 if disabled
+  uint16_t Decimation;                      //!< Decimation factor of the envelope signal
+  float BinFreqStep;                        //!< Envelope spectrum bin frequency increment
+  arm_rfft_fast_instance_f32 FftS;          //!< Instance structure for the envelope RFFT
+  arm_biquad_casd_df1_inst_f32 BandPass;    //!< Band-pass filter (high-pass and low-pass stages)
+  arm_biquad_casd_df1_inst_f32 LowPass;     //!< Envelope low-pass and anti-aliasing filter
+  float BandPassCoeffs[2 * 5];              //!< Band-pass filter coefficients
+  float BandPassState[2 * 4];               //!< Band-pass filter state
+  float LowPassCoeffs[2 * 5];               //!< Low-pass filter coefficients
+  float LowPassState[2 * 4];                //!< Low-pass filter state
+  float *pIn;                               //!< Decimated envelope (FftSize elements)
+  sAxisArray_t Mag;                         //!< Envelope spectrum amplitude (FftSize/2 elements for each axis)
+  struct
+  {
+    sMaxOnArray_t X;
+    sMaxOnArray_t Y;
+    sMaxOnArray_t Z;
+  } Max;                                    //!< Max value inside the envelope spectrum
+} sEnvelope_t;
+
+/**
+  * @brief  Number of floats to be supplied to MotionSP_CtxEnvelopeInit
+  * @param  fft_size FFT size
+  * @param  decimation decimation factor of the envelope signal
+  */
+#define MOTIONSP_ENV_MEM_SIZE(fft_size, decimation)  (((uint32_t)(fft_size) / (decimation)) + \
+                                                      (NUM_AXES * ((uint32_t)(fft_size) / (decimation) / 2U)))
+
+/**
+  * @brief  Goertzel filter for one tone
+  */
+typedef struct
+{
+  float Freq;               //!< Tone frequency in Hz
+  float Coeff;              //!< Goertzel coefficient 2*cos(2*PI*Freq/ODR)
+  SensorVal_f_t S1;         //!< X-Y-Z Goertzel state s[n-1]
+  SensorVal_f_t S2;         //!< X-Y-Z Goertzel state s[n-2]
+  SensorVal_f_t Amplitude;  //!< X-Y-Z Tone amplitude of the last evaluated block
+} sTone_t;
+
+/**
+  * @brief  Goertzel filter bank for targeted frequency monitoring
+  */
+typedef struct
+{
+  uint8_t Num;                          //!< Number of tracked tones, 0 if disabled
+  uint8_t Ready;                        //!< New amplitudes are available
+  uint16_t BlockSize;                   //!< Number of samples for each evaluation
+  uint16_t Count;                       //!< Number of samples of the current block
+  sTone_t Tone[TONE_BANK_SIZE_MAX];     //!< Tracked tones
+} sToneBank_t;
+
+/**
+  * @brief  Number of floats to be supplied to MotionSP_CtxInit
+  * @param  fft_size FFT size
+  * @param  circ_size circular buffer size for each axis
+  */
+#define MOTIONSP_CTX_MEM_SIZE(fft_size, circ_size)  ((NUM_AXES * (uint32_t)(circ_size)) + (3U * (uint32_t)(fft_size)) + \
+                                                     (NUM_AXES * ((uint32_t)(fft_size) / 2U)))
+
+/**
+  * @brief  Motion Signal Processing context, one for each analyzed sensor
+  */
+typedef struct
+{
+  sMotionSP_Parameter_t Parameters;   //!< Algorithm parameters
+  sAcceleroODR_t AcceleroODR;         //!< Real accelerometer ODR
+  sCircBuff_t AccCircBuff;            //!< Circular buffer for storing input values for FFT
+  uint16_t CircBuffIndexForFft;       //!< Position index in circular buffer to perform FFT
+  sAcceleroParam_t TimeDomain;        //!< Time domain results
+  sTimeDomainState_t TdState;         //!< Time domain filter states
+  arm_rfft_fast_instance_f32 FftS;    //!< Instance structure for the floating-point RFFT/RIFFT function
+  float *pWindow;                     //!< Window filter parameters (FftSize elements)
+  float WindowScaleFactor;            //!< Scale factor to correct amplitude
+  float *pFftIn;                      //!< FFT input and magnitude output (FftSize elements)
+  float *pFftTmp;                     //!< FFT complex output (FftSize elements)
+  uint16_t MagSize;                   //!< Number of FFT magnitude elements
+  sAxisArray_t AvgMag;                //!< Magnitude average values (MagSize elements for each axis)
+  sSumCnt_t SumCnt;                   //!< Sum counter for FFT during averaging
+  sAxesMagResults_t MagResults;       //!< FFT peak results
+  uint8_t AvgRdy;                     //!< Axes whose average is available (bit 0 X, bit 1 Y, bit 2 Z)
+  uint8_t FeaturesEn;                 //!< Statistical features evaluated (1) or not (0), see MotionSP_CtxFeaturesEnable
+  sFrameFeatures_t Features;          //!< Statistical features of the last FFT window
+  sEnvelope_t Envelope;               //!< Envelope spectrum of the last FFT window
+  sToneBank_t ToneBank;               //!< Goertzel bank updated by the time domain processing
+} MotionSP_Ctx_t;
+
 #ifdef USE_SUBRANGE
 typedef struct {
   float AXIS_X[SUBRANGE_MAX];   //!< X Array Subrange datatype
@@ -275,6 +397,8 @@ typedef struct {
 void MotionSP_accDelOffset(SensorVal_f_t *pDstArr, SensorVal_f_t *pSrcArr, float Smooth, uint16_t Restart);
 void MotionSP_CreateAccCircBuffer(sCircBuffer_t *pCircBuff, SensorVal_f_t buffType);
 void MotionSP_TimeDomainProcess(sAcceleroParam_t *sTimeDomain, Td_Type_t td_type, uint8_t Restart);
+uint16_t MotionSP_TimeDomainProcessBlock(sAcceleroParam_t *pTimeDomain, sCircBuffer_t *pCircBuff, const SensorVal_f_t *pSamples,
+                                         uint16_t Samples, Td_Type_t td_type, uint8_t Restart);
 
 void MotionSP_fftCalc(arm_rfft_fast_instance_f32 *pfftS, float *pfftIn, float *pfftOut);
 void MotionSP_fftAdapt(sAxesMagBuff_t *pfftCmplxMag, uint16_t size);
@@ -292,10 +416,22 @@ void MotionSP_fftAdapting(sAccMagResults_t *pAccMagResults, float WSF);
 void MotionSP_fftPeakFinding(sAccMagResults_t *pAccMagResults);
 void MotionSP_fftExecution(uint8_t avg);
 
+uint8_t MotionSP_CtxInit(MotionSP_Ctx_t *pCtx, float *pMem, uint32_t MemSize, uint16_t FftSize, uint16_t CircSize);
+void MotionSP_CtxReset(MotionSP_Ctx_t *pCtx);
+void MotionSP_CtxSetWindow(MotionSP_Ctx_t *pCtx, Filt_Type_t Ftype);
+void MotionSP_CtxSetOdr(MotionSP_Ctx_t *pCtx, float Frequency);
+uint16_t MotionSP_CtxTimeDomainProcessBlock(MotionSP_Ctx_t *pCtx, const SensorVal_f_t *pSamples, uint16_t Samples, uint8_t Restart);
+uint8_t MotionSP_CtxFrequencyDomainProcess(MotionSP_Ctx_t *pCtx, uint8_t FinishAvg);
+uint8_t MotionSP_CtxToneBankInit(MotionSP_Ctx_t *pCtx, const float *pFreq, uint8_t Num, uint16_t BlockSize);
+uint8_t MotionSP_CtxEnvelopeInit(MotionSP_Ctx_t *pCtx, float *pMem, uint32_t MemSize, float BandLow, float BandHigh, uint16_t Decimation);
+void MotionSP_CtxFeaturesEnable(MotionSP_Ctx_t *pCtx, uint8_t Enable);
+void MotionSP_FeaturesEnable(uint8_t Enable);
+
 sAcceleroODR_t *MotionSP_GetRealAcceleroOdr(void);
 sMotionSP_Parameter_t *MotionSP_GetParameters(void);
 sAccMagResults_t *MotionSP_GetAccMagResults(void);
 sTimeDomainData_t *MotionSP_GetTimeDomainData(void);
+sFrameFeatures_t *MotionSP_GetFrameFeatures(void);
 
 /**
   * @}
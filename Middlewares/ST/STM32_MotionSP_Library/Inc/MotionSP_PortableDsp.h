@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file           : MotionSP_PortableDsp.h
+  * @author         : System Research & Applications Team - Catania Lab
+  * @version        : v2.2.2
+  * @date           : 20-Nov-2024
+  * @brief          : Portable reference implementation of the CMSIS-DSP subset
+  *                   used by MotionSP (host builds only)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018-2019 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MOTIONSP_PORTABLEDSP_H
+#define __MOTIONSP_PORTABLEDSP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/** @addtogroup MIDDLEWARES Middlewares
+  * @{
+  */
+
+/** @addtogroup ST ST
+  * @{
+  */
+
+/** @addtogroup STM32_MOTIONSP_LIB STM32 Motion Signal Processing Library
+  * @{
+  */
+
+/** @addtogroup STM32_MOTIONSP_LIB_PORTABLE_DSP STM32 Motion Signal Processing Library Portable DSP
+  * @brief  Drop-in replacement for the CMSIS-DSP kernels used by MotionSP.
+  *         Selected by defining MOTIONSP_PORTABLE_DSP at build time, so that
+  *         the library can be built and profiled on a host without the
+  *         target CMSIS-DSP archives. Names, types and packing conventions
+  *         mirror arm_math.h; accuracy is reference grade, not speed tuned.
+  * @{
+  */
+
+/** @addtogroup STM32_MOTIONSP_LIB_PORTABLE_DSP_EXPORTED_TYPES STM32 Motion Signal Processing Library Portable DSP Exported Types
+  * @{
+  */
+
+#ifndef PI
+#define PI               3.14159265358979f
+#endif
+
+typedef float float32_t;
+
+/**
+  * @brief  Error status returned by some functions
+  */
+typedef enum
+{
+  ARM_MATH_SUCCESS        =  0,        //!< No error
+  ARM_MATH_ARGUMENT_ERROR = -1,        //!< One or more arguments are incorrect
+  ARM_MATH_LENGTH_ERROR   = -2,        //!< Length of data buffer is incorrect
+} arm_status;
+
+/**
+  * @brief  Instance structure for the floating-point real FFT
+  */
+typedef struct
+{
+  uint16_t fftLenRFFT;                 //!< Length of the real sequence
+} arm_rfft_fast_instance_f32;
+
+/**
+  * @brief  Instance structure for the floating-point Biquad cascade filter
+  */
+typedef struct
+{
+  uint32_t numStages;                  //!< Number of 2nd order stages in the filter
+  float32_t *pState;                   //!< Points to the state array, 4*numStages long
+  const float32_t *pCoeffs;            //!< Points to the coefficients array, 5*numStages long
+} arm_biquad_casd_df1_inst_f32;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32_MOTIONSP_LIB_PORTABLE_DSP_EXPORTED_FUNCTIONS STM32 Motion Signal Processing Library Portable DSP Exported Functions
+  * @{
+  */
+
+/* Exported functions ------------------------------------------------------- */
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen);
+void arm_rfft_fast_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag);
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+void arm_mult_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+void arm_abs_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_scale_f32(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize);
+void arm_offset_f32(const float32_t *pSrc, float32_t offset, float32_t *pDst, uint32_t blockSize);
+void arm_mean_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult);
+void arm_max_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult, uint32_t *pIndex);
+void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32 *S, uint8_t numStages,
+                                     const float32_t *pCoeffs, float32_t *pState);
+void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32 *S, const float32_t *pSrc,
+                                float32_t *pDst, uint32_t blockSize);
+float32_t arm_sin_f32(float32_t x);
+float32_t arm_cos_f32(float32_t x);
+arm_status arm_sqrt_f32(float32_t in, float32_t *pOut);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MOTIONSP_PORTABLEDSP_H */
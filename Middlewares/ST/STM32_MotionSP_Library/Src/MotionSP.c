@@ -34,6 +34,31 @@
   * @{
   */
 
+/** @addtogroup STM32_MOTIONSP_LIB_PRIVATE_TYPES STM32 Motion Signal Processing Library Private Types
+  * @{
+  */
+
+/**
+  * @brief  Time domain filter states of a single axis, held in registers by the block processing
+  */
+typedef struct
+{
+  float AccDcDstPre;      //!< Previous output of the accelerometer DC removal filter
+  float AccDcSrcPre;      //!< Previous input of the accelerometer DC removal filter
+  float AccPre;           //!< Previous acceleration, for the speed integration
+  float Speed;            //!< Speed from acceleration
+  float SpeedDcDstPre;    //!< Previous output of the speed DC removal filter
+  float SpeedDcSrcPre;    //!< Previous input of the speed DC removal filter
+  float SpeedNoDc;        //!< Speed from acceleration without DC
+  float SpeedRms;         //!< Speed Fast Moving RMS
+  float AccRms;           //!< Accelerometer Fast Moving RMS
+  float AccPeak;          //!< Accelerometer Peak
+} sTD_Axis_t;
+
+/**
+  * @}
+  */
+
 /** @addtogroup STM32_MOTIONSP_LIB_PUBLIC_VARIABLES STM32 Motion Signal Processing Library Public Variables
   * @{
   */
@@ -70,8 +95,21 @@ sSubrange_t SRBinVal;                           //!< X-Y-Z Threshold Bin Frequen
   */
 
 sAxesMagBuff_t AccAxesAvgMagBuff;               //!< Array for storing accelerometer magnitude average values
-static SensorVal_f_t SpeedTimeDomain;           //!< Time Domain Speed Arrays to use during integration
-static SensorVal_f_t SpeedTimeDomain_noDC;      //!< Time Domain Speed Arrays without DC Offset to use during integration
+static float LegacyFftIn[FFT_SIZE_MAX];         //!< FFT input and magnitude output of the global API
+static float LegacyFftTmp[FFT_SIZE_MAX];        //!< FFT complex output of the global API
+
+/**
+  * @brief  Context of the global API, bound to the public variables
+  */
+static MotionSP_Ctx_t LegacyCtx =
+{
+  .AccCircBuff = {.Array = {.X = AccCircBuffer.Data.AXIS_X, .Y = AccCircBuffer.Data.AXIS_Y, .Z = AccCircBuffer.Data.AXIS_Z}},
+  .pWindow = Filter_Params,
+  .pFftIn = LegacyFftIn,
+  .pFftTmp = LegacyFftTmp,
+  .AvgMag = {.X = AccAxesAvgMagBuff.AXIS_X, .Y = AccAxesAvgMagBuff.AXIS_Y, .Z = AccAxesAvgMagBuff.AXIS_Z},
+  .FeaturesEn = 0,                              /* Enabled only by MotionSP_FeaturesEnable */
+};
 
 /**
   * @}
@@ -86,6 +124,19 @@ static void MotionSP_evalSpeedFromAccelero(SensorVal_f_t *pDstArr, sCircBuffer_t
 static void MotionSP_SwSpeedRmsFilter(SensorVal_f_t *pDstArr, SensorVal_f_t *pSrcArr, float ExpTau, uint8_t start);
 static void MotionSP_SwAccRmsFilter(SensorVal_f_t *pDstArr, sCircBuffer_t *pSrcArr, float Lambda, uint8_t start);
 static void MotionSP_SwAccPkEval(SensorVal_f_t *pDstArr, sCircBuffer_t *pSrcArr);
+static inline void MotionSP_TD_AxisStep(sTD_Axis_t *pAx, float *pCirc, float In, float kPre, float kCurr,
+                                        float SpeedInvWN, float AccInvWN, uint8_t DoSpeed, uint8_t DoAcc);
+static uint16_t MotionSP_TD_Block(sTimeDomainState_t *pTd, sAcceleroParam_t *pTimeDomain, const sAxisArray_t *pCirc,
+                                  uint16_t CircSize, uint16_t *pIdPos, uint8_t *pOvf, const sAcceleroODR_t *pAccOdr,
+                                  Td_Type_t td_type, const SensorVal_f_t *pSamples, uint16_t Samples, uint8_t Restart);
+static void MotionSP_WindowCoeffsSet(float *pCoeffs, uint16_t size, Filt_Type_t Ftype, float *pScaleFactor);
+static void MotionSP_MagAdapt(float *pMag, uint16_t size, float WSF);
+static void MotionSP_FeaturesEval(const float *pData, uint16_t size, float *pRms, float *pPeak, float *pCrest, float *pKurt);
+static void MotionSP_BiquadCoeffsSet(float *pCoeffs, float Fc, float Fs, uint8_t HighPass);
+static void MotionSP_EnvelopeEval(sEnvelope_t *pEnv, const float *pFrame, uint16_t FrameSize, float *pScratch, float *pMag);
+static void MotionSP_GoertzelRun(const float *pData, uint16_t Samples, float Coeff, float *pS1, float *pS2);
+static float MotionSP_GoertzelAmplitude(float Coeff, float *pS1, float *pS2, uint16_t BlockSize);
+static void MotionSP_ToneBankUpdate(sToneBank_t *pBank, const float *pX, const float *pY, const float *pZ, uint16_t Samples);
 
 static void MotionSP_TD_PeakEvalFromCircBuff(sTimeDomainData_t *pDst, sCircBuff_t *pSrc, uint16_t SrcId);
 static void MotionSP_TD_SpeedEvalFromCircBuff(sTimeDomainData_t *pDst, sCircBuff_t *pSrc, uint16_t SrcId, sAcceleroODR_t  AccOdr, uint8_t Rst);
@@ -101,32 +152,32 @@ static void MotionSP_TD_AccRmsEvalFromCircBuff(sTimeDomainData_t *pDst, sCircBuf
   */
 static void MotionSP_speedDelOffset(SensorVal_f_t *pDstArr, SensorVal_f_t *pSrcArr, float Smooth, uint8_t Restart)
 {
-  static SensorVal_f_t DstArrPre;
-  static SensorVal_f_t SrcArrPre;
-  
+  SensorVal_f_t *pDstArrPre = &LegacyCtx.TdState.SpeedDcDstPre;
+  SensorVal_f_t *pSrcArrPre = &LegacyCtx.TdState.SpeedDcSrcPre;
+
   if (Restart == 1)
   {
     pDstArr->AXIS_X = 0.0;
     pDstArr->AXIS_Y = 0.0;
     pDstArr->AXIS_Z = 0.0;
-    DstArrPre.AXIS_X = pSrcArr->AXIS_X;
-    DstArrPre.AXIS_Y = pSrcArr->AXIS_Y;
-    DstArrPre.AXIS_Z = pSrcArr->AXIS_Z;
-    SrcArrPre.AXIS_X = pSrcArr->AXIS_X;
-    SrcArrPre.AXIS_Y = pSrcArr->AXIS_Y;
-    SrcArrPre.AXIS_Z = pSrcArr->AXIS_Z;
+    pDstArrPre->AXIS_X = pSrcArr->AXIS_X;
+    pDstArrPre->AXIS_Y = pSrcArr->AXIS_Y;
+    pDstArrPre->AXIS_Z = pSrcArr->AXIS_Z;
+    pSrcArrPre->AXIS_X = pSrcArr->AXIS_X;
+    pSrcArrPre->AXIS_Y = pSrcArr->AXIS_Y;
+    pSrcArrPre->AXIS_Z = pSrcArr->AXIS_Z;
   }
   else
   {
-    pDstArr->AXIS_X = (Smooth * DstArrPre.AXIS_X) + Smooth * (pSrcArr->AXIS_X - SrcArrPre.AXIS_X);
-    pDstArr->AXIS_Y = (Smooth * DstArrPre.AXIS_Y) + Smooth * (pSrcArr->AXIS_Y - SrcArrPre.AXIS_Y);
-    pDstArr->AXIS_Z = (Smooth * DstArrPre.AXIS_Z) + Smooth * (pSrcArr->AXIS_Z - SrcArrPre.AXIS_Z);
-    DstArrPre.AXIS_X = pDstArr->AXIS_X;
-    DstArrPre.AXIS_Y = pDstArr->AXIS_Y;
-    DstArrPre.AXIS_Z = pDstArr->AXIS_Z;
-    SrcArrPre.AXIS_X = pSrcArr->AXIS_X;
-    SrcArrPre.AXIS_Y = pSrcArr->AXIS_Y;
-    SrcArrPre.AXIS_Z = pSrcArr->AXIS_Z;
+    pDstArr->AXIS_X = (Smooth * pDstArrPre->AXIS_X) + Smooth * (pSrcArr->AXIS_X - pSrcArrPre->AXIS_X);
+    pDstArr->AXIS_Y = (Smooth * pDstArrPre->AXIS_Y) + Smooth * (pSrcArr->AXIS_Y - pSrcArrPre->AXIS_Y);
+    pDstArr->AXIS_Z = (Smooth * pDstArrPre->AXIS_Z) + Smooth * (pSrcArr->AXIS_Z - pSrcArrPre->AXIS_Z);
+    pDstArrPre->AXIS_X = pDstArr->AXIS_X;
+    pDstArrPre->AXIS_Y = pDstArr->AXIS_Y;
+    pDstArrPre->AXIS_Z = pDstArr->AXIS_Z;
+    pSrcArrPre->AXIS_X = pSrcArr->AXIS_X;
+    pSrcArrPre->AXIS_Y = pSrcArr->AXIS_Y;
+    pSrcArrPre->AXIS_Z = pSrcArr->AXIS_Z;
   }
 }
 
@@ -143,7 +194,6 @@ static void MotionSP_evalSpeedFromAccelero(SensorVal_f_t *pDstArr,
 {
   uint16_t IndexCurr, IndexPre;
   float DeltaT;
-  static SensorVal_f_t DstArrPre;
   
   DeltaT = AcceleroODR.Period;
   IndexCurr = pSrcArr->IdPos;
@@ -155,28 +205,602 @@ static void MotionSP_evalSpeedFromAccelero(SensorVal_f_t *pDstArr,
   if (Restart == 1) 
   {  
     memset((void *)pDstArr, 0, sizeof(SensorVal_f_t));
-    memset((void *)&DstArrPre, 0, sizeof(SensorVal_f_t));
   }
   
   else
   {     // vi+1 = vi +[(1-GAMMA)*DELTA_T]*ai + (GAMMA*DELTA_T)*ai+1 /* in mm/s
 
-    pDstArr->AXIS_X = DstArrPre.AXIS_X +
+    pDstArr->AXIS_X = pDstArr->AXIS_X +
                       (((1-GAMMA)*DeltaT)*(pSrcArr->Data.AXIS_X[IndexPre]))+
                       (GAMMA*DeltaT*(pSrcArr->Data.AXIS_X[IndexCurr]));
 
-    pDstArr->AXIS_Y = DstArrPre.AXIS_Y +
+    pDstArr->AXIS_Y = pDstArr->AXIS_Y +
                       (((1-GAMMA)*DeltaT)*(pSrcArr->Data.AXIS_Y[IndexPre]))+
                       (GAMMA*DeltaT*(pSrcArr->Data.AXIS_Y[IndexCurr]));
  
-    pDstArr->AXIS_Z = DstArrPre.AXIS_Z +
+    pDstArr->AXIS_Z = pDstArr->AXIS_Z +
                       (((1-GAMMA)*DeltaT)*(pSrcArr->Data.AXIS_Z[IndexPre]))+
                       (GAMMA*DeltaT*(pSrcArr->Data.AXIS_Z[IndexCurr]));
-    
-    memcpy((void *)&DstArrPre, (void *)pDstArr, sizeof(SensorVal_f_t));
   }
 }
 
+/**
+  * @brief  Compute the Windowing Coefficients and the related amplitude scale factor
+  * @param  pCoeffs pointer to filtering parameters array
+  * @param  size filtering parameters array size
+  * @param  Ftype filtering method
+  * @param  pScaleFactor pointer to the scale factor to correct amplitude
+  * @return none
+  */
+static void MotionSP_WindowCoeffsSet(float *pCoeffs, uint16_t size, Filt_Type_t Ftype, float *pScaleFactor)
+{
+  for (int i = 0; i < size; i++)
+  {
+    if (Ftype == RECTANGULAR)
+    {
+      pCoeffs[i] = 1.0f;
+    }
+
+    if (Ftype == HANNING)
+    {
+      pCoeffs[i] = (0.5f * (1 - arm_cos_f32((2 * PI * i) / (size - 1))));
+    }
+
+    if (Ftype == HAMMING)
+    {
+      pCoeffs[i] = 0.54f - (0.46f * (arm_cos_f32((2 * PI * i) / (size - 1))));
+    }
+
+    if (Ftype == FLAT_TOP)
+      pCoeffs[i] = 0.21557895f - \
+                         (0.41663158f * arm_cos_f32((2 * PI * i) / (size - 1))) + \
+                         0.277263158f * (arm_cos_f32((4 * PI * i) / (size - 1))) - \
+                         0.083578947f * (arm_cos_f32((6 * PI * i) / (size - 1))) + \
+                         0.006947368f * (arm_cos_f32((8 * PI * i) / (size - 1)));
+  }
+
+  switch (Ftype)
+  {
+    case RECTANGULAR:
+      *pScaleFactor = 1.0f;
+      break;
+
+    case HANNING:
+      *pScaleFactor = 2.0f;
+      break;
+
+    case HAMMING:
+      *pScaleFactor = 1.85f;
+      break;
+
+    case FLAT_TOP:
+      *pScaleFactor = 4.55f;
+      break;
+  }
+}
+
+/**
+  * @brief  Re-scaling of one axis FFT magnitude after the RAW frequency Domain processing
+  * @param  pMag pointer to the magnitude array
+  * @param  size magnitude array size
+  * @param  WSF scale factor to correct amplitude
+  * @return none
+  */
+static void MotionSP_MagAdapt(float *pMag, uint16_t size, float WSF)
+{
+  /* Adjust DC component */
+  pMag[0] = (pMag[0] / (2 * size)) * WSF;
+
+  /* Adjust all the elements with i > 0 */
+  for (uint16_t i = 1; i < size; i++)
+  {
+    pMag[i] = (pMag[i] / size) * WSF;
+  }
+}
+
+/**
+  * @brief  Statistical features of one axis over the FFT window
+  * @param  pData pointer to the window data
+  * @param  size window size
+  * @param  pRms pointer to the RMS without DC
+  * @param  pPeak pointer to the peak without DC
+  * @param  pCrest pointer to the crest factor
+  * @param  pKurt pointer to the kurtosis
+  * @return none
+  */
+static void MotionSP_FeaturesEval(const float *pData, uint16_t size, float *pRms, float *pPeak, float *pCrest, float *pKurt)
+{
+  float mean;
+  float diff;
+  float diff2;
+  float m2 = 0.0f;
+  float m4 = 0.0f;
+  float peak = 0.0f;
+
+  arm_mean_f32(pData, size, &mean);
+
+  for (uint16_t i = 0; i < size; i++)
+  {
+    diff = pData[i] - mean;
+    diff2 = diff * diff;
+    m2 += diff2;
+    m4 += diff2 * diff2;
+    if (peak < fabsf(diff))
+    {
+      peak = fabsf(diff);
+    }
+  }
+
+  m2 /= size;
+  m4 /= size;
+
+  arm_sqrt_f32(m2, pRms);
+  *pPeak = peak;
+  *pCrest = (*pRms > 0.0f) ? (peak / *pRms) : 0.0f;
+  *pKurt = (m2 > 0.0f) ? (m4 / (m2 * m2)) : 0.0f;
+}
+
+/**
+  * @brief  Butterworth biquad coefficients in CMSIS-DSP format {b0, b1, b2, a1, a2}
+  * @param  pCoeffs pointer to the 5 coefficients
+  * @param  Fc cut-off frequency in Hz
+  * @param  Fs sampling frequency in Hz
+  * @param  HighPass 1 for high-pass, 0 for low-pass
+  * @return none
+  */
+static void MotionSP_BiquadCoeffsSet(float *pCoeffs, float Fc, float Fs, uint8_t HighPass)
+{
+  float w0 = 2 * PI * Fc / Fs;
+  float cosw0 = arm_cos_f32(w0);
+  float alpha = arm_sin_f32(w0) / (2 * 0.70710678f);
+  float a0 = 1 + alpha;
+
+  if (HighPass)
+  {
+    pCoeffs[0] = ((1 + cosw0) / 2) / a0;
+    pCoeffs[1] = -(1 + cosw0) / a0;
+  }
+  else
+  {
+    pCoeffs[0] = ((1 - cosw0) / 2) / a0;
+    pCoeffs[1] = (1 - cosw0) / a0;
+  }
+  pCoeffs[2] = pCoeffs[0];
+  pCoeffs[3] = (2 * cosw0) / a0;
+  pCoeffs[4] = -(1 - alpha) / a0;
+}
+
+/**
+  * @brief  Envelope spectrum of one axis over the FFT window
+  * @param  pEnv pointer to the envelope structure
+  * @param  pFrame pointer to the window data
+  * @param  FrameSize window size
+  * @param  pScratch pointer to a scratch array of FrameSize elements
+  * @param  pMag pointer to the envelope spectrum amplitude (pEnv->FftSize/2 elements)
+  * @return none
+  *
+  * @details More details
+  * Band-pass, rectify, low-pass, decimate and FFT. The filter states are reset on each
+  * window so that each spectrum depends only on the window it is evaluated from.
+  */
+static void MotionSP_EnvelopeEval(sEnvelope_t *pEnv, const float *pFrame, uint16_t FrameSize, float *pScratch, float *pMag)
+{
+  uint16_t envSize = pEnv->FftSize;
+  float mean;
+
+  memset((void *)pEnv->BandPassState, 0, sizeof(pEnv->BandPassState));
+  memset((void *)pEnv->LowPassState, 0, sizeof(pEnv->LowPassState));
+
+  /* Band-pass around the resonance excited by the fault impacts */
+  arm_biquad_cascade_df1_f32(&pEnv->BandPass, pFrame, pScratch, FrameSize);
+
+  /* Rectify and low-pass to get the envelope */
+  arm_abs_f32(pScratch, pScratch, FrameSize);
+  arm_biquad_cascade_df1_f32(&pEnv->LowPass, pScratch, pScratch, FrameSize);
+
+  /* Decimate and remove the envelope mean value */
+  for (uint16_t i = 0; i < envSize; i++)
+  {
+    pEnv->pIn[i] = pScratch[i * pEnv->Decimation];
+  }
+  arm_mean_f32(pEnv->pIn, envSize, &mean);
+  arm_offset_f32(pEnv->pIn, -mean, pEnv->pIn, envSize);
+
+  /* Envelope spectrum amplitude */
+  arm_rfft_fast_f32(&pEnv->FftS, pEnv->pIn, pScratch, 0);
+  arm_cmplx_mag_f32(pScratch, pMag, envSize / 2);
+  arm_scale_f32(pMag, 2.0f / envSize, pMag, envSize / 2);
+  pMag[0] = 0.0f;
+}
+
+/**
+  * @brief  Goertzel recursion over consecutive samples
+  * @param  pData pointer to the samples
+  * @param  Samples number of samples
+  * @param  Coeff Goertzel coefficient
+  * @param  pS1 pointer to the state s[n-1]
+  * @param  pS2 pointer to the state s[n-2]
+  * @return none
+  */
+static void MotionSP_GoertzelRun(const float *pData, uint16_t Samples, float Coeff, float *pS1, float *pS2)
+{
+  float s0;
+  float s1 = *pS1;
+  float s2 = *pS2;
+
+  for (uint16_t i = 0; i < Samples; i++)
+  {
+    s0 = pData[i] + (Coeff * s1) - s2;
+    s2 = s1;
+    s1 = s0;
+  }
+
+  *pS1 = s1;
+  *pS2 = s2;
+}
+
+/**
+  * @brief  Tone amplitude at the end of a Goertzel block, the states are reset
+  * @param  Coeff Goertzel coefficient
+  * @param  pS1 pointer to the state s[n-1]
+  * @param  pS2 pointer to the state s[n-2]
+  * @param  BlockSize number of samples of the block
+  * @return Tone amplitude
+  */
+static float MotionSP_GoertzelAmplitude(float Coeff, float *pS1, float *pS2, uint16_t BlockSize)
+{
+  float power = (*pS1 * *pS1) + (*pS2 * *pS2) - (Coeff * *pS1 * *pS2);
+  float magnitude;
+
+  arm_sqrt_f32(power, &magnitude);
+  *pS1 = 0.0f;
+  *pS2 = 0.0f;
+
+  return (2.0f * magnitude) / BlockSize;
+}
+
+/**
+  * @brief  Feed new samples to the Goertzel bank
+  * @param  pBank pointer to the Goertzel bank
+  * @param  pX pointer to consecutive X samples
+  * @param  pY pointer to consecutive Y samples
+  * @param  pZ pointer to consecutive Z samples
+  * @param  Samples number of samples
+  * @return none
+  */
+static void MotionSP_ToneBankUpdate(sToneBank_t *pBank, const float *pX, const float *pY, const float *pZ, uint16_t Samples)
+{
+  uint16_t seg;
+  sTone_t *pTone;
+
+  while (Samples > 0)
+  {
+    seg = pBank->BlockSize - pBank->Count;
+    if (Samples < seg)
+    {
+      seg = Samples;
+    }
+
+    for (uint8_t t = 0; t < pBank->Num; t++)
+    {
+      pTone = &pBank->Tone[t];
+      MotionSP_GoertzelRun(pX, seg, pTone->Coeff, &pTone->S1.AXIS_X, &pTone->S2.AXIS_X);
+      MotionSP_GoertzelRun(pY, seg, pTone->Coeff, &pTone->S1.AXIS_Y, &pTone->S2.AXIS_Y);
+      MotionSP_GoertzelRun(pZ, seg, pTone->Coeff, &pTone->S1.AXIS_Z, &pTone->S2.AXIS_Z);
+    }
+
+    pBank->Count += seg;
+    if (pBank->Count == pBank->BlockSize)
+    {
+      for (uint8_t t = 0; t < pBank->Num; t++)
+      {
+        pTone = &pBank->Tone[t];
+        pTone->Amplitude.AXIS_X = MotionSP_GoertzelAmplitude(pTone->Coeff, &pTone->S1.AXIS_X, &pTone->S2.AXIS_X, pBank->BlockSize);
+        pTone->Amplitude.AXIS_Y = MotionSP_GoertzelAmplitude(pTone->Coeff, &pTone->S1.AXIS_Y, &pTone->S2.AXIS_Y, pBank->BlockSize);
+        pTone->Amplitude.AXIS_Z = MotionSP_GoertzelAmplitude(pTone->Coeff, &pTone->S1.AXIS_Z, &pTone->S2.AXIS_Z, pBank->BlockSize);
+      }
+      pBank->Count = 0;
+      pBank->Ready = 1;
+    }
+
+    pX += seg;
+    pY += seg;
+    pZ += seg;
+    Samples -= seg;
+  }
+}
+
+/**
+  * @brief  Time Domain Processing of one sample of a single axis
+  * @param  pAx pointer to the filter states of the axis
+  * @param  pCirc pointer to the circular array element to be filled
+  * @param  In accelerometer value in mg
+  * @param  kPre speed integration weight of the previous acceleration
+  * @param  kCurr speed integration weight of the current acceleration
+  * @param  SpeedInvWN inverse of the weight of the speed moving RMS filter, shared by the axes
+  * @param  AccInvWN inverse of the weight of the accelerometer moving RMS filter, shared by the axes
+  * @param  DoSpeed speed analysis enabled
+  * @param  DoAcc accelerometer RMS analysis enabled
+  * @return none
+  *
+  * @details More details
+  * Same arithmetic as MotionSP_accDelOffset, MotionSP_CreateAccCircBuffer and
+  * MotionSP_TimeDomainProcess on a sample which is not a restart. The square roots are
+  * written to a local variable, so the axis state does not escape and stays in registers.
+  */
+static inline void MotionSP_TD_AxisStep(sTD_Axis_t *pAx, float *pCirc, float In, float kPre, float kCurr,
+                                        float SpeedInvWN, float AccInvWN, uint8_t DoSpeed, uint8_t DoAcc)
+{
+  float noDc;
+  float acc;
+  float absAcc;
+  float rms;
+
+  /* Remove DC offset */
+  noDc = (DC_SMOOTH * pAx->AccDcDstPre) + DC_SMOOTH * (In - pAx->AccDcSrcPre);
+  pAx->AccDcDstPre = noDc;
+  pAx->AccDcSrcPre = In;
+
+  /* Fill the accelero circular buffer */
+  acc = noDc*G_CONV;
+  *pCirc = acc;
+
+  /* Peak evaluation */
+  absAcc = fabsf(acc);
+  if (pAx->AccPeak < absAcc)
+  {
+    pAx->AccPeak = absAcc;
+  }
+
+  if (DoSpeed)
+  {
+    /* vi+1 = vi +[(1-GAMMA)*DELTA_T]*ai + (GAMMA*DELTA_T)*ai+1 */
+    pAx->Speed = pAx->Speed + (kPre*pAx->AccPre) + (kCurr*acc);
+
+    /* Delete the Speed DC components */
+    pAx->SpeedNoDc = (DC_SMOOTH * pAx->SpeedDcDstPre) + DC_SMOOTH * (pAx->Speed - pAx->SpeedDcSrcPre);
+    pAx->SpeedDcDstPre = pAx->SpeedNoDc;
+    pAx->SpeedDcSrcPre = pAx->Speed;
+
+    /* Evaluate SwExponential Filter by TAU_FILTER on Speed data */
+    arm_sqrt_f32(((1 - SpeedInvWN) * (pAx->SpeedRms * pAx->SpeedRms) + SpeedInvWN * (pAx->SpeedNoDc * pAx->SpeedNoDc)), &rms);
+    pAx->SpeedRms = rms;
+  }
+
+  if (DoAcc)
+  {
+    /* Evaluate SwExponential Filter by TAU_FILTER on Accelerometer data */
+    arm_sqrt_f32(((1 - AccInvWN) * (pAx->AccRms * pAx->AccRms) + AccInvWN * (acc * acc)), &rms);
+    pAx->AccRms = rms;
+  }
+
+  pAx->AccPre = acc;
+}
+
+/**
+  * @brief  Time Domain Processing of a block of accelerometer samples
+  * @param  pTd pointer to the time domain filter states
+  * @param  pTimeDomain pointer to the time domain results
+  * @param  pCirc pointer to the circular arrays
+  * @param  CircSize circular array size
+  * @param  pIdPos pointer to the last filled position index of the circular arrays
+  * @param  pOvf pointer to the circular buffer overflow flag
+  * @param  pAccOdr pointer to the accelerometer ODR info
+  * @param  td_type Time domain analysis type
+  * @param  pSamples pointer to the accelerometer samples in mg
+  * @param  Samples number of samples
+  * @param  Restart flag to reInit internal value on the first sample
+  * @return Number of processed samples, the processing stops at the sample wrapping the circular arrays
+  *
+  * @details More details
+  * Loop-fused equivalent of MotionSP_accDelOffset, MotionSP_CreateAccCircBuffer and
+  * MotionSP_TimeDomainProcess: the three axes are processed in a single pass, the filter
+  * states are kept in local variables for the whole block and the RMS filter weights,
+  * shared by the axes, are inverted once per sample. The arithmetic is the same as the
+  * per-sample path, so the results are bit-exact.
+  */
+static uint16_t MotionSP_TD_Block(sTimeDomainState_t *pTd, sAcceleroParam_t *pTimeDomain, const sAxisArray_t *pCirc,
+                                  uint16_t CircSize, uint16_t *pIdPos, uint8_t *pOvf, const sAcceleroODR_t *pAccOdr,
+                                  Td_Type_t td_type, const SensorVal_f_t *pSamples, uint16_t Samples, uint8_t Restart)
+{
+  const float kPre = (1-GAMMA)*pAccOdr->Period;
+  const float kCurr = GAMMA*pAccOdr->Period;
+  const float lambda = pAccOdr->Tau;
+  const uint8_t doSpeed = (td_type == TD_SPEED) || (td_type == TD_BOTH_TAU);
+  const uint8_t doAcc = (td_type == TD_ACCELERO) || (td_type == TD_BOTH_TAU);
+  float *pX = pCirc->X;
+  float *pY = pCirc->Y;
+  float *pZ = pCirc->Z;
+  float speedWN = pTd->SpeedRmsWN;
+  float accWN = pTd->AccRmsWN;
+  float speedInvWN = 0.0f;
+  float accInvWN = 0.0f;
+  sTD_Axis_t ax[NUM_AXES];
+  uint16_t prev;
+  uint16_t pos;
+  uint16_t cnt;
+  uint16_t s = 0;
+
+  if (Samples == 0)
+  {
+    return 0;
+  }
+
+  /* Samples up to (and including) the one wrapping the circular buffer */
+  cnt = CircSize - *pIdPos;
+  if (Samples < cnt)
+  {
+    cnt = Samples;
+  }
+
+  prev = *pIdPos;
+  pos = prev + 1;
+  if (pos == CircSize)
+  {
+    pos = 0;
+  }
+
+  ax[0].AccDcDstPre = pTd->AccDcDstPre.AXIS_X;
+  ax[0].AccDcSrcPre = pTd->AccDcSrcPre.AXIS_X;
+  ax[0].AccPre = pX[prev];
+  ax[0].Speed = pTd->Speed.AXIS_X;
+  ax[0].SpeedDcDstPre = pTd->SpeedDcDstPre.AXIS_X;
+  ax[0].SpeedDcSrcPre = pTd->SpeedDcSrcPre.AXIS_X;
+  ax[0].SpeedNoDc = pTd->SpeedNoDc.AXIS_X;
+  ax[0].SpeedRms = pTimeDomain->SpeedRms.AXIS_X;
+  ax[0].AccRms = pTimeDomain->AccRms.AXIS_X;
+  ax[0].AccPeak = pTimeDomain->AccPeak.AXIS_X;
+
+  ax[1].AccDcDstPre = pTd->AccDcDstPre.AXIS_Y;
+  ax[1].AccDcSrcPre = pTd->AccDcSrcPre.AXIS_Y;
+  ax[1].AccPre = pY[prev];
+  ax[1].Speed = pTd->Speed.AXIS_Y;
+  ax[1].SpeedDcDstPre = pTd->SpeedDcDstPre.AXIS_Y;
+  ax[1].SpeedDcSrcPre = pTd->SpeedDcSrcPre.AXIS_Y;
+  ax[1].SpeedNoDc = pTd->SpeedNoDc.AXIS_Y;
+  ax[1].SpeedRms = pTimeDomain->SpeedRms.AXIS_Y;
+  ax[1].AccRms = pTimeDomain->AccRms.AXIS_Y;
+  ax[1].AccPeak = pTimeDomain->AccPeak.AXIS_Y;
+
+  ax[2].AccDcDstPre = pTd->AccDcDstPre.AXIS_Z;
+  ax[2].AccDcSrcPre = pTd->AccDcSrcPre.AXIS_Z;
+  ax[2].AccPre = pZ[prev];
+  ax[2].Speed = pTd->Speed.AXIS_Z;
+  ax[2].SpeedDcDstPre = pTd->SpeedDcDstPre.AXIS_Z;
+  ax[2].SpeedDcSrcPre = pTd->SpeedDcSrcPre.AXIS_Z;
+  ax[2].SpeedNoDc = pTd->SpeedNoDc.AXIS_Z;
+  ax[2].SpeedRms = pTimeDomain->SpeedRms.AXIS_Z;
+  ax[2].AccRms = pTimeDomain->AccRms.AXIS_Z;
+  ax[2].AccPeak = pTimeDomain->AccPeak.AXIS_Z;
+
+  if (Restart == 1)
+  {
+    /* The first sample restarts the filters: no DC removed, null acceleration and speed */
+    ax[0].AccDcDstPre = pSamples[0].AXIS_X;
+    ax[0].AccDcSrcPre = pSamples[0].AXIS_X;
+    ax[1].AccDcDstPre = pSamples[0].AXIS_Y;
+    ax[1].AccDcSrcPre = pSamples[0].AXIS_Y;
+    ax[2].AccDcDstPre = pSamples[0].AXIS_Z;
+    ax[2].AccDcSrcPre = pSamples[0].AXIS_Z;
+
+    for (uint8_t a = 0; a < NUM_AXES; a++)
+    {
+      ax[a].AccPre = 0.0f*G_CONV;
+      if (ax[a].AccPeak < 0.0f)
+      {
+        ax[a].AccPeak = 0.0f;
+      }
+      ax[a].Speed = 0.0f;
+      ax[a].SpeedNoDc = 0.0f;
+      ax[a].SpeedDcDstPre = 0.0f;
+      ax[a].SpeedDcSrcPre = 0.0f;
+      if (doSpeed)
+      {
+        ax[a].SpeedRms = 0.0f;
+      }
+      if (doAcc)
+      {
+        ax[a].AccRms = ax[a].AccPre;
+      }
+    }
+    pX[pos] = ax[0].AccPre;
+    pY[pos] = ax[1].AccPre;
+    pZ[pos] = ax[2].AccPre;
+    if (doSpeed)
+    {
+      speedWN = 1;
+    }
+    if (doAcc)
+    {
+      accWN = 1;
+    }
+
+    pos++;
+    if (pos == CircSize)
+    {
+      pos = 0;
+    }
+    s = 1;
+  }
+
+  for (; s < cnt; s++)
+  {
+    if (doSpeed)
+    {
+      speedInvWN = 1 / speedWN;
+    }
+    if (doAcc)
+    {
+      accInvWN = 1 / accWN;
+    }
+
+    MotionSP_TD_AxisStep(&ax[0], &pX[pos], pSamples[s].AXIS_X, kPre, kCurr, speedInvWN, accInvWN, doSpeed, doAcc);
+    MotionSP_TD_AxisStep(&ax[1], &pY[pos], pSamples[s].AXIS_Y, kPre, kCurr, speedInvWN, accInvWN, doSpeed, doAcc);
+    MotionSP_TD_AxisStep(&ax[2], &pZ[pos], pSamples[s].AXIS_Z, kPre, kCurr, speedInvWN, accInvWN, doSpeed, doAcc);
+
+    if (doSpeed)
+    {
+      speedWN = lambda * speedWN + 1;
+    }
+    if (doAcc)
+    {
+      accWN = lambda * accWN + 1;
+    }
+
+    pos++;
+    if (pos == CircSize)
+    {
+      pos = 0;
+    }
+  }
+
+  pTd->AccDcDstPre.AXIS_X = ax[0].AccDcDstPre;
+  pTd->AccDcDstPre.AXIS_Y = ax[1].AccDcDstPre;
+  pTd->AccDcDstPre.AXIS_Z = ax[2].AccDcDstPre;
+  pTd->AccDcSrcPre.AXIS_X = ax[0].AccDcSrcPre;
+  pTd->AccDcSrcPre.AXIS_Y = ax[1].AccDcSrcPre;
+  pTd->AccDcSrcPre.AXIS_Z = ax[2].AccDcSrcPre;
+  pTimeDomain->AccPeak.AXIS_X = ax[0].AccPeak;
+  pTimeDomain->AccPeak.AXIS_Y = ax[1].AccPeak;
+  pTimeDomain->AccPeak.AXIS_Z = ax[2].AccPeak;
+
+  if (doSpeed)
+  {
+    pTd->Speed.AXIS_X = ax[0].Speed;
+    pTd->Speed.AXIS_Y = ax[1].Speed;
+    pTd->Speed.AXIS_Z = ax[2].Speed;
+    pTd->SpeedDcDstPre.AXIS_X = ax[0].SpeedDcDstPre;
+    pTd->SpeedDcDstPre.AXIS_Y = ax[1].SpeedDcDstPre;
+    pTd->SpeedDcDstPre.AXIS_Z = ax[2].SpeedDcDstPre;
+    pTd->SpeedDcSrcPre.AXIS_X = ax[0].SpeedDcSrcPre;
+    pTd->SpeedDcSrcPre.AXIS_Y = ax[1].SpeedDcSrcPre;
+    pTd->SpeedDcSrcPre.AXIS_Z = ax[2].SpeedDcSrcPre;
+    pTd->SpeedNoDc.AXIS_X = ax[0].SpeedNoDc;
+    pTd->SpeedNoDc.AXIS_Y = ax[1].SpeedNoDc;
+    pTd->SpeedNoDc.AXIS_Z = ax[2].SpeedNoDc;
+    pTimeDomain->SpeedRms.AXIS_X = ax[0].SpeedRms;
+    pTimeDomain->SpeedRms.AXIS_Y = ax[1].SpeedRms;
+    pTimeDomain->SpeedRms.AXIS_Z = ax[2].SpeedRms;
+  }
+  if (doAcc)
+  {
+    pTimeDomain->AccRms.AXIS_X = ax[0].AccRms;
+    pTimeDomain->AccRms.AXIS_Y = ax[1].AccRms;
+    pTimeDomain->AccRms.AXIS_Z = ax[2].AccRms;
+  }
+  pTd->SpeedRmsWN = speedWN;
+  pTd->AccRmsWN = accWN;
+
+  *pIdPos += cnt;
+  if (*pIdPos >= CircSize)
+  {
+    *pIdPos -= CircSize;
+    *pOvf = 1;
+  }
+
+  return cnt;
+}
+
 /**
   * @}
   */
@@ -200,8 +824,8 @@ static void MotionSP_SwSpeedRmsFilter(SensorVal_f_t *pDstArr, SensorVal_f_t *pSr
 {
   SensorVal_f_t SquareData = {0, 0, 0};
   SensorVal_f_t PrevSquareData  = {0, 0, 0};
-  static float WN = 0.0;
-  static float WN_1 = 0.0;
+  float WN = LegacyCtx.TdState.SpeedRmsWN;
+  float WN_1 = 0.0;
 
   if (start == 1)
   {
@@ -227,6 +851,8 @@ static void MotionSP_SwSpeedRmsFilter(SensorVal_f_t *pDstArr, SensorVal_f_t *pSr
     WN_1 =  WN;
     WN =  Lambda * WN_1 + 1;
   }
+
+  LegacyCtx.TdState.SpeedRmsWN = WN;
 }
 
 /**
@@ -242,8 +868,8 @@ static void MotionSP_SwAccRmsFilter(SensorVal_f_t *pDstArr, sCircBuffer_t *pSrcA
   uint16_t Index = 0;
   SensorVal_f_t SquareData = {0, 0, 0};
   SensorVal_f_t PrevSquareData  = {0, 0, 0};
-  static float WN = 0.0;
-  static float WN_1 = 0.0;
+  float WN = LegacyCtx.TdState.AccRmsWN;
+  float WN_1 = 0.0;
 
   Index = pSrcArr->IdPos;
   
@@ -271,6 +897,8 @@ static void MotionSP_SwAccRmsFilter(SensorVal_f_t *pDstArr, sCircBuffer_t *pSrcA
     WN_1 =  WN;
     WN =  Lambda * WN_1 + 1;
   }
+
+  LegacyCtx.TdState.AccRmsWN = WN;
 }
 
 /**
@@ -408,32 +1036,32 @@ static void MotionSP_TD_AccRmsEvalFromCircBuff(sTimeDomainData_t *pDst, sCircBuf
   */
 void MotionSP_accDelOffset(SensorVal_f_t *pDstArr, SensorVal_f_t *pSrcArr, float Smooth, uint16_t Restart)
 {
-  static SensorVal_f_t DstArrPre;
-  static SensorVal_f_t SrcArrPre;
-  
+  SensorVal_f_t *pDstArrPre = &LegacyCtx.TdState.AccDcDstPre;
+  SensorVal_f_t *pSrcArrPre = &LegacyCtx.TdState.AccDcSrcPre;
+
   if (Restart == 1)
   {
     pDstArr->AXIS_X = 0.0;
     pDstArr->AXIS_Y = 0.0;
     pDstArr->AXIS_Z = 0.0;
-    DstArrPre.AXIS_X = pSrcArr->AXIS_X;
-    DstArrPre.AXIS_Y = pSrcArr->AXIS_Y;
-    DstArrPre.AXIS_Z = pSrcArr->AXIS_Z;
-    SrcArrPre.AXIS_X = pSrcArr->AXIS_X;
-    SrcArrPre.AXIS_Y = pSrcArr->AXIS_Y;
-    SrcArrPre.AXIS_Z = pSrcArr->AXIS_Z;
+    pDstArrPre->AXIS_X = pSrcArr->AXIS_X;
+    pDstArrPre->AXIS_Y = pSrcArr->AXIS_Y;
+    pDstArrPre->AXIS_Z = pSrcArr->AXIS_Z;
+    pSrcArrPre->AXIS_X = pSrcArr->AXIS_X;
+    pSrcArrPre->AXIS_Y = pSrcArr->AXIS_Y;
+    pSrcArrPre->AXIS_Z = pSrcArr->AXIS_Z;
   }
   else
   {
-    pDstArr->AXIS_X = (Smooth * DstArrPre.AXIS_X) + Smooth * (pSrcArr->AXIS_X - SrcArrPre.AXIS_X);
-    pDstArr->AXIS_Y = (Smooth * DstArrPre.AXIS_Y) + Smooth * (pSrcArr->AXIS_Y - SrcArrPre.AXIS_Y);
-    pDstArr->AXIS_Z = (Smooth * DstArrPre.AXIS_Z) + Smooth * (pSrcArr->AXIS_Z - SrcArrPre.AXIS_Z);
-    DstArrPre.AXIS_X = pDstArr->AXIS_X;
-    DstArrPre.AXIS_Y = pDstArr->AXIS_Y;
-    DstArrPre.AXIS_Z = pDstArr->AXIS_Z;
-    SrcArrPre.AXIS_X = pSrcArr->AXIS_X;
-    SrcArrPre.AXIS_Y = pSrcArr->AXIS_Y;
-    SrcArrPre.AXIS_Z = pSrcArr->AXIS_Z;
+    pDstArr->AXIS_X = (Smooth * pDstArrPre->AXIS_X) + Smooth * (pSrcArr->AXIS_X - pSrcArrPre->AXIS_X);
+    pDstArr->AXIS_Y = (Smooth * pDstArrPre->AXIS_Y) + Smooth * (pSrcArr->AXIS_Y - pSrcArrPre->AXIS_Y);
+    pDstArr->AXIS_Z = (Smooth * pDstArrPre->AXIS_Z) + Smooth * (pSrcArr->AXIS_Z - pSrcArrPre->AXIS_Z);
+    pDstArrPre->AXIS_X = pDstArr->AXIS_X;
+    pDstArrPre->AXIS_Y = pDstArr->AXIS_Y;
+    pDstArrPre->AXIS_Z = pDstArr->AXIS_Z;
+    pSrcArrPre->AXIS_X = pSrcArr->AXIS_X;
+    pSrcArrPre->AXIS_Y = pSrcArr->AXIS_Y;
+    pSrcArrPre->AXIS_Z = pSrcArr->AXIS_Z;
   }
 }
 
@@ -475,11 +1103,11 @@ void MotionSP_TimeDomainProcess(sAcceleroParam_t *pTimeDomain, Td_Type_t td_type
   if (td_type == TD_SPEED)
   {
     /* TIME DOMAIN ANALYSIS: Speed RMS Moving AVERAGE */
-    MotionSP_evalSpeedFromAccelero(&SpeedTimeDomain, &AccCircBuffer, Restart);
+    MotionSP_evalSpeedFromAccelero(&LegacyCtx.TdState.Speed, &AccCircBuffer, Restart);
     // Delete the Speed DC components
-    MotionSP_speedDelOffset(&SpeedTimeDomain_noDC, &SpeedTimeDomain, DC_SMOOTH, Restart);
+    MotionSP_speedDelOffset(&LegacyCtx.TdState.SpeedNoDc, &LegacyCtx.TdState.Speed, DC_SMOOTH, Restart);
     // Evaluate SwExponential Filter by TAU_FILTER on Speed data
-    MotionSP_SwSpeedRmsFilter(&sTimeDomain.SpeedRms, &SpeedTimeDomain_noDC, AcceleroODR.Tau, Restart);
+    MotionSP_SwSpeedRmsFilter(&sTimeDomain.SpeedRms, &LegacyCtx.TdState.SpeedNoDc, AcceleroODR.Tau, Restart);
   }
 
   if (td_type == TD_ACCELERO)
@@ -492,16 +1120,38 @@ void MotionSP_TimeDomainProcess(sAcceleroParam_t *pTimeDomain, Td_Type_t td_type
   if (td_type == TD_BOTH_TAU)
   {
     /* TIME DOMAIN ANALYSIS: Speed and both RMS Moving AVERAGE TAU */
-    MotionSP_evalSpeedFromAccelero(&SpeedTimeDomain, &AccCircBuffer, Restart);
+    MotionSP_evalSpeedFromAccelero(&LegacyCtx.TdState.Speed, &AccCircBuffer, Restart);
     // Delete the Speed DC components
-    MotionSP_speedDelOffset(&SpeedTimeDomain_noDC, &SpeedTimeDomain, DC_SMOOTH, Restart);
+    MotionSP_speedDelOffset(&LegacyCtx.TdState.SpeedNoDc, &LegacyCtx.TdState.Speed, DC_SMOOTH, Restart);
     // Evaluate SwExponential Filter by TAU_FILTER on Speed data
-    MotionSP_SwSpeedRmsFilter(&sTimeDomain.SpeedRms, &SpeedTimeDomain_noDC, AcceleroODR.Tau, Restart);
+    MotionSP_SwSpeedRmsFilter(&sTimeDomain.SpeedRms, &LegacyCtx.TdState.SpeedNoDc, AcceleroODR.Tau, Restart);
     // Evaluate SwExponential Filter by TAU_FILTER on Accelerometer data
     MotionSP_SwAccRmsFilter(&sTimeDomain.AccRms, &AccCircBuffer, AcceleroODR.Tau, Restart);
   }
 }
 
+/**
+  * @brief Time Domain Processing of a block of accelerometer samples
+  * @brief Block equivalent of MotionSP_accDelOffset, MotionSP_CreateAccCircBuffer and
+  *        MotionSP_TimeDomainProcess called for each sample
+  * @param pTimeDomain Pointer to time domain parameter to evaluate
+  * @param pCircBuff Pointer to the accelerometer circular buffer to be filled
+  * @param pSamples Pointer to the accelerometer samples in mg
+  * @param Samples Number of accelerometer samples
+  * @param td_type Time domain analysis type
+  * @param Restart Flag to reInit internal value on the first sample
+  * @return Number of processed samples, the processing stops as soon as the circular buffer overflows
+  */
+uint16_t MotionSP_TimeDomainProcessBlock(sAcceleroParam_t *pTimeDomain, sCircBuffer_t *pCircBuff, const SensorVal_f_t *pSamples,
+                                         uint16_t Samples, Td_Type_t td_type, uint8_t Restart)
+{
+  sAxisArray_t circ = {pCircBuff->Data.AXIS_X, pCircBuff->Data.AXIS_Y, pCircBuff->Data.AXIS_Z};
+
+  /* The filter states stay in the context of the global API, the results and the buffer are the caller ones */
+  return MotionSP_TD_Block(&LegacyCtx.TdState, pTimeDomain, &circ, pCircBuff->Size, &pCircBuff->IdPos, &pCircBuff->Ovf,
+                           &AcceleroODR, td_type, pSamples, Samples, Restart);
+}
+
 /**
   * @brief Time Domain Data Evaluation from a stored accelerations
   * @param pTimeDomainData Time domain data to be filled
@@ -682,49 +1332,7 @@ void MotionSP_fftPeakFinding(sAccMagResults_t *pAccMagResults)
   */
 void MotionSP_SetWindFiltArray(float *Filter_Params, uint16_t size, Filt_Type_t Ftype)
 {
-  for (int i = 0; i < size; i++)
-  {
-    if (Ftype == RECTANGULAR)
-    {
-      Filter_Params[i] = 1.0f;
-    }
-
-    if (Ftype == HANNING)
-    {
-      Filter_Params[i] = (0.5f * (1 - arm_cos_f32((2 * PI * i) / (size - 1))));
-    }
-
-    if (Ftype == HAMMING)
-    {
-      Filter_Params[i] = 0.54f - (0.46f * (arm_cos_f32((2 * PI * i) / (size - 1))));
-    }
-
-    if (Ftype == FLAT_TOP)
-      Filter_Params[i] = 0.21557895f - \
-                         (0.41663158f * arm_cos_f32((2 * PI * i) / (size - 1))) + \
-                         0.277263158f * (arm_cos_f32((4 * PI * i) / (size - 1))) - \
-                         0.083578947f * (arm_cos_f32((6 * PI * i) / (size - 1))) + \
-                         0.006947368f * (arm_cos_f32((8 * PI * i) / (size - 1)));
-  }
-
-  switch (Ftype)
-  {
-    case RECTANGULAR:
-      Window_Scale_Factor = 1.0f;
-      break;
-
-    case HANNING:
-      Window_Scale_Factor = 2.0f;
-      break;
-
-    case HAMMING:
-      Window_Scale_Factor = 1.85f;
-      break;
-
-    case FLAT_TOP:
-      Window_Scale_Factor = 4.55f;
-      break;
-  }
+  MotionSP_WindowCoeffsSet(Filter_Params, size, Ftype, &Window_Scale_Factor);
 }
 
 /**
@@ -881,80 +1489,29 @@ uint8_t MotionSP_fftAverageCalcTime(float *pDstArr, float *pSrcArr, uint16_t Len
   */
 void MotionSP_FrequencyDomainProcess(void)
 {
-  static struct {
-    uint8_t xAccAvgRdy : 1;
-    uint8_t yAccAvgRdy : 1;
-    uint8_t zAccAvgRdy : 1;
-  } AvgRdy = {0,0,0};
- 
-  static sAccAxesArray_t AccAxesArray_fftIn;  //!< Array for acc axes input values for FFT
-  static float fftIn[FFT_SIZE_MAX];           //!< Array for input values for FFT
-  static float fftOut[FFT_SIZE_MAX];          //!< Array for output values for the complex magnitude function
-
-  /* ------------------ Freeze the Accelerometer data to analyze--------------*/
-  MotionSP_fftInBuild(AccAxesArray_fftIn.AXIS_X, MotionSP_Parameters.FftSize, AccCircBuffer.Data.AXIS_X, AccCircBuffer.Size, accCircBuffIndexForFft);
-  MotionSP_fftInBuild(AccAxesArray_fftIn.AXIS_Y, MotionSP_Parameters.FftSize, AccCircBuffer.Data.AXIS_Y, AccCircBuffer.Size, accCircBuffIndexForFft);
-  MotionSP_fftInBuild(AccAxesArray_fftIn.AXIS_Z, MotionSP_Parameters.FftSize, AccCircBuffer.Data.AXIS_Z, AccCircBuffer.Size, accCircBuffIndexForFft);
-
-  /* ------------------ First Axis: Analysis on X-Acceleration--------------*/
-  /* Apply the Windowing before to perform FFT */
-  motionSP_fftUseWindow(fftIn, AccAxesArray_fftIn.AXIS_X, MotionSP_Parameters.FftSize, Filter_Params);
-  MotionSP_fftCalc(&fftS, fftIn, fftOut);
-  if (MotionSP_fftAverageCalcTime(AccAxesAvgMagBuff.AXIS_X, fftOut, magSize, &(AccSumCnt.AXIS_X), FinishAvgFlag))
-  {
-    // Save the Max FFT Number evaluated
-    AccAxesMagResults.X_FFT_AVG = AccSumCnt.AXIS_X;
-    // Reset the FFT AVG Number for axis evaluated
-    AccSumCnt.AXIS_X = 0;
-    // AVG available
-    AvgRdy.xAccAvgRdy = 1;
-  }
-
-  /* ------------------ Second Axis: Analysis on Y-Acceleration ----------*/
-  /* Apply the Windowing before to perform FFT */
-  motionSP_fftUseWindow(fftIn, AccAxesArray_fftIn.AXIS_Y, MotionSP_Parameters.FftSize,
-                        Filter_Params); /* Evaluate FFT on Acc Data */
-  MotionSP_fftCalc(&fftS, fftIn, fftOut);
-  if (MotionSP_fftAverageCalcTime(AccAxesAvgMagBuff.AXIS_Y, fftOut, magSize, &(AccSumCnt.AXIS_Y), FinishAvgFlag))
-  {
-    // Save the Max FFT Number evaluated
-    AccAxesMagResults.Y_FFT_AVG = AccSumCnt.AXIS_Y;    // Reset the FFT AVG Number for axis evaluated
-    AccSumCnt.AXIS_Y = 0;
-    // AVG available
-    AvgRdy.yAccAvgRdy = 1;
-  }
-
-  /* ------------------ Third Axis: Analysis on Z-Acceleration-------------*/
-  /* Apply the Windowing before to perform FFT */
-  motionSP_fftUseWindow(fftIn, AccAxesArray_fftIn.AXIS_Z, MotionSP_Parameters.FftSize, Filter_Params);
-  MotionSP_fftCalc(&fftS, fftIn, fftOut);
-  if (MotionSP_fftAverageCalcTime(AccAxesAvgMagBuff.AXIS_Z, fftOut, magSize, &(AccSumCnt.AXIS_Z), FinishAvgFlag))
+  LegacyCtx.Parameters.FftSize = MotionSP_Parameters.FftSize;
+  LegacyCtx.AccCircBuff.Size = AccCircBuffer.Size;
+  LegacyCtx.AccCircBuff.Array.X = AccCircBuffer.Data.AXIS_X;
+  LegacyCtx.AccCircBuff.Array.Y = AccCircBuffer.Data.AXIS_Y;
+  LegacyCtx.AccCircBuff.Array.Z = AccCircBuffer.Data.AXIS_Z;
+  LegacyCtx.CircBuffIndexForFft = accCircBuffIndexForFft;
+  LegacyCtx.FftS = fftS;
+  LegacyCtx.WindowScaleFactor = Window_Scale_Factor;
+  LegacyCtx.MagSize = magSize;
+  LegacyCtx.SumCnt = AccSumCnt;
+  LegacyCtx.MagResults = AccAxesMagResults;
+
+  if (MotionSP_CtxFrequencyDomainProcess(&LegacyCtx, FinishAvgFlag))
   {
-    // Save the Max FFT Number evaluated
-    AccAxesMagResults.Z_FFT_AVG = AccSumCnt.AXIS_Z;
-    // Reset the FFT AVG Number for axis evaluated
-    AccSumCnt.AXIS_Z = 0;
-    // AVG available
-    AvgRdy.zAccAvgRdy = 1;
-  }
-
-  /* ---------------------------- Finish ----------------------------------*/
-  if (AvgRdy.xAccAvgRdy & AvgRdy.yAccAvgRdy & AvgRdy.zAccAvgRdy) 
-  {
-    MotionSP_fftAdapt(&AccAxesAvgMagBuff, magSize);
-    MotionSP_fftFindPeak(&AccAxesAvgMagBuff, magSize, &AccAxesMagResults);
-
-
-#ifdef USE_SUBRANGE	
+#ifdef USE_SUBRANGE
     MotionSP_evalMaxAmplitudeRange (AccAxesAvgMagBuff.AXIS_X, MotionSP_Parameters.subrange_num, SRAmplitude.AXIS_X, SRBinVal.AXIS_X);
     MotionSP_evalMaxAmplitudeRange (AccAxesAvgMagBuff.AXIS_Y, MotionSP_Parameters.subrange_num, SRAmplitude.AXIS_Y, SRBinVal.AXIS_Y);
     MotionSP_evalMaxAmplitudeRange (AccAxesAvgMagBuff.AXIS_Z, MotionSP_Parameters.subrange_num, SRAmplitude.AXIS_Z, SRBinVal.AXIS_Z);
 #endif /* USE_SUBRANGE */
-
-    AvgRdy.xAccAvgRdy = 0;
-    AvgRdy.yAccAvgRdy = 0;
-    AvgRdy.zAccAvgRdy = 0;
   }
+
+  AccSumCnt = LegacyCtx.SumCnt;
+  AccAxesMagResults = LegacyCtx.MagResults;
 }
 
 /**
@@ -1071,6 +1628,348 @@ void MotionSP_evalMaxAmplitudeRange(float *pfftCmplxMagAxis, uint16_t subrange,
   }
 }
 
+/**
+  * @brief  Initialize a MotionSP context on caller supplied memory
+  * @param  pCtx Pointer to the context
+  * @param  pMem Pointer to the memory, at least MOTIONSP_CTX_MEM_SIZE(FftSize, CircSize) floats
+  * @param  MemSize Number of floats available in pMem
+  * @param  FftSize FFT size (FFT_SIZE_256 ... FFT_SIZE_2048)
+  * @param  CircSize Circular buffer size for each axis, not lower than FftSize
+  * @retval 0 in case of success
+  * @retval 1 in case of failure
+  */
+uint8_t MotionSP_CtxInit(MotionSP_Ctx_t *pCtx, float *pMem, uint32_t MemSize, uint16_t FftSize, uint16_t CircSize)
+{
+  uint16_t magSize = FftSize / 2;
+
+  if ((pCtx == NULL) || (pMem == NULL) || (CircSize < FftSize) || (MemSize < MOTIONSP_CTX_MEM_SIZE(FftSize, CircSize)))
+  {
+    return 1;
+  }
+
+  memset((void *)pCtx, 0, sizeof(MotionSP_Ctx_t));
+
+  if (arm_rfft_fast_init_f32(&pCtx->FftS, FftSize) != ARM_MATH_SUCCESS)
+  {
+    return 1;
+  }
+
+  pCtx->AccCircBuff.Size = CircSize;
+  pCtx->AccCircBuff.Array.X = pMem;
+  pCtx->AccCircBuff.Array.Y = pCtx->AccCircBuff.Array.X + CircSize;
+  pCtx->AccCircBuff.Array.Z = pCtx->AccCircBuff.Array.Y + CircSize;
+  pCtx->pWindow = pCtx->AccCircBuff.Array.Z + CircSize;
+  pCtx->pFftIn = pCtx->pWindow + FftSize;
+  pCtx->pFftTmp = pCtx->pFftIn + FftSize;
+  pCtx->AvgMag.X = pCtx->pFftTmp + FftSize;
+  pCtx->AvgMag.Y = pCtx->AvgMag.X + magSize;
+  pCtx->AvgMag.Z = pCtx->AvgMag.Y + magSize;
+  pCtx->MagSize = magSize;
+
+  pCtx->Parameters.FftSize = FftSize;
+  pCtx->Parameters.tau = TAU_DEFAULT;
+  pCtx->Parameters.td_type = TD_DEFAULT;
+  pCtx->Parameters.tacq = TACQ_DEFAULT;
+  pCtx->Parameters.FftOvl = FFT_OVL_DEFAULT;
+
+  MotionSP_CtxSetWindow(pCtx, WINDOW_DEFAULT);
+  MotionSP_CtxReset(pCtx);
+
+  return 0;
+}
+
+/**
+  * @brief  Reset the circular buffer and all the results of a MotionSP context
+  * @param  pCtx Pointer to the context
+  * @return none
+  */
+void MotionSP_CtxReset(MotionSP_Ctx_t *pCtx)
+{
+  memset((void *)pCtx->AccCircBuff.Array.X, 0, pCtx->AccCircBuff.Size * sizeof(float));
+  memset((void *)pCtx->AccCircBuff.Array.Y, 0, pCtx->AccCircBuff.Size * sizeof(float));
+  memset((void *)pCtx->AccCircBuff.Array.Z, 0, pCtx->AccCircBuff.Size * sizeof(float));
+  pCtx->AccCircBuff.IdPos = 0;
+  pCtx->AccCircBuff.Ovf = 0;
+  pCtx->CircBuffIndexForFft = pCtx->Parameters.FftSize - 1; /* It is the minimum value to do the first FFT */
+
+  memset((void *)&pCtx->TimeDomain, 0, sizeof(sAcceleroParam_t));
+  memset((void *)&pCtx->TdState, 0, sizeof(sTimeDomainState_t));
+  memset((void *)&pCtx->SumCnt, 0, sizeof(sSumCnt_t));
+  memset((void *)&pCtx->MagResults, 0, sizeof(sAxesMagResults_t));
+  pCtx->AvgRdy = 0;
+}
+
+/**
+  * @brief  Set the window filtering of a MotionSP context
+  * @param  pCtx Pointer to the context
+  * @param  Ftype Filtering method
+  * @return none
+  */
+void MotionSP_CtxSetWindow(MotionSP_Ctx_t *pCtx, Filt_Type_t Ftype)
+{
+  pCtx->Parameters.window = (uint16_t)Ftype;
+  MotionSP_WindowCoeffsSet(pCtx->pWindow, pCtx->Parameters.FftSize, Ftype, &pCtx->WindowScaleFactor);
+}
+
+/**
+  * @brief  Set the real accelerometer ODR of a MotionSP context
+  * @param  pCtx Pointer to the context
+  * @param  Frequency Measured accelerometer ODR in Hz
+  * @return none
+  */
+void MotionSP_CtxSetOdr(MotionSP_Ctx_t *pCtx, float Frequency)
+{
+  pCtx->AcceleroODR.Frequency = Frequency;
+
+  if (Frequency != 0)
+  {
+    pCtx->AcceleroODR.Period = 1 / Frequency;
+  }
+
+  pCtx->AcceleroODR.Tau = expf(-(1000.0f * pCtx->AcceleroODR.Period) / pCtx->Parameters.tau);
+}
+
+/**
+  * @brief  Enable the Goertzel bank of a MotionSP context
+  * @param  pCtx Pointer to the context, its accelerometer ODR has to be already set
+  * @param  pFreq Pointer to the frequencies in Hz of the tones to be tracked
+  * @param  Num Number of tones (up to TONE_BANK_SIZE_MAX), 0 to disable the bank
+  * @param  BlockSize Number of samples for each evaluation, the resolution is ODR / BlockSize
+  * @retval 0 in case of success
+  * @retval 1 in case of failure
+  *
+  * @details More details
+  * The tone frequencies do not need to be on the FFT bins. The amplitudes are evaluated
+  * with a rectangular window and refreshed every BlockSize samples in pCtx->ToneBank.
+  */
+uint8_t MotionSP_CtxToneBankInit(MotionSP_Ctx_t *pCtx, const float *pFreq, uint8_t Num, uint16_t BlockSize)
+{
+  sToneBank_t *pBank = &pCtx->ToneBank;
+  float fs = pCtx->AcceleroODR.Frequency;
+
+  memset((void *)pBank, 0, sizeof(sToneBank_t));
+
+  if (Num == 0)
+  {
+    return 0;
+  }
+
+  if ((pFreq == NULL) || (Num > TONE_BANK_SIZE_MAX) || (BlockSize == 0) || (fs <= 0.0f))
+  {
+    return 1;
+  }
+
+  for (uint8_t t = 0; t < Num; t++)
+  {
+    if ((pFreq[t] < 0.0f) || (pFreq[t] >= (fs / 2)))
+    {
+      return 1;
+    }
+    pBank->Tone[t].Freq = pFreq[t];
+    pBank->Tone[t].Coeff = 2 * arm_cos_f32(2 * PI * pFreq[t] / fs);
+  }
+
+  pBank->BlockSize = BlockSize;
+  pBank->Num = Num;
+
+  return 0;
+}
+
+/**
+  * @brief  Enable the envelope spectrum of a MotionSP context
+  * @param  pCtx Pointer to the context, its accelerometer ODR has to be already set
+  * @param  pMem Pointer to the memory, at least MOTIONSP_ENV_MEM_SIZE(FftSize, Decimation) floats
+  * @param  MemSize Number of floats available in pMem
+  * @param  BandLow Band-pass filter low cut-off frequency in Hz
+  * @param  BandHigh Band-pass filter high cut-off frequency in Hz
+  * @param  Decimation Decimation factor of the envelope, FftSize / Decimation has to be a valid RFFT size
+  * @retval 0 in case of success
+  * @retval 1 in case of failure
+  */
+uint8_t MotionSP_CtxEnvelopeInit(MotionSP_Ctx_t *pCtx, float *pMem, uint32_t MemSize, float BandLow, float BandHigh, uint16_t Decimation)
+{
+  sEnvelope_t *pEnv = &pCtx->Envelope;
+  float fs = pCtx->AcceleroODR.Frequency;
+  uint16_t envSize;
+
+  pEnv->FftSize = 0;
+
+  if ((pMem == NULL) || (Decimation == 0) || (fs <= 0.0f) || (BandLow <= 0.0f) || (BandHigh <= BandLow) || (BandHigh >= (fs / 2)))
+  {
+    return 1;
+  }
+
+  envSize = pCtx->Parameters.FftSize / Decimation;
+
+  if (MemSize < MOTIONSP_ENV_MEM_SIZE(pCtx->Parameters.FftSize, Decimation))
+  {
+    return 1;
+  }
+
+  if (arm_rfft_fast_init_f32(&pEnv->FftS, envSize) != ARM_MATH_SUCCESS)
+  {
+    return 1;
+  }
+
+  MotionSP_BiquadCoeffsSet(&pEnv->BandPassCoeffs[0], BandLow, fs, 1);
+  MotionSP_BiquadCoeffsSet(&pEnv->BandPassCoeffs[5], BandHigh, fs, 0);
+  arm_biquad_cascade_df1_init_f32(&pEnv->BandPass, 2, pEnv->BandPassCoeffs, pEnv->BandPassState);
+
+  /* 4th order low-pass, also used as anti-aliasing filter before decimation */
+  MotionSP_BiquadCoeffsSet(&pEnv->LowPassCoeffs[0], fs / (2.5f * Decimation), fs, 0);
+  MotionSP_BiquadCoeffsSet(&pEnv->LowPassCoeffs[5], fs / (2.5f * Decimation), fs, 0);
+  arm_biquad_cascade_df1_init_f32(&pEnv->LowPass, 2, pEnv->LowPassCoeffs, pEnv->LowPassState);
+
+  pEnv->Decimation = Decimation;
+  pEnv->BinFreqStep = (fs / Decimation) / envSize;
+  pEnv->pIn = pMem;
+  pEnv->Mag.X = pEnv->pIn + envSize;
+  pEnv->Mag.Y = pEnv->Mag.X + (envSize / 2);
+  pEnv->Mag.Z = pEnv->Mag.Y + (envSize / 2);
+  memset((void *)&pEnv->Max, 0, sizeof(pEnv->Max));
+  pEnv->FftSize = envSize;
+
+  return 0;
+}
+
+/**
+  * @brief  Time Domain Processing of a block of accelerometer samples on a MotionSP context
+  * @param  pCtx Pointer to the context
+  * @param  pSamples Pointer to the accelerometer samples in mg
+  * @param  Samples Number of accelerometer samples
+  * @param  Restart Flag to reInit internal value on the first sample
+  * @return Number of processed samples, the processing stops as soon as the circular buffer overflows
+  */
+uint16_t MotionSP_CtxTimeDomainProcessBlock(MotionSP_Ctx_t *pCtx, const SensorVal_f_t *pSamples, uint16_t Samples, uint8_t Restart)
+{
+  sCircBuff_t *pCircBuff = &pCtx->AccCircBuff;
+  uint16_t cnt;
+  uint16_t pos;
+
+  pos = pCircBuff->IdPos + 1;
+  if (pos == pCircBuff->Size)
+  {
+    pos = 0;
+  }
+
+  cnt = MotionSP_TD_Block(&pCtx->TdState, &pCtx->TimeDomain, &pCircBuff->Array, pCircBuff->Size, &pCircBuff->IdPos,
+                          &pCircBuff->Ovf, &pCtx->AcceleroODR, (Td_Type_t)pCtx->Parameters.td_type, pSamples, Samples, Restart);
+
+  /* Track the targeted tones on the new samples, they wrap at most once in the circular buffer */
+  if (pCtx->ToneBank.Num != 0)
+  {
+    uint16_t first = pCircBuff->Size - pos;
+
+    if (cnt < first)
+    {
+      first = cnt;
+    }
+    MotionSP_ToneBankUpdate(&pCtx->ToneBank, &pCircBuff->Array.X[pos], &pCircBuff->Array.Y[pos], &pCircBuff->Array.Z[pos], first);
+    MotionSP_ToneBankUpdate(&pCtx->ToneBank, pCircBuff->Array.X, pCircBuff->Array.Y, pCircBuff->Array.Z, cnt - first);
+  }
+
+  return cnt;
+}
+
+/**
+  * @brief  Enable the statistical features of a MotionSP context
+  * @param  pCtx Pointer to the context
+  * @param  Enable 1 to evaluate the features on each FFT window, 0 to skip them
+  * @return none
+  *
+  * @details More details
+  * The features are disabled by MotionSP_CtxInit. When they are disabled, pCtx->Features
+  * is cleared and no more updated.
+  */
+void MotionSP_CtxFeaturesEnable(MotionSP_Ctx_t *pCtx, uint8_t Enable)
+{
+  pCtx->FeaturesEn = (Enable != 0) ? 1 : 0;
+
+  if (pCtx->FeaturesEn == 0)
+  {
+    memset((void *)&pCtx->Features, 0, sizeof(sFrameFeatures_t));
+  }
+}
+
+/**
+  * @brief  Frequency Domain Processing on a MotionSP context
+  * @param  pCtx Pointer to the context
+  * @param  FinishAvg Flag to finish the FFT average
+  * @retval 1 if new averaged magnitude values are available in pCtx->AvgMag
+  * @retval 0 otherwise
+  *
+  * @details More details
+  * pCtx->Features and pCtx->Envelope, if enabled, are updated on each call.
+  */
+uint8_t MotionSP_CtxFrequencyDomainProcess(MotionSP_Ctx_t *pCtx, uint8_t FinishAvg)
+{
+  uint16_t fftSize = pCtx->Parameters.FftSize;
+  float *pCirc[NUM_AXES] = {pCtx->AccCircBuff.Array.X, pCtx->AccCircBuff.Array.Y, pCtx->AccCircBuff.Array.Z};
+  float *pAvg[NUM_AXES] = {pCtx->AvgMag.X, pCtx->AvgMag.Y, pCtx->AvgMag.Z};
+  uint16_t *pSumCnt[NUM_AXES] = {&pCtx->SumCnt.AXIS_X, &pCtx->SumCnt.AXIS_Y, &pCtx->SumCnt.AXIS_Z};
+  uint16_t *pFftAvg[NUM_AXES] = {&pCtx->MagResults.X_FFT_AVG, &pCtx->MagResults.Y_FFT_AVG, &pCtx->MagResults.Z_FFT_AVG};
+  float *pRms[NUM_AXES] = {&pCtx->Features.Rms.AXIS_X, &pCtx->Features.Rms.AXIS_Y, &pCtx->Features.Rms.AXIS_Z};
+  float *pPeak[NUM_AXES] = {&pCtx->Features.Peak.AXIS_X, &pCtx->Features.Peak.AXIS_Y, &pCtx->Features.Peak.AXIS_Z};
+  float *pCrest[NUM_AXES] = {&pCtx->Features.CrestFactor.AXIS_X, &pCtx->Features.CrestFactor.AXIS_Y, &pCtx->Features.CrestFactor.AXIS_Z};
+  float *pKurt[NUM_AXES] = {&pCtx->Features.Kurtosis.AXIS_X, &pCtx->Features.Kurtosis.AXIS_Y, &pCtx->Features.Kurtosis.AXIS_Z};
+  float *pEnvMag[NUM_AXES] = {pCtx->Envelope.Mag.X, pCtx->Envelope.Mag.Y, pCtx->Envelope.Mag.Z};
+  sMaxOnArray_t *pEnvMax[NUM_AXES] = {&pCtx->Envelope.Max.X, &pCtx->Envelope.Max.Y, &pCtx->Envelope.Max.Z};
+  uint8_t axis;
+
+  for (axis = 0; axis < NUM_AXES; axis++)
+  {
+    /* Freeze the Accelerometer data to analyze */
+    MotionSP_fftInBuild(pCtx->pFftIn, fftSize, pCirc[axis], pCtx->AccCircBuff.Size, pCtx->CircBuffIndexForFft);
+
+    /* Statistical features over the same window */
+    if (pCtx->FeaturesEn != 0)
+    {
+      MotionSP_FeaturesEval(pCtx->pFftIn, fftSize, pRms[axis], pPeak[axis], pCrest[axis], pKurt[axis]);
+    }
+
+    /* Envelope spectrum over the same window */
+    if (pCtx->Envelope.FftSize != 0)
+    {
+      MotionSP_EnvelopeEval(&pCtx->Envelope, pCtx->pFftIn, fftSize, pCtx->pFftTmp, pEnvMag[axis]);
+      arm_max_f32(pEnvMag[axis], pCtx->Envelope.FftSize / 2, &pEnvMax[axis]->value, &pEnvMax[axis]->loc);
+    }
+
+    /* Apply the Windowing before to perform FFT */
+    motionSP_fftUseWindow(pCtx->pFftIn, pCtx->pFftIn, fftSize, pCtx->pWindow);
+
+    /* The FFT input is no more needed after the transform, reuse it for the magnitude */
+    arm_rfft_fast_f32(&pCtx->FftS, pCtx->pFftIn, pCtx->pFftTmp, 0);
+    arm_cmplx_mag_f32(pCtx->pFftTmp, pCtx->pFftIn, fftSize / 2);
+
+    if (MotionSP_fftAverageCalcTime(pAvg[axis], pCtx->pFftIn, pCtx->MagSize, pSumCnt[axis], FinishAvg))
+    {
+      // Save the Max FFT Number evaluated
+      *pFftAvg[axis] = *pSumCnt[axis];
+      // Reset the FFT AVG Number for axis evaluated
+      *pSumCnt[axis] = 0;
+      // AVG available
+      pCtx->AvgRdy |= (uint8_t)(1U << axis);
+    }
+  }
+
+  if (pCtx->AvgRdy != ((1U << NUM_AXES) - 1U))
+  {
+    return 0;
+  }
+
+  MotionSP_MagAdapt(pCtx->AvgMag.X, pCtx->MagSize, pCtx->WindowScaleFactor);
+  MotionSP_MagAdapt(pCtx->AvgMag.Y, pCtx->MagSize, pCtx->WindowScaleFactor);
+  MotionSP_MagAdapt(pCtx->AvgMag.Z, pCtx->MagSize, pCtx->WindowScaleFactor);
+
+  arm_max_f32(pCtx->AvgMag.X, pCtx->MagSize, &pCtx->MagResults.X_Value, &pCtx->MagResults.X_Index);
+  arm_max_f32(pCtx->AvgMag.Y, pCtx->MagSize, &pCtx->MagResults.Y_Value, &pCtx->MagResults.Y_Index);
+  arm_max_f32(pCtx->AvgMag.Z, pCtx->MagSize, &pCtx->MagResults.Z_Value, &pCtx->MagResults.Z_Index);
+
+  pCtx->AvgRdy = 0;
+
+  return 1;
+}
+
 /**
   * @brief Get real accelerometer ODR
   * @return sAcceleroODR_t Pointer to the real accelerometer ODR
@@ -1107,6 +2006,25 @@ sTimeDomainData_t *MotionSP_GetTimeDomainData(void)
   return &TimeDomainData;
 }
 
+/**
+  * @brief  Enable the statistical features of the global API, disabled by default
+  * @param  Enable 1 to evaluate the features on each FFT window, 0 to skip them
+  * @return none
+  */
+void MotionSP_FeaturesEnable(uint8_t Enable)
+{
+  MotionSP_CtxFeaturesEnable(&LegacyCtx, Enable);
+}
+
+/**
+  * @brief Get statistical features of the last FFT window
+  * @return sFrameFeatures_t Pointer to the statistical features, updated only if enabled by MotionSP_FeaturesEnable
+  */
+sFrameFeatures_t *MotionSP_GetFrameFeatures(void)
+{
+  return &LegacyCtx.Features;
+}
+
 /**
   * @}
   */
@@ -0,0 +1,508 @@
+/**
+  ******************************************************************************
+  * @file           : MotionSP_PortableDsp.c
+  * @author         : System Research & Applications Team - Catania Lab
+  * @version        : v2.2.2
+  * @date           : 20-Nov-2024
+  * @brief          : Portable reference implementation of the CMSIS-DSP subset
+  *                   used by MotionSP (host builds only)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018-2019 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifdef MOTIONSP_PORTABLE_DSP
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <string.h>
+#include "MotionSP_PortableDsp.h"
+
+/* Private define ------------------------------------------------------------*/
+#define PORTABLE_DSP_PI    3.14159265358979323846  //!< Double precision PI for twiddle generation
+
+/** @addtogroup MIDDLEWARES Middlewares
+  * @{
+  */
+
+/** @addtogroup ST ST
+  * @{
+  */
+
+/** @addtogroup STM32_MOTIONSP_LIB STM32 Motion Signal Processing Library
+  * @{
+  */
+
+/** @addtogroup STM32_MOTIONSP_LIB_PORTABLE_DSP STM32 Motion Signal Processing Library Portable DSP
+  * @{
+  */
+
+/** @addtogroup STM32_MOTIONSP_LIB_PORTABLE_DSP_PRIVATE_FUNCTIONS STM32 Motion Signal Processing Library Portable DSP Private Functions
+  * @{
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+static void MotionSP_PortableCfft(float32_t *pData, uint16_t Len, uint8_t Inverse);
+
+/**
+  *  @brief  In-place radix-2 complex FFT (interleaved re/im, unscaled)
+  *  @param  pData pointer to Len complex samples
+  *  @param  Len number of complex samples, power of 2
+  *  @param  Inverse 0 for forward transform, 1 for inverse
+  *  @return none
+  */
+static void MotionSP_PortableCfft(float32_t *pData, uint16_t Len, uint8_t Inverse)
+{
+  uint32_t i, j, k, span;
+  float32_t tmp;
+
+  /* Bit reversal permutation */
+  for (i = 1, j = 0; i < Len; i++)
+  {
+    uint32_t bit = (uint32_t)Len >> 1;
+
+    for (; (j & bit) != 0U; bit >>= 1)
+    {
+      j ^= bit;
+    }
+    j ^= bit;
+
+    if (i < j)
+    {
+      tmp = pData[2U * i];
+      pData[2U * i] = pData[2U * j];
+      pData[2U * j] = tmp;
+      tmp = pData[2U * i + 1U];
+      pData[2U * i + 1U] = pData[2U * j + 1U];
+      pData[2U * j + 1U] = tmp;
+    }
+  }
+
+  /* Butterflies, twiddles from a double precision recurrence */
+  for (span = 1; span < Len; span <<= 1)
+  {
+    double theta = ((Inverse != 0U) ? PORTABLE_DSP_PI : -PORTABLE_DSP_PI) / (double)span;
+    double wpr = cos(theta);
+    double wpi = sin(theta);
+    double wr = 1.0;
+    double wi = 0.0;
+
+    for (k = 0; k < span; k++)
+    {
+      float32_t twr = (float32_t)wr;
+      float32_t twi = (float32_t)wi;
+      double wtmp;
+
+      for (i = k; i < Len; i += 2U * span)
+      {
+        uint32_t a = 2U * i;
+        uint32_t b = 2U * (i + span);
+        float32_t tr = (twr * pData[b]) - (twi * pData[b + 1U]);
+        float32_t ti = (twr * pData[b + 1U]) + (twi * pData[b]);
+
+        pData[b] = pData[a] - tr;
+        pData[b + 1U] = pData[a + 1U] - ti;
+        pData[a] += tr;
+        pData[a + 1U] += ti;
+      }
+
+      wtmp = wr;
+      wr = (wr * wpr) - (wi * wpi);
+      wi = (wi * wpr) + (wtmp * wpi);
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32_MOTIONSP_LIB_PORTABLE_DSP_EXPORTED_FUNCTIONS STM32 Motion Signal Processing Library Portable DSP Exported Functions
+  * @{
+  */
+
+/**
+  *  @brief  Initialize the real FFT instance
+  *  @param  S pointer to the instance
+  *  @param  fftLen length of the real sequence (32 to 4096, power of 2)
+  *  @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+  */
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen)
+{
+  /* Same lengths as the CMSIS-DSP implementation */
+  if ((fftLen < 32U) || (fftLen > 4096U) || ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->fftLenRFFT = fftLen;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  *  @brief  Real FFT with CMSIS packed spectrum layout
+  *  @param  S pointer to the instance
+  *  @param  p pointer to the input buffer
+  *  @param  pOut pointer to the output buffer
+  *  @param  ifftFlag 0 for forward transform, 1 for inverse (scaled by 1/N)
+  *  @return none
+  *  @note   Forward output is {X[0], X[N/2], Re X[1], Im X[1], ...}.
+  *          Unlike CMSIS-DSP, the input buffer is left untouched.
+  */
+void arm_rfft_fast_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag)
+{
+  uint16_t fftLen = S->fftLenRFFT;
+  uint16_t half = fftLen / 2U;
+  double theta = -2.0 * PORTABLE_DSP_PI / (double)fftLen;
+  uint32_t k;
+
+  if (pOut != p)
+  {
+    memcpy((void *)pOut, (void *)p, fftLen * sizeof(float32_t));
+  }
+
+  if (ifftFlag == 0U)
+  {
+    float32_t z0r;
+
+    MotionSP_PortableCfft(pOut, half, 0);
+
+    z0r = pOut[0];
+    pOut[0] = z0r + pOut[1];
+    pOut[1] = z0r - pOut[1];
+
+    for (k = 1; k <= (half / 2U); k++)
+    {
+      float32_t *pA = &pOut[2U * k];
+      float32_t *pB = &pOut[2U * (half - k)];
+      float32_t wr = (float32_t)cos(theta * (double)k);
+      float32_t wi = (float32_t)sin(theta * (double)k);
+      /* Fe = (Z[k] + conj(Z[N/2-k])) / 2, Fo = -j * (Z[k] - conj(Z[N/2-k])) / 2 */
+      float32_t eRe = 0.5f * (pA[0] + pB[0]);
+      float32_t eIm = 0.5f * (pA[1] - pB[1]);
+      float32_t oRe = 0.5f * (pA[1] + pB[1]);
+      float32_t oIm = -0.5f * (pA[0] - pB[0]);
+      float32_t tr = (wr * oRe) - (wi * oIm);
+      float32_t ti = (wr * oIm) + (wi * oRe);
+
+      /* X[k] = Fe + W^k Fo, X[N/2-k] = conj(Fe - W^k Fo) */
+      pA[0] = eRe + tr;
+      pA[1] = eIm + ti;
+      pB[0] = eRe - tr;
+      pB[1] = ti - eIm;
+    }
+  }
+  else
+  {
+    float32_t x0 = pOut[0];
+    float32_t scale = 1.0f / (float32_t)half;
+
+    pOut[0] = 0.5f * (x0 + pOut[1]);
+    pOut[1] = 0.5f * (x0 - pOut[1]);
+
+    for (k = 1; k <= (half / 2U); k++)
+    {
+      float32_t *pA = &pOut[2U * k];
+      float32_t *pB = &pOut[2U * (half - k)];
+      float32_t wr = (float32_t)cos(theta * (double)k);
+      float32_t wi = (float32_t)sin(theta * (double)k);
+      /* Fe = (X[k] + conj(X[N/2-k])) / 2, Fo = (X[k] - conj(X[N/2-k])) / (2 W^k) */
+      float32_t eRe = 0.5f * (pA[0] + pB[0]);
+      float32_t eIm = 0.5f * (pA[1] - pB[1]);
+      float32_t dr = 0.5f * (pA[0] - pB[0]);
+      float32_t di = 0.5f * (pA[1] + pB[1]);
+      float32_t oRe = (dr * wr) + (di * wi);
+      float32_t oIm = (di * wr) - (dr * wi);
+
+      /* Z[k] = Fe + j Fo, Z[N/2-k] = conj(Fe - j Fo) */
+      pA[0] = eRe - oIm;
+      pA[1] = eIm + oRe;
+      pB[0] = eRe + oIm;
+      pB[1] = oRe - eIm;
+    }
+
+    MotionSP_PortableCfft(pOut, half, 1);
+
+    for (k = 0; k < fftLen; k++)
+    {
+      pOut[k] *= scale;
+    }
+  }
+}
+
+/**
+  *  @brief  Magnitude of interleaved complex samples
+  *  @param  pSrc pointer to the complex input
+  *  @param  pDst pointer to the real output
+  *  @param  numSamples number of complex samples
+  *  @return none
+  */
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+  uint32_t i;
+
+  for (i = 0; i < numSamples; i++)
+  {
+    float32_t re = pSrc[2U * i];
+    float32_t im = pSrc[2U * i + 1U];
+
+    pDst[i] = sqrtf((re * re) + (im * im));
+  }
+}
+
+/**
+  *  @brief  Element-wise multiplication
+  *  @param  pSrcA pointer to the first input
+  *  @param  pSrcB pointer to the second input
+  *  @param  pDst pointer to the output
+  *  @param  blockSize number of samples
+  *  @return none
+  */
+void arm_mult_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+  uint32_t i;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    pDst[i] = pSrcA[i] * pSrcB[i];
+  }
+}
+
+/**
+  *  @brief  Element-wise absolute value
+  *  @param  pSrc pointer to the input
+  *  @param  pDst pointer to the output
+  *  @param  blockSize number of samples
+  *  @return none
+  */
+void arm_abs_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+  uint32_t i;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    pDst[i] = fabsf(pSrc[i]);
+  }
+}
+
+/**
+  *  @brief  Multiply a vector by a scalar
+  *  @param  pSrc pointer to the input
+  *  @param  scale scale factor
+  *  @param  pDst pointer to the output
+  *  @param  blockSize number of samples
+  *  @return none
+  */
+void arm_scale_f32(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize)
+{
+  uint32_t i;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    pDst[i] = pSrc[i] * scale;
+  }
+}
+
+/**
+  *  @brief  Add a scalar offset to a vector
+  *  @param  pSrc pointer to the input
+  *  @param  offset offset to add
+  *  @param  pDst pointer to the output
+  *  @param  blockSize number of samples
+  *  @return none
+  */
+void arm_offset_f32(const float32_t *pSrc, float32_t offset, float32_t *pDst, uint32_t blockSize)
+{
+  uint32_t i;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    pDst[i] = pSrc[i] + offset;
+  }
+}
+
+/**
+  *  @brief  Mean value of a vector
+  *  @param  pSrc pointer to the input
+  *  @param  blockSize number of samples
+  *  @param  pResult pointer to the mean value
+  *  @return none
+  */
+void arm_mean_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult)
+{
+  float32_t sum = 0.0f;
+  uint32_t i;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    sum += pSrc[i];
+  }
+
+  *pResult = sum / (float32_t)blockSize;
+}
+
+/**
+  *  @brief  Maximum value of a vector and its first position
+  *  @param  pSrc pointer to the input
+  *  @param  blockSize number of samples
+  *  @param  pResult pointer to the maximum value
+  *  @param  pIndex pointer to the index of the maximum value
+  *  @return none
+  */
+void arm_max_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult, uint32_t *pIndex)
+{
+  float32_t maxVal = pSrc[0];
+  uint32_t maxIdx = 0;
+  uint32_t i;
+
+  for (i = 1; i < blockSize; i++)
+  {
+    if (pSrc[i] > maxVal)
+    {
+      maxVal = pSrc[i];
+      maxIdx = i;
+    }
+  }
+
+  *pResult = maxVal;
+  *pIndex = maxIdx;
+}
+
+/**
+  *  @brief  Initialize the Biquad cascade filter and clear its state
+  *  @param  S pointer to the instance
+  *  @param  numStages number of 2nd order stages
+  *  @param  pCoeffs pointer to {b0, b1, b2, a1, a2} for each stage
+  *  @param  pState pointer to the state array, 4*numStages long
+  *  @return none
+  */
+void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32 *S, uint8_t numStages,
+                                     const float32_t *pCoeffs, float32_t *pState)
+{
+  S->numStages = numStages;
+  S->pCoeffs = pCoeffs;
+  memset((void *)pState, 0, 4U * (uint32_t)numStages * sizeof(float32_t));
+  S->pState = pState;
+}
+
+/**
+  *  @brief  Biquad cascade filter, Direct Form I
+  *  @param  S pointer to the instance
+  *  @param  pSrc pointer to the input
+  *  @param  pDst pointer to the output (may alias pSrc)
+  *  @param  blockSize number of samples
+  *  @return none
+  *  @note   y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] + a1*y[n-1] + a2*y[n-2]
+  */
+void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32 *S, const float32_t *pSrc,
+                                float32_t *pDst, uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;
+  const float32_t *pCoeffs = S->pCoeffs;
+  float32_t *pState = S->pState;
+  uint32_t stage, i;
+
+  for (stage = 0; stage < S->numStages; stage++)
+  {
+    float32_t b0 = pCoeffs[0];
+    float32_t b1 = pCoeffs[1];
+    float32_t b2 = pCoeffs[2];
+    float32_t a1 = pCoeffs[3];
+    float32_t a2 = pCoeffs[4];
+    float32_t xn1 = pState[0];
+    float32_t xn2 = pState[1];
+    float32_t yn1 = pState[2];
+    float32_t yn2 = pState[3];
+
+    for (i = 0; i < blockSize; i++)
+    {
+      float32_t xn = pIn[i];
+      float32_t acc = (b0 * xn) + (b1 * xn1) + (b2 * xn2) + (a1 * yn1) + (a2 * yn2);
+
+      xn2 = xn1;
+      xn1 = xn;
+      yn2 = yn1;
+      yn1 = acc;
+      pDst[i] = acc;
+    }
+
+    pState[0] = xn1;
+    pState[1] = xn2;
+    pState[2] = yn1;
+    pState[3] = yn2;
+
+    /* Next stage runs in place on this stage's output */
+    pIn = pDst;
+    pCoeffs += 5;
+    pState += 4;
+  }
+}
+
+/**
+  *  @brief  Sine of an angle in radians
+  *  @param  x input angle
+  *  @return sin(x)
+  */
+float32_t arm_sin_f32(float32_t x)
+{
+  return sinf(x);
+}
+
+/**
+  *  @brief  Cosine of an angle in radians
+  *  @param  x input angle
+  *  @return cos(x)
+  */
+float32_t arm_cos_f32(float32_t x)
+{
+  return cosf(x);
+}
+
+/**
+  *  @brief  Square root
+  *  @param  in input value
+  *  @param  pOut pointer to the square root, 0 for negative input
+  *  @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for negative input
+  */
+arm_status arm_sqrt_f32(float32_t in, float32_t *pOut)
+{
+  if (in >= 0.0f)
+  {
+    *pOut = sqrtf(in);
+    return ARM_MATH_SUCCESS;
+  }
+
+  *pOut = 0.0f;
+  return ARM_MATH_ARGUMENT_ERROR;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* MOTIONSP_PORTABLE_DSP */
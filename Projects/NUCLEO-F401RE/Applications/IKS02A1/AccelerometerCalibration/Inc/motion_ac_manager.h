@@ -52,6 +52,7 @@ void MotionAC_manager_update(MAC_input_t *data_in, uint8_t *is_calibrated);
 void MotionAC_manager_get_params(MAC_output_t *data_out);
 void MotionAC_manager_get_version(char *version, int32_t *length);
 void MotionAC_manager_compensate(MOTION_SENSOR_Axes_t *DataIn, MOTION_SENSOR_Axes_t *DataOut);
+void MotionAC_manager_save_cal(void);
 
 int16_t acc_bias_to_mg(float acc_bias);
 
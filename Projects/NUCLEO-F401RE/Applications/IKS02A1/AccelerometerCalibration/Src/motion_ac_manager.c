@@ -18,6 +18,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "motion_ac_manager.h"
+#include "nvm_store.h"
 
 /** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
   * @{
@@ -112,6 +113,23 @@ void MotionAC_manager_compensate(MOTION_SENSOR_Axes_t *data_in, MOTION_SENSOR_Ax
   data_out->z = (int32_t)ans_float[2];
 }
 
+/**
+  * @brief  Save the calibration parameters in storage and go on calibrating
+  * @note   The library saves them when it is disabled, and loads them back when enabled.
+  * @param  None
+  * @retval None
+  */
+void MotionAC_manager_save_cal(void)
+{
+  MAC_knobs_t knobs;
+
+  /* The initialization resets the knobs */
+  MotionAC_GetKnobs(&knobs);
+  MotionAC_Initialize((uint8_t)MAC_DISABLE_LIB);
+  MotionAC_Initialize((uint8_t)MAC_ENABLE_LIB);
+  (void)MotionAC_SetKnobs(&knobs);
+}
+
 /**
   * @brief  Convert accelerometer bias from [g] to [mg]
   * @param  acc_bias  accelerometer bias in [g]
@@ -143,26 +161,26 @@ int16_t acc_bias_to_mg(float acc_bias)
          No need to call this function, library call this function automatically */
 /**
   * @brief  Load the calibration parameters from storage
-  * @param  data_size  size of data
+  * @param  data_size  size of data [bytes]
   * @param  data  pointer of data
   * @retval Will return 0 the if it is success and 1 if it is failure
   */
 char MotionAC_LoadCalFromNVM(unsigned short int data_size, unsigned int *data)
 {
-  return (char)1; /* FAILURE: Read from NVM not implemented. */
+  return NVM_Calib_Load(NVM_ID_AC_CAL, data_size, data);
 }
 
 /* NOTE: Must be implemented for each platform separately, because its implementation is platform dependent.
          No need to call this function, library call this function automatically */
 /**
   * @brief  Save the calibration parameters in storage
-  * @param  data_size  size of data
+  * @param  data_size  size of data [bytes]
   * @param  data  pointer of data
   * @retval Will return 0 the if it is success and 1 if it is failure
   */
 char MotionAC_SaveCalInNVM(unsigned short int data_size, unsigned int *data)
 {
-  return (char)1; /* FAILURE: Write to NVM not implemented. */
+  return NVM_Calib_Save(NVM_ID_AC_CAL, data_size, data);
 }
 
 /**
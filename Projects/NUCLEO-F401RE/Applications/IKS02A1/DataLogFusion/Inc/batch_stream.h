@@ -0,0 +1,95 @@
+/**
+  *******************************************************************************
+  * @file    batch_stream.h
+  * @author  MEMS Software Solutions Team
+  * @brief   header for batch_stream.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------ */
+#ifndef BATCH_STREAM_H
+#define BATCH_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "serial_protocol.h"
+
+/* Exported defines --------------------------------------------------------*/
+/* Batch content, same bits as the SensorsEnabled masks */
+#define BATCH_PRESS            0x01U
+#define BATCH_TEMP             0x02U
+#define BATCH_HUM              0x04U
+#define BATCH_ACC              0x10U
+#define BATCH_GYR              0x20U
+#define BATCH_MAG              0x40U
+#define BATCH_CONTENT_MASK     (BATCH_PRESS | BATCH_TEMP | BATCH_HUM | BATCH_ACC | BATCH_GYR | BATCH_MAG)
+
+/* Batch encoding flags */
+#define BATCH_FLAG_DELTA       0x01U /* Axes of the samples after the first one coded as int16 deltas */
+#define BATCH_FLAGS_MASK       BATCH_FLAG_DELTA
+
+/* Batched frame layout, after the 3 bytes message header:
+ *   BaseTime [us] | Content | Flags | Count | Sample 0 | Sample 1 ... Sample Count-1
+ *        4            1        1       1
+ * Sample: TimeDelta [us] (uint16, not in sample 0) | Press | Temp | Hum (float) |
+ *         Acc | Gyr | Mag (3 x int32, or 3 x int16 deltas from the previous sample)
+ * Only the sensors in Content are present, all values LSB first.
+ */
+#define BATCH_HEADER_OFFSET    3U
+#define BATCH_HEADER_LEN       7U
+
+/* Room left in the Msg for the largest integrity trailer */
+#define BATCH_MAX_LEN          ((uint32_t)Msg_MaxLen - CRC32_LEN)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Batched sample structure definition
+  */
+typedef struct
+{
+  uint32_t TimeUs;   /* Acquisition time [us] */
+  float Press;       /* [hPa] */
+  float Temp;        /* [degC] */
+  float Hum;         /* [%] */
+  int32_t Acc[3];    /* [mg] */
+  int32_t Gyr[3];    /* [mdps] */
+  int32_t Mag[3];    /* [mGauss] */
+} Batch_Sample_t;
+
+/**
+  * @brief  Batched frame encoder structure definition
+  */
+typedef struct
+{
+  uint8_t Content;     /* Sensors in the frame */
+  uint8_t Flags;       /* Encoding flags */
+  uint8_t MaxSamples;  /* Samples per frame */
+  uint8_t Count;       /* Samples in the frame */
+  uint32_t LastTimeUs; /* Time of the last sample */
+  int32_t Last[9];     /* Axes of the last sample, delta coding reference */
+} Batch_t;
+
+/* Exported functions ------------------------------------------------------- */
+void Batch_Init(Batch_t *Batch, uint8_t Content, uint8_t Flags, uint8_t MaxSamples);
+int32_t Batch_AddSample(Batch_t *Batch, Msg_t *Msg, const Batch_Sample_t *Sample);
+int32_t Batch_Decode(Msg_t *Msg, Batch_Sample_t *Samples, uint32_t MaxSamples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BATCH_STREAM_H */
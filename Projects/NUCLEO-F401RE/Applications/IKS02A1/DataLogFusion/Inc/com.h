@@ -25,9 +25,15 @@ extern "C" {
 #endif
 
 /* Includes ------------------------------------------------------------------*/
+#ifndef COM_HOST_STUB
 #include "main.h"
 #include "serial_protocol.h"
 #include "bsp_ip_conf.h"
+#else
+/* Host build: UART, DMA and core stubs provided by the host program */
+#include "serial_protocol.h"
+#include "com_host_stub.h"
+#endif /* COM_HOST_STUB */
 
 /* Exported types ------------------------------------------------------------*/
 /**
@@ -36,12 +42,66 @@ extern "C" {
 typedef struct
 {
   uint8_t *pDMA_Buffer;
-  uint16_t StartOfMsg;
+  uint16_t StartOfMsg;        /* Next byte of UartRxBuffer to be parsed */
+  volatile uint8_t RxEvent;   /* Set by the reception DMA half/full transfer and idle line events */
+  volatile uint8_t RxRestart; /* Set by the UART error callback, the reception restarts in UART_ReceivedMSG */
+  uint8_t RxState;            /* Reception parser state */
+  uint8_t RxCobsCode;         /* COBS code of the current block, 0 at the frame beginning */
+  uint8_t RxCobsLeft;         /* COBS bytes left in the current block */
 } Uart_Engine_t;
 
+/**
+  * @brief  Serial message transmit queue statistics
+  */
+typedef struct
+{
+  uint32_t Queued;       /* Frames accepted by the queue */
+  uint32_t Sent;         /* Frames completely transmitted */
+  uint32_t Dropped;      /* Frames discarded because the queue was full */
+  uint32_t Overwritten;  /* Queued frames discarded to make room for newer ones */
+  uint8_t Depth;         /* Frames in the queue, including the one being transmitted */
+  uint8_t MaxDepth;      /* Highest depth reached */
+} Uart_TxStats_t;
+
+/**
+  * @brief  Frame built in place in a transmit slot, see UART_FrameBegin
+  */
+typedef struct
+{
+  uint8_t Slot;          /* Transmit slot, UART_TX_NO_SLOT if the frame is dropped */
+  uint8_t Framing;       /* Framing latched at UART_FrameBegin */
+  uint8_t Integrity;     /* Integrity trailer latched at UART_FrameBegin */
+  uint8_t Code;          /* COBS: length code of the current block */
+  uint16_t CodePos;      /* COBS: slot position of the current block code */
+  uint16_t Count;        /* Bytes written into the slot */
+  uint32_t Len;          /* Payload bytes */
+  uint32_t Crc;          /* Running CRC-32 of the payload */
+  uint8_t Chk;           /* Running 8-bit checksum of the payload */
+} Uart_Frame_t;
+
 /* Exported defines ----------------------------------------------------------*/
 #define UART_RX_BUFFER_SIZE (2 * Msg_MaxLen)
-#define UART_TX_BUFFER_SIZE (2 * Msg_MaxLen)
+#define UART_TX_BUFFER_SIZE (2 * Msg_MaxLen + 1) /* Every byte escaped plus the end of frame */
+
+/* Transmit queue: frames are stuffed into one of UART_TX_QUEUE_LEN slots and sent by DMA */
+#define UART_TX_QUEUE_LEN  4U
+#define UART_TX_NO_SLOT    0xFFU
+
+/* Transmit queue policy when all the slots are in use */
+#define UART_TX_DROP_NEWEST       0U /* The new frame is discarded */
+#define UART_TX_OVERWRITE_OLDEST  1U /* The oldest frame not yet on the line is discarded */
+
+/* Message framing, selected at run time by CMD_Set_Framing */
+#define UART_FRAMING_STUFFING  0U /* Msg_BS byte stuffing, Msg_EOF delimiter (up to 2x expansion) */
+#define UART_FRAMING_COBS      1U /* COBS, Msg_COBS_EOF delimiter (1 byte every 254 expansion) */
+
+/* Message integrity trailer, selected at run time by CMD_Set_Integrity */
+#define UART_INTEGRITY_CHK8    0U /* 8-bit additive checksum */
+#define UART_INTEGRITY_CRC32   1U /* CRC-32/MPEG-2, CRC32_LEN bytes LSB first */
+
+#ifndef UART_TX_QUEUE_POLICY
+#define UART_TX_QUEUE_POLICY  UART_TX_DROP_NEWEST
+#endif /* UART_TX_QUEUE_POLICY */
 
 /* Exported variables --------------------------------------------------------*/
 extern volatile uint8_t UartRxBuffer[];
@@ -53,6 +113,14 @@ extern Uart_Engine_t UartEngine;
 void UART_StartReceiveMsg(void);
 int32_t UART_ReceivedMSG(Msg_t *Msg);
 void UART_SendMsg(Msg_t *Msg);
+int32_t UART_SetFraming(uint8_t Framing);
+int32_t UART_SetIntegrity(uint8_t Integrity);
+void UART_GetTxStats(Uart_TxStats_t *Stats);
+int32_t UART_FrameBegin(Uart_Frame_t *Frame);
+void UART_FramePut(Uart_Frame_t *Frame, const uint8_t *Data, uint32_t Len);
+void UART_FrameSerialize(Uart_Frame_t *Frame, uint32_t Source, uint32_t Len);
+void UART_FrameFloat(Uart_Frame_t *Frame, float Data);
+void UART_FrameEnd(Uart_Frame_t *Frame);
 
 #ifdef __cplusplus
 }
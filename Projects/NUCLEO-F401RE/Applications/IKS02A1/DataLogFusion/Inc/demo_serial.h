@@ -27,8 +27,14 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "serial_protocol.h"
 #include "serial_cmd.h"
+#include "com.h"
+#include "batch_stream.h"
+#include "stream_layout.h"
 #include "bsp_ip_conf.h"
 #include "motion_fx_manager.h"
+#include "low_power.h"
+#include "profiler.h"
+#include "resampler.h"
 
 /* Exported types ------------------------------------------------------------*/
 typedef struct
@@ -59,7 +65,8 @@ typedef struct
 #define DEV_ADDR  50U
 #define I2C_DATA_MAX_LENGTH_BYTES  16
 #define MIN(A,B) ((A)<(B)?(A):(B))
-#define OFFLINE_DATA_SIZE  8
+#define OFFLINE_DATA_SIZE  64
+#define OFFLINE_RECORD_LEN  52U /* Offline record size in CMD_Offline_Data and CMD_Offline_Bulk_Data */
 
 /* Enable sensor masks */
 #define PRESSURE_SENSOR       0x00000001U
@@ -84,7 +91,23 @@ extern offline_data_t OfflineData[OFFLINE_DATA_SIZE];
 extern int32_t OfflineDataReadIndex;
 extern int32_t OfflineDataWriteIndex;
 extern int32_t OfflineDataCount;
+extern uint8_t OfflineBulk;
+extern uint16_t OfflineBulkDecimation;
+extern uint32_t OfflineBulkProcessed;
+extern uint32_t OfflineBulkElapsedUs;
+extern uint32_t OfflineBulkBusyUs;
 extern uint32_t AlgoFreq;
+extern uint8_t BatchMaxSamples;
+extern uint8_t BatchFlags;
+extern volatile uint8_t BatchFlushRequest;
+extern uint32_t StreamSelect;
+extern uint32_t SensorTick;
+extern LP_Stats_t LowPower;
+extern uint8_t ResampleMode;
+extern uint16_t ResampleOdr;
+extern uint8_t ResampleActive;
+extern Resampler_t AccResampler;
+extern Resampler_t GyrResampler;
 
 extern uint8_t Enabled6X;
 
@@ -92,6 +115,8 @@ extern uint8_t Enabled6X;
 void BUILD_REPLY_HEADER(Msg_t *Msg);
 void INIT_STREAMING_HEADER(Msg_t *Msg);
 void INIT_STREAMING_MSG(Msg_t *Msg);
+void INIT_STREAMING_FRAME(Uart_Frame_t *Frame, uint8_t Cmd);
+void INIT_BATCH_HEADER(Msg_t *Msg);
 int32_t HandleMSG(Msg_t *Msg);
 
 void RTC_DateRegulate(uint8_t y, uint8_t m, uint8_t d, uint8_t dw);
@@ -54,4 +54,9 @@ void BSP_SENSOR_ACC_GetDRDYStatus(uint8_t *Status);
 void BSP_ACC_GYR_Read_FSM_Data(uint8_t *Data);
 void BSP_ACC_GYR_Read_MLC_Data(uint8_t *Data);
 
+void BSP_ACC_GYR_FIFO_Start(float Bdr);
+void BSP_ACC_GYR_FIFO_Stop(void);
+void BSP_ACC_GYR_FIFO_Get_Num_Samples(uint16_t *NumSamples);
+void BSP_ACC_GYR_FIFO_Get_Sample(uint8_t *Tag, IKS02A1_MOTION_SENSOR_Axes_t *Axes);
+
 #endif /* IKS02A1_MEMS_CONTROL_EX_H */
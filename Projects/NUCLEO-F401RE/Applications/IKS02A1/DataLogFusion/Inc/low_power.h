@@ -0,0 +1,83 @@
+/**
+  *******************************************************************************
+  * @file    low_power.h
+  * @author  MEMS Software Solutions Team
+  * @brief   header for low_power.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------ */
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported defines --------------------------------------------------------*/
+/* Idle policies */
+#define LP_MODE_RUN     0U /* The main loop spins between the ticks */
+#define LP_MODE_SLEEP   1U /* The core sleeps until the next interrupt when no work is pending */
+
+/* Wake-up sources, several may be pending at once */
+#define LP_WAKE_TIMER    0x01U /* Algorithm timer tick */
+#define LP_WAKE_UART     0x02U /* UART reception and transmission, and their DMA */
+#define LP_WAKE_BUTTON   0x04U /* User button */
+#define LP_WAKE_SYSTICK  0x08U /* HAL time base */
+#define LP_WAKE_OTHER    0x10U /* None of the above */
+#define LP_WAKE_COUNT    5U
+
+#define LP_WINDOW_US     1000000U /* Wake-ups per second window */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Low power hardware interface, called by LP_Idle
+  */
+typedef struct
+{
+  uint32_t (*GetTimeUs)(void);    /* Time base [us] */
+  uint32_t (*Pending)(void);      /* Not 0 if work is pending, called with the interrupts masked */
+  void (*Sleep)(void);            /* Sleep until an interrupt is pending, called with the interrupts masked */
+  uint32_t (*WakeSources)(void);  /* LP_WAKE_x pending, called with the interrupts masked */
+  void (*Mask)(void);             /* Mask the interrupts */
+  void (*Unmask)(void);           /* Unmask the interrupts, the pending ones are served */
+} LP_Ctx_t;
+
+/**
+  * @brief  Low power statistics
+  */
+typedef struct
+{
+  uint8_t Mode;                              /* LP_MODE_x */
+  uint32_t ActiveUs;                         /* Time running [us], wraps around */
+  uint32_t IdleUs;                           /* Time sleeping, wake-up interrupts included [us], wraps around */
+  uint32_t Sleeps;                           /* Sleep mode entries */
+  uint32_t Wakeups[LP_WAKE_COUNT];           /* Wake-ups by source, bit index of LP_WAKE_x */
+  uint16_t LastSecond[LP_WAKE_COUNT];        /* Wake-ups by source in the last complete window */
+  uint16_t Window[LP_WAKE_COUNT];            /* Wake-ups by source in the current window */
+  uint32_t WindowStartUs;
+  uint32_t LastUs;                           /* End of the last accounted interval */
+} LP_Stats_t;
+
+/* Exported functions ------------------------------------------------------- */
+void LP_Init(LP_Stats_t *Stats, uint8_t Mode, uint32_t NowUs);
+uint32_t LP_Idle(const LP_Ctx_t *Ctx, LP_Stats_t *Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOW_POWER_H */
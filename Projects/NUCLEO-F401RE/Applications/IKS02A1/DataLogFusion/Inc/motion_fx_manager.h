@@ -48,6 +48,8 @@ void MotionFX_manager_get_version(char *version, int32_t *length);
 void MotionFX_manager_MagCal_run(MFX_MagCal_input_t *data_in, MFX_MagCal_output_t *data_out);
 void MotionFX_manager_MagCal_start(int32_t sampletime);
 void MotionFX_manager_MagCal_stop(int32_t sampletime);
+void MotionFX_manager_MagCal_clear(void);
+void MotionFX_manager_save_gbias(void);
 
 char MotionFX_LoadMagCalFromNVM(unsigned short int dataSize, unsigned int *data);
 char MotionFX_SaveMagCalInNVM(unsigned short int dataSize, unsigned int *data);
@@ -0,0 +1,96 @@
+/**
+  *******************************************************************************
+  * @file    profiler.h
+  * @author  MEMS Software Solutions Team
+  * @brief   header for profiler.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------ */
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifndef PROF_HOST_STUB
+#include "main.h"
+#endif
+
+/* Exported defines --------------------------------------------------------*/
+/* Stages of the application, a stage nested in another one is counted in both */
+#define PROF_STAGE_RX_PARSE   0U  /* UART_ReceivedMSG */
+#define PROF_STAGE_COMMAND    1U  /* HandleMSG */
+#define PROF_STAGE_RTC        2U  /* RTC_Handler */
+#define PROF_STAGE_ACC        3U  /* Accelerometer handler */
+#define PROF_STAGE_GYR        4U  /* Gyroscope handler */
+#define PROF_STAGE_MAG        5U  /* Magnetometer handler */
+#define PROF_STAGE_PRESS      6U  /* Pressure handler */
+#define PROF_STAGE_TEMP       7U  /* Temperature handler */
+#define PROF_STAGE_HUM        8U  /* Humidity handler */
+#define PROF_STAGE_FX         9U  /* MotionFX_manager_run */
+#define PROF_STAGE_FRAME      10U /* Streaming frame build or batching, queuing included */
+#define PROF_STAGE_UART_SEND  11U /* UART_SendMsg: checksum, framing and queuing */
+#define PROF_STAGE_TICK       12U /* Acquisition tick, from the sensor reads to the frame */
+#define PROF_STAGE_FIFO       13U /* FIFO read of the resampled sensors */
+#define PROF_STAGE_COUNT      14U
+
+#define PROF_STAGE_ALL        0xFFU /* Every stage, for Prof_Reset */
+
+/* Histogram: bin 0 counts the runs below 2^(PROF_HIST_SHIFT + 1) cycles, bin n > 0 the runs
+ * in [2^(n + PROF_HIST_SHIFT), 2^(n + PROF_HIST_SHIFT + 1)), the last bin every longer run */
+#define PROF_HIST_BINS        16U
+#define PROF_HIST_SHIFT       6U
+
+/* Cycle counter: the free running DWT counter of the core, a stub in the host build */
+#ifdef PROF_HOST_STUB
+uint32_t Prof_Stub_GetCycles(void);
+#define PROF_GET_CYCLES()     Prof_Stub_GetCycles()
+#else
+#define PROF_GET_CYCLES()     (DWT->CYCCNT)
+#endif
+
+/* Start of a stage run, the value is passed to Prof_End */
+#define PROF_BEGIN()          PROF_GET_CYCLES()
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Statistics of a stage
+  */
+typedef struct
+{
+  uint32_t Count;                  /* Runs */
+  uint32_t MinCycles;
+  uint32_t MaxCycles;
+  uint64_t SumCycles;
+  uint16_t Hist[PROF_HIST_BINS];   /* Runs by duration, saturated at 0xFFFF */
+} Prof_Stage_t;
+
+/* Exported functions ------------------------------------------------------- */
+void Prof_Init(void);
+uint32_t Prof_End(uint8_t Stage, uint32_t Begin);
+void Prof_Add(uint8_t Stage, uint32_t Cycles);
+void Prof_Reset(uint8_t Stage);
+const Prof_Stage_t *Prof_Get(uint8_t Stage);
+uint32_t Prof_Avg(const Prof_Stage_t *Stats);
+uint32_t Prof_Hist_Bin(uint32_t Cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILER_H */
@@ -0,0 +1,89 @@
+/**
+  *******************************************************************************
+  * @file    resampler.h
+  * @author  MEMS Software Solutions Team
+  * @brief   header for resampler.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------ */
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported defines --------------------------------------------------------*/
+/* Resampling modes */
+#define RESAMPLER_MODE_OFF     0U /* No resampling, the newest sample is output */
+#define RESAMPLER_MODE_LINEAR  1U /* Linear interpolation of the two samples around the output time */
+#define RESAMPLER_MODE_FIR     2U /* Polyphase windowed sinc, low pass below the output Nyquist frequency */
+
+#define RESAMPLER_AXES         3U
+#define RESAMPLER_BUF_LEN      32U /* Input samples kept, power of 2: the FIR taps plus the samples of a few ticks */
+#define RESAMPLER_FIR_TAPS     12U /* Taps of a phase, even: half of them are input samples after the output time */
+#define RESAMPLER_FIR_PHASES   16U /* Phases between two input samples, the taps are interpolated in between */
+#define RESAMPLER_FIR_CUTOFF   0.8f /* FIR cutoff, ratio of the lower of the input and output Nyquist frequencies */
+
+/* Input clock recovery of the FIFO batches, see Resampler_Push_Batch */
+#define RESAMPLER_BASE_LEN     1024U /* Samples of the period measurement, between 1 and 2 times this */
+#define RESAMPLER_BASE_MIN     32U   /* Samples before the first period measurement, the nominal one until then */
+#define RESAMPLER_MARGIN_US    2U    /* Read time uncertainty [us] */
+#define RESAMPLER_WANDER       0.0005f /* ODR wander between two batches, ratio of the period */
+#define RESAMPLER_RESYNC       8U    /* Stamp error [input periods] restarting the recovery, e.g. after a FIFO overrun */
+#define RESAMPLER_PERIOD_TOL   0.05f /* Estimated period range, ratio of the nominal period */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Resampler of a three axes stream
+  * @note   The input samples come at the sensor ODR, each with its time stamp; the output
+  *         samples are computed at the algorithm rate, DelayUs before the time requested,
+  *         so that the input samples around the output time are already available.
+  */
+typedef struct
+{
+  uint8_t Mode;                                           /* RESAMPLER_MODE_x */
+  uint32_t TimeUs[RESAMPLER_BUF_LEN];                     /* Input sample times [us], wrap around */
+  int32_t Axes[RESAMPLER_BUF_LEN][RESAMPLER_AXES];        /* Input samples */
+  uint32_t Pushed;                                        /* Input samples pushed, the newest at (Pushed - 1) % RESAMPLER_BUF_LEN */
+  uint32_t DelayUs;                                       /* Output latency [us] */
+  float NominalUs;                                        /* Nominal input period, from the ODR [us] */
+  float PeriodUs;                                         /* Estimated input period [us] */
+  uint32_t LastUs;                                        /* Time of the newest input sample [us] */
+  uint32_t LoUs;                                          /* Bounds of the newest batched sample time [us] */
+  uint32_t HiUs;
+  uint32_t BaseUs;                                        /* Newest sample time at the period measurement start [us] */
+  uint32_t BaseCount;                                     /* Samples produced by then */
+  uint32_t NextUs;                                        /* Newest sample time at the next period measurement start [us] */
+  uint32_t NextCount;
+  uint32_t Outputs;                                       /* Samples output */
+  uint32_t Holds;                                         /* Outputs missing input samples, the previous output is held */
+  int32_t Last[RESAMPLER_AXES];                           /* Previous output */
+  float Coef[RESAMPLER_FIR_PHASES + 1U][RESAMPLER_FIR_TAPS]; /* FIR taps of each phase, unity gain */
+} Resampler_t;
+
+/* Exported functions ------------------------------------------------------- */
+void Resampler_Init(Resampler_t *Rs, uint8_t Mode, float InOdr, float OutFreq);
+void Resampler_Push(Resampler_t *Rs, uint32_t TimeUs, const int32_t *Axes);
+void Resampler_Push_Batch(Resampler_t *Rs, uint32_t ReadUs, const int32_t (*Axes)[RESAMPLER_AXES], uint32_t Count);
+int32_t Resampler_Get(Resampler_t *Rs, uint32_t TimeUs, int32_t *Axes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESAMPLER_H */
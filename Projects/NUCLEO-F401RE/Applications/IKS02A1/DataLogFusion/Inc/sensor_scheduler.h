@@ -0,0 +1,59 @@
+/**
+  *******************************************************************************
+  * @file    sensor_scheduler.h
+  * @author  MEMS Software Solutions Team
+  * @brief   header for sensor_scheduler.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------ */
+#ifndef SENSOR_SCHEDULER_H
+#define SENSOR_SCHEDULER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported defines --------------------------------------------------------*/
+/* Tick running every task whatever its period, e.g. for the offline data records */
+#define SENSOR_SCHED_TICK_ALL  0xFFFFFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Sensor task structure definition
+  * @note   The task runs on tick 0, so that every value is valid from the first frame on,
+  *         then on the ticks Phase, Phase + Period, Phase + 2 * Period ...
+  *         Between two runs the frames carry the value cached by the handler.
+  */
+typedef struct
+{
+  void (*Handler)(void);  /* Sensor handler, reading the sensor into its cached value */
+  uint32_t Mask;          /* SensorsEnabled mask of the sensor, the task is skipped if not enabled */
+  uint16_t Period;        /* [ticks], 1 for every tick */
+  uint16_t Phase;         /* [ticks], lower than Period: spreads the slow sensors over different ticks */
+  uint16_t BusUs;         /* Estimated bus time of a run [us], for Sensor_Sched_BusUs */
+} Sensor_Task_t;
+
+/* Exported functions ------------------------------------------------------- */
+uint32_t Sensor_Sched_Due(const Sensor_Task_t *Task, uint32_t Tick);
+void Sensor_Sched_Run(const Sensor_Task_t *Tasks, uint32_t Count, uint32_t Tick, uint32_t Enabled);
+uint32_t Sensor_Sched_BusUs(const Sensor_Task_t *Tasks, uint32_t Count, uint32_t Tick, uint32_t Enabled);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSOR_SCHEDULER_H */
@@ -38,6 +38,21 @@ extern "C" {
 #define CMD_Offline_Data               0x10 /* Offline data stream */
 #define CMD_Use_Offline_Data           0x11 /* From Msg->Data[3]: uint8_t UseOfflineData (1 ON, 0 OFF) */
 #define CMD_Get_App_Info               0x12 /* From Msg->Data[3]: int32_t AlgoFreq; uint8_t RequiredData; */
+#define CMD_Get_Tx_Stats               0x13 /* From Msg->Data[3]: uint32_t Queued, Sent, Dropped, Overwritten; uint8_t Depth, MaxDepth */
+#define CMD_Set_Framing                0x14 /* From Msg->Data[3]: uint8_t Framing (0 byte stuffing, 1 COBS), replied in the previous framing */
+#define CMD_Set_Integrity              0x15 /* From Msg->Data[3]: uint8_t Integrity (0 8-bit checksum, 1 CRC-32), replied with the previous trailer */
+#define CMD_Set_Batch                  0x16 /* From Msg->Data[3]: uint8_t MaxSamples (0 one frame per sample); uint8_t Flags (BATCH_FLAG_DELTA) */
+#define CMD_Batch_Data_Streaming       0x17 /* Batched samples frame, layout in batch_stream.h */
+#define CMD_Set_Stream_Layout          0x18 /* From Msg->Data[3]: uint32_t Select (STREAM_FIELD_x, STREAM_LAYOUT_FIXED, STREAM_LAYOUT_COMPACT), replied with the layout descriptor */
+#define CMD_Get_Stream_Layout          0x19 /* Replied with the layout descriptor of the enabled sensors, see stream_layout.h */
+#define CMD_Layout_Data_Streaming      0x1A /* Streaming frame with the fields of the layout descriptor */
+#define CMD_Offline_Bulk_Start         0x1B /* From Msg->Data[3]: uint16_t Decimation (one streaming frame every Decimation records, 0 none), replied with uint16_t FreeRecords */
+#define CMD_Offline_Bulk_Data          0x1C /* From Msg->Data[3]: uint8_t Count; Count x OFFLINE_RECORD_LEN records, replied with uint8_t Accepted; uint16_t FreeRecords; uint32_t Processed, ElapsedUs, BusyUs */
+#define CMD_Set_Low_Power              0x1D /* From Msg->Data[3]: uint8_t Mode (LP_MODE_RUN, LP_MODE_SLEEP), the statistics are reset, replied with the previous mode */
+#define CMD_Get_Power_Stats            0x1E /* From Msg->Data[3]: uint8_t Mode; uint32_t ActiveUs, IdleUs, Sleeps; uint32_t Wakeups[5]; uint16_t LastSecond[5] (LP_WAKE_x order) */
+#define CMD_Get_Profile                0x1F /* From Msg->Data[3]: uint8_t Stage (PROF_STAGE_x); uint8_t Reset (optional, 1 resets the stage after the reply), replied with uint8_t Stage, StageCount; uint32_t CoreClockHz, Count, MinCycles, AvgCycles, MaxCycles; uint16_t Hist[16] */
+#define CMD_Set_Resampler              0x20 /* From Msg->Data[3]: uint8_t Mode (RESAMPLER_MODE_x); uint16_t Odr [Hz], applied at the next streaming start, replied with the previous mode */
+#define CMD_Get_Resampler              0x21 /* From Msg->Data[3]: uint8_t Mode, Active; uint16_t Odr; uint32_t DelayUs, AccPeriodNs, GyrPeriodNs, AccOutputs, AccHolds, GyrOutputs, GyrHolds */
 
 #define CMD_Set_DateTime               0x0C
 #define CMD_Enter_DFU_Mode             0x0E
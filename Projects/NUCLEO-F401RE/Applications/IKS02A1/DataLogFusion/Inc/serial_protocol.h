@@ -27,6 +27,17 @@
 #define Msg_EOF                0xF0
 #define Msg_BS                 0xF1
 #define Msg_BS_EOF             0xF2
+#define Msg_COBS_EOF           0x00
+
+/* COBS code of a block of 254 non-zero bytes, not followed by an implicit zero */
+#define COBS_MAX_CODE          0xFFU
+
+/* Worst case size of a COBS encoded Msg of Len bytes, Msg_COBS_EOF delimiter included */
+#define COBS_MAX_LEN(Len)      ((Len) + ((Len) / 254U) + 2U)
+
+/* CRC-32/MPEG-2 (STM32 CRC unit): polynomial 0x04C11DB7, no reflection, no final XOR */
+#define CRC32_INIT             0xFFFFFFFFU
+#define CRC32_LEN              4U
 
 #ifdef USE_USB_OTG_HS
 #define Msg_MaxLen             512
@@ -52,8 +63,11 @@ int32_t ReverseByteStuffCopyByte2(uint8_t Source0, uint8_t Source1, uint8_t *Des
 int32_t ByteStuffCopy(uint8_t *Dest, Msg_t *Source);
 int32_t ReverseByteStuffCopyByte(uint8_t *Source, uint8_t *Dest);
 int32_t ReverseByteStuffCopy(Msg_t *Dest, uint8_t *Source);
+int32_t CobsEncode(uint8_t *Dest, Msg_t *Source);
+int32_t CobsDecode(Msg_t *Dest, uint8_t *Source, uint32_t Len);
 void CHK_ComputeAndAdd(Msg_t *Msg);
 int32_t CHK_CheckAndRemove(Msg_t *Msg);
+uint32_t CRC32_Update(uint32_t Crc, const uint8_t *Data, uint32_t Len);
 uint32_t Deserialize(uint8_t *Source, uint32_t Len);
 int32_t Deserialize_s32(uint8_t *Source, uint32_t Len);
 void Serialize(uint8_t *Dest, uint32_t Source, uint32_t Len);
@@ -0,0 +1,118 @@
+/**
+  *******************************************************************************
+  * @file    stream_layout.h
+  * @author  MEMS Software Solutions Team
+  * @brief   header for stream_layout.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------ */
+#ifndef STREAM_LAYOUT_H
+#define STREAM_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "serial_protocol.h"
+
+/* Exported defines --------------------------------------------------------*/
+/* Streaming frame fields, the bit order is the order of the fields in the frame */
+#define STREAM_FIELD_TIME         0x00000001U /* hours, minutes, seconds, subseconds (4 x uint8) */
+#define STREAM_FIELD_PRESS        0x00000002U /* [hPa] (float) */
+#define STREAM_FIELD_TEMP         0x00000004U /* [degC] (float) */
+#define STREAM_FIELD_HUM          0x00000008U /* [%] (float) */
+#define STREAM_FIELD_ACC          0x00000010U /* [mg] (3 x int32) */
+#define STREAM_FIELD_GYR          0x00000020U /* [mdps] (3 x int32) */
+#define STREAM_FIELD_MAG          0x00000040U /* [mGauss] (3 x int32) */
+#define STREAM_FIELD_QUATERNION   0x00000080U /* (4 x float) */
+#define STREAM_FIELD_ROTATION     0x00000100U /* yaw, pitch, roll [deg] (3 x float) */
+#define STREAM_FIELD_GRAVITY      0x00000200U /* [g] (3 x float) */
+#define STREAM_FIELD_LINEAR_ACC   0x00000400U /* [g] (3 x float) */
+#define STREAM_FIELD_HEADING      0x00000800U /* [deg] (float) */
+#define STREAM_FIELD_HEADING_ERR  0x00001000U /* [deg] (float) */
+#define STREAM_FIELD_ELAPSED      0x00002000U /* Sensor Fusion run time [us] (uint32) */
+
+#define STREAM_FIELD_COUNT        14U
+#define STREAM_FIELD_MAX_SIZE     16U
+#define STREAM_FIELD_ALL          0x00003FFFU
+#define STREAM_FIELD_SENSORS      0x0000007EU /* Fields of the enabled sensors */
+#define STREAM_FIELD_FUSION       0x00003F80U /* Sensor Fusion outputs */
+
+/* Selection flag: all the fields, whatever the enabled sensors, in the STREAMING_MSG_LENGTH frame */
+#define STREAM_LAYOUT_FIXED       0x80000000U
+
+/* Selection flag, ignored with STREAM_LAYOUT_FIXED: compact Sensor Fusion outputs
+ *   QUATERNION   smallest three, 3 x uint16 (6 bytes): the components but the largest one,
+ *                in x, y, z, w order, as int15 scaled by STREAM_COMPACT_QUAT_SCALE in bits 15..1;
+ *                bit 0 of the first two words is the index of the largest component, sent as
+ *                non negative (q and -q are the same rotation) and recomputed from the unit norm
+ *   ROTATION     yaw (uint16), pitch, roll (int16) [0.01 deg] (6 bytes)
+ *   GRAVITY      3 x int16 [mg] (6 bytes)
+ *   LINEAR_ACC   3 x int16 [mg] (6 bytes)
+ *   HEADING      uint16 [0.01 deg] (2 bytes)
+ *   HEADING_ERR  uint16 [0.01 deg] (2 bytes)
+ * Values out of range are saturated, NaN is sent as the lowest code and a quaternion with
+ * a non finite component as the identity.
+ */
+#define STREAM_LAYOUT_COMPACT     0x40000000U
+#define STREAM_COMPACT_QUAT_SCALE 23169.0f /* 16383 * sqrt(2) */
+#define STREAM_COMPACT_DEG_SCALE  100.0f
+#define STREAM_COMPACT_G_SCALE    1000.0f
+
+#define STREAM_LAYOUT_SELECT_MASK (STREAM_LAYOUT_FIXED | STREAM_LAYOUT_COMPACT | STREAM_FIELD_ALL)
+
+/* Layout descriptor:
+ *   Fields (uint32) | Len (uint8, frame length from the message header on) | Count (uint8) | Field 0 ... Field Count-1
+ * Field: Id (bit index of STREAM_FIELD_x) | Offset (from the message header on) | Size [bytes]
+ */
+#define STREAM_LAYOUT_DESC_HEADER_LEN  6U
+#define STREAM_LAYOUT_DESC_FIELD_LEN   3U
+#define STREAM_LAYOUT_DESC_MAX_LEN     (STREAM_LAYOUT_DESC_HEADER_LEN + (STREAM_FIELD_COUNT * STREAM_LAYOUT_DESC_FIELD_LEN))
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Streaming sample structure definition
+  */
+typedef struct
+{
+  uint8_t Time[4];
+  float Press;
+  float Temp;
+  float Hum;
+  int32_t Acc[3];
+  int32_t Gyr[3];
+  int32_t Mag[3];
+  float Quaternion[4];
+  float Rotation[3];
+  float Gravity[3];
+  float LinearAcc[3];
+  float Heading;
+  float HeadingErr;
+  uint32_t ElapsedUs;
+} Stream_Sample_t;
+
+/* Exported functions ------------------------------------------------------- */
+uint32_t Stream_Layout_Fields(uint32_t Select, uint32_t SensorsEnabled);
+uint32_t Stream_Layout_Len(uint32_t Fields);
+uint32_t Stream_Layout_Describe(uint32_t Fields, uint8_t *Dest);
+uint32_t Stream_Layout_Field(uint32_t Field, const Stream_Sample_t *Sample, uint8_t *Dest);
+int32_t Stream_Layout_Decode(uint32_t Fields, Msg_t *Msg, Stream_Sample_t *Sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STREAM_LAYOUT_H */
@@ -24,6 +24,7 @@ extern "C" {
 #include "app_mems.h"
 #include "main.h"
 #include <stdio.h>
+#include <string.h>
 
 #include "stm32f4xx_hal.h"
 #include "stm32f4xx_nucleo.h"
@@ -32,19 +33,45 @@ extern "C" {
 #include "bsp_ip_conf.h"
 #include "fw_version.h"
 #include "motion_fx_manager.h"
+#include "sensor_scheduler.h"
+#include "low_power.h"
+#include "profiler.h"
+#include "resampler.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
-#define DWT_LAR_KEY  0xC5ACCE55 /* DWT register unlock key */
 #define ALGO_FREQ  100U /* Algorithm frequency 100Hz */
 #define ACC_ODR  ((float)ALGO_FREQ)
 #define ACC_FS  4 /* FS = <-4g, 4g> */
+#define GYR_ODR  ((float)ALGO_FREQ) /* Restored when the resampling stops */
 #define ALGO_PERIOD  (1000U / ALGO_FREQ) /* Algorithm period [ms] */
 #define MOTION_FX_ENGINE_DELTATIME  0.01f
 #define FROM_MG_TO_G  0.001f
 #define FROM_G_TO_MG  1000.0f
 #define FROM_MDPS_TO_DPS  0.001f
 #define FROM_DPS_TO_MDPS  1000.0f
+
+/* Acquisition periods and phases [ticks of ALGO_FREQ]: the environmental values change at
+ * sub-Hz rates, they are read once a second on different ticks and cached in between */
+#define SCHED_ENV_PERIOD   ALGO_FREQ
+#define SCHED_PRESS_PHASE  (ALGO_FREQ / 4U)
+#define SCHED_TEMP_PHASE   (ALGO_FREQ / 2U)
+#define SCHED_HUM_PHASE    ((3U * ALGO_FREQ) / 4U)
+
+/* Estimated bus time of a read at 400 kHz [us]: axes plus sensitivity register for the
+ * ISM330DHCX, axes for the IIS2MDC, no environmental sensor on the X-NUCLEO-IKS02A1 */
+#define SCHED_ACC_BUS_US   320U
+#define SCHED_GYR_BUS_US   320U
+#define SCHED_MAG_BUS_US   210U
+#define SCHED_ENV_BUS_US   0U
+
+#define LP_DEFAULT_MODE    LP_MODE_RUN /* Idle policy at start-up, changed by CMD_Set_Low_Power */
+
+/* Resampling of the accelerometer and gyroscope, changed by CMD_Set_Resampler: batched in the FIFO
+ * at their ODR, they are resampled at ALGO_FREQ on the timer ticks */
+#define RESAMPLE_DEFAULT_MODE  RESAMPLER_MODE_OFF
+#define RESAMPLE_DEFAULT_ODR   104U /* [Hz] */
+#define RESAMPLE_FIFO_MAX      RESAMPLER_BUF_LEN /* FIFO samples read per tick, the older ones are dropped */
 #define FROM_MGAUSS_TO_UT50  (0.1f/50.0f)
 #define FROM_UT50_TO_MGAUSS  500.0f
 #define FROM_S_TO_MS  1000U
@@ -62,8 +89,24 @@ offline_data_t OfflineData[OFFLINE_DATA_SIZE];
 int32_t OfflineDataReadIndex = 0;
 int32_t OfflineDataWriteIndex = 0;
 int32_t OfflineDataCount = 0;
+uint8_t OfflineBulk = 0; /* Bulk replay: offline records processed back to back, with flow control */
+uint16_t OfflineBulkDecimation = 1; /* Bulk replay: one streaming frame every OfflineBulkDecimation records, 0 for none */
+uint32_t OfflineBulkProcessed = 0; /* Bulk replay: records processed */
+uint32_t OfflineBulkElapsedUs = 0; /* Bulk replay: time from the first record to the last one processed [us] */
+uint32_t OfflineBulkBusyUs = 0; /* Bulk replay: time spent processing the records [us] */
 uint32_t AlgoFreq = ALGO_FREQ;
 uint8_t Enabled6X = 0;
+uint8_t BatchMaxSamples = 0; /* Samples per batched frame, 0 for one streaming frame per sample */
+uint8_t BatchFlags = 0;
+volatile uint8_t BatchFlushRequest = 0;
+uint32_t StreamSelect = STREAM_LAYOUT_FIXED | STREAM_FIELD_ALL; /* Streaming frame fields, see stream_layout.h */
+uint32_t SensorTick = 0; /* Acquisition ticks since the streaming start, see sensor_scheduler.h */
+LP_Stats_t LowPower; /* Idle policy and statistics, see low_power.h */
+uint8_t ResampleMode = RESAMPLE_DEFAULT_MODE; /* RESAMPLER_MODE_x, applied at the streaming start */
+uint16_t ResampleOdr = RESAMPLE_DEFAULT_ODR; /* Accelerometer and gyroscope ODR when resampling [Hz] */
+uint8_t ResampleActive = 0; /* The accelerometer and gyroscope are read from the FIFO and resampled */
+Resampler_t AccResampler;
+Resampler_t GyrResampler;
 static int32_t PushButtonState = GPIO_PIN_RESET;
 
 /* Extern variables ----------------------------------------------------------*/
@@ -76,26 +119,40 @@ static float PressValue;
 static float TempValue;
 static float HumValue;
 static volatile uint32_t TimeStamp = 0;
+static volatile uint32_t TickUs = 0; /* Time of the last timer tick [us] */
 static volatile uint8_t MagCalRequest = 0;
 static MOTION_SENSOR_Axes_t MagOffset;
 static uint8_t MagCalStatus = 0;
+static Batch_t Batch;
+static uint8_t TimeValue[4]; /* hours, minutes, seconds, subseconds [1/100 s] */
+static MFX_output_t FxOutput;
+static uint32_t FxElapsedUs = 0U;
 
 /* Private function prototypes -----------------------------------------------*/
 static void MX_DataLogFusion_Init(void);
 static void MX_DataLogFusion_Process(void);
-static void FX_Data_Handler(Msg_t *Msg);
+static void FX_Data_Handler(void);
 static void Init_Sensors(void);
-static void RTC_Handler(Msg_t *Msg);
-static void Accelero_Sensor_Handler(Msg_t *Msg);
-static void Gyro_Sensor_Handler(Msg_t *Msg);
-static void Magneto_Sensor_Handler(Msg_t *Msg);
-static void Pressure_Sensor_Handler(Msg_t *Msg);
-static void Temperature_Sensor_Handler(Msg_t *Msg);
-static void Humidity_Sensor_Handler(Msg_t *Msg);
+static void RTC_Handler(void);
+static void Accelero_Sensor_Handler(void);
+static void Gyro_Sensor_Handler(void);
+static void Magneto_Sensor_Handler(void);
+static void Pressure_Sensor_Handler(void);
+static void Temperature_Sensor_Handler(void);
+static void Humidity_Sensor_Handler(void);
+static void Resample_Config(void);
+static void Fifo_Handler(void);
+static void Resample_Get(Resampler_t *Rs, void (*Read)(MOTION_SENSOR_Axes_t *Axes), MOTION_SENSOR_Axes_t *Value);
+static void Streaming_Send(void);
+static void Batch_Handler(Msg_t *Msg);
+static void Batch_Send(Msg_t *Msg);
+static uint32_t Get_Time_us(void);
 static void TIM_Config(uint32_t Freq);
-static void DWT_Init(void);
-static void DWT_Start(void);
-static uint32_t DWT_Stop(void);
+static uint32_t LP_Pending(void);
+static void LP_Sleep(void);
+static uint32_t LP_Wake_Sources(void);
+static void LP_Mask(void);
+static void LP_Unmask(void);
 
 void MX_MEMS_Init(void)
 {
@@ -143,6 +200,7 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
   if (htim->Instance == BSP_IP_TIM_HANDLE.Instance)
   {
+    TickUs = Get_Time_us();
     SensorReadRequest = 1;
   }
 }
@@ -204,7 +262,9 @@ static void MX_DataLogFusion_Init(void)
     MagCalStatus = 1;
   }
 
-  DWT_Init();
+  Prof_Init();
+
+  LP_Init(&LowPower, LP_DEFAULT_MODE, Get_Time_us());
 
   BSP_LED_On(LED2);
   HAL_Delay(500);
@@ -220,15 +280,36 @@ static void MX_DataLogFusion_Init(void)
   */
 static void MX_DataLogFusion_Process(void)
 {
-  static Msg_t msg_dat;
   static Msg_t msg_cmd;
+  static Msg_t msg_batch;
   static int32_t discarded_count = 0;
-
-  if (UART_ReceivedMSG((Msg_t *)&msg_cmd) == 1)
+  static uint32_t bulk_start_us = 0;
+  static const LP_Ctx_t lp_ctx = {Get_Time_us, LP_Pending, LP_Sleep, LP_Wake_Sources, LP_Mask, LP_Unmask};
+  static const Sensor_Task_t sensor_tasks[] =
+  {
+    {Accelero_Sensor_Handler,    ACCELEROMETER_SENSOR, 1U,               0U,                SCHED_ACC_BUS_US},
+    {Gyro_Sensor_Handler,        GYROSCOPE_SENSOR,     1U,               0U,                SCHED_GYR_BUS_US},
+    {Magneto_Sensor_Handler,     MAGNETIC_SENSOR,      1U,               0U,                SCHED_MAG_BUS_US},
+    {Humidity_Sensor_Handler,    HUMIDITY_SENSOR,      SCHED_ENV_PERIOD, SCHED_HUM_PHASE,   SCHED_ENV_BUS_US},
+    {Temperature_Sensor_Handler, TEMPERATURE_SENSOR,   SCHED_ENV_PERIOD, SCHED_TEMP_PHASE,  SCHED_ENV_BUS_US},
+    {Pressure_Sensor_Handler,    PRESSURE_SENSOR,      SCHED_ENV_PERIOD, SCHED_PRESS_PHASE, SCHED_ENV_BUS_US},
+  };
+  uint32_t record_start_us = 0;
+  uint32_t tick_begin;
+  uint32_t begin;
+  int32_t received;
+
+  begin = PROF_BEGIN();
+  received = UART_ReceivedMSG((Msg_t *)&msg_cmd);
+  (void)Prof_End(PROF_STAGE_RX_PARSE, begin);
+
+  if (received == 1)
   {
     if (msg_cmd.Data[0] == DEV_ADDR)
     {
+      begin = PROF_BEGIN();
       (void)HandleMSG((Msg_t *)&msg_cmd);
+      (void)Prof_End(PROF_STAGE_COMMAND, begin);
     }
   }
 
@@ -251,29 +332,58 @@ static void MX_DataLogFusion_Process(void)
     MagOffset.y = 0;
     MagOffset.z = 0;
 
+    /* Forget the saved calibration, the library would load it again */
+    MotionFX_manager_MagCal_clear();
+
     /* Enable magnetometer calibration */
     MotionFX_manager_MagCal_start(ALGO_PERIOD);
   }
 
+  if (BatchFlushRequest == 1U)
+  {
+    BatchFlushRequest = 0;
+    Batch_Send(&msg_batch);
+  }
+
   if (SensorReadRequest == 1U)
   {
     SensorReadRequest = 0;
+    tick_begin = PROF_BEGIN();
+
+    if (OfflineBulk == 1U)
+    {
+      record_start_us = Get_Time_us();
+      if (OfflineBulkProcessed == 0U)
+      {
+        bulk_start_us = record_start_us;
+      }
+    }
 
-    /* Acquire data from enabled sensors and fill Msg stream */
-    RTC_Handler(&msg_dat);
-    Accelero_Sensor_Handler(&msg_dat);
-    Gyro_Sensor_Handler(&msg_dat);
-    Magneto_Sensor_Handler(&msg_dat);
-    Humidity_Sensor_Handler(&msg_dat);
-    Temperature_Sensor_Handler(&msg_dat);
-    Pressure_Sensor_Handler(&msg_dat);
+    /* Acquire data from the sensors due on this tick, the others keep their cached value;
+     * every offline record holds all the values */
+    begin = PROF_BEGIN();
+    RTC_Handler();
+    (void)Prof_End(PROF_STAGE_RTC, begin);
 
-    /* Sensor Fusion specific part */
-    FX_Data_Handler(&msg_dat);
+    if (SensorTick == 0U)
+    {
+      /* Streaming start: the FIFO batching follows the resampling mode */
+      Resample_Config();
+    }
+
+    if (ResampleActive == 1U)
+    {
+      begin = PROF_BEGIN();
+      Fifo_Handler();
+      (void)Prof_End(PROF_STAGE_FIFO, begin);
+    }
+
+    Sensor_Sched_Run(sensor_tasks, sizeof(sensor_tasks) / sizeof(sensor_tasks[0]),
+                     (UseOfflineData == 1U) ? SENSOR_SCHED_TICK_ALL : SensorTick, SensorsEnabled);
+    SensorTick++;
 
-    /* Send data stream */
-    INIT_STREAMING_HEADER(&msg_dat);
-    msg_dat.Len = STREAMING_MSG_LENGTH;
+    /* Sensor Fusion specific part */
+    FX_Data_Handler();
 
     if (UseOfflineData == 1U)
     {
@@ -299,11 +409,45 @@ static void MX_DataLogFusion_Process(void)
     {
       discarded_count++;
     }
+    else if (OfflineBulk == 1U)
+    {
+      /* Records are processed back to back, the output is decimated to keep the UART out of the way */
+      OfflineBulkProcessed++;
+      if ((OfflineBulkDecimation != 0U) && ((OfflineBulkProcessed % OfflineBulkDecimation) == 0U))
+      {
+        begin = PROF_BEGIN();
+        if (BatchMaxSamples != 0U)
+        {
+          Batch_Handler(&msg_batch);
+        }
+        else
+        {
+          Streaming_Send();
+        }
+        (void)Prof_End(PROF_STAGE_FRAME, begin);
+      }
+
+      OfflineBulkBusyUs += Get_Time_us() - record_start_us;
+      OfflineBulkElapsedUs = Get_Time_us() - bulk_start_us;
+    }
+    else if (BatchMaxSamples != 0U)
+    {
+      begin = PROF_BEGIN();
+      Batch_Handler(&msg_batch);
+      (void)Prof_End(PROF_STAGE_FRAME, begin);
+    }
     else
     {
-      UART_SendMsg(&msg_dat);
+      begin = PROF_BEGIN();
+      Streaming_Send();
+      (void)Prof_End(PROF_STAGE_FRAME, begin);
     }
+
+    (void)Prof_End(PROF_STAGE_TICK, tick_begin);
   }
+
+  /* Sleep until the next interrupt if nothing is left to do */
+  (void)LP_Idle(&lp_ctx, &LowPower);
 }
 
 /**
@@ -325,11 +469,11 @@ static void Init_Sensors(void)
 }
 
 /**
-  * @brief  Handles the time+date getting/sending
-  * @param  Msg the time+date part of the stream
+  * @brief  Handles the time+date getting
+  * @param  None
   * @retval None
   */
-static void RTC_Handler(Msg_t *Msg)
+static void RTC_Handler(void)
 {
   uint8_t sub_sec = 0;
   RTC_DateTypeDef sdatestructureget;
@@ -340,10 +484,10 @@ static void RTC_Handler(Msg_t *Msg)
 
   if (UseOfflineData == 1)
   {
-    Msg->Data[3] = (uint8_t)OfflineData[OfflineDataReadIndex].hours;
-    Msg->Data[4] = (uint8_t)OfflineData[OfflineDataReadIndex].minutes;
-    Msg->Data[5] = (uint8_t)OfflineData[OfflineDataReadIndex].seconds;
-    Msg->Data[6] = (uint8_t)OfflineData[OfflineDataReadIndex].subsec;
+    TimeValue[0] = (uint8_t)OfflineData[OfflineDataReadIndex].hours;
+    TimeValue[1] = (uint8_t)OfflineData[OfflineDataReadIndex].minutes;
+    TimeValue[2] = (uint8_t)OfflineData[OfflineDataReadIndex].seconds;
+    TimeValue[3] = (uint8_t)OfflineData[OfflineDataReadIndex].subsec;
   }
   else
   {
@@ -358,25 +502,24 @@ static void RTC_Handler(Msg_t *Msg)
     ans_uint32 = (uint32_t)ans_int32 & 0xFFU;
     sub_sec = (uint8_t)ans_uint32;
 
-    Msg->Data[3] = (uint8_t)stimestructure.Hours;
-    Msg->Data[4] = (uint8_t)stimestructure.Minutes;
-    Msg->Data[5] = (uint8_t)stimestructure.Seconds;
-    Msg->Data[6] = sub_sec;
+    TimeValue[0] = (uint8_t)stimestructure.Hours;
+    TimeValue[1] = (uint8_t)stimestructure.Minutes;
+    TimeValue[2] = (uint8_t)stimestructure.Seconds;
+    TimeValue[3] = sub_sec;
   }
 }
 
 /**
   * @brief  Sensor Fusion data handler
-  * @param  Msg the Sensor Fusion data part of the stream
+  * @param  None
   * @retval None
   */
-static void FX_Data_Handler(Msg_t *Msg)
+static void FX_Data_Handler(void)
 {
-  uint32_t elapsed_time_us = 0U;
   MFX_input_t data_in;
   MFX_input_t *pdata_in = &data_in;
-  MFX_output_t data_out;
-  MFX_output_t *pdata_out = &data_out;
+  MFX_output_t *pdata_out = &FxOutput;
+  uint32_t begin;
 
   if ((SensorsEnabled & ACCELEROMETER_SENSOR) == ACCELEROMETER_SENSOR)
   {
@@ -401,20 +544,10 @@ static void FX_Data_Handler(Msg_t *Msg)
 
         /* Run Sensor Fusion algorithm */
         BSP_LED_On(LED2);
-        DWT_Start();
+        begin = PROF_BEGIN();
         MotionFX_manager_run(pdata_in, pdata_out, MOTION_FX_ENGINE_DELTATIME);
-        elapsed_time_us = DWT_Stop();
+        FxElapsedUs = Prof_End(PROF_STAGE_FX, begin) / (SystemCoreClock / 1000000U);
         BSP_LED_Off(LED2);
-
-        (void)memcpy(&Msg->Data[55], (void *)pdata_out->quaternion, 4U * sizeof(float));
-        (void)memcpy(&Msg->Data[71], (void *)pdata_out->rotation, 3U * sizeof(float));
-        (void)memcpy(&Msg->Data[83], (void *)pdata_out->gravity, 3U * sizeof(float));
-        (void)memcpy(&Msg->Data[95], (void *)pdata_out->linear_acceleration, 3U * sizeof(float));
-
-        (void)memcpy(&Msg->Data[107], (void *) & (pdata_out->heading), sizeof(float));
-        (void)memcpy(&Msg->Data[111], (void *) & (pdata_out->headingErr), sizeof(float));
-
-        Serialize_s32(&Msg->Data[115], (int32_t)elapsed_time_us, 4);
       }
     }
   }
@@ -431,12 +564,14 @@ void BSP_PB_Callback(Button_TypeDef Button)
 }
 
 /**
-  * @brief  Handles the ACC axes data getting/sending
-  * @param  Msg the ACC part of the stream
+  * @brief  Handles the ACC axes data getting
+  * @param  None
   * @retval None
   */
-static void Accelero_Sensor_Handler(Msg_t *Msg)
+static void Accelero_Sensor_Handler(void)
 {
+  uint32_t begin = PROF_BEGIN();
+
   if ((SensorsEnabled & ACCELEROMETER_SENSOR) == ACCELEROMETER_SENSOR)
   {
     if (UseOfflineData == 1)
@@ -445,24 +580,28 @@ static void Accelero_Sensor_Handler(Msg_t *Msg)
       AccValue.y = OfflineData[OfflineDataReadIndex].acceleration_y_mg;
       AccValue.z = OfflineData[OfflineDataReadIndex].acceleration_z_mg;
     }
+    else if (ResampleActive == 1U)
+    {
+      Resample_Get(&AccResampler, BSP_SENSOR_ACC_GetAxes, &AccValue);
+    }
     else
     {
       BSP_SENSOR_ACC_GetAxes(&AccValue);
     }
-
-    Serialize_s32(&Msg->Data[19], (int32_t)AccValue.x, 4);
-    Serialize_s32(&Msg->Data[23], (int32_t)AccValue.y, 4);
-    Serialize_s32(&Msg->Data[27], (int32_t)AccValue.z, 4);
   }
+
+  (void)Prof_End(PROF_STAGE_ACC, begin);
 }
 
 /**
-  * @brief  Handles the GYR axes data getting/sending
-  * @param  Msg the GYR part of the stream
+  * @brief  Handles the GYR axes data getting
+  * @param  None
   * @retval None
   */
-static void Gyro_Sensor_Handler(Msg_t *Msg)
+static void Gyro_Sensor_Handler(void)
 {
+  uint32_t begin = PROF_BEGIN();
+
   if ((SensorsEnabled & GYROSCOPE_SENSOR) == GYROSCOPE_SENSOR)
   {
     if (UseOfflineData == 1)
@@ -471,27 +610,30 @@ static void Gyro_Sensor_Handler(Msg_t *Msg)
       GyrValue.y = OfflineData[OfflineDataReadIndex].angular_rate_y_mdps;
       GyrValue.z = OfflineData[OfflineDataReadIndex].angular_rate_z_mdps;
     }
+    else if (ResampleActive == 1U)
+    {
+      Resample_Get(&GyrResampler, BSP_SENSOR_GYR_GetAxes, &GyrValue);
+    }
     else
     {
       BSP_SENSOR_GYR_GetAxes(&GyrValue);
     }
-
-    Serialize_s32(&Msg->Data[31], GyrValue.x, 4);
-    Serialize_s32(&Msg->Data[35], GyrValue.y, 4);
-    Serialize_s32(&Msg->Data[39], GyrValue.z, 4);
   }
+
+  (void)Prof_End(PROF_STAGE_GYR, begin);
 }
 
 /**
-  * @brief  Handles the MAG axes data getting/sending
-  * @param  Msg the MAG part of the stream
+  * @brief  Handles the MAG axes data getting
+  * @param  None
   * @retval None
   */
-static void Magneto_Sensor_Handler(Msg_t *Msg)
+static void Magneto_Sensor_Handler(void)
 {
   float ans_float;
   MFX_MagCal_input_t mag_data_in;
   MFX_MagCal_output_t mag_data_out;
+  uint32_t begin = PROF_BEGIN();
 
   if ((SensorsEnabled & MAGNETIC_SENSOR) == MAGNETIC_SENSOR)
   {
@@ -536,20 +678,20 @@ static void Magneto_Sensor_Handler(Msg_t *Msg)
       MagValue.y = (int32_t)(MagValue.y - MagOffset.y);
       MagValue.z = (int32_t)(MagValue.z - MagOffset.z);
     }
-
-    Serialize_s32(&Msg->Data[43], MagValue.x, 4);
-    Serialize_s32(&Msg->Data[47], MagValue.y, 4);
-    Serialize_s32(&Msg->Data[51], MagValue.z, 4);
   }
+
+  (void)Prof_End(PROF_STAGE_MAG, begin);
 }
 
 /**
-  * @brief  Handles the PRESS sensor data getting/sending.
-  * @param  Msg the PRESS part of the stream
+  * @brief  Handles the PRESS sensor data getting
+  * @param  None
   * @retval None
   */
-static void Pressure_Sensor_Handler(Msg_t *Msg)
+static void Pressure_Sensor_Handler(void)
 {
+  uint32_t begin = PROF_BEGIN();
+
   if ((SensorsEnabled & PRESSURE_SENSOR) == PRESSURE_SENSOR)
   {
     if (UseOfflineData == 1)
@@ -560,18 +702,20 @@ static void Pressure_Sensor_Handler(Msg_t *Msg)
     {
       BSP_SENSOR_PRESS_GetValue(&PressValue);
     }
-
-    (void)memcpy(&Msg->Data[7], (void *)&PressValue, sizeof(float));
   }
+
+  (void)Prof_End(PROF_STAGE_PRESS, begin);
 }
 
 /**
-  * @brief  Handles the TEMP axes data getting/sending
-  * @param  Msg the TEMP part of the stream
+  * @brief  Handles the TEMP axes data getting
+  * @param  None
   * @retval None
   */
-static void Temperature_Sensor_Handler(Msg_t *Msg)
+static void Temperature_Sensor_Handler(void)
 {
+  uint32_t begin = PROF_BEGIN();
+
   if ((SensorsEnabled & TEMPERATURE_SENSOR) == TEMPERATURE_SENSOR)
   {
     if (UseOfflineData == 1)
@@ -582,18 +726,20 @@ static void Temperature_Sensor_Handler(Msg_t *Msg)
     {
       BSP_SENSOR_TEMP_GetValue(&TempValue);
     }
-
-    (void)memcpy(&Msg->Data[11], (void *)&TempValue, sizeof(float));
   }
+
+  (void)Prof_End(PROF_STAGE_TEMP, begin);
 }
 
 /**
-  * @brief  Handles the HUM axes data getting/sending
-  * @param  Msg the HUM part of the stream
+  * @brief  Handles the HUM axes data getting
+  * @param  None
   * @retval None
   */
-static void Humidity_Sensor_Handler(Msg_t *Msg)
+static void Humidity_Sensor_Handler(void)
 {
+  uint32_t begin = PROF_BEGIN();
+
   if ((SensorsEnabled & HUMIDITY_SENSOR) == HUMIDITY_SENSOR)
   {
     if (UseOfflineData == 1)
@@ -604,11 +750,278 @@ static void Humidity_Sensor_Handler(Msg_t *Msg)
     {
       BSP_SENSOR_HUM_GetValue(&HumValue);
     }
+  }
+
+  (void)Prof_End(PROF_STAGE_HUM, begin);
+}
+
+/**
+  * @brief  Start or stop the accelerometer and gyroscope resampling, as selected by ResampleMode
+  * @note   When resampling, both sensors run and batch in the FIFO at ResampleOdr, and the
+  *         resamplers are restarted; otherwise the FIFO is stopped and the ODR restored.
+  * @param  None
+  * @retval None
+  */
+static void Resample_Config(void)
+{
+  float odr = 0.0f;
+
+  if ((ResampleMode != RESAMPLER_MODE_OFF) && (UseOfflineData == 0U)
+      && ((SensorsEnabled & (ACCELEROMETER_SENSOR | GYROSCOPE_SENSOR)) != 0U))
+  {
+    BSP_SENSOR_ACC_SetOutputDataRate((float)ResampleOdr);
+    BSP_SENSOR_GYR_SetOutputDataRate((float)ResampleOdr);
+
+    /* Nominal rates, as rounded by the sensor */
+    BSP_SENSOR_ACC_GetOutputDataRate(&odr);
+    if (odr <= 0.0f)
+    {
+      odr = (float)ResampleOdr;
+    }
+    BSP_ACC_GYR_FIFO_Start(odr);
+    Resampler_Init(&AccResampler, ResampleMode, odr, (float)ALGO_FREQ);
 
-    (void)memcpy(&Msg->Data[15], (void *)&HumValue, sizeof(float));
+    BSP_SENSOR_GYR_GetOutputDataRate(&odr);
+    if (odr <= 0.0f)
+    {
+      odr = (float)ResampleOdr;
+    }
+    Resampler_Init(&GyrResampler, ResampleMode, odr, (float)ALGO_FREQ);
+
+    ResampleActive = 1;
+  }
+  else if (ResampleActive == 1U)
+  {
+    BSP_ACC_GYR_FIFO_Stop();
+    BSP_SENSOR_ACC_SetOutputDataRate(ACC_ODR);
+    BSP_SENSOR_GYR_SetOutputDataRate(GYR_ODR);
+    ResampleActive = 0;
+  }
+  else
+  {
+    /* Not resampling */
   }
 }
 
+/**
+  * @brief  Read the FIFO and push the samples to the resamplers
+  * @note   The read time, taken after the FIFO level read, stamps the batches; if the FIFO
+  *         holds more than RESAMPLE_FIFO_MAX samples, the older ones are dropped.
+  * @param  None
+  * @retval None
+  */
+static void Fifo_Handler(void)
+{
+  int32_t acc[RESAMPLE_FIFO_MAX][RESAMPLER_AXES];
+  int32_t gyr[RESAMPLE_FIFO_MAX][RESAMPLER_AXES];
+  MOTION_SENSOR_Axes_t axes;
+  uint32_t acc_count = 0;
+  uint32_t gyr_count = 0;
+  uint32_t read_us;
+  uint16_t num = 0;
+  uint8_t tag = 0;
+
+  BSP_ACC_GYR_FIFO_Get_Num_Samples(&num);
+  read_us = Get_Time_us();
+
+  for (; num > 0U; num--)
+  {
+    BSP_ACC_GYR_FIFO_Get_Sample(&tag, &axes);
+
+    if (num > RESAMPLE_FIFO_MAX)
+    {
+      continue;
+    }
+
+    if (tag == (uint8_t)ISM330DHCX_XL_NC_TAG)
+    {
+      acc[acc_count][0] = axes.x;
+      acc[acc_count][1] = axes.y;
+      acc[acc_count][2] = axes.z;
+      acc_count++;
+    }
+    else if (tag == (uint8_t)ISM330DHCX_GYRO_NC_TAG)
+    {
+      gyr[gyr_count][0] = axes.x;
+      gyr[gyr_count][1] = axes.y;
+      gyr[gyr_count][2] = axes.z;
+      gyr_count++;
+    }
+    else
+    {
+      /* Not batched */
+    }
+  }
+
+  Resampler_Push_Batch(&AccResampler, read_us, (const int32_t (*)[RESAMPLER_AXES])acc, acc_count);
+  Resampler_Push_Batch(&GyrResampler, read_us, (const int32_t (*)[RESAMPLER_AXES])gyr, gyr_count);
+}
+
+/**
+  * @brief  Get the resampled value of the last timer tick
+  * @note   Until the first output, DelayUs after the streaming start, the sensor is read
+  *         directly; then, if an output misses its input samples, the previous one is held.
+  * @param  Rs the resampler
+  * @param  Read direct read of the sensor
+  * @param  Value the value
+  * @retval None
+  */
+static void Resample_Get(Resampler_t *Rs, void (*Read)(MOTION_SENSOR_Axes_t *Axes), MOTION_SENSOR_Axes_t *Value)
+{
+  int32_t axes[RESAMPLER_AXES];
+
+  if ((Resampler_Get(Rs, TickUs, axes) == 0) && (Rs->Outputs == 0U))
+  {
+    Read(Value);
+  }
+  else
+  {
+    Value->x = axes[0];
+    Value->y = axes[1];
+    Value->z = axes[2];
+  }
+}
+
+/**
+  * @brief  Send the last acquired sample and fusion output in a streaming frame
+  * @note   The frame holds the fields of StreamSelect the enabled sensors provide, or all
+  *         of them in the STREAMING_MSG_LENGTH frame if STREAM_LAYOUT_FIXED is selected.
+  *         It is built in place in the transmit queue, the sensors not enabled keep their
+  *         last value.
+  * @param  None
+  * @retval None
+  */
+static void Streaming_Send(void)
+{
+  Uart_Frame_t frame;
+  Stream_Sample_t sample;
+  uint8_t data[STREAM_FIELD_MAX_SIZE];
+  uint32_t fields;
+  uint32_t field;
+  uint32_t size;
+
+  if (UART_FrameBegin(&frame) == 0)
+  {
+    return;
+  }
+
+  fields = Stream_Layout_Fields(StreamSelect, SensorsEnabled);
+
+  (void)memcpy(sample.Time, TimeValue, 4);
+  sample.Press = PressValue;
+  sample.Temp = TempValue;
+  sample.Hum = HumValue;
+  sample.Acc[0] = AccValue.x;
+  sample.Acc[1] = AccValue.y;
+  sample.Acc[2] = AccValue.z;
+  sample.Gyr[0] = GyrValue.x;
+  sample.Gyr[1] = GyrValue.y;
+  sample.Gyr[2] = GyrValue.z;
+  sample.Mag[0] = MagValue.x;
+  sample.Mag[1] = MagValue.y;
+  sample.Mag[2] = MagValue.z;
+  (void)memcpy(sample.Quaternion, FxOutput.quaternion, sizeof(sample.Quaternion));
+  (void)memcpy(sample.Rotation, FxOutput.rotation, sizeof(sample.Rotation));
+  (void)memcpy(sample.Gravity, FxOutput.gravity, sizeof(sample.Gravity));
+  (void)memcpy(sample.LinearAcc, FxOutput.linear_acceleration, sizeof(sample.LinearAcc));
+  sample.Heading = FxOutput.heading;
+  sample.HeadingErr = FxOutput.headingErr;
+  sample.ElapsedUs = FxElapsedUs;
+
+  INIT_STREAMING_FRAME(&frame, ((StreamSelect & STREAM_LAYOUT_FIXED) != 0U) ? (uint8_t)CMD_Start_Data_Streaming
+                       : (uint8_t)CMD_Layout_Data_Streaming);
+
+  for (field = STREAM_FIELD_TIME; field <= STREAM_FIELD_ALL; field <<= 1)
+  {
+    if ((fields & field) != 0U)
+    {
+      size = Stream_Layout_Field(field | (fields & STREAM_LAYOUT_COMPACT), &sample, data);
+      UART_FramePut(&frame, data, size);
+    }
+  }
+
+  UART_FrameEnd(&frame);
+}
+
+/**
+  * @brief  Append the last acquired sample to the batched frame, send the frame when complete
+  * @param  Msg the batched frame
+  * @retval None
+  */
+static void Batch_Handler(Msg_t *Msg)
+{
+  Batch_Sample_t sample;
+
+  sample.TimeUs = Get_Time_us();
+  sample.Press = PressValue;
+  sample.Temp = TempValue;
+  sample.Hum = HumValue;
+  sample.Acc[0] = AccValue.x;
+  sample.Acc[1] = AccValue.y;
+  sample.Acc[2] = AccValue.z;
+  sample.Gyr[0] = GyrValue.x;
+  sample.Gyr[1] = GyrValue.y;
+  sample.Gyr[2] = GyrValue.z;
+  sample.Mag[0] = MagValue.x;
+  sample.Mag[1] = MagValue.y;
+  sample.Mag[2] = MagValue.z;
+
+  if (Batch.Count == 0U)
+  {
+    Batch_Init(&Batch, (uint8_t)(SensorsEnabled & BATCH_CONTENT_MASK), BatchFlags, BatchMaxSamples);
+  }
+
+  if (Batch_AddSample(&Batch, Msg, &sample) == 0)
+  {
+    /* Frame closed, the sample starts the next one */
+    Batch_Send(Msg);
+    Batch_Init(&Batch, (uint8_t)(SensorsEnabled & BATCH_CONTENT_MASK), BatchFlags, BatchMaxSamples);
+    (void)Batch_AddSample(&Batch, Msg, &sample);
+  }
+
+  if (Batch.Count >= Batch.MaxSamples)
+  {
+    Batch_Send(Msg);
+  }
+}
+
+/**
+  * @brief  Send the pending batched frame, if any
+  * @param  Msg the batched frame
+  * @retval None
+  */
+static void Batch_Send(Msg_t *Msg)
+{
+  if (Batch.Count != 0U)
+  {
+    INIT_BATCH_HEADER(Msg);
+    UART_SendMsg(Msg);
+    Batch.Count = 0;
+  }
+}
+
+/**
+  * @brief  Get the time elapsed from the start-up in [us]
+  * @param  None
+  * @note   The HAL tick is expected at the default 1 kHz
+  * @retval Time in [us], wraps around every ~71 minutes
+  */
+static uint32_t Get_Time_us(void)
+{
+  uint32_t tick;
+  uint32_t val;
+  uint32_t load = SysTick->LOAD + 1U;
+
+  /* Read again if the SysTick wrapped between the two readings */
+  do
+  {
+    tick = HAL_GetTick();
+    val = SysTick->VAL;
+  } while (tick != HAL_GetTick());
+
+  return (tick * 1000U) + (((load - val) * 1000U) / load);
+}
+
 /**
   * @brief  Timer configuration
   * @param  Freq the desired Timer frequency
@@ -641,43 +1054,80 @@ static void TIM_Config(uint32_t Freq)
 }
 
 /**
-  * @brief  Initialize DWT register for counting clock cycles purpose
+  * @brief  Tell if the main loop has work pending, called with the interrupts masked
   * @param  None
-  * @retval None
+  * @retval Not 0 if work is pending
   */
-static void DWT_Init(void)
+static uint32_t LP_Pending(void)
 {
-  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
-  DWT->CTRL &= ~DWT_CTRL_CYCCNTENA_Msk; /* Disable counter */
+  return (uint32_t)SensorReadRequest | (uint32_t)BatchFlushRequest | (uint32_t)MagCalRequest
+         | (uint32_t)UartEngine.RxEvent | (uint32_t)UartEngine.RxRestart;
 }
 
 /**
-  * @brief  Start counting clock cycles
+  * @brief  Enter the sleep mode until an interrupt is pending
+  * @note   The interrupts being masked, the core wakes up on the pending interrupt
+  *         without serving it; the peripherals and the SysTick keep running.
   * @param  None
   * @retval None
   */
-static void DWT_Start(void)
+static void LP_Sleep(void)
 {
-  DWT->CYCCNT = 0; /* Clear count of clock cycles */
-  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; /* Enable counter */
+  HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
 }
 
 /**
-  * @brief  Stop counting clock cycles and calculate elapsed time in [us]
+  * @brief  Get the pending wake-up sources, called with the interrupts masked
+  * @note   The interrupts are the ones of stm32f4xx_it.c
   * @param  None
-  * @retval Elapsed time in [us]
+  * @retval LP_WAKE_x pending
   */
-static uint32_t DWT_Stop(void)
+static uint32_t LP_Wake_Sources(void)
 {
-  volatile uint32_t cycles_count = 0U;
-  uint32_t system_core_clock_mhz = 0U;
+  uint32_t sources = 0;
 
-  DWT->CTRL &= ~DWT_CTRL_CYCCNTENA_Msk; /* Disable counter */
-  cycles_count = DWT->CYCCNT; /* Read count of clock cycles */
+  if (NVIC_GetPendingIRQ(TIM3_IRQn) != 0U)
+  {
+    sources |= LP_WAKE_TIMER;
+  }
 
-  /* Calculate elapsed time in [us] */
-  system_core_clock_mhz = SystemCoreClock / 1000000U;
-  return cycles_count / system_core_clock_mhz;
+  if ((NVIC_GetPendingIRQ(USART2_IRQn) != 0U) || (NVIC_GetPendingIRQ(DMA1_Stream5_IRQn) != 0U)
+      || (NVIC_GetPendingIRQ(DMA1_Stream6_IRQn) != 0U))
+  {
+    sources |= LP_WAKE_UART;
+  }
+
+  if (NVIC_GetPendingIRQ(EXTI15_10_IRQn) != 0U)
+  {
+    sources |= LP_WAKE_BUTTON;
+  }
+
+  if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)
+  {
+    sources |= LP_WAKE_SYSTICK;
+  }
+
+  return sources;
+}
+
+/**
+  * @brief  Mask the interrupts
+  * @param  None
+  * @retval None
+  */
+static void LP_Mask(void)
+{
+  __disable_irq();
+}
+
+/**
+  * @brief  Unmask the interrupts, the pending ones are served
+  * @param  None
+  * @retval None
+  */
+static void LP_Unmask(void)
+{
+  __enable_irq();
 }
 
 #ifdef __cplusplus
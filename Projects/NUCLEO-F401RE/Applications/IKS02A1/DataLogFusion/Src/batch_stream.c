@@ -0,0 +1,363 @@
+/**
+  ******************************************************************************
+  * @file    batch_stream.c
+  * @author  MEMS Software Solutions Team
+  * @brief   This file implements the batched multi-sample streaming frames
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "batch_stream.h"
+
+/** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define BATCH_TIME_DELTA_MAX  0xFFFFU
+#define BATCH_DELTA_MIN       (-32768)
+#define BATCH_DELTA_MAX       32767
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Batch_Get_Axes(uint8_t Content, const Batch_Sample_t *Sample, int32_t *Axes);
+static void Batch_Set_Axes(uint8_t Content, Batch_Sample_t *Sample, const int32_t *Axes);
+static uint32_t Batch_Sample_Size(uint8_t Content, uint8_t Delta, uint32_t Index);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Start a new batched frame
+  * @param  Batch pointer to the encoder
+  * @param  Content sensors in the frame (BATCH_PRESS ... BATCH_MAG)
+  * @param  Flags encoding flags (BATCH_FLAG_DELTA)
+  * @param  MaxSamples samples per frame
+  * @retval None
+  */
+void Batch_Init(Batch_t *Batch, uint8_t Content, uint8_t Flags, uint8_t MaxSamples)
+{
+  Batch->Content = Content & (uint8_t)BATCH_CONTENT_MASK;
+  Batch->Flags = Flags & (uint8_t)BATCH_FLAGS_MASK;
+  Batch->MaxSamples = MaxSamples;
+  Batch->Count = 0;
+  Batch->LastTimeUs = 0;
+}
+
+/**
+  * @brief  Append a sample to the batched frame
+  * @note   The frame is closed when it holds MaxSamples samples, when the sample does not
+  *         fit into the Msg, or when its time delta or axes deltas exceed the coding range.
+  *         The caller then sends Msg, calls Batch_Init and adds the sample again.
+  * @param  Batch pointer to the encoder
+  * @param  Msg pointer to the frame, from the message header on
+  * @param  Sample pointer to the sample
+  * @retval 1 if the sample is added, 0 if the frame is closed
+  */
+int32_t Batch_AddSample(Batch_t *Batch, Msg_t *Msg, const Batch_Sample_t *Sample)
+{
+  int32_t axes[9];
+  int32_t d;
+  uint32_t n_axes;
+  uint32_t dt = 0;
+  uint32_t i;
+  uint32_t pos;
+  uint8_t delta = 0;
+
+  if (Batch->Count >= Batch->MaxSamples)
+  {
+    return 0;
+  }
+
+  n_axes = Batch_Get_Axes(Batch->Content, Sample, axes);
+
+  if (Batch->Count == 0U)
+  {
+    Msg->Len = BATCH_HEADER_OFFSET + BATCH_HEADER_LEN;
+  }
+  else
+  {
+    dt = Sample->TimeUs - Batch->LastTimeUs;
+
+    if (dt > BATCH_TIME_DELTA_MAX)
+    {
+      return 0;
+    }
+
+    if ((Batch->Flags & BATCH_FLAG_DELTA) != 0U)
+    {
+      for (i = 0; i < n_axes; i++)
+      {
+        d = (int32_t)((uint32_t)axes[i] - (uint32_t)Batch->Last[i]);
+
+        if ((d < BATCH_DELTA_MIN) || (d > BATCH_DELTA_MAX))
+        {
+          return 0;
+        }
+      }
+
+      delta = 1;
+    }
+  }
+
+  if ((Msg->Len + Batch_Sample_Size(Batch->Content, delta, Batch->Count)) > BATCH_MAX_LEN)
+  {
+    return 0;
+  }
+
+  pos = Msg->Len;
+
+  if (Batch->Count == 0U)
+  {
+    Serialize(&Msg->Data[BATCH_HEADER_OFFSET], Sample->TimeUs, 4);
+    Msg->Data[BATCH_HEADER_OFFSET + 4U] = Batch->Content;
+    Msg->Data[BATCH_HEADER_OFFSET + 5U] = Batch->Flags;
+  }
+  else
+  {
+    Serialize(&Msg->Data[pos], dt, 2);
+    pos += 2U;
+  }
+
+  if ((Batch->Content & BATCH_PRESS) != 0U)
+  {
+    FloatToArray(&Msg->Data[pos], Sample->Press);
+    pos += 4U;
+  }
+
+  if ((Batch->Content & BATCH_TEMP) != 0U)
+  {
+    FloatToArray(&Msg->Data[pos], Sample->Temp);
+    pos += 4U;
+  }
+
+  if ((Batch->Content & BATCH_HUM) != 0U)
+  {
+    FloatToArray(&Msg->Data[pos], Sample->Hum);
+    pos += 4U;
+  }
+
+  for (i = 0; i < n_axes; i++)
+  {
+    if (delta != 0U)
+    {
+      d = (int32_t)((uint32_t)axes[i] - (uint32_t)Batch->Last[i]);
+      Serialize_s32(&Msg->Data[pos], d, 2);
+      pos += 2U;
+    }
+    else
+    {
+      Serialize_s32(&Msg->Data[pos], axes[i], 4);
+      pos += 4U;
+    }
+
+    Batch->Last[i] = axes[i];
+  }
+
+  Batch->LastTimeUs = Sample->TimeUs;
+  Batch->Count++;
+  Msg->Data[BATCH_HEADER_OFFSET + 6U] = Batch->Count;
+  Msg->Len = pos;
+
+  return 1;
+}
+
+/**
+  * @brief  Decode a batched frame
+  * @param  Msg pointer to the frame, from the message header on, integrity trailer removed
+  * @param  Samples pointer to the decoded samples, the sensors not in the frame are set to 0
+  * @param  MaxSamples number of elements of Samples
+  * @retval Number of decoded samples, -1 if the frame is malformed or too long
+  */
+int32_t Batch_Decode(Msg_t *Msg, Batch_Sample_t *Samples, uint32_t MaxSamples)
+{
+  int32_t axes[9];
+  uint32_t n_axes;
+  uint32_t count;
+  uint32_t time_us;
+  uint32_t pos;
+  uint32_t i;
+  uint32_t k;
+  uint8_t content;
+  uint8_t flags;
+  uint8_t delta;
+
+  if (Msg->Len < (BATCH_HEADER_OFFSET + BATCH_HEADER_LEN))
+  {
+    return -1;
+  }
+
+  time_us = Deserialize(&Msg->Data[BATCH_HEADER_OFFSET], 4);
+  content = Msg->Data[BATCH_HEADER_OFFSET + 4U];
+  flags = Msg->Data[BATCH_HEADER_OFFSET + 5U];
+  count = Msg->Data[BATCH_HEADER_OFFSET + 6U];
+
+  if (((content & (uint8_t)~BATCH_CONTENT_MASK) != 0U) || ((flags & (uint8_t)~BATCH_FLAGS_MASK) != 0U) || (count > MaxSamples))
+  {
+    return -1;
+  }
+
+  n_axes = 0;
+  n_axes += ((content & BATCH_ACC) != 0U) ? 3U : 0U;
+  n_axes += ((content & BATCH_GYR) != 0U) ? 3U : 0U;
+  n_axes += ((content & BATCH_MAG) != 0U) ? 3U : 0U;
+
+  pos = BATCH_HEADER_OFFSET + BATCH_HEADER_LEN;
+
+  /* axes[] holds the previous sample, the reference of the deltas */
+  for (i = 0; i < count; i++)
+  {
+    delta = ((i != 0U) && ((flags & BATCH_FLAG_DELTA) != 0U)) ? 1U : 0U;
+
+    if ((pos + Batch_Sample_Size(content, delta, i)) > Msg->Len)
+    {
+      return -1;
+    }
+
+    (void)memset(&Samples[i], 0, sizeof(Batch_Sample_t));
+
+    if (i != 0U)
+    {
+      time_us += Deserialize(&Msg->Data[pos], 2);
+      pos += 2U;
+    }
+
+    Samples[i].TimeUs = time_us;
+
+    if ((content & BATCH_PRESS) != 0U)
+    {
+      (void)memcpy(&Samples[i].Press, &Msg->Data[pos], 4);
+      pos += 4U;
+    }
+
+    if ((content & BATCH_TEMP) != 0U)
+    {
+      (void)memcpy(&Samples[i].Temp, &Msg->Data[pos], 4);
+      pos += 4U;
+    }
+
+    if ((content & BATCH_HUM) != 0U)
+    {
+      (void)memcpy(&Samples[i].Hum, &Msg->Data[pos], 4);
+      pos += 4U;
+    }
+
+    for (k = 0; k < n_axes; k++)
+    {
+      if (delta != 0U)
+      {
+        /* Sign extend the int16 delta */
+        axes[k] = (int32_t)((uint32_t)axes[k] + (uint32_t)(int32_t)(int16_t)Deserialize(&Msg->Data[pos], 2));
+        pos += 2U;
+      }
+      else
+      {
+        axes[k] = Deserialize_s32(&Msg->Data[pos], 4);
+        pos += 4U;
+      }
+    }
+
+    Batch_Set_Axes(content, &Samples[i], axes);
+  }
+
+  return (pos == Msg->Len) ? (int32_t)count : -1;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Gather the axes of the sensors in the frame, in frame order
+  * @param  Content sensors in the frame
+  * @param  Sample pointer to the sample
+  * @param  Axes pointer to the gathered axes, 9 elements
+  * @retval Number of gathered axes
+  */
+static uint32_t Batch_Get_Axes(uint8_t Content, const Batch_Sample_t *Sample, int32_t *Axes)
+{
+  uint32_t n = 0;
+
+  if ((Content & BATCH_ACC) != 0U)
+  {
+    (void)memcpy(&Axes[n], Sample->Acc, sizeof(Sample->Acc));
+    n += 3U;
+  }
+
+  if ((Content & BATCH_GYR) != 0U)
+  {
+    (void)memcpy(&Axes[n], Sample->Gyr, sizeof(Sample->Gyr));
+    n += 3U;
+  }
+
+  if ((Content & BATCH_MAG) != 0U)
+  {
+    (void)memcpy(&Axes[n], Sample->Mag, sizeof(Sample->Mag));
+    n += 3U;
+  }
+
+  return n;
+}
+
+/**
+  * @brief  Scatter the axes of the sensors in the frame, in frame order
+  * @param  Content sensors in the frame
+  * @param  Sample pointer to the sample
+  * @param  Axes pointer to the axes to be scattered
+  * @retval None
+  */
+static void Batch_Set_Axes(uint8_t Content, Batch_Sample_t *Sample, const int32_t *Axes)
+{
+  uint32_t n = 0;
+
+  if ((Content & BATCH_ACC) != 0U)
+  {
+    (void)memcpy(Sample->Acc, &Axes[n], sizeof(Sample->Acc));
+    n += 3U;
+  }
+
+  if ((Content & BATCH_GYR) != 0U)
+  {
+    (void)memcpy(Sample->Gyr, &Axes[n], sizeof(Sample->Gyr));
+    n += 3U;
+  }
+
+  if ((Content & BATCH_MAG) != 0U)
+  {
+    (void)memcpy(Sample->Mag, &Axes[n], sizeof(Sample->Mag));
+  }
+}
+
+/**
+  * @brief  Size of a sample in the frame
+  * @param  Content sensors in the frame
+  * @param  Delta 1 if the axes are delta coded, 0 otherwise
+  * @param  Index sample index in the frame
+  * @retval Size [bytes]
+  */
+static uint32_t Batch_Sample_Size(uint8_t Content, uint8_t Delta, uint32_t Index)
+{
+  uint32_t size = (Index != 0U) ? 2U : 0U;
+  uint32_t axis_size = (Delta != 0U) ? 2U : 4U;
+
+  size += ((Content & BATCH_PRESS) != 0U) ? 4U : 0U;
+  size += ((Content & BATCH_TEMP) != 0U) ? 4U : 0U;
+  size += ((Content & BATCH_HUM) != 0U) ? 4U : 0U;
+  size += ((Content & BATCH_ACC) != 0U) ? (3U * axis_size) : 0U;
+  size += ((Content & BATCH_GYR) != 0U) ? (3U * axis_size) : 0U;
+  size += ((Content & BATCH_MAG) != 0U) ? (3U * axis_size) : 0U;
+
+  return size;
+}
+
+/**
+  * @}
+  */
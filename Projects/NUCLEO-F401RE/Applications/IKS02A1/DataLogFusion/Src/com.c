@@ -17,7 +17,9 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include <string.h>
 #include "com.h"
+#include "profiler.h"
 
 /** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
   * @{
@@ -25,7 +27,12 @@
 
 /* Private types -------------------------------------------------------------*/
 /* Private defines -----------------------------------------------------------*/
-#define UART_MSG_MAX_SIZE Msg_MaxLen
+/* Reception parser states */
+#define UART_RX_STATE_IDLE    0U /* Delimiter received, the last frame is kept until the next byte */
+#define UART_RX_STATE_DATA    1U /* Frame bytes */
+#define UART_RX_STATE_ESCAPE  2U /* Msg_BS received, escaped byte expected */
+#define UART_RX_STATE_SKIP    3U /* Invalid frame, discarded up to the next delimiter */
+#define UART_TX_ALL_FREE  ((uint8_t)((1U << UART_TX_QUEUE_LEN) - 1U))
 
 /* Private macro -------------------------------------------------------------*/
 /* Exported variables --------------------------------------------------------*/
@@ -33,123 +40,356 @@ volatile uint8_t UartRxBuffer[UART_RX_BUFFER_SIZE];
 Uart_Engine_t UartEngine;
 
 /* Private variables ---------------------------------------------------------*/
-static volatile uint8_t UartTxBuffer[UART_TX_BUFFER_SIZE];
+static volatile uint8_t UartTxBuffer[UART_TX_QUEUE_LEN][UART_TX_BUFFER_SIZE];
+static uint16_t UartTxLen[UART_TX_QUEUE_LEN];
+static uint8_t UartTxFifo[UART_TX_QUEUE_LEN]; /* Slots waiting for the line, oldest first */
+static uint8_t UartTxHead = 0;                /* FIFO position of the oldest waiting slot */
+static uint8_t UartTxCount = 0;               /* Number of waiting slots */
+static uint8_t UartTxFree = UART_TX_ALL_FREE; /* Bit mask of the free slots */
+static volatile uint8_t UartTxActive = UART_TX_NO_SLOT; /* Slot on the line */
+static Uart_TxStats_t UartTxStats;
+static uint8_t UartFraming = UART_FRAMING_STUFFING;
+static uint8_t UartIntegrity = UART_INTEGRITY_CHK8;
+static Msg_t UartRxMsg; /* Frame being received */
 
 /* Private function prototypes -----------------------------------------------*/
 static uint32_t Get_DMA_Flag_Status(DMA_HandleTypeDef *handle_dma);
 static uint32_t Get_DMA_Counter(DMA_HandleTypeDef *handle_dma);
+static uint8_t Tx_Slot_Acquire(void);
+static void Tx_Slot_Commit(uint8_t Slot, uint16_t Len);
+static void Tx_Slot_Release(uint8_t Slot);
+static void Frame_Put_Byte(Uart_Frame_t *Frame, uint8_t Data);
+static void Tx_Start_Next(void);
+static void Rx_Parse_Reset(void);
+static int32_t Rx_Parse_Byte(uint8_t Data);
+static uint32_t Crc32_Compute(const uint8_t *Data, uint32_t Len);
+static int32_t Integrity_Add(Msg_t *Msg);
+static int32_t Integrity_CheckAndRemove(Msg_t *Msg);
 
 /* Exported functions --------------------------------------------------------*/
 /**
   * @brief  Check if a message is received via UART
+  * @note   The bytes received since the previous call are parsed once, the frame being
+  *         un-framed as it arrives. Nothing is done until the reception DMA reports
+  *         a half/full transfer or an idle line. A reception stopped by a UART error
+  *         is restarted here, so that the parser is never reset while parsing.
   * @param  Msg the pointer to the message to be received
   * @retval 1 if a complete message is found, 0 otherwise
   */
 int32_t UART_ReceivedMSG(Msg_t *Msg)
 {
-  uint16_t i;
-  uint16_t j;
-  uint16_t k;
-  uint16_t j2;
-  uint16_t length;
   uint16_t dma_counter;
   uint8_t data;
-  uint16_t source = 0;
-  uint8_t inc;
 
-  if (Get_DMA_Flag_Status(hcom_uart[COM1].hdmarx) == (uint32_t)RESET)
+  if (UartEngine.RxRestart != 0U)
   {
-    dma_counter = (uint16_t)UART_RX_BUFFER_SIZE - (uint16_t)Get_DMA_Counter(hcom_uart[COM1].hdmarx);
+    UartEngine.RxRestart = 0;
+    UART_StartReceiveMsg();
+    return 0;
+  }
+
+  if ((UartEngine.RxEvent == 0U) || (Get_DMA_Flag_Status(hcom_uart[COM1].hdmarx) != (uint32_t)RESET))
+  {
+    return 0;
+  }
+
+  /* Cleared before reading the DMA position, bytes received later raise a new event */
+  UartEngine.RxEvent = 0;
+  dma_counter = (uint16_t)UART_RX_BUFFER_SIZE - (uint16_t)Get_DMA_Counter(hcom_uart[COM1].hdmarx);
+
+  if (dma_counter >= (uint16_t)UART_RX_BUFFER_SIZE)
+  {
+    dma_counter = 0;
+  }
+
+  while (UartEngine.StartOfMsg != dma_counter)
+  {
+    data = UartRxBuffer[UartEngine.StartOfMsg];
+    UartEngine.StartOfMsg++;
 
-    if (dma_counter >= UartEngine.StartOfMsg)
+    if (UartEngine.StartOfMsg >= (uint16_t)UART_RX_BUFFER_SIZE)
     {
-      length = dma_counter - UartEngine.StartOfMsg;
+      UartEngine.StartOfMsg = 0;
     }
-    else
+
+    if ((Rx_Parse_Byte(data) != 0) && (Integrity_CheckAndRemove(&UartRxMsg) != 0))
     {
-      length = (uint16_t)UART_RX_BUFFER_SIZE + dma_counter - UartEngine.StartOfMsg;
+      (void)memcpy(Msg->Data, UartRxMsg.Data, UartRxMsg.Len);
+      Msg->Len = UartRxMsg.Len;
+
+      /* The remaining bytes are parsed by the next call */
+      UartEngine.RxEvent = 1;
+      return 1;
     }
+  }
 
-    j = UartEngine.StartOfMsg;
+  return 0;
+}
 
-    for (k = 0; k < length; k++)
-    {
-      data = UartRxBuffer[j];
-      j++;
+/**
+  * @brief  Send a message via UART
+  * @note   Only the queued messages are profiled in PROF_STAGE_UART_SEND
+  * @param  Msg the pointer to the message to be sent
+  * @retval None
+  */
+void UART_SendMsg(Msg_t *Msg)
+{
+  uint16_t count_out;
+  uint8_t slot;
+  uint32_t begin = PROF_BEGIN();
 
-      if (j >= (uint16_t)UART_RX_BUFFER_SIZE)
-      {
-        j = 0;
-      }
+  if (Integrity_Add(Msg) == 0)
+  {
+    return;
+  }
 
-      if (data == (uint8_t)Msg_EOF)
-      {
-        j = UartEngine.StartOfMsg;
+  slot = Tx_Slot_Acquire();
+
+  if (slot == UART_TX_NO_SLOT)
+  {
+    return;
+  }
+
+  /* MISRA C-2012 rule 11.8 violation for purpose */
+  if (UartFraming == UART_FRAMING_COBS)
+  {
+    count_out = (uint16_t)CobsEncode((uint8_t *)UartTxBuffer[slot], Msg);
+  }
+  else
+  {
+    count_out = (uint16_t)ByteStuffCopy((uint8_t *)UartTxBuffer[slot], Msg);
+  }
+
+  Tx_Slot_Commit(slot, count_out);
+  (void)Prof_End(PROF_STAGE_UART_SEND, begin);
+}
+
+/**
+  * @brief  Start a frame built in place in a transmit slot, without intermediate Msg
+  * @note   The payload is framed and checksummed as it is written, the frame being queued
+  *         by UART_FrameEnd. The output is byte identical to UART_SendMsg of the same payload.
+  * @param  Frame the pointer to the frame
+  * @retval 1 if a transmit slot is available, 0 if the frame is dropped by the queue policy
+  */
+int32_t UART_FrameBegin(Uart_Frame_t *Frame)
+{
+  Frame->Slot = Tx_Slot_Acquire();
+  Frame->Framing = UartFraming;
+  Frame->Integrity = UartIntegrity;
+  Frame->Code = 1;
+  Frame->CodePos = 0;
+  Frame->Count = (Frame->Framing == UART_FRAMING_COBS) ? 1U : 0U;
+  Frame->Len = 0;
+  Frame->Crc = CRC32_INIT;
+  Frame->Chk = 0;
+
+  return (Frame->Slot != UART_TX_NO_SLOT) ? 1 : 0;
+}
 
-        for (i = 0; i < k; i += inc)
-        {
-          uint8_t  Source0;
-          uint8_t  Source1;
-          uint8_t *Dest;
+/**
+  * @brief  Append bytes to the frame payload
+  * @param  Frame the pointer to the frame
+  * @param  Data the pointer to the bytes
+  * @param  Len number of bytes
+  * @retval None
+  */
+void UART_FramePut(Uart_Frame_t *Frame, const uint8_t *Data, uint32_t Len)
+{
+  uint32_t i;
 
-          j2 = (j + 1U) % (uint16_t)UART_RX_BUFFER_SIZE;
+  if (Frame->Slot == UART_TX_NO_SLOT)
+  {
+    return;
+  }
 
-          if (source >= Msg_MaxLen)
-          {
-            UartEngine.StartOfMsg = j;
-            return 0;
-          }
+  if (Frame->Integrity == UART_INTEGRITY_CRC32)
+  {
+    Frame->Crc = CRC32_Update(Frame->Crc, Data, Len);
+  }
 
-          Source0 = UartRxBuffer[j];
-          Source1 = UartRxBuffer[j2];
-          Dest    = &Msg->Data[source];
+  for (i = 0; i < Len; i++)
+  {
+    Frame->Chk -= Data[i];
+    Frame_Put_Byte(Frame, Data[i]);
+  }
+}
 
-          inc = (uint8_t)ReverseByteStuffCopyByte2(Source0, Source1, Dest);
+/**
+  * @brief  Append an unsigned number to the frame payload (LSB first)
+  * @param  Frame the pointer to the frame
+  * @param  Source the number
+  * @param  Len number of bytes
+  * @retval None
+  */
+void UART_FrameSerialize(Uart_Frame_t *Frame, uint32_t Source, uint32_t Len)
+{
+  uint8_t data[4];
 
-          if (inc == 0U)
-          {
-            UartEngine.StartOfMsg = j2;
-            return 0;
-          }
+  Serialize(data, Source, Len);
+  UART_FramePut(Frame, data, Len);
+}
 
-          j = (j + inc) % (uint16_t)UART_RX_BUFFER_SIZE;
-          source++;
-        }
+/**
+  * @brief  Append a float to the frame payload
+  * @param  Frame the pointer to the frame
+  * @param  Data the float
+  * @retval None
+  */
+void UART_FrameFloat(Uart_Frame_t *Frame, float Data)
+{
+  uint8_t data[4];
 
-        Msg->Len = source;
-        j = (j + 1U) % (uint16_t)UART_RX_BUFFER_SIZE; /* skip Msg_EOF */
-        UartEngine.StartOfMsg = j;
+  FloatToArray(data, Data);
+  UART_FramePut(Frame, data, 4);
+}
 
-        /* check message integrity */
-        return (CHK_CheckAndRemove(Msg) != 0) ? 1 : 0;
-      }
-    }
+/**
+  * @brief  Append the integrity trailer and the delimiter, then queue the frame
+  * @param  Frame the pointer to the frame
+  * @retval None
+  */
+void UART_FrameEnd(Uart_Frame_t *Frame)
+{
+  uint8_t trailer[CRC32_LEN];
+  uint32_t trailer_len;
+  uint32_t i;
 
-    if (length > (uint16_t)UART_MSG_MAX_SIZE)
-    {
-      UartEngine.StartOfMsg = dma_counter;
-    }
+  if (Frame->Slot == UART_TX_NO_SLOT)
+  {
+    return;
   }
 
-  return 0;
+  if (Frame->Integrity == UART_INTEGRITY_CRC32)
+  {
+    Serialize(trailer, Frame->Crc, CRC32_LEN);
+    trailer_len = CRC32_LEN;
+  }
+  else
+  {
+    trailer[0] = Frame->Chk;
+    trailer_len = 1;
+  }
+
+  /* The payload and its trailer have to fit a Msg, as for UART_SendMsg */
+  if ((Frame->Len + trailer_len) > (uint32_t)Msg_MaxLen)
+  {
+    Tx_Slot_Release(Frame->Slot);
+    Frame->Slot = UART_TX_NO_SLOT;
+    return;
+  }
+
+  for (i = 0; i < trailer_len; i++)
+  {
+    Frame_Put_Byte(Frame, trailer[i]);
+  }
+
+  if (Frame->Framing == UART_FRAMING_COBS)
+  {
+    UartTxBuffer[Frame->Slot][Frame->CodePos] = Frame->Code;
+    UartTxBuffer[Frame->Slot][Frame->Count] = Msg_COBS_EOF;
+  }
+  else
+  {
+    UartTxBuffer[Frame->Slot][Frame->Count] = Msg_EOF;
+  }
+
+  Tx_Slot_Commit(Frame->Slot, Frame->Count + 1U);
+  Frame->Slot = UART_TX_NO_SLOT;
 }
 
 /**
-  * @brief  Send a message via UART
-  * @param  Msg the pointer to the message to be sent
+  * @brief  Select the framing of the next sent and received messages
+  * @param  Framing UART_FRAMING_STUFFING or UART_FRAMING_COBS
+  * @retval 1 if the framing is supported, 0 otherwise
+  */
+int32_t UART_SetFraming(uint8_t Framing)
+{
+  if ((Framing != UART_FRAMING_STUFFING) && (Framing != UART_FRAMING_COBS))
+  {
+    return 0;
+  }
+
+  UartFraming = Framing;
+  Rx_Parse_Reset();
+  return 1;
+}
+
+/**
+  * @brief  Select the integrity trailer of the next sent and received messages
+  * @param  Integrity UART_INTEGRITY_CHK8 or UART_INTEGRITY_CRC32
+  * @retval 1 if the integrity trailer is supported, 0 otherwise
+  */
+int32_t UART_SetIntegrity(uint8_t Integrity)
+{
+  if ((Integrity != UART_INTEGRITY_CHK8) && (Integrity != UART_INTEGRITY_CRC32))
+  {
+    return 0;
+  }
+
+  UartIntegrity = Integrity;
+  return 1;
+}
+
+/**
+  * @brief  Get the transmit queue statistics
+  * @param  Stats the pointer to the statistics to be filled
   * @retval None
   */
-void UART_SendMsg(Msg_t *Msg)
+void UART_GetTxStats(Uart_TxStats_t *Stats)
 {
-  uint16_t count_out;
+  uint32_t primask = __get_PRIMASK();
 
-  CHK_ComputeAndAdd(Msg);
+  __disable_irq();
+  *Stats = UartTxStats;
+  __set_PRIMASK(primask);
+}
 
-  /* MISRA C-2012 rule 11.8 violation for purpose */
-  count_out = (uint16_t)ByteStuffCopy((uint8_t *)UartTxBuffer, Msg);
+/**
+  * @brief  Tx Transfer completed callback, start the next queued frame
+  * @param  huart UART handle
+  * @retval None
+  */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if ((huart->Instance == hcom_uart[COM1].Instance) && (UartTxActive != UART_TX_NO_SLOT))
+  {
+    UartTxFree |= (uint8_t)(1U << UartTxActive);
+    UartTxActive = UART_TX_NO_SLOT;
+    UartTxStats.Sent++;
+    UartTxStats.Depth--;
 
-  /* MISRA C-2012 rule 11.8 violation for purpose */
-  (void)HAL_UART_Transmit(&hcom_uart[COM1], (uint8_t *)UartTxBuffer, count_out, 5000);
+    Tx_Start_Next();
+  }
+}
+
+/**
+  * @brief  UART error callback, restart the stopped transfers
+  * @param  huart UART handle
+  * @retval None
+  */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance != hcom_uart[COM1].Instance)
+  {
+    return;
+  }
+
+  /* A blocking error aborts the reception DMA, UART_ReceivedMSG restarts it from the buffer beginning */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    UartEngine.RxRestart = 1;
+  }
+
+  /* The frame on the line is lost, go on with the queue */
+  if ((huart->gState == HAL_UART_STATE_READY) && (UartTxActive != UART_TX_NO_SLOT))
+  {
+    UartTxFree |= (uint8_t)(1U << UartTxActive);
+    UartTxActive = UART_TX_NO_SLOT;
+    UartTxStats.Dropped++;
+    UartTxStats.Depth--;
+
+    Tx_Start_Next();
+  }
 }
 
 /**
@@ -163,10 +403,32 @@ void UART_StartReceiveMsg(void)
   hcom_uart[COM1].RxXferSize = UART_RX_BUFFER_SIZE;
   hcom_uart[COM1].ErrorCode = (uint32_t)HAL_UART_ERROR_NONE;
 
+  /* The DMA restarts from the buffer beginning */
+  UartEngine.StartOfMsg = 0;
+  UartEngine.RxEvent = 0;
+  UartEngine.RxRestart = 0;
+  Rx_Parse_Reset();
+
   /* Enable the DMA transfer for the receiver request by setting the DMAR bit
-     in the UART CR3 register */
+     in the UART CR3 register, and the idle line interrupt */
   /* MISRA C-2012 rule 11.8 violation for purpose */
-  (void)HAL_UART_Receive_DMA(&hcom_uart[COM1], (uint8_t *)UartRxBuffer, UART_RX_BUFFER_SIZE);
+  (void)HAL_UARTEx_ReceiveToIdle_DMA(&hcom_uart[COM1], (uint8_t *)UartRxBuffer, UART_RX_BUFFER_SIZE);
+}
+
+/**
+  * @brief  Reception event callback: DMA half/full transfer or idle line
+  * @param  huart UART handle
+  * @param  Size position of the DMA in the reception buffer
+  * @retval None
+  */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  (void)Size;
+
+  if (huart->Instance == hcom_uart[COM1].Instance)
+  {
+    UartEngine.RxEvent = 1;
+  }
 }
 
 /* Private functions ---------------------------------------------------------*/
@@ -191,6 +453,364 @@ static uint32_t Get_DMA_Counter(DMA_HandleTypeDef *handle_dma)
   return (__HAL_DMA_GET_COUNTER(handle_dma));
 }
 
+/**
+  * @brief  Restart the reception parser from the beginning of a frame
+  * @param  None
+  * @retval None
+  */
+static void Rx_Parse_Reset(void)
+{
+  UartEngine.RxState = UART_RX_STATE_IDLE;
+  UartEngine.RxCobsLeft = 0;
+  UartEngine.RxCobsCode = 0;
+}
+
+/**
+  * @brief  Un-frame one received byte into UartRxMsg
+  * @note   Invalid sequences and too long frames are discarded up to the next delimiter
+  * @param  Data received byte
+  * @retval 1 if the byte completes a frame, 0 otherwise
+  */
+static int32_t Rx_Parse_Byte(uint8_t Data)
+{
+  uint8_t eof = (UartFraming == UART_FRAMING_COBS) ? (uint8_t)Msg_COBS_EOF : (uint8_t)Msg_EOF;
+  int32_t append = 1;
+
+  if (Data == eof)
+  {
+    /* Empty frame, truncated escape sequence or COBS block */
+    append = ((UartEngine.RxState == UART_RX_STATE_DATA) && (UartEngine.RxCobsLeft == 0U)) ? 1 : 0;
+    Rx_Parse_Reset();
+    return append;
+  }
+
+  if (UartEngine.RxState == UART_RX_STATE_SKIP)
+  {
+    return 0;
+  }
+
+  if (UartEngine.RxState == UART_RX_STATE_IDLE)
+  {
+    UartEngine.RxState = UART_RX_STATE_DATA;
+    UartRxMsg.Len = 0;
+  }
+
+  if (UartFraming == UART_FRAMING_COBS)
+  {
+    if (UartEngine.RxCobsLeft == 0U)
+    {
+      /* Code byte: each block but the first and the full ones is preceded by a zero */
+      append = ((UartEngine.RxCobsCode != 0U) && (UartEngine.RxCobsCode != COBS_MAX_CODE)) ? 1 : 0;
+      UartEngine.RxCobsCode = Data;
+      UartEngine.RxCobsLeft = Data - 1U;
+      Data = Msg_COBS_EOF;
+    }
+    else
+    {
+      UartEngine.RxCobsLeft--;
+    }
+  }
+  else if (UartEngine.RxState == UART_RX_STATE_ESCAPE)
+  {
+    UartEngine.RxState = UART_RX_STATE_DATA;
+
+    if (Data == (uint8_t)Msg_BS_EOF)
+    {
+      Data = Msg_EOF;
+    }
+    else if (Data != (uint8_t)Msg_BS)
+    {
+      UartEngine.RxState = UART_RX_STATE_SKIP;
+      return 0;
+    }
+    else
+    {
+      /* Escaped Msg_BS */
+    }
+  }
+  else if (Data == (uint8_t)Msg_BS)
+  {
+    UartEngine.RxState = UART_RX_STATE_ESCAPE;
+    append = 0;
+  }
+  else
+  {
+    /* Plain byte */
+  }
+
+  if (append != 0)
+  {
+    if (UartRxMsg.Len >= (uint32_t)Msg_MaxLen)
+    {
+      UartEngine.RxState = UART_RX_STATE_SKIP;
+      return 0;
+    }
+
+    UartRxMsg.Data[UartRxMsg.Len] = Data;
+    UartRxMsg.Len++;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  CRC-32/MPEG-2 of a byte array
+  * @note   Whole words go through the CRC unit, most significant byte first so that
+  *         the result matches the byte oriented CRC32_Update, the tail is done in software.
+  *         To be called from the main loop only, the CRC unit is not reentrant.
+  * @param  Data pointer to the bytes
+  * @param  Len number of bytes
+  * @retval The CRC value
+  */
+static uint32_t Crc32_Compute(const uint8_t *Data, uint32_t Len)
+{
+#ifdef HAL_CRC_MODULE_ENABLED
+  uint32_t i;
+  uint32_t words = Len / 4U;
+
+  WRITE_REG(CRC->CR, CRC_CR_RESET);
+
+  for (i = 0; i < words; i++)
+  {
+    WRITE_REG(CRC->DR, ((uint32_t)Data[0] << 24) | ((uint32_t)Data[1] << 16) | ((uint32_t)Data[2] << 8) | (uint32_t)Data[3]);
+    Data += 4;
+  }
+
+  return CRC32_Update(READ_REG(CRC->DR), Data, Len - (words * 4U));
+#else
+  return CRC32_Update(CRC32_INIT, Data, Len);
+#endif /* HAL_CRC_MODULE_ENABLED */
+}
+
+/**
+  * @brief  Append the integrity trailer selected by UART_SetIntegrity
+  * @param  Msg pointer to the message
+  * @retval 1 if the operation succeeds, 0 if the message has no room for the trailer
+  */
+static int32_t Integrity_Add(Msg_t *Msg)
+{
+  if (UartIntegrity == UART_INTEGRITY_CRC32)
+  {
+    if ((Msg->Len + CRC32_LEN) > (uint32_t)Msg_MaxLen)
+    {
+      return 0;
+    }
+
+    Serialize(&Msg->Data[Msg->Len], Crc32_Compute(Msg->Data, Msg->Len), CRC32_LEN);
+    Msg->Len += CRC32_LEN;
+    return 1;
+  }
+
+  if (Msg->Len >= (uint32_t)Msg_MaxLen)
+  {
+    return 0;
+  }
+
+  CHK_ComputeAndAdd(Msg);
+  return 1;
+}
+
+/**
+  * @brief  Check and remove the integrity trailer selected by UART_SetIntegrity
+  * @param  Msg pointer to the message
+  * @retval 1 if the message is intact, 0 otherwise
+  */
+static int32_t Integrity_CheckAndRemove(Msg_t *Msg)
+{
+  if (UartIntegrity == UART_INTEGRITY_CRC32)
+  {
+    if (Msg->Len < CRC32_LEN)
+    {
+      return 0;
+    }
+
+    Msg->Len -= CRC32_LEN;
+    return (Crc32_Compute(Msg->Data, Msg->Len) == Deserialize(&Msg->Data[Msg->Len], CRC32_LEN)) ? 1 : 0;
+  }
+
+  if (Msg->Len == 0U)
+  {
+    return 0;
+  }
+
+  return (CHK_CheckAndRemove(Msg) != 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Get a free transmit slot, applying the queue policy when all are in use
+  * @param  None
+  * @retval The slot index, UART_TX_NO_SLOT if the frame has to be dropped
+  */
+static uint8_t Tx_Slot_Acquire(void)
+{
+  uint8_t slot = UART_TX_NO_SLOT;
+  uint8_t i;
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+
+  if (UartTxFree != 0U)
+  {
+    for (i = 0; (UartTxFree & (1U << i)) == 0U; i++)
+    {
+    }
+
+    UartTxFree &= (uint8_t)~(1U << i);
+    slot = i;
+  }
+#if (UART_TX_QUEUE_POLICY == UART_TX_OVERWRITE_OLDEST)
+  else if (UartTxCount != 0U)
+  {
+    /* Reuse the oldest frame still waiting, the one on the line cannot be touched */
+    slot = UartTxFifo[UartTxHead];
+    UartTxHead = (uint8_t)((UartTxHead + 1U) % UART_TX_QUEUE_LEN);
+    UartTxCount--;
+    UartTxStats.Overwritten++;
+    UartTxStats.Depth--;
+  }
+#endif /* UART_TX_QUEUE_POLICY */
+  else
+  {
+    UartTxStats.Dropped++;
+  }
+
+  __set_PRIMASK(primask);
+
+  return slot;
+}
+
+/**
+  * @brief  Queue a filled transmit slot and start the transmission if the line is idle
+  * @param  Slot the slot index
+  * @param  Len the number of bytes to be sent
+  * @retval None
+  */
+static void Tx_Slot_Commit(uint8_t Slot, uint16_t Len)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+
+  UartTxLen[Slot] = Len;
+  UartTxFifo[(UartTxHead + UartTxCount) % UART_TX_QUEUE_LEN] = Slot;
+  UartTxCount++;
+
+  UartTxStats.Queued++;
+  UartTxStats.Depth++;
+  if (UartTxStats.Depth > UartTxStats.MaxDepth)
+  {
+    UartTxStats.MaxDepth = UartTxStats.Depth;
+  }
+
+  if (UartTxActive == UART_TX_NO_SLOT)
+  {
+    Tx_Start_Next();
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Give back an acquired transmit slot without sending it
+  * @param  Slot the slot index
+  * @retval None
+  */
+static void Tx_Slot_Release(uint8_t Slot)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  UartTxFree |= (uint8_t)(1U << Slot);
+  UartTxStats.Dropped++;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Frame one payload or trailer byte into the transmit slot
+  * @note   Bytes beyond Msg_MaxLen are counted but not written, UART_FrameEnd drops the frame
+  * @param  Frame the pointer to the frame
+  * @param  Data the byte
+  * @retval None
+  */
+static void Frame_Put_Byte(Uart_Frame_t *Frame, uint8_t Data)
+{
+  volatile uint8_t *dest = UartTxBuffer[Frame->Slot];
+
+  Frame->Len++;
+
+  if (Frame->Len > (uint32_t)Msg_MaxLen)
+  {
+    return;
+  }
+
+  if (Frame->Framing == UART_FRAMING_COBS)
+  {
+    if (Data == (uint8_t)Msg_COBS_EOF)
+    {
+      dest[Frame->CodePos] = Frame->Code;
+      Frame->CodePos = Frame->Count;
+      Frame->Count++;
+      Frame->Code = 1;
+    }
+    else
+    {
+      dest[Frame->Count] = Data;
+      Frame->Count++;
+      Frame->Code++;
+
+      if (Frame->Code == COBS_MAX_CODE)
+      {
+        dest[Frame->CodePos] = Frame->Code;
+        Frame->CodePos = Frame->Count;
+        Frame->Count++;
+        Frame->Code = 1;
+      }
+    }
+  }
+  else
+  {
+    if ((Data == (uint8_t)Msg_EOF) || (Data == (uint8_t)Msg_BS))
+    {
+      dest[Frame->Count] = Msg_BS;
+      Frame->Count++;
+      Data = (Data == (uint8_t)Msg_EOF) ? (uint8_t)Msg_BS_EOF : (uint8_t)Msg_BS;
+    }
+
+    dest[Frame->Count] = Data;
+    Frame->Count++;
+  }
+}
+
+/**
+  * @brief  Start the DMA transmission of the oldest waiting slot, if any
+  * @note   To be called with interrupts disabled or from the UART interrupt
+  * @param  None
+  * @retval None
+  */
+static void Tx_Start_Next(void)
+{
+  uint8_t slot;
+
+  while (UartTxCount != 0U)
+  {
+    slot = UartTxFifo[UartTxHead];
+    UartTxHead = (uint8_t)((UartTxHead + 1U) % UART_TX_QUEUE_LEN);
+    UartTxCount--;
+
+    /* MISRA C-2012 rule 11.8 violation for purpose */
+    if (HAL_UART_Transmit_DMA(&hcom_uart[COM1], (uint8_t *)UartTxBuffer[slot], UartTxLen[slot]) == HAL_OK)
+    {
+      UartTxActive = slot;
+      return;
+    }
+
+    /* The frame cannot be sent, release the slot */
+    UartTxFree |= (uint8_t)(1U << slot);
+    UartTxStats.Dropped++;
+    UartTxStats.Depth--;
+  }
+}
+
 /**
   * @}
   */
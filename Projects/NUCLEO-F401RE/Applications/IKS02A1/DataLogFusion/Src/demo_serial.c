@@ -55,6 +55,8 @@
 static volatile uint8_t DataStreamingDest = 1;
 
 /* Private function prototypes -----------------------------------------------*/
+static void Offline_Data_Put(const uint8_t *Record);
+
 /* Exported functions --------------------------------------------------------*/
 /**
   * @brief  Build the reply header
@@ -101,6 +103,34 @@ void INIT_STREAMING_MSG(Msg_t *Msg)
   Msg->Len = 3;
 }
 
+/**
+  * @brief  Put the streaming header at the start of a frame built in place
+  * @param  Frame the pointer to the frame started with UART_FrameBegin
+  * @param  Cmd CMD_Start_Data_Streaming or CMD_Layout_Data_Streaming
+  * @retval None
+  */
+void INIT_STREAMING_FRAME(Uart_Frame_t *Frame, uint8_t Cmd)
+{
+  uint8_t header[3];
+
+  header[0] = DataStreamingDest;
+  header[1] = DEV_ADDR;
+  header[2] = Cmd;
+  UART_FramePut(Frame, header, 3);
+}
+
+/**
+  * @brief  Initialize the batched frame header, the frame length is left unchanged
+  * @param  Msg the pointer to the header to be initialized
+  * @retval None
+  */
+void INIT_BATCH_HEADER(Msg_t *Msg)
+{
+  Msg->Data[0] = DataStreamingDest;
+  Msg->Data[1] = DEV_ADDR;
+  Msg->Data[2] = CMD_Batch_Data_Streaming;
+}
+
 /**
   * @brief  Handle a message
   * @param  Msg the pointer to the message to be handled
@@ -118,6 +148,12 @@ int32_t HandleMSG(Msg_t *Msg)
   static uint32_t sensors_enabled_prev = 0;
   int32_t msg_offset;
   uint32_t msg_count;
+  Uart_TxStats_t tx_stats;
+  uint8_t framing;
+  uint8_t integrity;
+  uint8_t mode;
+  uint8_t reset;
+  const Prof_Stage_t *prof;
 
   if (Msg->Len < 2U)
   {
@@ -260,6 +296,8 @@ int32_t HandleMSG(Msg_t *Msg)
         BSP_SENSOR_MAG_Enable();
       }
 
+      /* Every enabled sensor is read on the first tick */
+      SensorTick = 0;
       (void)HAL_TIM_Base_Start_IT(&BSP_IP_TIM_HANDLE);
       DataLoggerActive = 1;
 
@@ -286,8 +324,15 @@ int32_t HandleMSG(Msg_t *Msg)
       BSP_SENSOR_TEMP_Disable();
       BSP_SENSOR_HUM_Disable();
 
+      /* Keep the gyroscope bias for the next start, unless it was estimated on offline data */
+      if (UseOfflineData == 0U)
+      {
+        MotionFX_manager_save_gbias();
+      }
+
       SensorsEnabled = 0;
       UseOfflineData = 0;
+      BatchFlushRequest = 1;
 
       BUILD_REPLY_HEADER(Msg);
       UART_SendMsg(Msg);
@@ -317,40 +362,8 @@ int32_t HandleMSG(Msg_t *Msg)
 
       for (i = 0; i < msg_count; i++)
       {
-        memcpy(&OfflineData[OfflineDataWriteIndex].hours, &Msg->Data[msg_offset], 1);
-        memcpy(&OfflineData[OfflineDataWriteIndex].minutes, &Msg->Data[msg_offset + 1], 1);
-        memcpy(&OfflineData[OfflineDataWriteIndex].seconds, &Msg->Data[msg_offset + 2], 1);
-        memcpy(&OfflineData[OfflineDataWriteIndex].subsec, &Msg->Data[msg_offset + 3], 1);
-
-        memcpy(&OfflineData[OfflineDataWriteIndex].pressure, &Msg->Data[msg_offset + 4], 4);
-        memcpy(&OfflineData[OfflineDataWriteIndex].temperature, &Msg->Data[msg_offset + 8], 4);
-        memcpy(&OfflineData[OfflineDataWriteIndex].humidity, &Msg->Data[msg_offset + 12], 4);
-
-        memcpy(&OfflineData[OfflineDataWriteIndex].acceleration_x_mg, &Msg->Data[msg_offset + 16], 4);
-        memcpy(&OfflineData[OfflineDataWriteIndex].acceleration_y_mg, &Msg->Data[msg_offset + 20], 4);
-        memcpy(&OfflineData[OfflineDataWriteIndex].acceleration_z_mg, &Msg->Data[msg_offset + 24], 4);
-
-        memcpy(&OfflineData[OfflineDataWriteIndex].angular_rate_x_mdps, &Msg->Data[msg_offset + 28], 4);
-        memcpy(&OfflineData[OfflineDataWriteIndex].angular_rate_y_mdps, &Msg->Data[msg_offset + 32], 4);
-        memcpy(&OfflineData[OfflineDataWriteIndex].angular_rate_z_mdps, &Msg->Data[msg_offset + 36], 4);
-
-        memcpy(&OfflineData[OfflineDataWriteIndex].magnetic_field_x_mgauss, &Msg->Data[msg_offset + 40], 4);
-        memcpy(&OfflineData[OfflineDataWriteIndex].magnetic_field_y_mgauss, &Msg->Data[msg_offset + 44], 4);
-        memcpy(&OfflineData[OfflineDataWriteIndex].magnetic_field_z_mgauss, &Msg->Data[msg_offset + 48], 4);
-
-        msg_offset += 52;
-
-        OfflineDataCount++;
-        if (OfflineDataCount > OFFLINE_DATA_SIZE)
-        {
-          OfflineDataCount = OFFLINE_DATA_SIZE;
-        }
-
-        OfflineDataWriteIndex++;
-        if (OfflineDataWriteIndex >= OFFLINE_DATA_SIZE)
-        {
-          OfflineDataWriteIndex = 0;
-        }
+        Offline_Data_Put(&Msg->Data[msg_offset]);
+        msg_offset += (int32_t)OFFLINE_RECORD_LEN;
       }
 
       SensorReadRequest = 1;
@@ -376,6 +389,7 @@ int32_t HandleMSG(Msg_t *Msg)
       else
       {
         UseOfflineData = 0U;
+        OfflineBulk = 0U;
         SensorsEnabled = sensors_enabled_prev;
       }
 
@@ -383,6 +397,177 @@ int32_t HandleMSG(Msg_t *Msg)
       UART_SendMsg(Msg);
       break;
 
+    case CMD_Offline_Bulk_Start:
+      if (Msg->Len < 5U)
+      {
+        return 0;
+      }
+
+      if (UseOfflineData == 0U)
+      {
+        UseOfflineData = 1U;
+        sensors_enabled_prev = SensorsEnabled;
+        SensorsEnabled = 0xFFFFFFFFU;
+        (void)HAL_TIM_Base_Stop_IT(&BSP_IP_TIM_HANDLE);
+      }
+
+      OfflineBulk = 1U;
+      OfflineBulkDecimation = (uint16_t)Deserialize(&Msg->Data[3], 2);
+      OfflineBulkProcessed = 0;
+      OfflineBulkElapsedUs = 0;
+      OfflineBulkBusyUs = 0;
+      OfflineDataReadIndex = 0;
+      OfflineDataWriteIndex = 0;
+      OfflineDataCount = 0;
+
+      BUILD_REPLY_HEADER(Msg);
+      Serialize(&Msg->Data[3], OFFLINE_DATA_SIZE, 2);
+      Msg->Len = 3 + 2;
+      UART_SendMsg(Msg);
+      break;
+
+    case CMD_Offline_Bulk_Data:
+      if ((Msg->Len < 4U) || (OfflineBulk == 0U))
+      {
+        return 0;
+      }
+
+      msg_count = (uint32_t)Msg->Data[3];
+      if (Msg->Len < (4U + (msg_count * OFFLINE_RECORD_LEN)))
+      {
+        return 0;
+      }
+
+      /* Unlike CMD_Offline_Data, records beyond the free slots are refused rather than overwriting
+       * the unprocessed ones: the host sends them again, paced by the FreeRecords of the reply */
+      msg_offset = 4;
+      for (i = 0; (i < msg_count) && (OfflineDataCount < OFFLINE_DATA_SIZE); i++)
+      {
+        Offline_Data_Put(&Msg->Data[msg_offset]);
+        msg_offset += (int32_t)OFFLINE_RECORD_LEN;
+      }
+
+      if (OfflineDataCount > 0)
+      {
+        SensorReadRequest = 1;
+      }
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Data[3] = (uint8_t)i;
+      Serialize(&Msg->Data[4], (uint32_t)OFFLINE_DATA_SIZE - (uint32_t)OfflineDataCount, 2);
+      Serialize(&Msg->Data[6], OfflineBulkProcessed, 4);
+      Serialize(&Msg->Data[10], OfflineBulkElapsedUs, 4);
+      Serialize(&Msg->Data[14], OfflineBulkBusyUs, 4);
+      Msg->Len = 3 + 15;
+      UART_SendMsg(Msg);
+      break;
+
+    case CMD_Set_Low_Power:
+      if ((Msg->Len < 4U) || ((Msg->Data[3] != LP_MODE_RUN) && (Msg->Data[3] != LP_MODE_SLEEP)))
+      {
+        return 0;
+      }
+
+      mode = LowPower.Mode;
+      LP_Init(&LowPower, Msg->Data[3], LowPower.LastUs);
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Data[3] = mode;
+      Msg->Len = 3 + 1;
+      UART_SendMsg(Msg);
+      break;
+
+    case CMD_Get_Power_Stats:
+      if (Msg->Len < 3U)
+      {
+        return 0;
+      }
+
+      Msg->Data[3] = LowPower.Mode;
+      Serialize(&Msg->Data[4], LowPower.ActiveUs, 4);
+      Serialize(&Msg->Data[8], LowPower.IdleUs, 4);
+      Serialize(&Msg->Data[12], LowPower.Sleeps, 4);
+
+      for (i = 0; i < LP_WAKE_COUNT; i++)
+      {
+        Serialize(&Msg->Data[16U + (4U * i)], LowPower.Wakeups[i], 4);
+        Serialize(&Msg->Data[36U + (2U * i)], LowPower.LastSecond[i], 2);
+      }
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Len = 3 + 43;
+      UART_SendMsg(Msg);
+      break;
+
+    case CMD_Get_Profile:
+      if ((Msg->Len < 4U) || (Msg->Data[3] >= PROF_STAGE_COUNT))
+      {
+        return 0;
+      }
+
+      prof = Prof_Get(Msg->Data[3]);
+      reset = (Msg->Len >= 5U) ? Msg->Data[4] : 0U;
+
+      Msg->Data[4] = (uint8_t)PROF_STAGE_COUNT;
+      Serialize(&Msg->Data[5], SystemCoreClock, 4);
+      Serialize(&Msg->Data[9], prof->Count, 4);
+      Serialize(&Msg->Data[13], prof->MinCycles, 4);
+      Serialize(&Msg->Data[17], Prof_Avg(prof), 4);
+      Serialize(&Msg->Data[21], prof->MaxCycles, 4);
+
+      for (i = 0; i < PROF_HIST_BINS; i++)
+      {
+        Serialize(&Msg->Data[25U + (2U * i)], prof->Hist[i], 2);
+      }
+
+      if (reset == 1U)
+      {
+        Prof_Reset(Msg->Data[3]);
+      }
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Len = 3 + 54;
+      UART_SendMsg(Msg);
+      break;
+
+    case CMD_Set_Resampler:
+      if ((Msg->Len < 6U) || (Msg->Data[3] > RESAMPLER_MODE_FIR) || (Deserialize(&Msg->Data[4], 2) == 0U))
+      {
+        return 0;
+      }
+
+      mode = ResampleMode;
+      ResampleMode = Msg->Data[3];
+      ResampleOdr = (uint16_t)Deserialize(&Msg->Data[4], 2);
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Data[3] = mode;
+      Msg->Len = 3 + 1;
+      UART_SendMsg(Msg);
+      break;
+
+    case CMD_Get_Resampler:
+      if (Msg->Len < 3U)
+      {
+        return 0;
+      }
+
+      Msg->Data[3] = ResampleMode;
+      Msg->Data[4] = ResampleActive;
+      Serialize(&Msg->Data[5], ResampleOdr, 2);
+      Serialize(&Msg->Data[7], AccResampler.DelayUs, 4);
+      Serialize(&Msg->Data[11], (uint32_t)(AccResampler.PeriodUs * 1000.0f), 4);
+      Serialize(&Msg->Data[15], (uint32_t)(GyrResampler.PeriodUs * 1000.0f), 4);
+      Serialize(&Msg->Data[19], AccResampler.Outputs, 4);
+      Serialize(&Msg->Data[23], AccResampler.Holds, 4);
+      Serialize(&Msg->Data[27], GyrResampler.Outputs, 4);
+      Serialize(&Msg->Data[31], GyrResampler.Holds, 4);
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Len = 3 + 32;
+      UART_SendMsg(Msg);
+      break;
+
     case CMD_Get_App_Info:
       if (Msg->Len < 3U)
       {
@@ -397,6 +582,96 @@ int32_t HandleMSG(Msg_t *Msg)
       UART_SendMsg(Msg);
       break;
 
+    case CMD_Get_Tx_Stats:
+      if (Msg->Len < 3U)
+      {
+        return 0;
+      }
+
+      UART_GetTxStats(&tx_stats);
+
+      Serialize(&Msg->Data[3], tx_stats.Queued, 4);
+      Serialize(&Msg->Data[7], tx_stats.Sent, 4);
+      Serialize(&Msg->Data[11], tx_stats.Dropped, 4);
+      Serialize(&Msg->Data[15], tx_stats.Overwritten, 4);
+      Msg->Data[19] = tx_stats.Depth;
+      Msg->Data[20] = tx_stats.MaxDepth;
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Len = 3 + 18;
+      UART_SendMsg(Msg);
+      break;
+
+    case CMD_Set_Framing:
+      if ((Msg->Len < 4U) || ((Msg->Data[3] != UART_FRAMING_STUFFING) && (Msg->Data[3] != UART_FRAMING_COBS)))
+      {
+        return 0;
+      }
+
+      framing = Msg->Data[3];
+
+      /* The reply is queued with the current framing, the new one applies from the next message */
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Len = 3;
+      UART_SendMsg(Msg);
+      (void)UART_SetFraming(framing);
+      break;
+
+    case CMD_Set_Integrity:
+      if ((Msg->Len < 4U) || ((Msg->Data[3] != UART_INTEGRITY_CHK8) && (Msg->Data[3] != UART_INTEGRITY_CRC32)))
+      {
+        return 0;
+      }
+
+      integrity = Msg->Data[3];
+
+      /* The reply is protected by the current trailer, the new one applies from the next message */
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Len = 3;
+      UART_SendMsg(Msg);
+      (void)UART_SetIntegrity(integrity);
+      break;
+
+    case CMD_Set_Batch:
+      if ((Msg->Len < 5U) || ((Msg->Data[4] & (uint8_t)~BATCH_FLAGS_MASK) != 0U))
+      {
+        return 0;
+      }
+
+      /* The pending frame is sent with the previous settings */
+      BatchMaxSamples = Msg->Data[3];
+      BatchFlags = Msg->Data[4];
+      BatchFlushRequest = 1;
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Len = 3;
+      UART_SendMsg(Msg);
+      break;
+
+    case CMD_Set_Stream_Layout:
+      if ((Msg->Len < 7U) || ((Deserialize(&Msg->Data[3], 4) & ~STREAM_LAYOUT_SELECT_MASK) != 0U))
+      {
+        return 0;
+      }
+
+      StreamSelect = Deserialize(&Msg->Data[3], 4);
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Len = 3 + Stream_Layout_Describe(Stream_Layout_Fields(StreamSelect, SensorsEnabled), &Msg->Data[3]);
+      UART_SendMsg(Msg);
+      break;
+
+    case CMD_Get_Stream_Layout:
+      if (Msg->Len < 3U)
+      {
+        return 0;
+      }
+
+      BUILD_REPLY_HEADER(Msg);
+      Msg->Len = 3 + Stream_Layout_Describe(Stream_Layout_Fields(StreamSelect, SensorsEnabled), &Msg->Data[3]);
+      UART_SendMsg(Msg);
+      break;
+
     case CMD_ChangeSF:
       if (Msg->Len < 3U)
       {
@@ -508,6 +783,51 @@ void Get_PresentationString(char *PresentationString, uint32_t *Length)
   *Length = snprintf(PresentationString, 64, ps, lib_version_num);
 }
 
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Store an offline record at the write index of the offline data ring
+  * @param  Record the pointer to the OFFLINE_RECORD_LEN bytes record
+  * @note   The oldest unprocessed record is overwritten when the ring is full
+  * @retval None
+  */
+static void Offline_Data_Put(const uint8_t *Record)
+{
+  offline_data_t *data = &OfflineData[OfflineDataWriteIndex];
+
+  memcpy(&data->hours, &Record[0], 1);
+  memcpy(&data->minutes, &Record[1], 1);
+  memcpy(&data->seconds, &Record[2], 1);
+  memcpy(&data->subsec, &Record[3], 1);
+
+  memcpy(&data->pressure, &Record[4], 4);
+  memcpy(&data->temperature, &Record[8], 4);
+  memcpy(&data->humidity, &Record[12], 4);
+
+  memcpy(&data->acceleration_x_mg, &Record[16], 4);
+  memcpy(&data->acceleration_y_mg, &Record[20], 4);
+  memcpy(&data->acceleration_z_mg, &Record[24], 4);
+
+  memcpy(&data->angular_rate_x_mdps, &Record[28], 4);
+  memcpy(&data->angular_rate_y_mdps, &Record[32], 4);
+  memcpy(&data->angular_rate_z_mdps, &Record[36], 4);
+
+  memcpy(&data->magnetic_field_x_mgauss, &Record[40], 4);
+  memcpy(&data->magnetic_field_y_mgauss, &Record[44], 4);
+  memcpy(&data->magnetic_field_z_mgauss, &Record[48], 4);
+
+  OfflineDataCount++;
+  if (OfflineDataCount > OFFLINE_DATA_SIZE)
+  {
+    OfflineDataCount = OFFLINE_DATA_SIZE;
+  }
+
+  OfflineDataWriteIndex++;
+  if (OfflineDataWriteIndex >= OFFLINE_DATA_SIZE)
+  {
+    OfflineDataWriteIndex = 0;
+  }
+}
+
 /**
   * @}
   */
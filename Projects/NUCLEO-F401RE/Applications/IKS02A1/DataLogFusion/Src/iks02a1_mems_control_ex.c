@@ -315,3 +315,52 @@ void BSP_ACC_GYR_Read_MLC_Data(uint8_t *Data)
   (void)BSP_SENSOR_ACC_Read_Register(ISM330DHCX_MLC7_SRC, &Data[7]);
   (void)BSP_SENSOR_ACC_Write_Register(ISM330DHCX_FUNC_CFG_ACCESS, 0x00);
 }
+
+/**
+  * @brief  Batch the accelerometer and gyroscope samples in the FIFO, in stream mode
+  * @note   The FIFO is emptied first
+  * @param  Bdr Batch data rate of both sensors, their ODR
+  * @retval None
+  */
+void BSP_ACC_GYR_FIFO_Start(float Bdr)
+{
+  (void)IKS02A1_MOTION_SENSOR_FIFO_Set_Mode(IKS02A1_ISM330DHCX_0, (uint8_t)ISM330DHCX_BYPASS_MODE);
+  (void)IKS02A1_MOTION_SENSOR_FIFO_Set_BDR(IKS02A1_ISM330DHCX_0, MOTION_ACCELERO, Bdr);
+  (void)IKS02A1_MOTION_SENSOR_FIFO_Set_BDR(IKS02A1_ISM330DHCX_0, MOTION_GYRO, Bdr);
+  (void)IKS02A1_MOTION_SENSOR_FIFO_Set_Mode(IKS02A1_ISM330DHCX_0, (uint8_t)ISM330DHCX_STREAM_MODE);
+}
+
+/**
+  * @brief  Stop the FIFO batching, the FIFO is emptied
+  * @param  None
+  * @retval None
+  */
+void BSP_ACC_GYR_FIFO_Stop(void)
+{
+  (void)IKS02A1_MOTION_SENSOR_FIFO_Set_Mode(IKS02A1_ISM330DHCX_0, (uint8_t)ISM330DHCX_BYPASS_MODE);
+}
+
+/**
+  * @brief  Get the number of samples in the FIFO
+  * @param  NumSamples number of samples, accelerometer and gyroscope ones
+  * @retval None
+  */
+void BSP_ACC_GYR_FIFO_Get_Num_Samples(uint16_t *NumSamples)
+{
+  (void)IKS02A1_MOTION_SENSOR_FIFO_Get_Num_Samples(IKS02A1_ISM330DHCX_0, NumSamples);
+}
+
+/**
+  * @brief  Read the oldest sample of the FIFO
+  * @param  Tag FIFO tag of the sample, ISM330DHCX_XL_NC_TAG or ISM330DHCX_GYRO_NC_TAG for the
+  *         accelerometer and gyroscope samples
+  * @param  Axes sample, in [mg] or [mdps]
+  * @retval None
+  */
+void BSP_ACC_GYR_FIFO_Get_Sample(uint8_t *Tag, IKS02A1_MOTION_SENSOR_Axes_t *Axes)
+{
+  (void)IKS02A1_MOTION_SENSOR_FIFO_Get_Tag(IKS02A1_ISM330DHCX_0, Tag);
+  (void)IKS02A1_MOTION_SENSOR_FIFO_Get_Axes(IKS02A1_ISM330DHCX_0,
+                                            (*Tag == (uint8_t)ISM330DHCX_GYRO_NC_TAG) ? MOTION_GYRO : MOTION_ACCELERO,
+                                            Axes);
+}
@@ -0,0 +1,137 @@
+/**
+  ******************************************************************************
+  * @file    low_power.c
+  * @author  MEMS Software Solutions Team
+  * @brief   This file implements the idle hook of the main loop: the core
+  *          sleeps between the interrupts when no work is pending, and the
+  *          active and idle times and the wake-ups by source are counted
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "low_power.h"
+
+/** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void LP_Count_Wakeup(LP_Stats_t *Stats, uint32_t Sources, uint32_t NowUs);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Reset the statistics and set the idle policy
+  * @param  Stats pointer to the statistics
+  * @param  Mode LP_MODE_x
+  * @param  NowUs current time [us]
+  * @retval None
+  */
+void LP_Init(LP_Stats_t *Stats, uint8_t Mode, uint32_t NowUs)
+{
+  (void)memset(Stats, 0, sizeof(LP_Stats_t));
+  Stats->Mode = Mode;
+  Stats->WindowStartUs = NowUs;
+  Stats->LastUs = NowUs;
+}
+
+/**
+  * @brief  Idle hook, to be called at the end of each main loop iteration
+  * @note   The pending work is checked with the interrupts masked: an interrupt raised after
+  *         the check stays pending and ends the sleep at once, so no tick is delayed.
+  *         The wake-up sources are read before the interrupts are unmasked and served.
+  * @param  Ctx pointer to the hardware interface
+  * @param  Stats pointer to the statistics
+  * @retval 1 if the core slept, 0 otherwise
+  */
+uint32_t LP_Idle(const LP_Ctx_t *Ctx, LP_Stats_t *Stats)
+{
+  uint32_t sleep_us;
+  uint32_t wake_us;
+  uint32_t sources;
+
+  sleep_us = Ctx->GetTimeUs();
+  Stats->ActiveUs += sleep_us - Stats->LastUs;
+  Stats->LastUs = sleep_us;
+
+  if (Stats->Mode != LP_MODE_SLEEP)
+  {
+    return 0;
+  }
+
+  Ctx->Mask();
+
+  if (Ctx->Pending() != 0U)
+  {
+    Ctx->Unmask();
+    return 0;
+  }
+
+  Ctx->Sleep();
+  sources = Ctx->WakeSources();
+  Ctx->Unmask();
+
+  wake_us = Ctx->GetTimeUs();
+  Stats->IdleUs += wake_us - sleep_us;
+  Stats->LastUs = wake_us;
+  Stats->Sleeps++;
+  LP_Count_Wakeup(Stats, sources, wake_us);
+
+  return 1;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Count a wake-up by source, and close the window when a second has elapsed
+  * @param  Stats pointer to the statistics
+  * @param  Sources LP_WAKE_x pending at the wake-up
+  * @param  NowUs current time [us]
+  * @retval None
+  */
+static void LP_Count_Wakeup(LP_Stats_t *Stats, uint32_t Sources, uint32_t NowUs)
+{
+  uint32_t i;
+
+  if (Sources == 0U)
+  {
+    Sources = LP_WAKE_OTHER;
+  }
+
+  for (i = 0; i < LP_WAKE_COUNT; i++)
+  {
+    if ((Sources & (1UL << i)) != 0U)
+    {
+      Stats->Wakeups[i]++;
+
+      if (Stats->Window[i] < 0xFFFFU)
+      {
+        Stats->Window[i]++;
+      }
+    }
+  }
+
+  if ((NowUs - Stats->WindowStartUs) >= LP_WINDOW_US)
+  {
+    (void)memcpy(Stats->LastSecond, Stats->Window, sizeof(Stats->LastSecond));
+    (void)memset(Stats->Window, 0, sizeof(Stats->Window));
+    Stats->WindowStartUs = NowUs;
+  }
+}
+
+/**
+  * @}
+  */
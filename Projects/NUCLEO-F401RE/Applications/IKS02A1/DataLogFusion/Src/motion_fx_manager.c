@@ -19,6 +19,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "motion_fx_manager.h"
 #include "iks02a1_mems_control_ex.h"
+#include "nvm_store.h"
 
 /** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
   * @{
@@ -54,6 +55,8 @@ static uint8_t mfxstate[STATE_SIZE];
   */
 void MotionFX_manager_init(void)
 {
+  float gbias[3];
+
   if (STATE_SIZE < MotionFX_GetStateSize())
   {
     Error_Handler();
@@ -77,6 +80,12 @@ void MotionFX_manager_init(void)
 
   MotionFX_setKnobs(mfxstate, ipKnobs);
 
+  /* Start from the gyroscope bias of the previous run, if saved */
+  if (NVM_Calib_Load(NVM_ID_FX_GBIAS, (uint16_t)sizeof(gbias), gbias) == (char)0)
+  {
+    MotionFX_setGbias(mfxstate, gbias);
+  }
+
   MotionFX_enable_6X(mfxstate, MFX_ENGINE_DISABLE);
   MotionFX_enable_9X(mfxstate, MFX_ENGINE_DISABLE);
 }
@@ -176,26 +185,49 @@ void MotionFX_manager_MagCal_stop(int32_t sampletime)
   MotionFX_MagCal_init(sampletime, 0);
 }
 
+/**
+  * @brief  Delete the saved magnetometer calibration, so that the next start calibrates from scratch
+  * @param  None
+  * @retval None
+  */
+void MotionFX_manager_MagCal_clear(void)
+{
+  NVM_Calib_Clear(NVM_ID_FX_MAGCAL);
+}
+
+/**
+  * @brief  Save the gyroscope bias estimated by the engine, loaded at the next initialization
+  * @param  None
+  * @retval None
+  */
+void MotionFX_manager_save_gbias(void)
+{
+  float gbias[3];
+
+  MotionFX_getGbias(mfxstate, gbias);
+  (void)NVM_Calib_Save(NVM_ID_FX_GBIAS, (uint16_t)sizeof(gbias), gbias);
+}
+
 /**
   * @brief  Load calibration parameter from memory
-  * @param  dataSize length of the data
+  * @param  dataSize length of the data [bytes]
   * @param  data pointer to the data
   * @retval (1) fail, (0) success
   */
 char MotionFX_LoadMagCalFromNVM(unsigned short int dataSize, unsigned int *data)
 {
-  return (char)1;
+  return NVM_Calib_Load(NVM_ID_FX_MAGCAL, dataSize, data);
 }
 
 /**
   * @brief  Save calibration parameter to memory
-  * @param  dataSize length of the data
+  * @param  dataSize length of the data [bytes]
   * @param  data pointer to the data
   * @retval (1) fail, (0) success
   */
 char MotionFX_SaveMagCalInNVM(unsigned short int dataSize, unsigned int *data)
 {
-  return (char)1;
+  return NVM_Calib_Save(NVM_ID_FX_MAGCAL, dataSize, data);
 }
 
 /**
@@ -0,0 +1,174 @@
+/**
+  ******************************************************************************
+  * @file    profiler.c
+  * @author  MEMS Software Solutions Team
+  * @brief   This file implements the stage profiler: the runs of each stage of
+  *          the main loop are timed with the core cycle counter and their
+  *          minimum, average, maximum and histogram kept in a fixed table
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "profiler.h"
+
+/** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static Prof_Stage_t ProfTable[PROF_STAGE_COUNT];
+
+/* Private function prototypes -----------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Start the cycle counter and reset the statistics
+  * @note   The counter is left running: the stages read it without stopping it, and a run
+  *         up to 2^32 cycles long is measured across the wrap around.
+  * @param  None
+  * @retval None
+  */
+void Prof_Init(void)
+{
+#ifndef PROF_HOST_STUB
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  Prof_Reset(PROF_STAGE_ALL);
+}
+
+/**
+  * @brief  End of a stage run
+  * @param  Stage PROF_STAGE_x
+  * @param  Begin counter value returned by PROF_BEGIN at the start of the run
+  * @retval Cycles of the run
+  */
+uint32_t Prof_End(uint8_t Stage, uint32_t Begin)
+{
+  uint32_t cycles = PROF_GET_CYCLES() - Begin;
+
+  Prof_Add(Stage, cycles);
+  return cycles;
+}
+
+/**
+  * @brief  Account a run of a stage
+  * @param  Stage PROF_STAGE_x, ignored if out of range
+  * @param  Cycles cycles of the run
+  * @retval None
+  */
+void Prof_Add(uint8_t Stage, uint32_t Cycles)
+{
+  Prof_Stage_t *stats;
+  uint32_t bin;
+
+  if (Stage >= PROF_STAGE_COUNT)
+  {
+    return;
+  }
+
+  stats = &ProfTable[Stage];
+
+  if ((stats->Count == 0U) || (Cycles < stats->MinCycles))
+  {
+    stats->MinCycles = Cycles;
+  }
+
+  if (Cycles > stats->MaxCycles)
+  {
+    stats->MaxCycles = Cycles;
+  }
+
+  stats->Count++;
+  stats->SumCycles += Cycles;
+
+  bin = Prof_Hist_Bin(Cycles);
+  if (stats->Hist[bin] != 0xFFFFU)
+  {
+    stats->Hist[bin]++;
+  }
+}
+
+/**
+  * @brief  Reset the statistics of a stage
+  * @param  Stage PROF_STAGE_x, or PROF_STAGE_ALL for every stage
+  * @retval None
+  */
+void Prof_Reset(uint8_t Stage)
+{
+  if (Stage == PROF_STAGE_ALL)
+  {
+    (void)memset(ProfTable, 0, sizeof(ProfTable));
+  }
+  else if (Stage < PROF_STAGE_COUNT)
+  {
+    (void)memset(&ProfTable[Stage], 0, sizeof(Prof_Stage_t));
+  }
+  else
+  {
+    /* Out of range, nothing to reset */
+  }
+}
+
+/**
+  * @brief  Get the statistics of a stage
+  * @param  Stage PROF_STAGE_x
+  * @retval Pointer to the statistics, NULL if the stage is out of range
+  */
+const Prof_Stage_t *Prof_Get(uint8_t Stage)
+{
+  return (Stage < PROF_STAGE_COUNT) ? &ProfTable[Stage] : NULL;
+}
+
+/**
+  * @brief  Average cycles of the runs of a stage
+  * @param  Stats pointer to the statistics
+  * @retval Average cycles, 0 if the stage did not run
+  */
+uint32_t Prof_Avg(const Prof_Stage_t *Stats)
+{
+  return (Stats->Count != 0U) ? (uint32_t)(Stats->SumCycles / Stats->Count) : 0U;
+}
+
+/**
+  * @brief  Histogram bin of a run
+  * @param  Cycles cycles of the run
+  * @retval Bin, see PROF_HIST_SHIFT
+  */
+uint32_t Prof_Hist_Bin(uint32_t Cycles)
+{
+  uint32_t msb = 0;
+
+  while ((Cycles >> 1) != 0U)
+  {
+    Cycles >>= 1;
+    msb++;
+  }
+
+  if (msb <= PROF_HIST_SHIFT)
+  {
+    return 0;
+  }
+
+  msb -= PROF_HIST_SHIFT;
+  return (msb < PROF_HIST_BINS) ? msb : (PROF_HIST_BINS - 1U);
+}
+
+/**
+  * @}
+  */
@@ -0,0 +1,368 @@
+/**
+  ******************************************************************************
+  * @file    resampler.c
+  * @author  MEMS Software Solutions Team
+  * @brief   This file implements the resampler: the sensor samples, batched at
+  *          the sensor ODR with their time stamps, are converted to samples
+  *          at the exact times of the algorithm rate
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <math.h>
+#include "resampler.h"
+
+/** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define RESAMPLER_PI       3.14159265f
+#define RESAMPLER_MASK     (RESAMPLER_BUF_LEN - 1U)
+#define RESAMPLER_HALF     (RESAMPLER_FIR_TAPS / 2U)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int32_t Round(float Value);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Initialize a resampler
+  * @note   The latency covers the input samples needed after the output time, plus one
+  *         input period as the newest sample read may be up to a period old, at the longest
+  *         period within RESAMPLER_PERIOD_TOL.
+  * @param  Rs the resampler
+  * @param  Mode RESAMPLER_MODE_x
+  * @param  InOdr nominal input rate [Hz]
+  * @param  OutFreq output rate [Hz]
+  * @retval None
+  */
+void Resampler_Init(Resampler_t *Rs, uint8_t Mode, float InOdr, float OutFreq)
+{
+  uint32_t phase;
+  uint32_t tap;
+  float fc;
+  float d;
+  float h;
+  float sum;
+
+  (void)memset(Rs, 0, sizeof(Resampler_t));
+
+  Rs->Mode = Mode;
+  Rs->NominalUs = 1000000.0f / InOdr;
+  Rs->PeriodUs = Rs->NominalUs;
+
+  if (Mode == RESAMPLER_MODE_LINEAR)
+  {
+    Rs->DelayUs = (uint32_t)(2.0f * Rs->NominalUs * (1.0f + RESAMPLER_PERIOD_TOL));
+  }
+  else if (Mode == RESAMPLER_MODE_FIR)
+  {
+    Rs->DelayUs = (uint32_t)((float)(RESAMPLER_HALF + 1U) * Rs->NominalUs * (1.0f + RESAMPLER_PERIOD_TOL));
+  }
+  else
+  {
+    Rs->DelayUs = 0;
+  }
+
+  /* Cutoff [cycles per input sample] */
+  fc = RESAMPLER_FIR_CUTOFF * 0.5f * ((OutFreq < InOdr) ? OutFreq : InOdr) / InOdr;
+
+  /* Phase p holds the taps of an output p / RESAMPLER_FIR_PHASES of a period after the input
+   * sample RESAMPLER_HALF - 1, Hann windowed over the RESAMPLER_FIR_TAPS periods */
+  for (phase = 0; phase <= RESAMPLER_FIR_PHASES; phase++)
+  {
+    sum = 0.0f;
+
+    for (tap = 0; tap < RESAMPLER_FIR_TAPS; tap++)
+    {
+      d = (float)tap - (float)(RESAMPLER_HALF - 1U) - ((float)phase / (float)RESAMPLER_FIR_PHASES);
+      h = (fabsf(d) < 1.0e-6f) ? (2.0f * fc) : (sinf(2.0f * RESAMPLER_PI * fc * d) / (RESAMPLER_PI * d));
+      h *= 0.5f + (0.5f * cosf(2.0f * RESAMPLER_PI * d / (float)RESAMPLER_FIR_TAPS));
+      Rs->Coef[phase][tap] = h;
+      sum += h;
+    }
+
+    for (tap = 0; tap < RESAMPLER_FIR_TAPS; tap++)
+    {
+      Rs->Coef[phase][tap] /= sum;
+    }
+  }
+}
+
+/**
+  * @brief  Push an input sample with its time stamp
+  * @param  Rs the resampler
+  * @param  TimeUs sample time [us]
+  * @param  Axes sample
+  * @retval None
+  */
+void Resampler_Push(Resampler_t *Rs, uint32_t TimeUs, const int32_t *Axes)
+{
+  uint32_t index = Rs->Pushed & RESAMPLER_MASK;
+
+  Rs->TimeUs[index] = TimeUs;
+  (void)memcpy(Rs->Axes[index], Axes, sizeof(Rs->Axes[index]));
+  Rs->Pushed++;
+  Rs->LastUs = TimeUs;
+}
+
+/**
+  * @brief  Push a batch of input samples read from a FIFO without time stamps
+  * @note   The samples are stamped with the recovered input clock. A read bounds the newest
+  *         sample in the period before it, the next one not being produced yet: these
+  *         bounds, carried over from batch to batch one estimated period per sample, narrow
+  *         down to the reads closest to a sample whatever the beat between the ODR and the
+  *         read rate, and the newest sample is stamped in their middle. If the carried
+  *         bounds miss the read ones, the stamps are moved to the nearest read bound. The
+  *         period is measured on these stamps over at least RESAMPLER_BASE_LEN samples, to
+  *         track the ODR deviation of the sensor.
+  * @param  Rs the resampler
+  * @param  ReadUs time of the FIFO read, taken after the FIFO level read [us]
+  * @param  Axes samples, oldest first
+  * @param  Count number of samples
+  * @retval None
+  */
+void Resampler_Push_Batch(Resampler_t *Rs, uint32_t ReadUs, const int32_t (*Axes)[RESAMPLER_AXES], uint32_t Count)
+{
+  uint32_t produced = Rs->Pushed + Count;
+  uint32_t samples;
+  uint32_t lo_read;
+  uint32_t newest;
+  uint32_t i;
+  float advance;
+  float slack;
+
+  if (Count == 0U)
+  {
+    return;
+  }
+
+  advance = (float)Count * Rs->PeriodUs;
+  lo_read = ReadUs - (uint32_t)Rs->PeriodUs;
+
+  if ((Rs->Pushed == 0U)
+      || (fabsf((float)(int32_t)(ReadUs - (Rs->LastUs + (uint32_t)advance))) > ((float)RESAMPLER_RESYNC * Rs->PeriodUs)))
+  {
+    /* First batch or lost track, e.g. after a FIFO overrun */
+    Rs->PeriodUs = Rs->NominalUs;
+    Rs->LoUs = ReadUs - (uint32_t)Rs->PeriodUs;
+    Rs->HiUs = ReadUs;
+    newest = Rs->LoUs + ((Rs->HiUs - Rs->LoUs) / 2U);
+    Rs->BaseUs = newest;
+    Rs->BaseCount = produced;
+    Rs->NextUs = newest;
+    Rs->NextCount = produced;
+  }
+  else
+  {
+    /* Bounds carried over, widened by the ODR wander, then narrowed by the read */
+    slack = (advance * RESAMPLER_WANDER) + (float)RESAMPLER_MARGIN_US;
+    Rs->LoUs += (uint32_t)(advance - slack);
+    Rs->HiUs += (uint32_t)(advance + slack);
+
+    if ((int32_t)(Rs->LoUs - ReadUs) > 0)
+    {
+      /* Stamps late */
+      Rs->LoUs = ReadUs;
+      Rs->HiUs = ReadUs;
+    }
+    else if ((int32_t)(Rs->HiUs - lo_read) < 0)
+    {
+      /* Stamps early */
+      Rs->LoUs = lo_read;
+      Rs->HiUs = lo_read;
+    }
+    else
+    {
+      if ((int32_t)(Rs->LoUs - lo_read) < 0)
+      {
+        Rs->LoUs = lo_read;
+      }
+
+      if ((int32_t)(Rs->HiUs - ReadUs) > 0)
+      {
+        Rs->HiUs = ReadUs;
+      }
+    }
+
+    newest = Rs->LoUs + ((Rs->HiUs - Rs->LoUs) / 2U);
+
+    /* Period over the stamps since the base */
+    samples = produced - Rs->BaseCount;
+    if (samples >= RESAMPLER_BASE_MIN)
+    {
+      Rs->PeriodUs = (float)(newest - Rs->BaseUs) / (float)samples;
+
+      if (Rs->PeriodUs < (Rs->NominalUs * (1.0f - RESAMPLER_PERIOD_TOL)))
+      {
+        Rs->PeriodUs = Rs->NominalUs * (1.0f - RESAMPLER_PERIOD_TOL);
+      }
+      else if (Rs->PeriodUs > (Rs->NominalUs * (1.0f + RESAMPLER_PERIOD_TOL)))
+      {
+        Rs->PeriodUs = Rs->NominalUs * (1.0f + RESAMPLER_PERIOD_TOL);
+      }
+      else
+      {
+        /* In range */
+      }
+    }
+
+    if ((produced - Rs->NextCount) >= RESAMPLER_BASE_LEN)
+    {
+      Rs->BaseUs = Rs->NextUs;
+      Rs->BaseCount = Rs->NextCount;
+      Rs->NextUs = newest;
+      Rs->NextCount = produced;
+    }
+  }
+
+  for (i = 0; i < Count; i++)
+  {
+    Resampler_Push(Rs, newest - (uint32_t)(((float)(Count - 1U - i) * Rs->PeriodUs) + 0.5f), Axes[i]);
+  }
+}
+
+/**
+  * @brief  Get the output sample of a time
+  * @param  Rs the resampler
+  * @param  TimeUs output time [us], the sample is computed at TimeUs - DelayUs
+  * @param  Axes output sample, the previous one if not computed
+  * @retval 1 if computed, 0 if the input samples around the output time are missing
+  */
+int32_t Resampler_Get(Resampler_t *Rs, uint32_t TimeUs, int32_t *Axes)
+{
+  uint32_t t = TimeUs - Rs->DelayUs;
+  uint32_t avail = (Rs->Pushed < RESAMPLER_BUF_LEN) ? Rs->Pushed : RESAMPLER_BUF_LEN;
+  uint32_t newest = Rs->Pushed - 1U;
+  uint32_t n;
+  uint32_t s = 0;
+  uint32_t a;
+  uint32_t tap;
+  uint32_t phase;
+  uint32_t found = 0;
+  int32_t span;
+  float frac;
+  float pos;
+  float c;
+  float out[RESAMPLER_AXES];
+  const int32_t *x0;
+  const int32_t *x1;
+
+  if (avail == 0U)
+  {
+    Rs->Holds++;
+    (void)memcpy(Axes, Rs->Last, sizeof(Rs->Last));
+    return 0;
+  }
+
+  if (Rs->Mode == RESAMPLER_MODE_OFF)
+  {
+    (void)memcpy(Rs->Last, Rs->Axes[newest & RESAMPLER_MASK], sizeof(Rs->Last));
+    (void)memcpy(Axes, Rs->Last, sizeof(Rs->Last));
+    Rs->Outputs++;
+    return 1;
+  }
+
+  /* Newest input sample at or before the output time */
+  for (n = 0; n < avail; n++)
+  {
+    s = newest - n;
+    if ((int32_t)(t - Rs->TimeUs[s & RESAMPLER_MASK]) >= 0)
+    {
+      found = 1;
+      break;
+    }
+  }
+
+  /* The output time must lie between two input samples, with the FIR taps around them kept */
+  if ((found == 0U) || (s == newest)
+      || ((Rs->Mode == RESAMPLER_MODE_FIR)
+          && (((newest - s) < RESAMPLER_HALF) || ((s - (newest - (avail - 1U))) < (RESAMPLER_HALF - 1U)))))
+  {
+    Rs->Holds++;
+    (void)memcpy(Axes, Rs->Last, sizeof(Rs->Last));
+    return 0;
+  }
+
+  span = (int32_t)(Rs->TimeUs[(s + 1U) & RESAMPLER_MASK] - Rs->TimeUs[s & RESAMPLER_MASK]);
+  frac = (span > 0) ? ((float)(int32_t)(t - Rs->TimeUs[s & RESAMPLER_MASK]) / (float)span) : 0.0f;
+  if (frac > 1.0f)
+  {
+    frac = 1.0f;
+  }
+
+  if (Rs->Mode == RESAMPLER_MODE_LINEAR)
+  {
+    x0 = Rs->Axes[s & RESAMPLER_MASK];
+    x1 = Rs->Axes[(s + 1U) & RESAMPLER_MASK];
+
+    for (a = 0; a < RESAMPLER_AXES; a++)
+    {
+      out[a] = (float)x0[a] + (frac * (float)(x1[a] - x0[a]));
+    }
+  }
+  else
+  {
+    pos = frac * (float)RESAMPLER_FIR_PHASES;
+    phase = (uint32_t)pos;
+    if (phase >= RESAMPLER_FIR_PHASES)
+    {
+      phase = RESAMPLER_FIR_PHASES - 1U;
+    }
+    pos -= (float)phase;
+
+    for (a = 0; a < RESAMPLER_AXES; a++)
+    {
+      out[a] = 0.0f;
+    }
+
+    for (tap = 0; tap < RESAMPLER_FIR_TAPS; tap++)
+    {
+      c = Rs->Coef[phase][tap] + (pos * (Rs->Coef[phase + 1U][tap] - Rs->Coef[phase][tap]));
+      x0 = Rs->Axes[(s - (RESAMPLER_HALF - 1U) + tap) & RESAMPLER_MASK];
+
+      for (a = 0; a < RESAMPLER_AXES; a++)
+      {
+        out[a] += c * (float)x0[a];
+      }
+    }
+  }
+
+  for (a = 0; a < RESAMPLER_AXES; a++)
+  {
+    Rs->Last[a] = Round(out[a]);
+  }
+
+  (void)memcpy(Axes, Rs->Last, sizeof(Rs->Last));
+  Rs->Outputs++;
+  return 1;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Round to the nearest integer
+  * @param  Value the value
+  * @retval Rounded value
+  */
+static int32_t Round(float Value)
+{
+  return (Value < 0.0f) ? (int32_t)(Value - 0.5f) : (int32_t)(Value + 0.5f);
+}
+
+/**
+  * @}
+  */
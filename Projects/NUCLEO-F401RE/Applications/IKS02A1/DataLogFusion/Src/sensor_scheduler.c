@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * @file    sensor_scheduler.c
+  * @author  MEMS Software Solutions Team
+  * @brief   This file implements the multi-rate sensor acquisition scheduler:
+  *          each sensor handler runs on the ticks of its own period and phase
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sensor_scheduler.h"
+
+/** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Tell if a task runs on the given tick
+  * @param  Task pointer to the task
+  * @param  Tick ticks since the acquisition start, SENSOR_SCHED_TICK_ALL for every task
+  * @retval 1 if the task runs, 0 otherwise
+  */
+uint32_t Sensor_Sched_Due(const Sensor_Task_t *Task, uint32_t Tick)
+{
+  if ((Tick == 0U) || (Tick == SENSOR_SCHED_TICK_ALL) || (Task->Period <= 1U))
+  {
+    return 1;
+  }
+
+  if (Tick < Task->Phase)
+  {
+    return 0;
+  }
+
+  return (((Tick - Task->Phase) % Task->Period) == 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Run the handlers of the enabled sensors due on the given tick
+  * @param  Tasks pointer to the task table
+  * @param  Count number of tasks
+  * @param  Tick ticks since the acquisition start, SENSOR_SCHED_TICK_ALL for every task
+  * @param  Enabled SensorsEnabled masks
+  * @retval None
+  */
+void Sensor_Sched_Run(const Sensor_Task_t *Tasks, uint32_t Count, uint32_t Tick, uint32_t Enabled)
+{
+  uint32_t i;
+
+  for (i = 0; i < Count; i++)
+  {
+    if (((Tasks[i].Mask & Enabled) != 0U) && (Sensor_Sched_Due(&Tasks[i], Tick) != 0U))
+    {
+      Tasks[i].Handler();
+    }
+  }
+}
+
+/**
+  * @brief  Estimated bus time of the given tick
+  * @param  Tasks pointer to the task table
+  * @param  Count number of tasks
+  * @param  Tick ticks since the acquisition start
+  * @param  Enabled SensorsEnabled masks
+  * @retval Sum of the BusUs of the tasks due [us]
+  */
+uint32_t Sensor_Sched_BusUs(const Sensor_Task_t *Tasks, uint32_t Count, uint32_t Tick, uint32_t Enabled)
+{
+  uint32_t bus_us = 0;
+  uint32_t i;
+
+  for (i = 0; i < Count; i++)
+  {
+    if (((Tasks[i].Mask & Enabled) != 0U) && (Sensor_Sched_Due(&Tasks[i], Tick) != 0U))
+    {
+      bus_us += Tasks[i].BusUs;
+    }
+  }
+
+  return bus_us;
+}
+
+/**
+  * @}
+  */
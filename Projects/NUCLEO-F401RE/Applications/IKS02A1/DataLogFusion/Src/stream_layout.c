@@ -0,0 +1,715 @@
+/**
+  ******************************************************************************
+  * @file    stream_layout.c
+  * @author  MEMS Software Solutions Team
+  * @brief   This file implements the streaming frames laid out from the enabled sensors
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <math.h>
+#include "stream_layout.h"
+
+/** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define STREAM_HEADER_LEN  3U
+
+/* SensorsEnabled masks, see demo_serial.h */
+#define STREAM_PRESSURE_SENSOR       0x00000001U
+#define STREAM_TEMPERATURE_SENSOR    0x00000002U
+#define STREAM_HUMIDITY_SENSOR       0x00000004U
+#define STREAM_ACCELEROMETER_SENSOR  0x00000010U
+#define STREAM_GYROSCOPE_SENSOR      0x00000020U
+#define STREAM_MAGNETIC_SENSOR       0x00000040U
+
+/* Sensor Fusion runs with accelerometer, gyroscope and magnetometer */
+#define STREAM_FUSION_SENSORS  (STREAM_ACCELEROMETER_SENSOR | STREAM_GYROSCOPE_SENSOR | STREAM_MAGNETIC_SENSOR)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Field sizes [bytes], by bit index */
+static const uint8_t FieldSize[STREAM_FIELD_COUNT] =
+{
+  4, 4, 4, 4, 12, 12, 12, 16, 12, 12, 12, 4, 4, 4
+};
+
+/* Field sizes [bytes] with STREAM_LAYOUT_COMPACT, by bit index */
+static const uint8_t FieldSizeCompact[STREAM_FIELD_COUNT] =
+{
+  4, 4, 4, 4, 12, 12, 12, 6, 6, 6, 6, 2, 2, 4
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Put_Floats(uint8_t *Dest, const float *Data, uint32_t Count);
+static uint32_t Put_Axes(uint8_t *Dest, const int32_t *Data);
+static void Get_Floats(float *Data, uint8_t *Source, uint32_t Count);
+static void Get_Axes(int32_t *Data, uint8_t *Source);
+static uint32_t Get_Field(uint32_t Field, uint8_t *Source, Stream_Sample_t *Sample);
+static uint32_t Put_Fixed(uint8_t *Dest, const float *Data, uint32_t Count, float Scale, int32_t Min, int32_t Max);
+static void Get_Fixed(float *Data, uint8_t *Source, uint32_t Count, float Scale, uint8_t Signed);
+static uint32_t Put_Quaternion(uint8_t *Dest, const float *Quaternion);
+static void Get_Quaternion(float *Quaternion, uint8_t *Source);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Fields of the streaming frame
+  * @param  Select requested fields (STREAM_FIELD_x, STREAM_LAYOUT_COMPACT), or STREAM_LAYOUT_FIXED for all of them
+  * @param  SensorsEnabled enabled sensors mask
+  * @retval Requested fields the enabled sensors provide and STREAM_LAYOUT_COMPACT if requested,
+  *         all the fields if STREAM_LAYOUT_FIXED
+  */
+uint32_t Stream_Layout_Fields(uint32_t Select, uint32_t SensorsEnabled)
+{
+  uint32_t available = STREAM_FIELD_TIME;
+
+  if ((Select & STREAM_LAYOUT_FIXED) != 0U)
+  {
+    return STREAM_FIELD_ALL;
+  }
+
+  if ((SensorsEnabled & STREAM_PRESSURE_SENSOR) != 0U)
+  {
+    available |= STREAM_FIELD_PRESS;
+  }
+
+  if ((SensorsEnabled & STREAM_TEMPERATURE_SENSOR) != 0U)
+  {
+    available |= STREAM_FIELD_TEMP;
+  }
+
+  if ((SensorsEnabled & STREAM_HUMIDITY_SENSOR) != 0U)
+  {
+    available |= STREAM_FIELD_HUM;
+  }
+
+  if ((SensorsEnabled & STREAM_ACCELEROMETER_SENSOR) != 0U)
+  {
+    available |= STREAM_FIELD_ACC;
+  }
+
+  if ((SensorsEnabled & STREAM_GYROSCOPE_SENSOR) != 0U)
+  {
+    available |= STREAM_FIELD_GYR;
+  }
+
+  if ((SensorsEnabled & STREAM_MAGNETIC_SENSOR) != 0U)
+  {
+    available |= STREAM_FIELD_MAG;
+  }
+
+  if ((SensorsEnabled & STREAM_FUSION_SENSORS) == STREAM_FUSION_SENSORS)
+  {
+    available |= STREAM_FIELD_FUSION;
+  }
+
+  return Select & (available | STREAM_LAYOUT_COMPACT);
+}
+
+/**
+  * @brief  Length of the fields of a streaming frame
+  * @param  Fields fields in the frame and STREAM_LAYOUT_COMPACT flag
+  * @retval Length [bytes], message header excluded
+  */
+uint32_t Stream_Layout_Len(uint32_t Fields)
+{
+  const uint8_t *size = ((Fields & STREAM_LAYOUT_COMPACT) != 0U) ? FieldSizeCompact : FieldSize;
+  uint32_t len = 0;
+  uint32_t i;
+
+  for (i = 0; i < STREAM_FIELD_COUNT; i++)
+  {
+    if ((Fields & (1UL << i)) != 0U)
+    {
+      len += size[i];
+    }
+  }
+
+  return len;
+}
+
+/**
+  * @brief  Build the layout descriptor of a streaming frame
+  * @param  Fields fields in the frame and STREAM_LAYOUT_COMPACT flag
+  * @param  Dest pointer to the descriptor, STREAM_LAYOUT_DESC_MAX_LEN bytes
+  * @retval Descriptor length [bytes]
+  */
+uint32_t Stream_Layout_Describe(uint32_t Fields, uint8_t *Dest)
+{
+  const uint8_t *size = ((Fields & STREAM_LAYOUT_COMPACT) != 0U) ? FieldSizeCompact : FieldSize;
+  uint32_t offset = STREAM_HEADER_LEN;
+  uint32_t pos = STREAM_LAYOUT_DESC_HEADER_LEN;
+  uint8_t count = 0;
+  uint32_t i;
+
+  Fields &= (STREAM_FIELD_ALL | STREAM_LAYOUT_COMPACT);
+
+  for (i = 0; i < STREAM_FIELD_COUNT; i++)
+  {
+    if ((Fields & (1UL << i)) != 0U)
+    {
+      Dest[pos] = (uint8_t)i;
+      Dest[pos + 1U] = (uint8_t)offset;
+      Dest[pos + 2U] = size[i];
+      pos += STREAM_LAYOUT_DESC_FIELD_LEN;
+      offset += size[i];
+      count++;
+    }
+  }
+
+  Serialize(Dest, Fields, 4);
+  Dest[4] = (uint8_t)offset;
+  Dest[5] = count;
+
+  return pos;
+}
+
+/**
+  * @brief  Encode one field of a streaming frame
+  * @param  Field the field (one STREAM_FIELD_x), with the STREAM_LAYOUT_COMPACT flag of the frame
+  * @param  Sample pointer to the sample
+  * @param  Dest pointer to the encoded field, STREAM_FIELD_MAX_SIZE bytes
+  * @retval Field size [bytes], 0 if Field is not a single field
+  */
+uint32_t Stream_Layout_Field(uint32_t Field, const Stream_Sample_t *Sample, uint8_t *Dest)
+{
+  uint32_t size = 0;
+
+  if ((Field & STREAM_LAYOUT_COMPACT) != 0U)
+  {
+    switch (Field & STREAM_FIELD_ALL)
+    {
+      case STREAM_FIELD_QUATERNION:
+        size = Put_Quaternion(Dest, Sample->Quaternion);
+        break;
+
+      case STREAM_FIELD_ROTATION:
+        size = Put_Fixed(&Dest[0], &Sample->Rotation[0], 1, STREAM_COMPACT_DEG_SCALE, 0, 0xFFFF);
+        size += Put_Fixed(&Dest[2], &Sample->Rotation[1], 2, STREAM_COMPACT_DEG_SCALE, -32768, 32767);
+        break;
+
+      case STREAM_FIELD_GRAVITY:
+        size = Put_Fixed(Dest, Sample->Gravity, 3, STREAM_COMPACT_G_SCALE, -32768, 32767);
+        break;
+
+      case STREAM_FIELD_LINEAR_ACC:
+        size = Put_Fixed(Dest, Sample->LinearAcc, 3, STREAM_COMPACT_G_SCALE, -32768, 32767);
+        break;
+
+      case STREAM_FIELD_HEADING:
+        size = Put_Fixed(Dest, &Sample->Heading, 1, STREAM_COMPACT_DEG_SCALE, 0, 0xFFFF);
+        break;
+
+      case STREAM_FIELD_HEADING_ERR:
+        size = Put_Fixed(Dest, &Sample->HeadingErr, 1, STREAM_COMPACT_DEG_SCALE, 0, 0xFFFF);
+        break;
+
+      default:
+        /* Same as the float encoding */
+        break;
+    }
+
+    if (size != 0U)
+    {
+      return size;
+    }
+  }
+
+  switch (Field & STREAM_FIELD_ALL)
+  {
+    case STREAM_FIELD_TIME:
+      (void)memcpy(Dest, Sample->Time, 4);
+      size = 4;
+      break;
+
+    case STREAM_FIELD_PRESS:
+      size = Put_Floats(Dest, &Sample->Press, 1);
+      break;
+
+    case STREAM_FIELD_TEMP:
+      size = Put_Floats(Dest, &Sample->Temp, 1);
+      break;
+
+    case STREAM_FIELD_HUM:
+      size = Put_Floats(Dest, &Sample->Hum, 1);
+      break;
+
+    case STREAM_FIELD_ACC:
+      size = Put_Axes(Dest, Sample->Acc);
+      break;
+
+    case STREAM_FIELD_GYR:
+      size = Put_Axes(Dest, Sample->Gyr);
+      break;
+
+    case STREAM_FIELD_MAG:
+      size = Put_Axes(Dest, Sample->Mag);
+      break;
+
+    case STREAM_FIELD_QUATERNION:
+      size = Put_Floats(Dest, Sample->Quaternion, 4);
+      break;
+
+    case STREAM_FIELD_ROTATION:
+      size = Put_Floats(Dest, Sample->Rotation, 3);
+      break;
+
+    case STREAM_FIELD_GRAVITY:
+      size = Put_Floats(Dest, Sample->Gravity, 3);
+      break;
+
+    case STREAM_FIELD_LINEAR_ACC:
+      size = Put_Floats(Dest, Sample->LinearAcc, 3);
+      break;
+
+    case STREAM_FIELD_HEADING:
+      size = Put_Floats(Dest, &Sample->Heading, 1);
+      break;
+
+    case STREAM_FIELD_HEADING_ERR:
+      size = Put_Floats(Dest, &Sample->HeadingErr, 1);
+      break;
+
+    case STREAM_FIELD_ELAPSED:
+      Serialize(Dest, Sample->ElapsedUs, 4);
+      size = 4;
+      break;
+
+    default:
+      size = 0;
+      break;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Decode a streaming frame
+  * @param  Fields fields in the frame and STREAM_LAYOUT_COMPACT flag, from the layout descriptor
+  * @param  Msg pointer to the frame, from the message header on, integrity trailer removed
+  * @param  Sample pointer to the decoded sample, the fields not in the frame are set to 0
+  * @retval 0 if decoded, -1 if the frame length does not match the layout
+  */
+int32_t Stream_Layout_Decode(uint32_t Fields, Msg_t *Msg, Stream_Sample_t *Sample)
+{
+  uint32_t pos = STREAM_HEADER_LEN;
+  uint32_t field;
+
+  Fields &= (STREAM_FIELD_ALL | STREAM_LAYOUT_COMPACT);
+
+  if (Msg->Len != (STREAM_HEADER_LEN + Stream_Layout_Len(Fields)))
+  {
+    return -1;
+  }
+
+  (void)memset(Sample, 0, sizeof(Stream_Sample_t));
+
+  for (field = STREAM_FIELD_TIME; field <= STREAM_FIELD_ALL; field <<= 1)
+  {
+    if ((Fields & field) != 0U)
+    {
+      pos += Get_Field(field | (Fields & STREAM_LAYOUT_COMPACT), &Msg->Data[pos], Sample);
+    }
+  }
+
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Encode floats
+  * @param  Dest pointer to the encoded floats
+  * @param  Data pointer to the floats
+  * @param  Count number of floats
+  * @retval Encoded size [bytes]
+  */
+static uint32_t Put_Floats(uint8_t *Dest, const float *Data, uint32_t Count)
+{
+  uint32_t i;
+
+  for (i = 0; i < Count; i++)
+  {
+    FloatToArray(&Dest[4U * i], Data[i]);
+  }
+
+  return 4U * Count;
+}
+
+/**
+  * @brief  Encode the 3 axes of a sensor (LSB first)
+  * @param  Dest pointer to the encoded axes
+  * @param  Data pointer to the axes
+  * @retval Encoded size [bytes]
+  */
+static uint32_t Put_Axes(uint8_t *Dest, const int32_t *Data)
+{
+  Serialize_s32(&Dest[0], Data[0], 4);
+  Serialize_s32(&Dest[4], Data[1], 4);
+  Serialize_s32(&Dest[8], Data[2], 4);
+
+  return 12;
+}
+
+/**
+  * @brief  Decode floats
+  * @param  Data pointer to the decoded floats
+  * @param  Source pointer to the encoded floats
+  * @param  Count number of floats
+  * @retval None
+  */
+static void Get_Floats(float *Data, uint8_t *Source, uint32_t Count)
+{
+  (void)memcpy(Data, Source, 4U * Count);
+}
+
+/**
+  * @brief  Decode the 3 axes of a sensor
+  * @param  Data pointer to the decoded axes
+  * @param  Source pointer to the encoded axes
+  * @retval None
+  */
+static void Get_Axes(int32_t *Data, uint8_t *Source)
+{
+  Data[0] = Deserialize_s32(&Source[0], 4);
+  Data[1] = Deserialize_s32(&Source[4], 4);
+  Data[2] = Deserialize_s32(&Source[8], 4);
+}
+
+/**
+  * @brief  Decode one field of a streaming frame
+  * @param  Field the field (one STREAM_FIELD_x), with the STREAM_LAYOUT_COMPACT flag of the frame
+  * @param  Source pointer to the encoded field
+  * @param  Sample pointer to the decoded sample
+  * @retval Field size [bytes]
+  */
+static uint32_t Get_Field(uint32_t Field, uint8_t *Source, Stream_Sample_t *Sample)
+{
+  uint32_t size = 0;
+
+  if ((Field & STREAM_LAYOUT_COMPACT) != 0U)
+  {
+    switch (Field & STREAM_FIELD_ALL)
+    {
+      case STREAM_FIELD_QUATERNION:
+        Get_Quaternion(Sample->Quaternion, Source);
+        size = 6;
+        break;
+
+      case STREAM_FIELD_ROTATION:
+        Get_Fixed(&Sample->Rotation[0], &Source[0], 1, STREAM_COMPACT_DEG_SCALE, 0);
+        Get_Fixed(&Sample->Rotation[1], &Source[2], 2, STREAM_COMPACT_DEG_SCALE, 1);
+        size = 6;
+        break;
+
+      case STREAM_FIELD_GRAVITY:
+        Get_Fixed(Sample->Gravity, Source, 3, STREAM_COMPACT_G_SCALE, 1);
+        size = 6;
+        break;
+
+      case STREAM_FIELD_LINEAR_ACC:
+        Get_Fixed(Sample->LinearAcc, Source, 3, STREAM_COMPACT_G_SCALE, 1);
+        size = 6;
+        break;
+
+      case STREAM_FIELD_HEADING:
+        Get_Fixed(&Sample->Heading, Source, 1, STREAM_COMPACT_DEG_SCALE, 0);
+        size = 2;
+        break;
+
+      case STREAM_FIELD_HEADING_ERR:
+        Get_Fixed(&Sample->HeadingErr, Source, 1, STREAM_COMPACT_DEG_SCALE, 0);
+        size = 2;
+        break;
+
+      default:
+        /* Same as the float encoding */
+        break;
+    }
+
+    if (size != 0U)
+    {
+      return size;
+    }
+  }
+
+  switch (Field & STREAM_FIELD_ALL)
+  {
+    case STREAM_FIELD_TIME:
+      (void)memcpy(Sample->Time, Source, 4);
+      size = 4;
+      break;
+
+    case STREAM_FIELD_PRESS:
+      Get_Floats(&Sample->Press, Source, 1);
+      size = 4;
+      break;
+
+    case STREAM_FIELD_TEMP:
+      Get_Floats(&Sample->Temp, Source, 1);
+      size = 4;
+      break;
+
+    case STREAM_FIELD_HUM:
+      Get_Floats(&Sample->Hum, Source, 1);
+      size = 4;
+      break;
+
+    case STREAM_FIELD_ACC:
+      Get_Axes(Sample->Acc, Source);
+      size = 12;
+      break;
+
+    case STREAM_FIELD_GYR:
+      Get_Axes(Sample->Gyr, Source);
+      size = 12;
+      break;
+
+    case STREAM_FIELD_MAG:
+      Get_Axes(Sample->Mag, Source);
+      size = 12;
+      break;
+
+    case STREAM_FIELD_QUATERNION:
+      Get_Floats(Sample->Quaternion, Source, 4);
+      size = 16;
+      break;
+
+    case STREAM_FIELD_ROTATION:
+      Get_Floats(Sample->Rotation, Source, 3);
+      size = 12;
+      break;
+
+    case STREAM_FIELD_GRAVITY:
+      Get_Floats(Sample->Gravity, Source, 3);
+      size = 12;
+      break;
+
+    case STREAM_FIELD_LINEAR_ACC:
+      Get_Floats(Sample->LinearAcc, Source, 3);
+      size = 12;
+      break;
+
+    case STREAM_FIELD_HEADING:
+      Get_Floats(&Sample->Heading, Source, 1);
+      size = 4;
+      break;
+
+    case STREAM_FIELD_HEADING_ERR:
+      Get_Floats(&Sample->HeadingErr, Source, 1);
+      size = 4;
+      break;
+
+    case STREAM_FIELD_ELAPSED:
+      Sample->ElapsedUs = Deserialize(Source, 4);
+      size = 4;
+      break;
+
+    default:
+      break;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Encode values as 16-bit fixed point (LSB first), saturated
+  * @param  Dest pointer to the encoded values
+  * @param  Data pointer to the values
+  * @param  Count number of values
+  * @param  Scale LSB per unit
+  * @param  Min lowest code
+  * @param  Max highest code
+  * @retval Encoded size [bytes]
+  */
+static uint32_t Put_Fixed(uint8_t *Dest, const float *Data, uint32_t Count, float Scale, int32_t Min, int32_t Max)
+{
+  float value;
+  int32_t code;
+  uint32_t i;
+
+  for (i = 0; i < Count; i++)
+  {
+    value = Data[i] * Scale;
+
+    /* NaN is coded as Min */
+    if (!(value > (float)Min))
+    {
+      code = Min;
+    }
+    else if (value >= (float)Max)
+    {
+      code = Max;
+    }
+    else
+    {
+      code = (value < 0.0f) ? -(int32_t)(0.5f - value) : (int32_t)(value + 0.5f);
+    }
+
+    Serialize_s32(&Dest[2U * i], code, 2);
+  }
+
+  return 2U * Count;
+}
+
+/**
+  * @brief  Decode 16-bit fixed point values
+  * @param  Data pointer to the decoded values
+  * @param  Source pointer to the encoded values
+  * @param  Count number of values
+  * @param  Scale LSB per unit
+  * @param  Signed 1 for int16 codes, 0 for uint16 codes
+  * @retval None
+  */
+static void Get_Fixed(float *Data, uint8_t *Source, uint32_t Count, float Scale, uint8_t Signed)
+{
+  uint32_t code;
+  uint32_t i;
+
+  for (i = 0; i < Count; i++)
+  {
+    code = Deserialize(&Source[2U * i], 2);
+    Data[i] = (Signed != 0U) ? ((float)(int16_t)code / Scale) : ((float)code / Scale);
+  }
+}
+
+/**
+  * @brief  Encode a unit quaternion with the smallest three method
+  * @note   Each of the three codes is rounded down or up, the combination with which
+  *         the decoded quaternion, its largest component rebuilt from the unit norm,
+  *         is the closest to the input being sent. A quaternion with a NaN or infinite
+  *         component is encoded as the identity.
+  * @param  Dest pointer to the encoded quaternion
+  * @param  Quaternion pointer to the quaternion (x, y, z, w)
+  * @retval Encoded size [bytes]
+  */
+static uint32_t Put_Quaternion(uint8_t *Dest, const float *Quaternion)
+{
+  static const float identity[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+  const float *q = Quaternion;
+  float value[3];
+  float low[3];
+  float decoded;
+  float sum;
+  float error;
+  float best_error = 2.0f;
+  uint32_t best = 0;
+  uint32_t largest = 0;
+  uint32_t round;
+  uint32_t word;
+  uint32_t i;
+  uint32_t k = 0;
+
+  /* NaN fails every comparison below and its conversion to an integer is undefined */
+  for (i = 0; i < 4U; i++)
+  {
+    if (isfinite(Quaternion[i]) == 0)
+    {
+      q = identity;
+    }
+  }
+
+  for (i = 1; i < 4U; i++)
+  {
+    if (fabsf(q[i]) > fabsf(q[largest]))
+    {
+      largest = i;
+    }
+  }
+
+  /* q and -q are the same rotation, the omitted component is sent as non negative */
+  for (i = 0; i < 4U; i++)
+  {
+    if (i != largest)
+    {
+      value[k] = ((q[largest] < 0.0f) ? -q[i] : q[i]) * STREAM_COMPACT_QUAT_SCALE;
+      value[k] = (value[k] > 16383.0f) ? 16383.0f : value[k];
+      value[k] = (value[k] < -16383.0f) ? -16383.0f : value[k];
+      low[k] = floorf(value[k]);
+      low[k] = (low[k] > 16382.0f) ? 16382.0f : low[k];
+      k++;
+    }
+  }
+
+  /* Bit k of round set: code k rounded up */
+  for (round = 0; round < 8U; round++)
+  {
+    sum = 0.0f;
+    error = 0.0f;
+
+    for (k = 0; k < 3U; k++)
+    {
+      decoded = (low[k] + (float)((round >> k) & 1U)) / STREAM_COMPACT_QUAT_SCALE;
+      sum += decoded * decoded;
+      error = fmaxf(error, fabsf(decoded - (value[k] / STREAM_COMPACT_QUAT_SCALE)));
+    }
+
+    decoded = (sum < 1.0f) ? sqrtf(1.0f - sum) : 0.0f;
+    error = fmaxf(error, fabsf(decoded - fabsf(q[largest])));
+
+    if (error < best_error)
+    {
+      best_error = error;
+      best = round;
+    }
+  }
+
+  for (k = 0; k < 3U; k++)
+  {
+    word = ((uint32_t)((int32_t)low[k] + (int32_t)((best >> k) & 1U)) << 1) & 0xFFFEU;
+    word |= (k < 2U) ? ((largest >> k) & 1U) : 0U;
+    Serialize(&Dest[2U * k], word, 2);
+  }
+
+  return 6;
+}
+
+/**
+  * @brief  Decode a smallest three quaternion
+  * @param  Quaternion pointer to the decoded quaternion (x, y, z, w)
+  * @param  Source pointer to the encoded quaternion
+  * @retval None
+  */
+static void Get_Quaternion(float *Quaternion, uint8_t *Source)
+{
+  uint32_t word[3];
+  uint32_t largest;
+  float sum = 0.0f;
+  uint32_t i;
+  uint32_t k = 0;
+
+  word[0] = Deserialize(&Source[0], 2);
+  word[1] = Deserialize(&Source[2], 2);
+  word[2] = Deserialize(&Source[4], 2);
+  largest = (word[0] & 1U) | ((word[1] & 1U) << 1);
+
+  for (i = 0; i < 4U; i++)
+  {
+    if (i != largest)
+    {
+      /* int15 in bits 15..1 */
+      Quaternion[i] = ((float)(int16_t)(word[k] & 0xFFFEU) / 2.0f) / STREAM_COMPACT_QUAT_SCALE;
+      sum += Quaternion[i] * Quaternion[i];
+      k++;
+    }
+  }
+
+  Quaternion[largest] = (sum < 1.0f) ? sqrtf(1.0f - sum) : 0.0f;
+}
+
+/**
+  * @}
+  */
@@ -40,6 +40,7 @@ void MotionMC_manager_update(MMC_Input_t *data_in);
 void MotionMC_manager_get_params(MMC_Output_t *data_out);
 void MotionMC_manager_get_version(char *version, int32_t *length);
 void MotionMC_manager_compensate(MOTION_SENSOR_Axes_t *data_raw, MOTION_SENSOR_Axes_t *data_comp);
+void MotionMC_manager_save_cal(void);
 
 int32_t mag_val_to_mGauss(float mag_val_uT);
 
@@ -18,6 +18,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "motion_mc_manager.h"
+#include "nvm_store.h"
 
 /** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
   * @{
@@ -28,6 +29,9 @@
   */
 
 /* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static int32_t McSampleTime;
+
 /* Exported functions prototypes ---------------------------------------------*/
 /* NOTE: Must be implemented for each platform separately, because its implementation
          is platform dependent. No need to call this function, library call this
@@ -48,6 +52,7 @@ char MotionMC_SaveCalInNVM(unsigned short int datasize, unsigned int *data);
   */
 void MotionMC_manager_init(int32_t sampletime, unsigned short int enable)
 {
+  McSampleTime = sampletime;
   MotionMC_Initialize(sampletime, enable);
 }
 
@@ -139,18 +144,30 @@ int32_t mag_val_to_mGauss(float mag_val_uT)
   }
 }
 
+/**
+  * @brief  Save the calibration parameters in storage and go on calibrating
+  * @note   The library saves them when it is disabled, and loads them back when enabled.
+  * @param  None
+  * @retval None
+  */
+void MotionMC_manager_save_cal(void)
+{
+  MotionMC_Initialize(McSampleTime, 0);
+  MotionMC_Initialize(McSampleTime, 1);
+}
+
 /* NOTE: Must be implemented for each platform separately, because its implementation
          is platform dependent. No need to call this function, library call this
          function automatically.*/
 /**
   * @brief  Load the calibration parameters from storage
-  * @param  dataSize  size of data
+  * @param  dataSize  size of data [bytes]
   * @param  data  pointer to data
   * @retval Will return 0 the if it is success and 1 if it is failure
   */
 char MotionMC_LoadCalFromNVM(unsigned short int datasize, unsigned int *data)
 {
-  return 1; /* FAILURE: Read from NVM not implemented. */
+  return NVM_Calib_Load(NVM_ID_MC_CAL, datasize, data);
 }
 
 /* NOTE: Must be implemented for each platform separately, because its implementation
@@ -158,13 +175,13 @@ char MotionMC_LoadCalFromNVM(unsigned short int datasize, unsigned int *data)
          function automatically.*/
 /**
   * @brief  Save the calibration parameters in storage
-  * @param  dataSize  size of data
+  * @param  dataSize  size of data [bytes]
   * @param  data  pointer to data
   * @retval Will return 0 the if it is success and 1 if it is failure
   */
 char MotionMC_SaveCalInNVM(unsigned short int datasize, unsigned int *data)
 {
-  return 1; /* FAILURE: Write to NVM not implemented. */
+  return NVM_Calib_Save(NVM_ID_MC_CAL, datasize, data);
 }
 
 /**
@@ -42,6 +42,8 @@ void MotionGC_manager_set_knobs(MGC_knobs_t *knobs);
 void MotionGC_manager_get_params(MGC_output_t *gyro_bias);
 void MotionGC_manager_set_params(MGC_output_t *gyro_bias);
 void MotionGC_manager_set_frequency(float freq);
+char MotionGC_manager_load_params(MGC_output_t *gyro_bias);
+void MotionGC_manager_save_params(void);
 void MotionGC_manager_get_version(char *version, int32_t *length);
 void MotionGC_manager_compensate(MOTION_SENSOR_Axes_t *DataIn, MOTION_SENSOR_Axes_t *DataOut);
 
@@ -0,0 +1,104 @@
+/**
+  *******************************************************************************
+  * @file    nvm_store.h
+  * @author  MEMS Software Solutions Team
+  * @brief   header for nvm_store.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion ------------------------------------ */
+#ifndef NVM_STORE_H
+#define NVM_STORE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported defines --------------------------------------------------------*/
+/* Return values */
+#define NVM_OK                 0
+#define NVM_NOT_FOUND          1 /* No record, or a record of another size */
+#define NVM_ERROR              2
+
+/* Record identifiers, shared by the applications using the same flash region */
+#define NVM_ID_MC_CAL          1U /* MotionMC calibration */
+#define NVM_ID_AC_CAL          2U /* MotionAC calibration */
+#define NVM_ID_GC_BIAS         3U /* MotionGC gyroscope bias */
+#define NVM_ID_FX_MAGCAL       4U /* MotionFX magnetometer calibration */
+#define NVM_ID_FX_GBIAS        5U /* MotionFX gyroscope bias */
+#define NVM_ID_COUNT           8U /* Identifiers from 1 to NVM_ID_COUNT - 1 */
+
+#define NVM_MAX_SIZE           1024U /* Largest record data [bytes] */
+#define NVM_NONE               0xFFU /* No active sector */
+
+/* Flash layout, two sectors used in turn, all words LSB first:
+ *   Sector: Magic | Seq | Record | Record ... | erased
+ *   Record: Header | Data (Size bytes padded to words) | CRC
+ *   Header: Id (8 bits) | ~Id (8 bits) | Size (16 bits)
+ * The records are appended, the newest one of an Id is the current one and a record of
+ * size 0 deletes it. The CRC-32 covers the header and the data words.
+ * When the active sector is full, the current records are copied to the other sector,
+ * erased first, then its Seq and Magic are written: the valid sector with the highest Seq
+ * is the active one, so that a power failure leaves the old or the new record of an Id.
+ */
+#define NVM_MAGIC              0x314D564EU /* "NVM1" */
+#define NVM_SECTOR_HEADER_LEN  8U
+#define NVM_RECORD_OVERHEAD    8U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Flash interface of the store, the offsets are in bytes from the first sector
+  */
+typedef struct
+{
+  uint32_t SectorSize;                               /* [bytes], multiple of 4 */
+  int32_t (*Erase)(uint32_t Sector);                 /* Erase sector 0 or 1, 0 on success */
+  int32_t (*Program)(uint32_t Offset, uint32_t Word); /* Program an erased word, 0 on success */
+  uint32_t (*Read)(uint32_t Offset);                 /* Read a word */
+} NVM_Flash_t;
+
+/**
+  * @brief  Record store
+  */
+typedef struct
+{
+  const NVM_Flash_t *Flash;
+  uint8_t Active;                 /* Active sector, NVM_NONE before the first write */
+  uint32_t Seq;                   /* Sequence number of the active sector */
+  uint32_t Free;                  /* Append offset in the active sector, SectorSize if its tail is unusable */
+  uint32_t Last[NVM_ID_COUNT];    /* Offset of the current record of each Id in the active sector, 0 if none */
+  uint32_t Writes;                /* Records written */
+  uint32_t Erases;                /* Sectors erased */
+} NVM_Store_t;
+
+/* Exported functions ------------------------------------------------------- */
+int32_t NVM_Store_Init(NVM_Store_t *Store, const NVM_Flash_t *Flash);
+int32_t NVM_Store_Read(NVM_Store_t *Store, uint8_t Id, void *Data, uint16_t Size);
+int32_t NVM_Store_Write(NVM_Store_t *Store, uint8_t Id, const void *Data, uint16_t Size);
+int32_t NVM_Store_Delete(NVM_Store_t *Store, uint8_t Id);
+
+#ifndef NVM_HOST_STUB
+/* Calibration store in the MCU flash, with the return values of the library NVM hooks */
+char NVM_Calib_Load(uint8_t Id, uint16_t DataSize, void *Data);
+char NVM_Calib_Save(uint8_t Id, uint16_t DataSize, const void *Data);
+void NVM_Calib_Clear(uint8_t Id);
+#endif /* NVM_HOST_STUB */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NVM_STORE_H */
@@ -175,10 +175,13 @@ static void MX_GyroscopeCalibration_Init(void)
   (void)MotionGC_SetKnobs(&Knobs);
 
   /* OPTIONAL */
-  /* Set initial gyroscope bias */
-  start_gyro_bias.GyroBiasX = 0.0f;
-  start_gyro_bias.GyroBiasY = 0.0f;
-  start_gyro_bias.GyroBiasZ = 0.0f;
+  /* Set initial gyroscope bias, the one of the previous run if saved */
+  if (MotionGC_manager_load_params(&start_gyro_bias) != (char)0)
+  {
+    start_gyro_bias.GyroBiasX = 0.0f;
+    start_gyro_bias.GyroBiasY = 0.0f;
+    start_gyro_bias.GyroBiasZ = 0.0f;
+  }
   MotionGC_manager_set_params(&start_gyro_bias);
 
   /* OPTIONAL */
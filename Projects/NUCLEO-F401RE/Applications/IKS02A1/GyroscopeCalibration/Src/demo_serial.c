@@ -286,6 +286,12 @@ int32_t HandleMSG(Msg_t *Msg)
       BSP_SENSOR_TEMP_Disable();
       BSP_SENSOR_HUM_Disable();
 
+      /* Keep the gyroscope bias for the next start, unless it was estimated on offline data */
+      if (UseOfflineData == 0U)
+      {
+        MotionGC_manager_save_params();
+      }
+
       SensorsEnabled = 0;
       UseOfflineData = 0;
 
@@ -18,6 +18,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "motion_gc_manager.h"
+#include "nvm_store.h"
 
 /** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
   * @{
@@ -92,6 +93,30 @@ void MotionGC_manager_set_params(MGC_output_t *gyro_bias)
   MotionGC_SetCalParams(gyro_bias);
 }
 
+/**
+  * @brief  Load the gyroscope compensation parameters saved by the previous run
+  * @note   The library has no storage hooks, the application loads and saves the bias.
+  * @param  gyro_bias  pointer to the offset values in [dps]
+  * @retval (1) fail, (0) success
+  */
+char MotionGC_manager_load_params(MGC_output_t *gyro_bias)
+{
+  return NVM_Calib_Load(NVM_ID_GC_BIAS, (uint16_t)sizeof(MGC_output_t), gyro_bias);
+}
+
+/**
+  * @brief  Save the gyroscope compensation parameters in storage
+  * @param  None
+  * @retval none
+  */
+void MotionGC_manager_save_params(void)
+{
+  MGC_output_t gyro_bias;
+
+  MotionGC_GetCalParams(&gyro_bias);
+  (void)NVM_Calib_Save(NVM_ID_GC_BIAS, (uint16_t)sizeof(MGC_output_t), &gyro_bias);
+}
+
 /**
   * @brief  Set new sample frequency
   * @param  freq  new sample frequency in Herz [Hz]
@@ -286,6 +286,12 @@ int32_t HandleMSG(Msg_t *Msg)
       BSP_SENSOR_TEMP_Disable();
       BSP_SENSOR_HUM_Disable();
 
+      /* Keep the magnetometer calibration for the next start, unless it was estimated on offline data */
+      if (UseOfflineData == 0U)
+      {
+        MotionMC_manager_save_cal();
+      }
+
       SensorsEnabled = 0;
       UseOfflineData = 0;
 
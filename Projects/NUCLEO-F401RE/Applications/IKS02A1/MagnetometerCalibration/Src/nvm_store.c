@@ -0,0 +1,679 @@
+/**
+  ******************************************************************************
+  * @file    nvm_store.c
+  * @author  MEMS Software Solutions Team
+  * @brief   This file contains the calibration record store in the MCU flash
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "nvm_store.h"
+#ifndef NVM_HOST_STUB
+#include "main.h"
+#endif /* NVM_HOST_STUB */
+
+/** @addtogroup MOTION_APPLICATIONS MOTION APPLICATIONS
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define NVM_ERASED         0xFFFFFFFFU
+#define NVM_CRC_INIT       0xFFFFFFFFU
+#define NVM_CRC_POLY       0x04C11DB7U
+
+/* Record check results */
+#define NVM_REC_END        0U /* Erased header, no record after */
+#define NVM_REC_VALID      1U
+#define NVM_REC_TORN       2U /* Valid header, wrong CRC: interrupted write, skipped */
+#define NVM_REC_BAD        3U /* Header not valid, the tail of the sector is not usable */
+
+#ifndef NVM_HOST_STUB
+/* Sectors 6 and 7 of the STM32F401RE, 128 Kbytes each, kept out of the code by the linker files.
+ * An erase stalls the code fetches for up to 4 s, it only occurs when a sector is full. */
+#define NVM_FLASH_BASE     0x08040000U
+#define NVM_FLASH_SECTOR   FLASH_SECTOR_6
+#define NVM_SECTOR_SIZE    0x20000U
+#endif /* NVM_HOST_STUB */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#ifndef NVM_HOST_STUB
+static int32_t NVM_Flash_Erase(uint32_t Sector);
+static int32_t NVM_Flash_Program(uint32_t Offset, uint32_t Word);
+static uint32_t NVM_Flash_Read(uint32_t Offset);
+
+static const NVM_Flash_t NvmFlash = {NVM_SECTOR_SIZE, NVM_Flash_Erase, NVM_Flash_Program, NVM_Flash_Read};
+static NVM_Store_t NvmStore;
+static uint8_t NvmStoreReady = 0;
+#endif /* NVM_HOST_STUB */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t NVM_Crc(uint32_t Crc, uint32_t Word);
+static uint32_t NVM_Record_Len(uint32_t Header);
+static uint32_t NVM_Check(const NVM_Store_t *Store, uint32_t Offset, uint32_t *Header);
+static uint32_t NVM_Sector_Valid(const NVM_Store_t *Store, uint8_t Sector, uint32_t *Seq);
+static void NVM_Scan(NVM_Store_t *Store);
+static uint32_t NVM_Pack(const uint8_t *Data, uint16_t Size, uint32_t Index);
+static uint32_t NVM_Same(const NVM_Store_t *Store, uint8_t Id, const uint8_t *Data, uint16_t Size);
+static int32_t NVM_Append(NVM_Store_t *Store, uint32_t Offset, uint8_t Id, const uint8_t *Data, uint16_t Size);
+static int32_t NVM_Compact(NVM_Store_t *Store, uint8_t Id, const uint8_t *Data, uint16_t Size);
+#ifndef NVM_HOST_STUB
+static uint32_t NVM_Calib_Open(void);
+#endif /* NVM_HOST_STUB */
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Find the active sector and index its current records
+  * @param  Store pointer to the store
+  * @param  Flash pointer to the flash interface
+  * @retval NVM_OK, NVM_ERROR if the sector size is not usable
+  */
+int32_t NVM_Store_Init(NVM_Store_t *Store, const NVM_Flash_t *Flash)
+{
+  uint32_t seq;
+  uint8_t sector;
+
+  (void)memset(Store, 0, sizeof(NVM_Store_t));
+  Store->Flash = Flash;
+  Store->Active = NVM_NONE;
+
+  if (((Flash->SectorSize % 4U) != 0U)
+      || (Flash->SectorSize < (NVM_SECTOR_HEADER_LEN + NVM_RECORD_OVERHEAD + NVM_MAX_SIZE)))
+  {
+    return NVM_ERROR;
+  }
+
+  for (sector = 0; sector < 2U; sector++)
+  {
+    if (NVM_Sector_Valid(Store, sector, &seq) == 1U)
+    {
+      if ((Store->Active == NVM_NONE) || (seq > Store->Seq))
+      {
+        Store->Active = sector;
+        Store->Seq = seq;
+      }
+    }
+  }
+
+  NVM_Scan(Store);
+  return NVM_OK;
+}
+
+/**
+  * @brief  Read the current record of an Id
+  * @param  Store pointer to the store
+  * @param  Id record identifier
+  * @param  Data pointer to the data read
+  * @param  Size data size [bytes]
+  * @retval NVM_OK, NVM_NOT_FOUND if there is no record of this size, NVM_ERROR if it is corrupted
+  */
+int32_t NVM_Store_Read(NVM_Store_t *Store, uint8_t Id, void *Data, uint16_t Size)
+{
+  uint8_t *dest = (uint8_t *)Data;
+  uint32_t offset;
+  uint32_t header;
+  uint32_t word = 0;
+  uint32_t i;
+
+  if ((Id == 0U) || (Id >= NVM_ID_COUNT))
+  {
+    return NVM_ERROR;
+  }
+
+  if ((Store->Active == NVM_NONE) || (Store->Last[Id] == 0U))
+  {
+    return NVM_NOT_FOUND;
+  }
+
+  offset = ((uint32_t)Store->Active * Store->Flash->SectorSize) + Store->Last[Id];
+
+  /* Checked again, the flash may have changed since the scan */
+  if (NVM_Check(Store, offset, &header) != NVM_REC_VALID)
+  {
+    return NVM_ERROR;
+  }
+
+  if ((header >> 16) != (uint32_t)Size)
+  {
+    return NVM_NOT_FOUND;
+  }
+
+  for (i = 0; i < (uint32_t)Size; i++)
+  {
+    if ((i % 4U) == 0U)
+    {
+      word = Store->Flash->Read(offset + 4U + i);
+    }
+
+    dest[i] = (uint8_t)(word >> (8U * (i % 4U)));
+  }
+
+  return NVM_OK;
+}
+
+/**
+  * @brief  Write a record, unless the current one has the same data
+  * @note   After a power failure during the write, the old or the new record is read.
+  * @param  Store pointer to the store
+  * @param  Id record identifier
+  * @param  Data pointer to the data
+  * @param  Size data size [bytes], 0 deletes the record
+  * @retval NVM_OK, NVM_ERROR on a flash failure or invalid parameters
+  */
+int32_t NVM_Store_Write(NVM_Store_t *Store, uint8_t Id, const void *Data, uint16_t Size)
+{
+  const uint8_t *src = (const uint8_t *)Data;
+  uint32_t len = NVM_Record_Len((uint32_t)Size << 16);
+
+  if ((Id == 0U) || (Id >= NVM_ID_COUNT) || ((uint32_t)Size > NVM_MAX_SIZE) || ((Size != 0U) && (Data == NULL)))
+  {
+    return NVM_ERROR;
+  }
+
+  if (NVM_Same(Store, Id, src, Size) == 1U)
+  {
+    return NVM_OK;
+  }
+
+  if ((Store->Active != NVM_NONE) && ((Store->Free + len) <= Store->Flash->SectorSize))
+  {
+    if (NVM_Append(Store, ((uint32_t)Store->Active * Store->Flash->SectorSize) + Store->Free, Id, src, Size) == NVM_OK)
+    {
+      Store->Last[Id] = (Size == 0U) ? 0U : Store->Free;
+      Store->Free += len;
+      return NVM_OK;
+    }
+
+    /* The torn record is skipped at the next scan, but nothing can be appended after it */
+    Store->Free = Store->Flash->SectorSize;
+  }
+
+  return NVM_Compact(Store, Id, src, Size);
+}
+
+/**
+  * @brief  Delete the record of an Id
+  * @param  Store pointer to the store
+  * @param  Id record identifier
+  * @retval NVM_OK, NVM_ERROR on a flash failure
+  */
+int32_t NVM_Store_Delete(NVM_Store_t *Store, uint8_t Id)
+{
+  return NVM_Store_Write(Store, Id, NULL, 0);
+}
+
+#ifndef NVM_HOST_STUB
+/**
+  * @brief  Load calibration data from the store in the MCU flash
+  * @param  Id record identifier
+  * @param  DataSize size of data [bytes]
+  * @param  Data pointer to data
+  * @retval (1) fail, (0) success
+  */
+char NVM_Calib_Load(uint8_t Id, uint16_t DataSize, void *Data)
+{
+  if (NVM_Calib_Open() == 0U)
+  {
+    return (char)1;
+  }
+
+  return (NVM_Store_Read(&NvmStore, Id, Data, DataSize) == NVM_OK) ? (char)0 : (char)1;
+}
+
+/**
+  * @brief  Save calibration data to the store in the MCU flash
+  * @param  Id record identifier
+  * @param  DataSize size of data [bytes]
+  * @param  Data pointer to data
+  * @retval (1) fail, (0) success
+  */
+char NVM_Calib_Save(uint8_t Id, uint16_t DataSize, const void *Data)
+{
+  if (NVM_Calib_Open() == 0U)
+  {
+    return (char)1;
+  }
+
+  return (NVM_Store_Write(&NvmStore, Id, Data, DataSize) == NVM_OK) ? (char)0 : (char)1;
+}
+
+/**
+  * @brief  Delete calibration data from the store in the MCU flash, to calibrate from scratch
+  * @param  Id record identifier
+  * @retval None
+  */
+void NVM_Calib_Clear(uint8_t Id)
+{
+  if (NVM_Calib_Open() == 1U)
+  {
+    (void)NVM_Store_Delete(&NvmStore, Id);
+  }
+}
+#endif /* NVM_HOST_STUB */
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  CRC-32/MPEG-2 update with a word, same result as the STM32 CRC unit
+  * @param  Crc current CRC value
+  * @param  Word word to add
+  * @retval The updated CRC value
+  */
+static uint32_t NVM_Crc(uint32_t Crc, uint32_t Word)
+{
+  uint32_t i;
+
+  Crc ^= Word;
+
+  for (i = 0; i < 32U; i++)
+  {
+    Crc = ((Crc & 0x80000000U) != 0U) ? ((Crc << 1) ^ NVM_CRC_POLY) : (Crc << 1);
+  }
+
+  return Crc;
+}
+
+/**
+  * @brief  Length of a record in flash
+  * @param  Header record header
+  * @retval Header, padded data and CRC length [bytes]
+  */
+static uint32_t NVM_Record_Len(uint32_t Header)
+{
+  return NVM_RECORD_OVERHEAD + (((Header >> 16) + 3U) & ~3U);
+}
+
+/**
+  * @brief  Check the record at an offset
+  * @param  Store pointer to the store
+  * @param  Offset record offset [bytes]
+  * @param  Header pointer to the record header read
+  * @retval NVM_REC_x
+  */
+static uint32_t NVM_Check(const NVM_Store_t *Store, uint32_t Offset, uint32_t *Header)
+{
+  const NVM_Flash_t *flash = Store->Flash;
+  uint32_t end = ((Offset / flash->SectorSize) + 1U) * flash->SectorSize;
+  uint32_t header = flash->Read(Offset);
+  uint32_t len;
+  uint32_t crc;
+  uint32_t i;
+
+  *Header = header;
+
+  if (header == NVM_ERASED)
+  {
+    return NVM_REC_END;
+  }
+
+  len = NVM_Record_Len(header);
+
+  if (((((header >> 8) ^ header) & 0xFFU) != 0xFFU) || ((header >> 16) > NVM_MAX_SIZE) || ((Offset + len) > end))
+  {
+    return NVM_REC_BAD;
+  }
+
+  crc = NVM_Crc(NVM_CRC_INIT, header);
+
+  for (i = 4U; i < (len - 4U); i += 4U)
+  {
+    crc = NVM_Crc(crc, flash->Read(Offset + i));
+  }
+
+  return (crc == flash->Read(Offset + len - 4U)) ? NVM_REC_VALID : NVM_REC_TORN;
+}
+
+/**
+  * @brief  Check the header of a sector
+  * @param  Store pointer to the store
+  * @param  Sector sector 0 or 1
+  * @param  Seq pointer to the sequence number of the sector
+  * @retval 1 if the sector holds records, 0 otherwise
+  */
+static uint32_t NVM_Sector_Valid(const NVM_Store_t *Store, uint8_t Sector, uint32_t *Seq)
+{
+  uint32_t base = (uint32_t)Sector * Store->Flash->SectorSize;
+
+  *Seq = Store->Flash->Read(base + 4U);
+
+  return ((Store->Flash->Read(base) == NVM_MAGIC) && (*Seq != NVM_ERASED)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Index the current records of the active sector and find its append offset
+  * @param  Store pointer to the store
+  * @retval None
+  */
+static void NVM_Scan(NVM_Store_t *Store)
+{
+  uint32_t size = Store->Flash->SectorSize;
+  uint32_t base;
+  uint32_t offset = NVM_SECTOR_HEADER_LEN;
+  uint32_t header;
+  uint32_t check;
+  uint32_t id;
+
+  (void)memset(Store->Last, 0, sizeof(Store->Last));
+  Store->Free = size;
+
+  if (Store->Active == NVM_NONE)
+  {
+    return;
+  }
+
+  base = (uint32_t)Store->Active * size;
+
+  while (offset < size)
+  {
+    check = NVM_Check(Store, base + offset, &header);
+
+    if (check == NVM_REC_END)
+    {
+      Store->Free = offset;
+      break;
+    }
+
+    if (check == NVM_REC_BAD)
+    {
+      break;
+    }
+
+    id = header & 0xFFU;
+
+    if ((check == NVM_REC_VALID) && (id != 0U) && (id < NVM_ID_COUNT))
+    {
+      Store->Last[id] = ((header >> 16) == 0U) ? 0U : offset;
+    }
+
+    offset += NVM_Record_Len(header);
+  }
+}
+
+/**
+  * @brief  Data word of a record, LSB first, padded with 0
+  * @param  Data pointer to the data
+  * @param  Size data size [bytes]
+  * @param  Index word index
+  * @retval The word
+  */
+static uint32_t NVM_Pack(const uint8_t *Data, uint16_t Size, uint32_t Index)
+{
+  uint32_t word = 0;
+  uint32_t i;
+
+  for (i = 0; i < 4U; i++)
+  {
+    if (((Index * 4U) + i) < (uint32_t)Size)
+    {
+      word |= (uint32_t)Data[(Index * 4U) + i] << (8U * i);
+    }
+  }
+
+  return word;
+}
+
+/**
+  * @brief  Compare the current record of an Id with new data
+  * @param  Store pointer to the store
+  * @param  Id record identifier
+  * @param  Data pointer to the data
+  * @param  Size data size [bytes], 0 for a deletion
+  * @retval 1 if the store already holds this data, 0 otherwise
+  */
+static uint32_t NVM_Same(const NVM_Store_t *Store, uint8_t Id, const uint8_t *Data, uint16_t Size)
+{
+  uint32_t offset;
+  uint32_t header;
+  uint32_t i;
+
+  if ((Store->Active == NVM_NONE) || (Store->Last[Id] == 0U))
+  {
+    return (Size == 0U) ? 1U : 0U;
+  }
+
+  offset = ((uint32_t)Store->Active * Store->Flash->SectorSize) + Store->Last[Id];
+
+  if ((NVM_Check(Store, offset, &header) != NVM_REC_VALID) || ((header >> 16) != (uint32_t)Size))
+  {
+    return 0;
+  }
+
+  for (i = 0; i < (((uint32_t)Size + 3U) / 4U); i++)
+  {
+    if (Store->Flash->Read(offset + 4U + (i * 4U)) != NVM_Pack(Data, Size, i))
+    {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/**
+  * @brief  Program a record at an erased offset, the header first so that its space is
+  *         skipped by the scan if the write is interrupted
+  * @param  Store pointer to the store
+  * @param  Offset record offset [bytes]
+  * @param  Id record identifier
+  * @param  Data pointer to the data
+  * @param  Size data size [bytes]
+  * @retval NVM_OK, NVM_ERROR on a flash failure
+  */
+static int32_t NVM_Append(NVM_Store_t *Store, uint32_t Offset, uint8_t Id, const uint8_t *Data, uint16_t Size)
+{
+  uint32_t header = (uint32_t)Id | (((uint32_t)~Id & 0xFFU) << 8) | ((uint32_t)Size << 16);
+  uint32_t crc = NVM_Crc(NVM_CRC_INIT, header);
+  uint32_t word;
+  uint32_t i;
+
+  if (Store->Flash->Program(Offset, header) != 0)
+  {
+    return NVM_ERROR;
+  }
+
+  for (i = 0; i < (((uint32_t)Size + 3U) / 4U); i++)
+  {
+    word = NVM_Pack(Data, Size, i);
+    crc = NVM_Crc(crc, word);
+
+    if (Store->Flash->Program(Offset + 4U + (i * 4U), word) != 0)
+    {
+      return NVM_ERROR;
+    }
+  }
+
+  if (Store->Flash->Program(Offset + NVM_Record_Len(header) - 4U, crc) != 0)
+  {
+    return NVM_ERROR;
+  }
+
+  Store->Writes++;
+  return NVM_OK;
+}
+
+/**
+  * @brief  Copy the current records and the new one to the other sector and activate it
+  * @note   The sector header is written last: until then the active sector is unchanged.
+  * @param  Store pointer to the store
+  * @param  Id record identifier of the new record
+  * @param  Data pointer to the data
+  * @param  Size data size [bytes], 0 deletes the record
+  * @retval NVM_OK, NVM_ERROR on a flash failure
+  */
+static int32_t NVM_Compact(NVM_Store_t *Store, uint8_t Id, const uint8_t *Data, uint16_t Size)
+{
+  const NVM_Flash_t *flash = Store->Flash;
+  uint8_t target = (Store->Active == 0U) ? 1U : 0U;
+  uint32_t base = (uint32_t)target * flash->SectorSize;
+  uint32_t last[NVM_ID_COUNT] = {0};
+  uint32_t offset;
+  uint32_t src;
+  uint32_t len;
+  uint32_t id;
+  uint32_t i;
+
+  /* Erase the target sector, unless it is blank */
+  for (i = 0; i < flash->SectorSize; i += 4U)
+  {
+    if (flash->Read(base + i) != NVM_ERASED)
+    {
+      if (flash->Erase(target) != 0)
+      {
+        return NVM_ERROR;
+      }
+
+      Store->Erases++;
+      break;
+    }
+  }
+
+  offset = NVM_SECTOR_HEADER_LEN;
+
+  for (id = 1; id < NVM_ID_COUNT; id++)
+  {
+    if ((id == (uint32_t)Id) || (Store->Active == NVM_NONE) || (Store->Last[id] == 0U))
+    {
+      continue;
+    }
+
+    src = ((uint32_t)Store->Active * flash->SectorSize) + Store->Last[id];
+    len = NVM_Record_Len(flash->Read(src));
+
+    if ((offset + len) > flash->SectorSize)
+    {
+      return NVM_ERROR;
+    }
+
+    for (i = 0; i < len; i += 4U)
+    {
+      if (flash->Program(base + offset + i, flash->Read(src + i)) != 0)
+      {
+        return NVM_ERROR;
+      }
+    }
+
+    last[id] = offset;
+    offset += len;
+  }
+
+  if (Size != 0U)
+  {
+    len = NVM_Record_Len((uint32_t)Size << 16);
+
+    if (((offset + len) > flash->SectorSize) || (NVM_Append(Store, base + offset, Id, Data, Size) != NVM_OK))
+    {
+      return NVM_ERROR;
+    }
+
+    last[Id] = offset;
+    offset += len;
+  }
+
+  if ((flash->Program(base + 4U, Store->Seq + 1U) != 0) || (flash->Program(base, NVM_MAGIC) != 0))
+  {
+    return NVM_ERROR;
+  }
+
+  Store->Active = target;
+  Store->Seq++;
+  Store->Free = offset;
+  (void)memcpy(Store->Last, last, sizeof(Store->Last));
+  return NVM_OK;
+}
+
+#ifndef NVM_HOST_STUB
+/**
+  * @brief  Initialize the calibration store at its first use, the libraries load their
+  *         calibration during their initialization
+  * @param  None
+  * @retval 1 if the store is ready, 0 otherwise
+  */
+static uint32_t NVM_Calib_Open(void)
+{
+  if (NvmStoreReady == 0U)
+  {
+    if (NVM_Store_Init(&NvmStore, &NvmFlash) != NVM_OK)
+    {
+      return 0;
+    }
+
+    NvmStoreReady = 1;
+  }
+
+  return 1;
+}
+
+/**
+  * @brief  Erase a sector of the store
+  * @param  Sector sector 0 or 1
+  * @retval 0 on success, -1 otherwise
+  */
+static int32_t NVM_Flash_Erase(uint32_t Sector)
+{
+  FLASH_EraseInitTypeDef erase;
+  uint32_t sector_error = 0;
+  int32_t ret = 0;
+
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.Banks = FLASH_BANK_1;
+  erase.Sector = NVM_FLASH_SECTOR + Sector;
+  erase.NbSectors = 1;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+  (void)HAL_FLASH_Unlock();
+
+  if (HAL_FLASHEx_Erase(&erase, &sector_error) != HAL_OK)
+  {
+    ret = -1;
+  }
+
+  (void)HAL_FLASH_Lock();
+  return ret;
+}
+
+/**
+  * @brief  Program a word of the store
+  * @param  Offset offset from the first sector [bytes]
+  * @param  Word word to program
+  * @retval 0 on success, -1 otherwise
+  */
+static int32_t NVM_Flash_Program(uint32_t Offset, uint32_t Word)
+{
+  int32_t ret = 0;
+
+  (void)HAL_FLASH_Unlock();
+
+  if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, NVM_FLASH_BASE + Offset, (uint64_t)Word) != HAL_OK)
+  {
+    ret = -1;
+  }
+
+  (void)HAL_FLASH_Lock();
+  return ret;
+}
+
+/**
+  * @brief  Read a word of the store
+  * @param  Offset offset from the first sector [bytes]
+  * @retval The word
+  */
+static uint32_t NVM_Flash_Read(uint32_t Offset)
+{
+  return *(__IO uint32_t *)(NVM_FLASH_BASE + Offset);
+}
+#endif /* NVM_HOST_STUB */
+
+/**
+  * @}
+  */
@@ -71,6 +71,8 @@ extern "C" {
 #define G_CONST               9.80665f                 //!< in m/s^2
 #define G_CONV                (float)(G_CONST/1000.0f) //!< CONSTANT for conversion from mm/s^2 to m/s^2
 
+#define TONE_BANK_SIZE_MAX    8             //!< Max number of tones tracked by the Goertzel bank
+
 #ifdef USE_SUBRANGE
 #define SUBRANGE_DEFAULT    8             //!< Default value for FFT output subranges
 #define SUBRANGE_MAX        64            //!< Default value for MAX Subranges to analyze
@@ -54,6 +54,7 @@
 #define ISM330DHCX_HP_ENABLE_DIV400  0xC4U  /* Enable HP filter, DIV/400 */
 #define ISM330DHCX_DEFAULT_ODR       417.0f /* Default output/batch data rate */
 #define ISM330DHCX_DEFAULT_FS        2      /* Default full scale */
+#define FIFO_BLOCK_SAMPLES           32U    /* Number of FIFO samples processed as a block */
 
 /* Extern variables ----------------------------------------------------------*/
 /* These "redundant" lines are here to fulfil MISRA C-2012 rule 8.4 */
@@ -75,6 +76,8 @@ static volatile uint32_t IntCurrentTime2 = 0;
 static volatile uint8_t AccIntReceived = 0;
 static uint8_t RestartFlag = 1;
 static uint32_t StartTick = 0;
+static SensorVal_f_t BlockData[FIFO_BLOCK_SAMPLES]; /* FIFO samples not yet processed */
+static uint16_t BlockSamples = 0;
 
 /* Private function prototypes -----------------------------------------------*/
 static void Init_Sensors(void);
@@ -204,6 +207,7 @@ int main(void)
           UART_SendMsg(&msg_dat);
         }
         RestartFlag = 1;
+        BlockSamples = 0;
       }
     }
   }
@@ -246,6 +250,7 @@ uint8_t Init_Demo(void)
   GuiSettings.switch_HP_to_DC_null = 0;
   GuiSettings.hp_filter = 0;
   fftIsEnabled = 0;
+  BlockSamples = 0;
 
   /* Set parameters for MotionSP library */
   MotionSP_Parameters.FftSize = FFT_SIZE_DEFAULT;
@@ -333,6 +338,9 @@ uint8_t Restart_FIFO(void)
 {
   AccIntReceived = 0;
 
+  /* The samples not yet processed belong to the interrupted acquisition */
+  BlockSamples = 0;
+
   /* FIFO Bypass Mode */
   if (IKS02A1_MOTION_SENSOR_FIFO_Set_Mode(IKS02A1_ISM330DHCX_0, ISM330DHCX_BYPASS_MODE) != BSP_ERROR_NONE)
   {
@@ -644,9 +652,8 @@ static uint8_t Collect_Data(void)
   uint8_t tag;
   uint16_t samples_in_fifo = 0;
   uint32_t start = HAL_GetTick();
+  uint16_t processed;
   IKS02A1_MOTION_SENSOR_Axes_t acceleration;
-  SensorVal_f_t single_data;
-  SensorVal_f_t single_data_no_dc;
 
   if (FinishAvgFlag == 0 && fftIsEnabled == 0 && AccIntReceived == 1)
   {
@@ -676,24 +683,31 @@ static uint8_t Collect_Data(void)
       }
 
       /* Store data */
-      single_data.AXIS_X = (float)acceleration.x;
-      single_data.AXIS_Y = (float)acceleration.y;
-      single_data.AXIS_Z = (float)acceleration.z;
+      BlockData[BlockSamples].AXIS_X = (float)acceleration.x;
+      BlockData[BlockSamples].AXIS_Y = (float)acceleration.y;
+      BlockData[BlockSamples].AXIS_Z = (float)acceleration.z;
+      BlockSamples++;
 
-      /* Remove DC offset */
-      MotionSP_accDelOffset(&single_data_no_dc, &single_data, DC_SMOOTH, RestartFlag);
+      if (BlockSamples < FIFO_BLOCK_SAMPLES)
+      {
+        continue;
+      }
 
-      /* Fill the accelero circular buffer */
-      MotionSP_CreateAccCircBuffer(&AccCircBuffer, single_data_no_dc);
+      /* Remove DC offset, fill the accelero circular buffer and perform Time Domain analysis */
+      processed = MotionSP_TimeDomainProcessBlock(&sTimeDomain, &AccCircBuffer, BlockData, BlockSamples,
+                                                  (Td_Type_t)MotionSP_Parameters.td_type, RestartFlag);
+      RestartFlag = 0;
+
+      /* The processing stops at the circular buffer wrap: the samples after it
+         are dropped by Restart_FIFO at the end of the acquisition */
+      BlockSamples -= processed;
+      (void)memmove(BlockData, &BlockData[processed], BlockSamples * sizeof(SensorVal_f_t));
 
       if (AccCircBuffer.Ovf == 1)
       {
         fftIsEnabled = 1;
         AccCircBuffer.Ovf = 0;
       }
-
-      MotionSP_TimeDomainProcess(&sTimeDomain, (Td_Type_t)MotionSP_Parameters.td_type, RestartFlag);
-      RestartFlag = 0;
     }
 
     if (!Restart_FIFO())
@@ -119,6 +119,9 @@ void MX_IKS4A1_DataLogTerminal_Init(void)
   snprintf(dataOut, MAX_BUF_SIZE, "\r\n__________________________________________________________________________\r\n");
   printf("%s", dataOut);
 
+  /* Start the boot of the LIS2DUXS12 first, it runs while the other sensors are initialized */
+  IKS4A1_MOTION_SENSOR_Init_Start(IKS4A1_LIS2DUXS12_0);
+
   IKS4A1_MOTION_SENSOR_Init(IKS4A1_LSM6DSV16X_0, MOTION_ACCELERO | MOTION_GYRO);
 
   IKS4A1_MOTION_SENSOR_Init(IKS4A1_LSM6DSO16IS_0, MOTION_ACCELERO | MOTION_GYRO);
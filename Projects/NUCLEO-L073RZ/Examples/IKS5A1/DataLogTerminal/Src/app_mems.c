@@ -117,6 +117,9 @@ void MX_IKS5A1_DataLogTerminal_Init(void)
   snprintf(dataOut, MAX_BUF_SIZE, "\r\n__________________________________________________________________________\r\n");
   printf("%s", dataOut);
 
+  /* Start the boot of the IIS2DULPX first, it runs while the other sensors are initialized */
+  IKS5A1_MOTION_SENSOR_Init_Start(IKS5A1_IIS2DULPX_0);
+
   IKS5A1_MOTION_SENSOR_Init(IKS5A1_ISM330IS_0, MOTION_ACCELERO | MOTION_GYRO);
 
   IKS5A1_MOTION_SENSOR_Init(IKS5A1_ISM6HG256X_0, MOTION_ACCELERO | MOTION_GYRO);
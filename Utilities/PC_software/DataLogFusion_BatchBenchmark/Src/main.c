@@ -0,0 +1,330 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host round trip benchmark of the DataLogFusion batched streaming
+  *          frames against the one frame per sample stream
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "serial_protocol.h"
+#include "batch_stream.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_ODR_DEFAULT      416.0    /* Simulated IMU output data rate [Hz] */
+#define BENCH_SAMPLES_DEFAULT  200000U  /* Default number of samples */
+#define BENCH_BAUD_DEFAULT     921600U  /* Default UART baud rate */
+#define BENCH_BITS_PER_BYTE    10U      /* 8N1 */
+#define BENCH_MAX_BATCH        255U     /* Largest MaxSamples accepted by CMD_Set_Batch */
+
+#define STREAMING_MSG_LENGTH   119U     /* One frame per sample, as in demo_serial.h */
+#define TWO_PI                 6.283185307179586
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t RandState = 0x2545F491U;
+static Batch_Sample_t Decoded[BENCH_MAX_BATCH];
+static uint8_t Wire[2U * Msg_MaxLen];
+static uint64_t BatchBytes = 0;
+static uint32_t Frames = 0;
+static uint32_t Decoded_Samples = 0;
+static uint32_t Errors = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static float Rand_Gauss(void);
+static void Make_Sample(Batch_Sample_t *Sample, uint32_t Index, double Odr, uint8_t Content);
+static uint32_t Legacy_Wire_Size(const Batch_Sample_t *Sample);
+static int32_t Check_Frame(Msg_t *Msg, const Batch_Sample_t *Ref, uint32_t First, uint8_t Content);
+static void Send_Frame(Batch_t *Batch, Msg_t *Msg, const Batch_Sample_t *Ref);
+static double Now_s(void);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Benchmark entry point
+  * @param  argc number of arguments
+  * @param  argv [max samples per frame] [content mask] [delta 0/1] [odr] [baud]
+  * @retval 0 if all the samples survive the round trip, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  uint32_t max_samples = (argc > 1) ? (uint32_t)atoi(argv[1]) : BENCH_MAX_BATCH;
+  uint8_t content = (argc > 2) ? (uint8_t)strtol(argv[2], NULL, 0) : (uint8_t)(BATCH_ACC | BATCH_GYR);
+  uint8_t flags = ((argc > 3) && (atoi(argv[3]) == 0)) ? 0U : (uint8_t)BATCH_FLAG_DELTA;
+  double odr = (argc > 4) ? atof(argv[4]) : BENCH_ODR_DEFAULT;
+  uint32_t baud = (argc > 5) ? (uint32_t)atoi(argv[5]) : BENCH_BAUD_DEFAULT;
+  static Batch_Sample_t samples[BENCH_SAMPLES_DEFAULT];
+  Batch_t batch;
+  Msg_t msg;
+  uint64_t legacy_bytes = 0;
+  uint32_t i;
+  double t0;
+  double t_batch;
+  double legacy_rate;
+  double batch_rate;
+
+  if ((max_samples == 0U) || (max_samples > BENCH_MAX_BATCH))
+  {
+    (void)fprintf(stderr, "max samples per frame must be in [1, %u]\n", BENCH_MAX_BATCH);
+    return 1;
+  }
+
+  content &= (uint8_t)BATCH_CONTENT_MASK;
+
+  for (i = 0; i < BENCH_SAMPLES_DEFAULT; i++)
+  {
+    Make_Sample(&samples[i], i, odr, content);
+    legacy_bytes += Legacy_Wire_Size(&samples[i]);
+  }
+
+  /* Encode, frame and decode as Batch_Handler in app_mems.c and the host logger do */
+  t0 = Now_s();
+  Batch_Init(&batch, content, flags, (uint8_t)max_samples);
+
+  for (i = 0; i < BENCH_SAMPLES_DEFAULT; i++)
+  {
+    if (Batch_AddSample(&batch, &msg, &samples[i]) == 0)
+    {
+      Send_Frame(&batch, &msg, samples);
+      (void)Batch_AddSample(&batch, &msg, &samples[i]);
+    }
+
+    if (batch.Count >= batch.MaxSamples)
+    {
+      Send_Frame(&batch, &msg, samples);
+    }
+  }
+
+  Send_Frame(&batch, &msg, samples);
+
+  t_batch = Now_s() - t0;
+
+  legacy_rate = ((double)baud / BENCH_BITS_PER_BYTE) / ((double)legacy_bytes / BENCH_SAMPLES_DEFAULT);
+  batch_rate = ((double)baud / BENCH_BITS_PER_BYTE) / ((double)BatchBytes / BENCH_SAMPLES_DEFAULT);
+
+  (void)printf("content 0x%02X, %s axes, up to %u samples per frame, %.0f Hz ODR\n", content,
+               (flags != 0U) ? "delta coded" : "raw", max_samples, odr);
+  (void)printf("one frame per sample: %.1f bytes/sample on the wire, %.0f samples/s at %u baud\n",
+               (double)legacy_bytes / BENCH_SAMPLES_DEFAULT, legacy_rate, baud);
+  (void)printf("batched frames:       %.1f bytes/sample on the wire, %.0f samples/s at %u baud (%.1f samples/frame)\n",
+               (double)BatchBytes / BENCH_SAMPLES_DEFAULT, batch_rate, baud, (double)Decoded_Samples / Frames);
+  (void)printf("gain %.2fx, round trip %u/%u samples in %u frames, %u frame errors, %.1f ns/sample encode+decode\n",
+               batch_rate / legacy_rate, Decoded_Samples, BENCH_SAMPLES_DEFAULT, Frames, Errors, (t_batch * 1e9) / BENCH_SAMPLES_DEFAULT);
+
+  return ((Errors == 0U) && (Decoded_Samples == BENCH_SAMPLES_DEFAULT)) ? 0 : 1;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Gaussian noise sample, unit variance
+  * @param  None
+  * @retval Noise sample
+  */
+static float Rand_Gauss(void)
+{
+  float sum = 0.0f;
+  uint32_t i;
+
+  for (i = 0; i < 12U; i++)
+  {
+    RandState ^= RandState << 13;
+    RandState ^= RandState >> 17;
+    RandState ^= RandState << 5;
+    sum += (float)RandState / 4294967296.0f;
+  }
+
+  return sum - 6.0f;
+}
+
+/**
+  * @brief  Synthetic sample of a handheld device: slow rotation, hand tremor and sensor noise
+  * @param  Sample pointer to the sample
+  * @param  Index sample index
+  * @param  Odr output data rate [Hz]
+  * @param  Content sensors in the sample
+  * @retval None
+  */
+static void Make_Sample(Batch_Sample_t *Sample, uint32_t Index, double Odr, uint8_t Content)
+{
+  double t = (double)Index / Odr;
+  double roll = 0.6 * sin(TWO_PI * 0.3 * t);
+  double pitch = 0.4 * sin(TWO_PI * 0.17 * t);
+  double tremor = sin(TWO_PI * 9.0 * t);
+
+  (void)memset(Sample, 0, sizeof(Batch_Sample_t));
+
+  /* 1 us jitter on the acquisition time */
+  Sample->TimeUs = (uint32_t)(t * 1e6) + (uint32_t)(Index % 3U);
+
+  if ((Content & BATCH_PRESS) != 0U)
+  {
+    Sample->Press = 1013.25f + (0.02f * Rand_Gauss());
+  }
+
+  if ((Content & BATCH_TEMP) != 0U)
+  {
+    Sample->Temp = 24.5f + (0.01f * Rand_Gauss());
+  }
+
+  if ((Content & BATCH_HUM) != 0U)
+  {
+    Sample->Hum = 41.0f + (0.05f * Rand_Gauss());
+  }
+
+  Sample->Acc[0] = (int32_t)lround((-1000.0 * sin(pitch)) + (30.0 * tremor) + (3.0 * Rand_Gauss()));
+  Sample->Acc[1] = (int32_t)lround((1000.0 * sin(roll) * cos(pitch)) + (3.0 * Rand_Gauss()));
+  Sample->Acc[2] = (int32_t)lround((1000.0 * cos(roll) * cos(pitch)) + (3.0 * Rand_Gauss()));
+  Sample->Gyr[0] = (int32_t)lround((1000.0 * 0.6 * TWO_PI * 0.3 * (360.0 / TWO_PI) * cos(TWO_PI * 0.3 * t)) + (2000.0 * tremor) + (70.0 * Rand_Gauss()));
+  Sample->Gyr[1] = (int32_t)lround((1000.0 * 0.4 * TWO_PI * 0.17 * (360.0 / TWO_PI) * cos(TWO_PI * 0.17 * t)) + (70.0 * Rand_Gauss()));
+  Sample->Gyr[2] = (int32_t)lround(500.0 + (70.0 * Rand_Gauss()));
+  Sample->Mag[0] = (int32_t)lround((250.0 * cos(roll)) + (4.0 * Rand_Gauss()));
+  Sample->Mag[1] = (int32_t)lround((250.0 * sin(pitch)) + (4.0 * Rand_Gauss()));
+  Sample->Mag[2] = (int32_t)lround(-400.0 + (4.0 * Rand_Gauss()));
+
+  if ((Content & BATCH_ACC) == 0U)
+  {
+    (void)memset(Sample->Acc, 0, sizeof(Sample->Acc));
+  }
+
+  if ((Content & BATCH_GYR) == 0U)
+  {
+    (void)memset(Sample->Gyr, 0, sizeof(Sample->Gyr));
+  }
+
+  if ((Content & BATCH_MAG) == 0U)
+  {
+    (void)memset(Sample->Mag, 0, sizeof(Sample->Mag));
+  }
+}
+
+/**
+  * @brief  Wire size of the sample sent in a STREAMING_MSG_LENGTH frame, as in app_mems.c
+  * @param  Sample pointer to the sample
+  * @retval Size [bytes], checksum, byte stuffing and Msg_EOF included
+  */
+static uint32_t Legacy_Wire_Size(const Batch_Sample_t *Sample)
+{
+  Msg_t msg;
+  uint32_t i;
+
+  (void)memset(&msg, 0, sizeof(msg));
+  msg.Data[0] = 1;
+  msg.Data[1] = 50;
+  msg.Data[2] = 0x08;
+  FloatToArray(&msg.Data[7], Sample->Press);
+  FloatToArray(&msg.Data[11], Sample->Temp);
+  FloatToArray(&msg.Data[15], Sample->Hum);
+
+  for (i = 0; i < 3U; i++)
+  {
+    Serialize_s32(&msg.Data[19U + (4U * i)], Sample->Acc[i], 4);
+    Serialize_s32(&msg.Data[31U + (4U * i)], Sample->Gyr[i], 4);
+    Serialize_s32(&msg.Data[43U + (4U * i)], Sample->Mag[i], 4);
+  }
+
+  /* Sensor fusion outputs, floats of similar magnitude */
+  for (i = 55; i < 115U; i += 4U)
+  {
+    FloatToArray(&msg.Data[i], (float)Sample->Acc[i % 3U] * 0.001f);
+  }
+
+  msg.Len = STREAMING_MSG_LENGTH;
+  CHK_ComputeAndAdd(&msg);
+
+  return (uint32_t)ByteStuffCopy(Wire, &msg);
+}
+
+/**
+  * @brief  Frame, unframe and check the pending batched frame, then start a new one
+  * @param  Batch pointer to the encoder
+  * @param  Msg pointer to the frame
+  * @param  Ref pointer to the encoded samples
+  * @retval None
+  */
+static void Send_Frame(Batch_t *Batch, Msg_t *Msg, const Batch_Sample_t *Ref)
+{
+  uint32_t count = Batch->Count;
+
+  if (count != 0U)
+  {
+    Msg->Data[0] = 1;
+    Msg->Data[1] = 50;
+    Msg->Data[2] = 0x17;
+    CHK_ComputeAndAdd(Msg);
+    BatchBytes += (uint32_t)ByteStuffCopy(Wire, Msg);
+    Frames++;
+
+    if ((ReverseByteStuffCopy(Msg, Wire) == 0) || (CHK_CheckAndRemove(Msg) == 0)
+        || (Check_Frame(Msg, Ref, Decoded_Samples, Batch->Content) != (int32_t)count))
+    {
+      Errors++;
+    }
+
+    Decoded_Samples += count;
+  }
+
+  Batch_Init(Batch, Batch->Content, Batch->Flags, Batch->MaxSamples);
+}
+
+/**
+  * @brief  Decode a batched frame and compare it with the encoded samples
+  * @param  Msg pointer to the frame, integrity trailer removed
+  * @param  Ref pointer to the encoded samples
+  * @param  First index of the first sample of the frame
+  * @param  Content sensors in the frame
+  * @retval Number of matching samples, -1 if the frame is malformed
+  */
+static int32_t Check_Frame(Msg_t *Msg, const Batch_Sample_t *Ref, uint32_t First, uint8_t Content)
+{
+  int32_t count = Batch_Decode(Msg, Decoded, BENCH_MAX_BATCH);
+  int32_t i;
+
+  if (count < 0)
+  {
+    return -1;
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    const Batch_Sample_t *ref = &Ref[First + (uint32_t)i];
+
+    if ((Decoded[i].TimeUs != ref->TimeUs) || (memcmp(Decoded[i].Acc, ref->Acc, sizeof(ref->Acc)) != 0)
+        || (memcmp(Decoded[i].Gyr, ref->Gyr, sizeof(ref->Gyr)) != 0) || (memcmp(Decoded[i].Mag, ref->Mag, sizeof(ref->Mag)) != 0)
+        || (((Content & BATCH_PRESS) != 0U) && (Decoded[i].Press != ref->Press))
+        || (((Content & BATCH_TEMP) != 0U) && (Decoded[i].Temp != ref->Temp))
+        || (((Content & BATCH_HUM) != 0U) && (Decoded[i].Hum != ref->Hum)))
+    {
+      return i;
+    }
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Monotonic time
+  * @param  None
+  * @retval Time [s]
+  */
+static double Now_s(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
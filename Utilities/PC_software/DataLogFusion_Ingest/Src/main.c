@@ -0,0 +1,1168 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host ingestion of the DataLogFusion streaming protocol: frames are
+  *          read from a serial device or a capture file, un-framed, checked,
+  *          decoded and written to CSV or columnar binary files
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <math.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <termios.h>
+#include "serial_protocol.h"
+#include "stream_layout.h"
+#include "batch_stream.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define INGEST_READ_SIZE        (1U << 20)  /* Input read block [bytes] */
+#define INGEST_COL_BUF_SIZE     (1U << 16)  /* Columnar output buffer per column [bytes] */
+#define INGEST_BAUD_DEFAULT     921600U
+#define INGEST_BITS_PER_BYTE    10U         /* 8N1 */
+#define INGEST_GAP_RATIO        1.5         /* A time step above 1.5 periods is a gap */
+#define INGEST_MAX_BATCH        255U
+
+/* Protocol, as in serial_cmd.h and demo_serial.h of the DataLogFusion application */
+#define CMD_START_DATA_STREAMING   0x08U
+#define CMD_BATCH_DATA_STREAMING   0x17U
+#define CMD_SET_STREAM_LAYOUT      0x18U
+#define CMD_GET_STREAM_LAYOUT      0x19U
+#define CMD_LAYOUT_DATA_STREAMING  0x1AU
+#define CMD_REPLY_ADD              0x80U
+#define DEV_ADDR                   50U
+
+/* Un-framing states, as in com.c */
+#define RX_STATE_IDLE    0U
+#define RX_STATE_DATA    1U
+#define RX_STATE_ESCAPE  2U
+#define RX_STATE_SKIP    3U
+
+/* Frame sources, the "source" column */
+#define SOURCE_FIXED   0U
+#define SOURCE_LAYOUT  1U
+#define SOURCE_BATCH   2U
+
+/* Time bases of the gap detection: time of day for the streaming frames, uptime for the batches */
+#define CLOCK_STREAM  0U
+#define CLOCK_BATCH   1U
+
+/* Column types */
+#define COL_U32  0U
+#define COL_I32  1U
+#define COL_F32  2U
+#define COL_F64  3U
+
+/* Synthetic capture */
+#define GEN_DROP_EVERY     997U  /* One frame out of GEN_DROP_EVERY is not written */
+#define GEN_CORRUPT_EVERY  1009U /* One frame out of GEN_CORRUPT_EVERY has a flipped bit */
+#define GEN_BATCH_ODR      416.0 /* [Hz] */
+#define TWO_PI             6.283185307179586
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Decoded row
+  */
+typedef struct
+{
+  uint32_t Source;         /* SOURCE_x */
+  uint32_t Fields;         /* Valid fields (STREAM_FIELD_x) */
+  double TimeS;            /* Time of day of the streaming frames, uptime of the batches [s] */
+  Stream_Sample_t Sample;
+} Row_t;
+
+/**
+  * @brief  Output column
+  */
+typedef struct
+{
+  const char *Name;
+  uint8_t Type;      /* COL_x */
+  uint32_t Field;    /* STREAM_FIELD_x providing the column, 0 if always valid */
+  size_t Offset;     /* In Row_t */
+} Column_t;
+
+/**
+  * @brief  Streaming un-framer, same state machine as Rx_Parse_Byte in com.c
+  */
+typedef struct
+{
+  uint8_t Cobs;
+  uint8_t State;
+  uint8_t CobsCode;
+  uint8_t CobsLeft;
+  Msg_t Msg;
+} Parser_t;
+
+/**
+  * @brief  Ingestion counters
+  */
+typedef struct
+{
+  uint64_t Bytes;
+  uint64_t Frames;          /* Frames passing the integrity check */
+  uint64_t Rows;
+  uint64_t ChecksumErrors;
+  uint64_t FramingErrors;   /* Bad escape, bad COBS block or oversize frame */
+  uint64_t DecodeErrors;    /* Frame length not matching its layout */
+  uint64_t OtherFrames;     /* Command replies and unknown frames */
+  uint64_t Gaps;            /* Time steps above INGEST_GAP_RATIO periods */
+  uint64_t Missing;         /* Samples estimated lost in the gaps */
+  uint64_t TimeResets;      /* Time steps <= 0, wrap around excluded */
+} Stats_t;
+
+/**
+  * @brief  Gap detection of one time base
+  */
+typedef struct
+{
+  double Last;
+  double Period;      /* Nominal period [s], the smallest step seen if not given */
+  double Wrap;        /* Wrap around of the time base [s] */
+  uint8_t Fixed;      /* 1 if Period is given on the command line */
+  uint8_t Valid;
+} Clock_t;
+
+/* Private macro -------------------------------------------------------------*/
+#define SAMPLE_OFFSET(m)  (offsetof(Row_t, Sample) + offsetof(Stream_Sample_t, m))
+
+/* Private variables ---------------------------------------------------------*/
+static const Column_t Columns[] =
+{
+  {"source",      COL_U32, 0U,                        offsetof(Row_t, Source)},
+  {"fields",      COL_U32, 0U,                        offsetof(Row_t, Fields)},
+  {"time_s",      COL_F64, STREAM_FIELD_TIME,         offsetof(Row_t, TimeS)},
+  {"press",       COL_F32, STREAM_FIELD_PRESS,        SAMPLE_OFFSET(Press)},
+  {"temp",        COL_F32, STREAM_FIELD_TEMP,         SAMPLE_OFFSET(Temp)},
+  {"hum",         COL_F32, STREAM_FIELD_HUM,          SAMPLE_OFFSET(Hum)},
+  {"acc_x",       COL_I32, STREAM_FIELD_ACC,          SAMPLE_OFFSET(Acc[0])},
+  {"acc_y",       COL_I32, STREAM_FIELD_ACC,          SAMPLE_OFFSET(Acc[1])},
+  {"acc_z",       COL_I32, STREAM_FIELD_ACC,          SAMPLE_OFFSET(Acc[2])},
+  {"gyr_x",       COL_I32, STREAM_FIELD_GYR,          SAMPLE_OFFSET(Gyr[0])},
+  {"gyr_y",       COL_I32, STREAM_FIELD_GYR,          SAMPLE_OFFSET(Gyr[1])},
+  {"gyr_z",       COL_I32, STREAM_FIELD_GYR,          SAMPLE_OFFSET(Gyr[2])},
+  {"mag_x",       COL_I32, STREAM_FIELD_MAG,          SAMPLE_OFFSET(Mag[0])},
+  {"mag_y",       COL_I32, STREAM_FIELD_MAG,          SAMPLE_OFFSET(Mag[1])},
+  {"mag_z",       COL_I32, STREAM_FIELD_MAG,          SAMPLE_OFFSET(Mag[2])},
+  {"quat_x",      COL_F32, STREAM_FIELD_QUATERNION,   SAMPLE_OFFSET(Quaternion[0])},
+  {"quat_y",      COL_F32, STREAM_FIELD_QUATERNION,   SAMPLE_OFFSET(Quaternion[1])},
+  {"quat_z",      COL_F32, STREAM_FIELD_QUATERNION,   SAMPLE_OFFSET(Quaternion[2])},
+  {"quat_w",      COL_F32, STREAM_FIELD_QUATERNION,   SAMPLE_OFFSET(Quaternion[3])},
+  {"yaw",         COL_F32, STREAM_FIELD_ROTATION,     SAMPLE_OFFSET(Rotation[0])},
+  {"pitch",       COL_F32, STREAM_FIELD_ROTATION,     SAMPLE_OFFSET(Rotation[1])},
+  {"roll",        COL_F32, STREAM_FIELD_ROTATION,     SAMPLE_OFFSET(Rotation[2])},
+  {"grav_x",      COL_F32, STREAM_FIELD_GRAVITY,      SAMPLE_OFFSET(Gravity[0])},
+  {"grav_y",      COL_F32, STREAM_FIELD_GRAVITY,      SAMPLE_OFFSET(Gravity[1])},
+  {"grav_z",      COL_F32, STREAM_FIELD_GRAVITY,      SAMPLE_OFFSET(Gravity[2])},
+  {"lin_acc_x",   COL_F32, STREAM_FIELD_LINEAR_ACC,   SAMPLE_OFFSET(LinearAcc[0])},
+  {"lin_acc_y",   COL_F32, STREAM_FIELD_LINEAR_ACC,   SAMPLE_OFFSET(LinearAcc[1])},
+  {"lin_acc_z",   COL_F32, STREAM_FIELD_LINEAR_ACC,   SAMPLE_OFFSET(LinearAcc[2])},
+  {"heading",     COL_F32, STREAM_FIELD_HEADING,      SAMPLE_OFFSET(Heading)},
+  {"heading_err", COL_F32, STREAM_FIELD_HEADING_ERR,  SAMPLE_OFFSET(HeadingErr)},
+  {"fx_time_us",  COL_U32, STREAM_FIELD_ELAPSED,      SAMPLE_OFFSET(ElapsedUs)},
+};
+
+#define COLUMN_COUNT  (sizeof(Columns) / sizeof(Columns[0]))
+
+static const char *const ColumnTypeName[] = {"u32", "i32", "f32", "f64"};
+static const size_t ColumnTypeSize[] = {4, 4, 4, 8};
+
+static Parser_t Parser;
+static Stats_t Stats;
+static Clock_t Clocks[2] =
+{
+  {0.0, 0.0, 86400.0, 0U, 0U},      /* Time of day */
+  {0.0, 0.0, 4294.967296, 0U, 0U},  /* Get_Time_us of app_mems.c */
+};
+static uint8_t UseCrc32 = 0;
+static uint32_t LayoutFields = STREAM_FIELD_ALL;
+static FILE *CsvFile = NULL;
+static FILE *ColFile[COLUMN_COUNT];
+static uint8_t *ColBuf[COLUMN_COUNT];
+static size_t ColLen[COLUMN_COUNT];
+static Batch_Sample_t BatchSamples[INGEST_MAX_BATCH];
+static volatile sig_atomic_t StopRequest = 0;
+static uint32_t RandState = 0x2545F491U;
+static uint32_t GenPhaseLen = 1;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static void On_Signal(int Signal);
+static double Now_s(void);
+static int Open_Input(const char *Path, uint32_t Baud, uint8_t *IsTty);
+static int Open_Outputs(const char *CsvPath, const char *BinPrefix);
+static void Close_Outputs(void);
+static void Parse_Block(const uint8_t *Data, size_t Len);
+static int32_t Parse_Byte(uint8_t Data);
+static int32_t Check_Integrity(Msg_t *Msg);
+static void Handle_Frame(Msg_t *Msg);
+static void Handle_Row(Row_t *Row, uint32_t Clock);
+static void Write_Row(const Row_t *Row);
+static void Col_Put(uint32_t Col, const void *Value);
+static void Print_Stats(FILE *Out, double Elapsed, uint32_t Baud);
+static int Generate(const char *Path, uint32_t Frames, uint8_t Cobs);
+static uint32_t Gen_Frame(Msg_t *Msg, uint8_t *Wire, uint8_t Cobs);
+static uint32_t Rand_Next(void);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Ingester entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 on success, 1 on error
+  */
+int main(int argc, char *argv[])
+{
+  static uint8_t block[INGEST_READ_SIZE];
+  const char *input = NULL;
+  const char *csv_path = NULL;
+  const char *bin_prefix = NULL;
+  uint32_t baud = INGEST_BAUD_DEFAULT;
+  uint32_t gen_frames = 0;
+  double period = 0.0;
+  double t0;
+  double t_report;
+  double elapsed;
+  ssize_t n;
+  uint8_t is_tty = 0;
+  int fd;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "i:o:b:B:f:k:l:p:g:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'i':
+        input = optarg;
+        break;
+      case 'o':
+        csv_path = optarg;
+        break;
+      case 'b':
+        bin_prefix = optarg;
+        break;
+      case 'B':
+        baud = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'f':
+        Parser.Cobs = (strcmp(optarg, "cobs") == 0) ? 1U : 0U;
+        break;
+      case 'k':
+        UseCrc32 = (strcmp(optarg, "crc32") == 0) ? 1U : 0U;
+        break;
+      case 'l':
+        LayoutFields = (uint32_t)strtoul(optarg, NULL, 0) & (STREAM_FIELD_ALL | STREAM_LAYOUT_COMPACT);
+        break;
+      case 'p':
+        period = atof(optarg) * 1e-6;
+        break;
+      case 'g':
+        gen_frames = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        Usage();
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+
+  if (input == NULL)
+  {
+    Usage();
+    return 1;
+  }
+
+  if ((gen_frames != 0U) && (Generate(input, gen_frames, Parser.Cobs) != 0))
+  {
+    return 1;
+  }
+
+  if (period > 0.0)
+  {
+    Clocks[CLOCK_STREAM].Period = period;
+    Clocks[CLOCK_STREAM].Fixed = 1;
+    Clocks[CLOCK_BATCH].Period = period;
+    Clocks[CLOCK_BATCH].Fixed = 1;
+  }
+
+  fd = Open_Input(input, baud, &is_tty);
+
+  if ((fd < 0) || (Open_Outputs(csv_path, bin_prefix) != 0))
+  {
+    return 1;
+  }
+
+  (void)signal(SIGINT, On_Signal);
+  (void)signal(SIGTERM, On_Signal);
+
+  t0 = Now_s();
+  t_report = t0 + 1.0;
+
+  while (StopRequest == 0)
+  {
+    n = read(fd, block, sizeof(block));
+
+    if (n < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+
+      perror("read");
+      break;
+    }
+
+    if (n == 0)
+    {
+      if (is_tty != 0U)
+      {
+        continue;
+      }
+
+      break;
+    }
+
+    Stats.Bytes += (uint64_t)n;
+    Parse_Block(block, (size_t)n);
+
+    /* Live statistics when capturing from the board */
+    if ((is_tty != 0U) && (Now_s() >= t_report))
+    {
+      Print_Stats(stderr, Now_s() - t0, baud);
+      t_report += 1.0;
+    }
+  }
+
+  elapsed = Now_s() - t0;
+  Close_Outputs();
+  (void)close(fd);
+  Print_Stats(stdout, elapsed, baud);
+
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line help
+  * @param  None
+  * @retval None
+  */
+static void Usage(void)
+{
+  (void)fprintf(stderr,
+                "usage: datalog_ingest -i <serial device | capture file | -> [options]\n"
+                "  -o <file.csv>      CSV output\n"
+                "  -b <prefix>        columnar binary output, one <prefix>_<column>.bin file per column\n"
+                "  -B <baud>          serial device baud rate (default %u)\n"
+                "  -f stuffing|cobs   framing, as set by CMD_Set_Framing (default stuffing)\n"
+                "  -k chk8|crc32      integrity trailer, as set by CMD_Set_Integrity (default chk8)\n"
+                "  -l <fields>        layout of the CMD_Layout_Data_Streaming frames until a layout\n"
+                "                     descriptor reply is seen (STREAM_FIELD_x | STREAM_LAYOUT_COMPACT)\n"
+                "  -p <period us>     nominal sample period for the gap detection (default: smallest step)\n"
+                "  -g <frames>        write a synthetic capture of <frames> frames to the -i file first\n",
+                INGEST_BAUD_DEFAULT);
+}
+
+/**
+  * @brief  SIGINT/SIGTERM handler, the outputs are flushed before exiting
+  * @param  Signal the signal
+  * @retval None
+  */
+static void On_Signal(int Signal)
+{
+  (void)Signal;
+  StopRequest = 1;
+}
+
+/**
+  * @brief  Monotonic time
+  * @param  None
+  * @retval Time [s]
+  */
+static double Now_s(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/**
+  * @brief  Open the input, a serial device is set in raw mode at the given baud rate
+  * @param  Path device or file path, "-" for the standard input
+  * @param  Baud baud rate
+  * @param  IsTty set to 1 if the input is a serial device
+  * @retval File descriptor, -1 on error
+  */
+static int Open_Input(const char *Path, uint32_t Baud, uint8_t *IsTty)
+{
+  struct termios tio;
+  speed_t speed;
+  int fd;
+
+  if (strcmp(Path, "-") == 0)
+  {
+    return STDIN_FILENO;
+  }
+
+  fd = open(Path, O_RDONLY | O_NOCTTY);
+
+  if (fd < 0)
+  {
+    perror(Path);
+    return -1;
+  }
+
+  if (isatty(fd) == 0)
+  {
+    return fd;
+  }
+
+  switch (Baud)
+  {
+    case 115200U:
+      speed = B115200;
+      break;
+    case 230400U:
+      speed = B230400;
+      break;
+    case 460800U:
+      speed = B460800;
+      break;
+    case 921600U:
+      speed = B921600;
+      break;
+    case 2000000U:
+      speed = B2000000;
+      break;
+    default:
+      (void)fprintf(stderr, "unsupported baud rate %u\n", Baud);
+      (void)close(fd);
+      return -1;
+  }
+
+  if (tcgetattr(fd, &tio) != 0)
+  {
+    perror("tcgetattr");
+    (void)close(fd);
+    return -1;
+  }
+
+  cfmakeraw(&tio);
+  (void)cfsetispeed(&tio, speed);
+  (void)cfsetospeed(&tio, speed);
+  tio.c_cflag |= (tcflag_t)(CLOCAL | CREAD);
+  tio.c_cc[VMIN] = 1;
+  tio.c_cc[VTIME] = 0;
+
+  if (tcsetattr(fd, TCSANOW, &tio) != 0)
+  {
+    perror("tcsetattr");
+    (void)close(fd);
+    return -1;
+  }
+
+  (void)tcflush(fd, TCIFLUSH);
+  *IsTty = 1;
+
+  return fd;
+}
+
+/**
+  * @brief  Open the CSV file and the column files
+  * @param  CsvPath CSV file path, NULL if not requested
+  * @param  BinPrefix column files prefix, NULL if not requested
+  * @retval 0 on success, -1 on error
+  */
+static int Open_Outputs(const char *CsvPath, const char *BinPrefix)
+{
+  char path[4096];
+  FILE *schema;
+  uint32_t i;
+
+  if (CsvPath != NULL)
+  {
+    CsvFile = fopen(CsvPath, "w");
+
+    if (CsvFile == NULL)
+    {
+      perror(CsvPath);
+      return -1;
+    }
+
+    (void)setvbuf(CsvFile, NULL, _IOFBF, INGEST_READ_SIZE);
+
+    for (i = 0; i < COLUMN_COUNT; i++)
+    {
+      (void)fprintf(CsvFile, "%s%c", Columns[i].Name, (i < (COLUMN_COUNT - 1U)) ? ',' : '\n');
+    }
+  }
+
+  if (BinPrefix == NULL)
+  {
+    return 0;
+  }
+
+  (void)snprintf(path, sizeof(path), "%s_schema.txt", BinPrefix);
+  schema = fopen(path, "w");
+
+  if (schema == NULL)
+  {
+    perror(path);
+    return -1;
+  }
+
+  (void)fprintf(schema, "# column type, little endian, one value per row; invalid fields are 0, see the fields column\n");
+
+  for (i = 0; i < COLUMN_COUNT; i++)
+  {
+    (void)fprintf(schema, "%s %s\n", Columns[i].Name, ColumnTypeName[Columns[i].Type]);
+    (void)snprintf(path, sizeof(path), "%s_%s.bin", BinPrefix, Columns[i].Name);
+    ColFile[i] = fopen(path, "wb");
+    ColBuf[i] = malloc(INGEST_COL_BUF_SIZE);
+
+    if ((ColFile[i] == NULL) || (ColBuf[i] == NULL))
+    {
+      perror(path);
+      (void)fclose(schema);
+      return -1;
+    }
+  }
+
+  (void)fclose(schema);
+
+  return 0;
+}
+
+/**
+  * @brief  Flush and close the outputs
+  * @param  None
+  * @retval None
+  */
+static void Close_Outputs(void)
+{
+  uint32_t i;
+
+  if (CsvFile != NULL)
+  {
+    (void)fclose(CsvFile);
+  }
+
+  for (i = 0; i < COLUMN_COUNT; i++)
+  {
+    if (ColFile[i] != NULL)
+    {
+      (void)fwrite(ColBuf[i], 1, ColLen[i], ColFile[i]);
+      (void)fclose(ColFile[i]);
+      free(ColBuf[i]);
+    }
+  }
+}
+
+/**
+  * @brief  Un-frame a block of received bytes and handle the complete frames
+  * @param  Data pointer to the bytes
+  * @param  Len number of bytes
+  * @retval None
+  */
+static void Parse_Block(const uint8_t *Data, size_t Len)
+{
+  size_t i;
+
+  for (i = 0; i < Len; i++)
+  {
+    if (Parse_Byte(Data[i]) != 0)
+    {
+      if (Check_Integrity(&Parser.Msg) != 0)
+      {
+        Stats.Frames++;
+        Handle_Frame(&Parser.Msg);
+      }
+      else
+      {
+        Stats.ChecksumErrors++;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Un-frame one byte
+  * @param  Data the byte
+  * @retval 1 if Parser.Msg holds a complete frame, 0 otherwise
+  */
+static int32_t Parse_Byte(uint8_t Data)
+{
+  uint8_t eof = (Parser.Cobs != 0U) ? (uint8_t)Msg_COBS_EOF : (uint8_t)Msg_EOF;
+  int32_t append = 1;
+
+  if (Data == eof)
+  {
+    append = ((Parser.State == RX_STATE_DATA) && (Parser.CobsLeft == 0U)) ? 1 : 0;
+
+    /* Truncated escape sequence or COBS block */
+    if ((append == 0) && (Parser.State != RX_STATE_IDLE) && (Parser.State != RX_STATE_SKIP))
+    {
+      Stats.FramingErrors++;
+    }
+
+    Parser.State = RX_STATE_IDLE;
+    Parser.CobsCode = 0;
+    Parser.CobsLeft = 0;
+    return append;
+  }
+
+  if (Parser.State == RX_STATE_SKIP)
+  {
+    return 0;
+  }
+
+  if (Parser.State == RX_STATE_IDLE)
+  {
+    Parser.State = RX_STATE_DATA;
+    Parser.Msg.Len = 0;
+  }
+
+  if (Parser.Cobs != 0U)
+  {
+    if (Parser.CobsLeft == 0U)
+    {
+      append = ((Parser.CobsCode != 0U) && (Parser.CobsCode != COBS_MAX_CODE)) ? 1 : 0;
+      Parser.CobsCode = Data;
+      Parser.CobsLeft = Data - 1U;
+      Data = Msg_COBS_EOF;
+    }
+    else
+    {
+      Parser.CobsLeft--;
+    }
+  }
+  else if (Parser.State == RX_STATE_ESCAPE)
+  {
+    Parser.State = RX_STATE_DATA;
+
+    if (Data == (uint8_t)Msg_BS_EOF)
+    {
+      Data = Msg_EOF;
+    }
+    else if (Data != (uint8_t)Msg_BS)
+    {
+      Parser.State = RX_STATE_SKIP;
+      Stats.FramingErrors++;
+      return 0;
+    }
+  }
+  else if (Data == (uint8_t)Msg_BS)
+  {
+    Parser.State = RX_STATE_ESCAPE;
+    append = 0;
+  }
+
+  if (append != 0)
+  {
+    if (Parser.Msg.Len >= (uint32_t)Msg_MaxLen)
+    {
+      Parser.State = RX_STATE_SKIP;
+      Stats.FramingErrors++;
+      return 0;
+    }
+
+    Parser.Msg.Data[Parser.Msg.Len] = Data;
+    Parser.Msg.Len++;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Check and remove the integrity trailer
+  * @param  Msg pointer to the frame
+  * @retval 1 if the frame is valid, 0 otherwise
+  */
+static int32_t Check_Integrity(Msg_t *Msg)
+{
+  uint32_t len;
+
+  if (UseCrc32 != 0U)
+  {
+    if (Msg->Len < CRC32_LEN)
+    {
+      return 0;
+    }
+
+    len = Msg->Len - CRC32_LEN;
+    Msg->Len = len;
+    return (CRC32_Update(CRC32_INIT, Msg->Data, len) == Deserialize(&Msg->Data[len], CRC32_LEN)) ? 1 : 0;
+  }
+
+  if (Msg->Len == 0U)
+  {
+    return 0;
+  }
+
+  return (CHK_CheckAndRemove(Msg) != 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Decode a valid frame into rows
+  * @param  Msg pointer to the frame, integrity trailer removed
+  * @retval None
+  */
+static void Handle_Frame(Msg_t *Msg)
+{
+  Row_t row;
+  int32_t count;
+  int32_t i;
+  uint32_t cmd = (Msg->Len >= 3U) ? Msg->Data[2] : 0U;
+
+  switch (cmd)
+  {
+    case CMD_START_DATA_STREAMING:
+    case CMD_LAYOUT_DATA_STREAMING:
+      row.Source = (cmd == CMD_START_DATA_STREAMING) ? SOURCE_FIXED : SOURCE_LAYOUT;
+      row.Fields = (cmd == CMD_START_DATA_STREAMING) ? STREAM_FIELD_ALL : LayoutFields;
+
+      if (Stream_Layout_Decode(row.Fields, Msg, &row.Sample) != 0)
+      {
+        Stats.DecodeErrors++;
+        break;
+      }
+
+      row.Fields &= STREAM_FIELD_ALL;
+      row.TimeS = (3600.0 * row.Sample.Time[0]) + (60.0 * row.Sample.Time[1]) + row.Sample.Time[2]
+                  + (0.01 * row.Sample.Time[3]);
+      Handle_Row(&row, CLOCK_STREAM);
+      break;
+
+    case CMD_BATCH_DATA_STREAMING:
+      count = Batch_Decode(Msg, BatchSamples, INGEST_MAX_BATCH);
+
+      if (count < 0)
+      {
+        Stats.DecodeErrors++;
+        break;
+      }
+
+      for (i = 0; i < count; i++)
+      {
+        (void)memset(&row, 0, sizeof(row));
+        row.Source = SOURCE_BATCH;
+        /* Batch content bits are the SensorsEnabled bits: PRESS/TEMP/HUM one bit up, axes as they are */
+        row.Fields = STREAM_FIELD_TIME | ((uint32_t)(Msg->Data[BATCH_HEADER_OFFSET + 4U] & 0x07U) << 1)
+                     | (Msg->Data[BATCH_HEADER_OFFSET + 4U] & 0x70U);
+        row.TimeS = (double)BatchSamples[i].TimeUs * 1e-6;
+        row.Sample.Press = BatchSamples[i].Press;
+        row.Sample.Temp = BatchSamples[i].Temp;
+        row.Sample.Hum = BatchSamples[i].Hum;
+        (void)memcpy(row.Sample.Acc, BatchSamples[i].Acc, sizeof(row.Sample.Acc));
+        (void)memcpy(row.Sample.Gyr, BatchSamples[i].Gyr, sizeof(row.Sample.Gyr));
+        (void)memcpy(row.Sample.Mag, BatchSamples[i].Mag, sizeof(row.Sample.Mag));
+        Handle_Row(&row, CLOCK_BATCH);
+      }
+      break;
+
+    case CMD_SET_STREAM_LAYOUT + CMD_REPLY_ADD:
+    case CMD_GET_STREAM_LAYOUT + CMD_REPLY_ADD:
+      /* Layout descriptor: the next CMD_Layout_Data_Streaming frames follow it */
+      if (Msg->Len >= (3U + STREAM_LAYOUT_DESC_HEADER_LEN))
+      {
+        LayoutFields = Deserialize(&Msg->Data[3], 4) & (STREAM_FIELD_ALL | STREAM_LAYOUT_COMPACT);
+      }
+
+      Stats.OtherFrames++;
+      break;
+
+    default:
+      Stats.OtherFrames++;
+      break;
+  }
+}
+
+/**
+  * @brief  Update the gap detection and write a row
+  * @param  Row pointer to the row
+  * @param  Clock time base of the row
+  * @retval None
+  */
+static void Handle_Row(Row_t *Row, uint32_t Clock)
+{
+  Clock_t *clk = &Clocks[Clock];
+  double step;
+
+  if ((Row->Fields & STREAM_FIELD_TIME) == 0U)
+  {
+    Row->TimeS = 0.0;
+  }
+  else if (clk->Valid == 0U)
+  {
+    clk->Last = Row->TimeS;
+    clk->Valid = 1;
+  }
+  else
+  {
+    step = Row->TimeS - clk->Last;
+    clk->Last = Row->TimeS;
+
+    if (step < -(0.5 * clk->Wrap))
+    {
+      step += clk->Wrap;
+    }
+
+    if (step <= 0.0)
+    {
+      Stats.TimeResets++;
+    }
+    else if (clk->Period <= 0.0)
+    {
+      clk->Period = step;
+    }
+    else if (step > (INGEST_GAP_RATIO * clk->Period))
+    {
+      Stats.Gaps++;
+      Stats.Missing += (uint64_t)llround(step / clk->Period) - 1U;
+    }
+    else if ((clk->Fixed == 0U) && (step < clk->Period))
+    {
+      clk->Period = step;
+    }
+    else
+    {
+      /* Regular step */
+    }
+  }
+
+  Stats.Rows++;
+  Write_Row(Row);
+}
+
+/**
+  * @brief  Write a row to the CSV file and to the column files
+  * @param  Row pointer to the row
+  * @retval None
+  */
+static void Write_Row(const Row_t *Row)
+{
+  const uint8_t *base = (const uint8_t *)Row;
+  const void *value;
+  uint32_t u32;
+  int32_t i32;
+  float f32;
+  double f64;
+  uint32_t i;
+
+  if ((CsvFile == NULL) && (ColFile[0] == NULL))
+  {
+    return;
+  }
+
+  for (i = 0; i < COLUMN_COUNT; i++)
+  {
+    value = &base[Columns[i].Offset];
+
+    if (ColFile[0] != NULL)
+    {
+      Col_Put(i, value);
+    }
+
+    if (CsvFile == NULL)
+    {
+      continue;
+    }
+
+    /* Fields not in the frame are left empty */
+    if ((Columns[i].Field == 0U) || ((Row->Fields & Columns[i].Field) != 0U))
+    {
+      switch (Columns[i].Type)
+      {
+        case COL_U32:
+          (void)memcpy(&u32, value, sizeof(u32));
+          (void)fprintf(CsvFile, "%u", u32);
+          break;
+        case COL_I32:
+          (void)memcpy(&i32, value, sizeof(i32));
+          (void)fprintf(CsvFile, "%d", i32);
+          break;
+        case COL_F32:
+          (void)memcpy(&f32, value, sizeof(f32));
+          (void)fprintf(CsvFile, "%.9g", (double)f32);
+          break;
+        default:
+          (void)memcpy(&f64, value, sizeof(f64));
+          (void)fprintf(CsvFile, "%.6f", f64);
+          break;
+      }
+    }
+
+    (void)fputc((i < (COLUMN_COUNT - 1U)) ? ',' : '\n', CsvFile);
+  }
+}
+
+/**
+  * @brief  Append a value to a column file
+  * @param  Col column index
+  * @param  Value pointer to the value
+  * @retval None
+  */
+static void Col_Put(uint32_t Col, const void *Value)
+{
+  size_t size = ColumnTypeSize[Columns[Col].Type];
+
+  if ((ColLen[Col] + size) > INGEST_COL_BUF_SIZE)
+  {
+    (void)fwrite(ColBuf[Col], 1, ColLen[Col], ColFile[Col]);
+    ColLen[Col] = 0;
+  }
+
+  (void)memcpy(&ColBuf[Col][ColLen[Col]], Value, size);
+  ColLen[Col] += size;
+}
+
+/**
+  * @brief  Print the counters and the throughput
+  * @param  Out output stream
+  * @param  Elapsed ingestion time [s]
+  * @param  Baud link baud rate, for the comparison
+  * @retval None
+  */
+static void Print_Stats(FILE *Out, double Elapsed, uint32_t Baud)
+{
+  double link = (double)Baud / INGEST_BITS_PER_BYTE;
+  double rate = (Elapsed > 0.0) ? ((double)Stats.Bytes / Elapsed) : 0.0;
+
+  (void)fprintf(Out, "%llu bytes, %llu frames, %llu rows | checksum errors %llu, framing errors %llu, decode errors %llu, "
+                "other frames %llu | gaps %llu (~%llu samples missing), time resets %llu\n",
+                (unsigned long long)Stats.Bytes, (unsigned long long)Stats.Frames, (unsigned long long)Stats.Rows,
+                (unsigned long long)Stats.ChecksumErrors, (unsigned long long)Stats.FramingErrors,
+                (unsigned long long)Stats.DecodeErrors, (unsigned long long)Stats.OtherFrames,
+                (unsigned long long)Stats.Gaps, (unsigned long long)Stats.Missing, (unsigned long long)Stats.TimeResets);
+  (void)fprintf(Out, "%.3f s, %.1f MB/s, %.0f frames/s, %.0f rows/s, %.0fx the %u baud link\n",
+                Elapsed, rate * 1e-6, (Elapsed > 0.0) ? ((double)Stats.Frames / Elapsed) : 0.0,
+                (Elapsed > 0.0) ? ((double)Stats.Rows / Elapsed) : 0.0, rate / link, Baud);
+}
+
+/**
+  * @brief  Write a synthetic capture: fixed frames, a layout descriptor, compact layout frames
+  *         and batched frames, in thirds, with dropped and corrupted frames
+  * @param  Path capture file path
+  * @param  Frames number of frames
+  * @param  Cobs 1 for COBS framing, 0 for byte stuffing
+  * @retval 0 on success, -1 on error
+  */
+static int Generate(const char *Path, uint32_t Frames, uint8_t Cobs)
+{
+  static uint8_t wire[2U * Msg_MaxLen + 1U];
+  FILE *out = fopen(Path, "wb");
+  Msg_t msg;
+  uint32_t dropped = 0;
+  uint32_t corrupted = 0;
+  uint32_t len;
+  uint32_t i;
+
+  if (out == NULL)
+  {
+    perror(Path);
+    return -1;
+  }
+
+  (void)setvbuf(out, NULL, _IOFBF, INGEST_READ_SIZE);
+  GenPhaseLen = (Frames / 3U) + 1U;
+
+  for (i = 0; i < Frames; i++)
+  {
+    len = Gen_Frame(&msg, wire, Cobs);
+
+    /* The layout descriptor is always delivered */
+    if ((msg.Data[2] & CMD_REPLY_ADD) != 0U)
+    {
+      (void)fwrite(wire, 1, len, out);
+      continue;
+    }
+
+    if ((i % GEN_DROP_EVERY) == (GEN_DROP_EVERY - 1U))
+    {
+      dropped++;
+      continue;
+    }
+
+    if ((i % GEN_CORRUPT_EVERY) == (GEN_CORRUPT_EVERY - 1U))
+    {
+      /* Any bit but the ones of the delimiter */
+      wire[Rand_Next() % (len - 1U)] ^= (uint8_t)(1U << (Rand_Next() % 8U));
+      corrupted++;
+    }
+
+    (void)fwrite(wire, 1, len, out);
+  }
+
+  (void)fclose(out);
+  (void)printf("synthetic capture %s: %u frames, %u dropped, %u corrupted\n", Path, Frames, dropped, corrupted);
+
+  return 0;
+}
+
+/**
+  * @brief  Next synthetic frame, framed and checksummed as by com.c
+  * @param  Msg pointer to the frame
+  * @param  Wire pointer to the framed bytes
+  * @param  Cobs 1 for COBS framing, 0 for byte stuffing
+  * @retval Number of framed bytes
+  */
+static uint32_t Gen_Frame(Msg_t *Msg, uint8_t *Wire, uint8_t Cobs)
+{
+  static uint32_t index = 0;
+  static uint32_t stream_index = 0;
+  static uint32_t phase = 0;
+  static uint32_t batch_index = 0;
+  static Batch_t batch;
+  static Batch_Sample_t pending;
+  static uint8_t pending_valid = 0;
+  Stream_Sample_t sample;
+  uint8_t data[STREAM_FIELD_MAX_SIZE];
+  uint32_t fields = 0;
+  uint32_t field;
+  uint32_t cs;
+  uint32_t crc;
+  double t;
+
+  Msg->Data[0] = 0x01;
+  Msg->Data[1] = DEV_ADDR;
+
+  if ((phase == 1U) && (index == 0U))
+  {
+    /* Layout descriptor reply, then the compact frames of the 9 axes plus fusion */
+    Msg->Data[2] = (uint8_t)(CMD_GET_STREAM_LAYOUT + CMD_REPLY_ADD);
+    fields = Stream_Layout_Fields(STREAM_LAYOUT_COMPACT | STREAM_FIELD_ALL, 0x70U);
+    Msg->Len = 3U + Stream_Layout_Describe(fields, &Msg->Data[3]);
+    index = 1;
+  }
+  else if (phase < 2U)
+  {
+    t = stream_index * 0.01;
+    cs = stream_index + (12U * 360000U);
+    (void)memset(&sample, 0, sizeof(sample));
+    sample.Time[0] = (uint8_t)(cs / 360000U);
+    sample.Time[1] = (uint8_t)((cs / 6000U) % 60U);
+    sample.Time[2] = (uint8_t)((cs / 100U) % 60U);
+    sample.Time[3] = (uint8_t)(cs % 100U);
+    sample.Press = 1013.25f;
+    sample.Temp = 24.5f;
+    sample.Hum = 41.0f;
+    sample.Acc[0] = (int32_t)(1000.0 * sin(TWO_PI * 0.3 * t));
+    sample.Acc[2] = (int32_t)(1000.0 * cos(TWO_PI * 0.3 * t));
+    sample.Gyr[0] = (int32_t)(Rand_Next() % 2000U);
+    sample.Mag[1] = 250;
+    sample.Quaternion[0] = (float)sin(TWO_PI * 0.15 * t);
+    sample.Quaternion[3] = (float)cos(TWO_PI * 0.15 * t);
+    sample.Rotation[0] = (float)fmod(t * 10.0, 360.0);
+    sample.Gravity[2] = 1.0f;
+    sample.Heading = sample.Rotation[0];
+    sample.ElapsedUs = 180U + (Rand_Next() % 20U);
+
+    fields = (phase == 0U) ? STREAM_FIELD_ALL : Stream_Layout_Fields(STREAM_LAYOUT_COMPACT | STREAM_FIELD_ALL, 0x70U);
+    Msg->Data[2] = (phase == 0U) ? (uint8_t)CMD_START_DATA_STREAMING : (uint8_t)CMD_LAYOUT_DATA_STREAMING;
+    Msg->Len = 3;
+
+    for (field = STREAM_FIELD_TIME; field <= STREAM_FIELD_ALL; field <<= 1)
+    {
+      if ((fields & field) != 0U)
+      {
+        uint32_t size = Stream_Layout_Field(field | (fields & STREAM_LAYOUT_COMPACT), &sample, data);
+        (void)memcpy(&Msg->Data[Msg->Len], data, size);
+        Msg->Len += size;
+      }
+    }
+
+    index++;
+    stream_index++;
+  }
+  else
+  {
+    /* Batched accelerometer and gyroscope frames of up to 255 samples */
+    Batch_Init(&batch, BATCH_ACC | BATCH_GYR, BATCH_FLAG_DELTA, INGEST_MAX_BATCH);
+
+    for (;;)
+    {
+      if (pending_valid == 0U)
+      {
+        t = batch_index / GEN_BATCH_ODR;
+        (void)memset(&pending, 0, sizeof(pending));
+        pending.TimeUs = (uint32_t)(t * 1e6);
+        pending.Acc[0] = (int32_t)(1000.0 * sin(TWO_PI * 0.3 * t));
+        pending.Acc[2] = (int32_t)(1000.0 * cos(TWO_PI * 0.3 * t));
+        pending.Gyr[1] = (int32_t)(Rand_Next() % 4000U) - 2000;
+        batch_index++;
+        pending_valid = 1;
+      }
+
+      if (Batch_AddSample(&batch, Msg, &pending) == 0)
+      {
+        break;
+      }
+
+      pending_valid = 0;
+
+      if (batch.Count >= batch.MaxSamples)
+      {
+        break;
+      }
+    }
+
+    Msg->Data[0] = 0x01;
+    Msg->Data[1] = DEV_ADDR;
+    Msg->Data[2] = (uint8_t)CMD_BATCH_DATA_STREAMING;
+  }
+
+  /* Thirds of the capture: fixed frames, compact layout frames, batched frames */
+  if ((phase < 2U) && (index >= GenPhaseLen))
+  {
+    phase++;
+    index = 0;
+  }
+
+  if (UseCrc32 != 0U)
+  {
+    crc = CRC32_Update(CRC32_INIT, Msg->Data, Msg->Len);
+    Serialize(&Msg->Data[Msg->Len], crc, CRC32_LEN);
+    Msg->Len += CRC32_LEN;
+  }
+  else
+  {
+    CHK_ComputeAndAdd(Msg);
+  }
+
+  return (Cobs != 0U) ? (uint32_t)CobsEncode(Wire, Msg) : (uint32_t)ByteStuffCopy(Wire, Msg);
+}
+
+/**
+  * @brief  Xorshift pseudo random number
+  * @param  None
+  * @retval Random number
+  */
+static uint32_t Rand_Next(void)
+{
+  RandState ^= RandState << 13;
+  RandState ^= RandState >> 17;
+  RandState ^= RandState << 5;
+
+  return RandState;
+}
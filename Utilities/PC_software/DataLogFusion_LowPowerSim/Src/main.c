@@ -0,0 +1,400 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host simulation of the DataLogFusion idle hook: the main loop and
+  *          the firmware idle policy (low_power.c) run on a virtual clock, with
+  *          stubs of the timer, SysTick and UART interrupts, and the tick
+  *          latency, the active and idle times and the wake-ups are reported
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "low_power.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_TICK_US        10000U  /* ALGO_FREQ 100 Hz */
+#define SIM_SYSTICK_US     1000U   /* HAL time base 1 kHz */
+#define SIM_WORK_US        900U    /* Sensor read, Sensor Fusion and frame build per tick */
+#define SIM_FRAME_BYTES    122U    /* STREAMING_MSG_LENGTH frame on the wire */
+#define SIM_BAUD           921600U
+#define SIM_CMD_PERIOD_US  250000U /* Host command, e.g. CMD_Get_Tx_Stats polling */
+#define SIM_CMD_WORK_US    50U
+#define SIM_LOOP_US        2U      /* Main loop iteration without work */
+
+/* Interrupts of the stub */
+#define IRQ_TICK     0x01U /* Algorithm timer */
+#define IRQ_SYSTICK  0x02U /* HAL time base */
+#define IRQ_RX       0x04U /* UART reception idle line */
+#define IRQ_TX_DONE  0x08U /* UART transmission DMA complete */
+#define IRQ_EVENTS   5U
+#define EVENT_TX     3U
+#define EVENT_RACE   4U
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Interrupt stub: next time of each periodic or one-shot interrupt
+  */
+typedef struct
+{
+  uint32_t Irq;      /* IRQ_x */
+  uint64_t NextUs;   /* UINT64_MAX if not armed */
+  uint32_t PeriodUs; /* 0 for a one-shot interrupt */
+} Event_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const WakeName[LP_WAKE_COUNT] = {"timer", "uart", "button", "systick", "other"};
+static uint64_t NowUs = 0;
+static Event_t Events[IRQ_EVENTS] =
+{
+  {IRQ_TICK,    SIM_TICK_US,       SIM_TICK_US},
+  {IRQ_SYSTICK, SIM_SYSTICK_US,    SIM_SYSTICK_US},
+  {IRQ_RX,      SIM_CMD_PERIOD_US, SIM_CMD_PERIOD_US},
+  {IRQ_TX_DONE, UINT64_MAX,        0U},
+  {IRQ_RX,      UINT64_MAX,        0U},                /* Race injection */
+};
+static uint32_t PendingIrq = 0;     /* IRQ_x raised and not served */
+static uint8_t Masked = 0;
+static uint8_t Naive = 0;           /* Pending work checked with the interrupts unmasked */
+static uint32_t RaceEvery = 0;      /* Reception raised right after the pending work check every RaceEvery checks */
+static uint32_t Checks = 0;
+
+/* Main loop flags, as in app_mems.c */
+static uint8_t SensorReadRequest = 0;
+static uint8_t RxEvent = 0;
+static uint64_t TickRaisedUs = 0;
+static uint64_t RxRaisedUs = 0;
+static uint32_t MissedTicks = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static void Advance(uint64_t ToUs);
+static void Raise(uint32_t Irq);
+static void Serve(void);
+static uint32_t Sim_GetTimeUs(void);
+static uint32_t Sim_Pending(void);
+static void Sim_Sleep(void);
+static uint32_t Sim_WakeSources(void);
+static void Sim_Mask(void);
+static void Sim_Unmask(void);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Simulation entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 on success, 1 if a tick is missed or served late
+  */
+int main(int argc, char *argv[])
+{
+  const LP_Ctx_t ctx = {Sim_GetTimeUs, Sim_Pending, Sim_Sleep, Sim_WakeSources, Sim_Mask, Sim_Unmask};
+  LP_Stats_t stats;
+  uint8_t mode = LP_MODE_SLEEP;
+  uint32_t work_us = SIM_WORK_US;
+  uint32_t seconds = 10;
+  uint64_t end_us;
+  uint64_t latency;
+  uint64_t max_latency = 0;
+  uint64_t latency_sum = 0;
+  uint64_t max_rx_latency = 0;
+  uint32_t ticks = 0;
+  uint32_t commands = 0;
+  uint32_t i;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "m:w:s:r:nh")) != -1)
+  {
+    switch (opt)
+    {
+      case 'm':
+        mode = (strcmp(optarg, "run") == 0) ? LP_MODE_RUN : LP_MODE_SLEEP;
+        break;
+      case 'w':
+        work_us = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        seconds = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'r':
+        RaceEvery = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'n':
+        Naive = 1;
+        break;
+      default:
+        Usage();
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+
+  if ((seconds == 0U) || (seconds > 4000U) || (work_us >= SIM_TICK_US))
+  {
+    Usage();
+    return 1;
+  }
+
+  LP_Init(&stats, mode, 0U);
+  end_us = (uint64_t)seconds * 1000000U;
+
+  /* Main loop of MX_DataLogFusion_Process */
+  while (NowUs < end_us)
+  {
+    if (RxEvent != 0U)
+    {
+      RxEvent = 0;
+      latency = NowUs - RxRaisedUs;
+      max_rx_latency = (latency > max_rx_latency) ? latency : max_rx_latency;
+      commands++;
+      Advance(NowUs + SIM_CMD_WORK_US);
+    }
+
+    if (SensorReadRequest != 0U)
+    {
+      SensorReadRequest = 0;
+      latency = NowUs - TickRaisedUs;
+      latency_sum += latency;
+      max_latency = (latency > max_latency) ? latency : max_latency;
+      ticks++;
+
+      Advance(NowUs + work_us);
+
+      /* The frame is sent by DMA, its completion interrupt wakes the core */
+      Events[EVENT_TX].NextUs = NowUs + (((uint64_t)SIM_FRAME_BYTES * 10U * 1000000U) / SIM_BAUD);
+    }
+
+    Advance(NowUs + SIM_LOOP_US);
+    (void)LP_Idle(&ctx, &stats);
+  }
+
+  (void)printf("mode %s%s, %u s, %u us of work per %u us tick\n", (mode == LP_MODE_SLEEP) ? "sleep" : "run",
+               (Naive != 0U) ? " (naive check)" : "", seconds, work_us, SIM_TICK_US);
+  (void)printf("ticks %u, missed %u, latency mean %.1f us, max %llu us\n", ticks, MissedTicks,
+               (ticks != 0U) ? ((double)latency_sum / (double)ticks) : 0.0, (unsigned long long)max_latency);
+  (void)printf("commands %u, latency max %llu us\n", commands, (unsigned long long)max_rx_latency);
+  (void)printf("active %.2f %%, idle %.2f %%, sleeps %u\n",
+               100.0 * (double)stats.ActiveUs / (double)NowUs, 100.0 * (double)stats.IdleUs / (double)NowUs,
+               stats.Sleeps);
+  (void)printf("wake-ups per second:");
+
+  for (i = 0; i < LP_WAKE_COUNT; i++)
+  {
+    (void)printf(" %s %.1f (last second %u)", WakeName[i], (double)stats.Wakeups[i] / (double)seconds,
+                 stats.LastSecond[i]);
+  }
+
+  (void)printf("\n");
+
+  /* Late if served after the time base interrupt following it: a lost wake-up */
+  return ((MissedTicks != 0U) || (max_latency > (SIM_SYSTICK_US / 2U)) || (max_rx_latency > (SIM_SYSTICK_US / 2U))) ? 1 : 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line help
+  * @param  None
+  * @retval None
+  */
+static void Usage(void)
+{
+  (void)fprintf(stderr,
+                "usage: lp_sim [options]\n"
+                "  -m run|sleep   idle policy (default sleep)\n"
+                "  -w <us>        work per tick (default %u)\n"
+                "  -s <seconds>   simulated time (default 10)\n"
+                "  -r <n>         raise a reception right after one pending work check out of n\n"
+                "  -n             check the pending work with the interrupts unmasked, to show the lost wake-up\n",
+                SIM_WORK_US);
+}
+
+/**
+  * @brief  Run the core up to the given time, the interrupts due are raised, and served if unmasked
+  * @param  ToUs virtual time [us]
+  * @retval None
+  */
+static void Advance(uint64_t ToUs)
+{
+  uint64_t next;
+  uint32_t i;
+  uint32_t first;
+
+  for (;;)
+  {
+    next = UINT64_MAX;
+    first = 0;
+
+    for (i = 0; i < IRQ_EVENTS; i++)
+    {
+      if (Events[i].NextUs < next)
+      {
+        next = Events[i].NextUs;
+        first = i;
+      }
+    }
+
+    if (next > ToUs)
+    {
+      break;
+    }
+
+    NowUs = next;
+    Raise(Events[first].Irq);
+    Events[first].NextUs = (Events[first].PeriodUs != 0U) ? (next + Events[first].PeriodUs) : UINT64_MAX;
+  }
+
+  NowUs = ToUs;
+}
+
+/**
+  * @brief  Raise an interrupt, served at once if the interrupts are unmasked
+  * @param  Irq IRQ_x
+  * @retval None
+  */
+static void Raise(uint32_t Irq)
+{
+  if ((Irq & ~PendingIrq & IRQ_TICK) != 0U)
+  {
+    TickRaisedUs = NowUs;
+  }
+
+  if ((Irq & ~PendingIrq & IRQ_RX) != 0U)
+  {
+    RxRaisedUs = NowUs;
+  }
+
+  PendingIrq |= Irq;
+
+  if (Masked == 0U)
+  {
+    Serve();
+  }
+}
+
+/**
+  * @brief  Interrupt handlers: HAL_TIM_PeriodElapsedCallback and the UART reception event
+  * @param  None
+  * @retval None
+  */
+static void Serve(void)
+{
+  if ((PendingIrq & IRQ_TICK) != 0U)
+  {
+    if (SensorReadRequest != 0U)
+    {
+      MissedTicks++;
+    }
+
+    SensorReadRequest = 1;
+  }
+
+  if ((PendingIrq & IRQ_RX) != 0U)
+  {
+    RxEvent = 1;
+  }
+
+  PendingIrq = 0;
+}
+
+/**
+  * @brief  Virtual time base
+  * @param  None
+  * @retval Time [us]
+  */
+static uint32_t Sim_GetTimeUs(void)
+{
+  return (uint32_t)NowUs;
+}
+
+/**
+  * @brief  Pending work check, with the race injection
+  * @param  None
+  * @retval Not 0 if work is pending
+  */
+static uint32_t Sim_Pending(void)
+{
+  uint32_t pending = (uint32_t)SensorReadRequest | (uint32_t)RxEvent;
+
+  Checks++;
+
+  /* A frame is received between the check and the sleep */
+  if ((pending == 0U) && (RaceEvery != 0U) && ((Checks % RaceEvery) == 0U))
+  {
+    Events[EVENT_RACE].NextUs = NowUs;
+    Advance(NowUs);
+  }
+
+  return pending;
+}
+
+/**
+  * @brief  Sleep until an interrupt is pending
+  * @param  None
+  * @retval None
+  */
+static void Sim_Sleep(void)
+{
+  uint64_t next = UINT64_MAX;
+  uint32_t i;
+
+  if (PendingIrq != 0U)
+  {
+    return;
+  }
+
+  for (i = 0; i < IRQ_EVENTS; i++)
+  {
+    next = (Events[i].NextUs < next) ? Events[i].NextUs : next;
+  }
+
+  Advance(next);
+}
+
+/**
+  * @brief  Pending interrupts, as LP_Wake_Sources in app_mems.c
+  * @param  None
+  * @retval LP_WAKE_x pending
+  */
+static uint32_t Sim_WakeSources(void)
+{
+  uint32_t sources = 0;
+
+  sources |= ((PendingIrq & IRQ_TICK) != 0U) ? LP_WAKE_TIMER : 0U;
+  sources |= ((PendingIrq & (IRQ_RX | IRQ_TX_DONE)) != 0U) ? LP_WAKE_UART : 0U;
+  sources |= ((PendingIrq & IRQ_SYSTICK) != 0U) ? LP_WAKE_SYSTICK : 0U;
+
+  return sources;
+}
+
+/**
+  * @brief  Mask the interrupts, ignored with the naive check
+  * @param  None
+  * @retval None
+  */
+static void Sim_Mask(void)
+{
+  Masked = (Naive != 0U) ? 0U : 1U;
+}
+
+/**
+  * @brief  Unmask the interrupts and serve the pending ones
+  * @param  None
+  * @retval None
+  */
+static void Sim_Unmask(void)
+{
+  Masked = 0;
+  Serve();
+}
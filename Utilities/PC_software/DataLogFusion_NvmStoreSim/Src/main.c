@@ -0,0 +1,470 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host check of the calibration record store: the firmware store
+  *          (nvm_store.c) runs on a RAM model of the two flash sectors, with
+  *          power failures injected in its erases and programs, and its
+  *          records are checked against a reference after each reboot
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "nvm_store.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_ERASED          0xFFFFFFFFU
+#define SIM_MAX_SECTOR      0x20000U /* Sector 6 or 7 of the STM32F401RE */
+#define SIM_IDS             5U       /* NVM_ID_MC_CAL to NVM_ID_FX_GBIAS */
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Reference record
+  */
+typedef struct
+{
+  uint8_t Valid;
+  uint16_t Size;
+  uint8_t Data[NVM_MAX_SIZE];
+} Ref_Record_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* Record sizes of the calibration data [bytes], close to the library ones */
+static const uint16_t IdSize[SIM_IDS + 1U] = {0U, 76U, 52U, 12U, 40U, 12U};
+
+static uint32_t Flash[2U * SIM_MAX_SECTOR / 4U]; /* Both sectors */
+static uint32_t FlashCopy[2U * SIM_MAX_SECTOR / 4U];
+static uint32_t Ops = 0;                          /* Erases and programs */
+static uint32_t FailAt = 0;                       /* Op losing the power, 0 for none */
+static uint32_t PowerLost = 0;
+static uint32_t Erases[2] = {0, 0};
+static uint32_t Programs = 0;
+static uint32_t Violations = 0;                   /* Programs of a word not erased */
+static Ref_Record_t Ref[NVM_ID_COUNT];
+static uint32_t Errors = 0;
+
+static int32_t Sim_Erase(uint32_t Sector);
+static int32_t Sim_Program(uint32_t Offset, uint32_t Word);
+static uint32_t Sim_Read(uint32_t Offset);
+
+static NVM_Flash_t SimFlash = {2048U, Sim_Erase, Sim_Program, Sim_Read};
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static uint32_t Rand32(void);
+static uint32_t Count_Ops(const NVM_Store_t *Store, uint8_t Id, const uint8_t *Data, uint16_t Size);
+static uint32_t Matches(NVM_Store_t *Store, uint8_t Id, const Ref_Record_t *Rec);
+static void Check_All(NVM_Store_t *Store, const char *When, uint32_t Op);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Simulation entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 if every record read matches the reference, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  NVM_Store_t store;
+  Ref_Record_t rec;
+  uint32_t count = 20000U;
+  uint32_t fail_pct = 10U;
+  uint32_t op;
+  uint32_t ops;
+  uint32_t writes = 0;
+  uint32_t skipped = 0;
+  uint32_t failures = 0;
+  uint32_t kept_old = 0;
+  uint32_t got_new = 0;
+  uint32_t total_writes = 0;
+  uint32_t max_size;
+  uint32_t i;
+  uint8_t id;
+  uint8_t buf[NVM_MAX_SIZE];
+  int32_t ret;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:k:p:s:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'n':
+        count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'k':
+        SimFlash.SectorSize = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'p':
+        fail_pct = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        srand((unsigned int)strtoul(optarg, NULL, 0));
+        break;
+      default:
+        Usage();
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+
+  if ((count == 0U) || (SimFlash.SectorSize > SIM_MAX_SECTOR) || (fail_pct > 100U))
+  {
+    Usage();
+    return 1;
+  }
+
+  /* Blank flash, as delivered */
+  (void)memset(Flash, 0xFF, sizeof(Flash));
+  (void)memset(Ref, 0, sizeof(Ref));
+
+  if (NVM_Store_Init(&store, &SimFlash) != NVM_OK)
+  {
+    (void)fprintf(stderr, "sector size %u too small, at least %u bytes\n", SimFlash.SectorSize,
+                  NVM_SECTOR_HEADER_LEN + NVM_RECORD_OVERHEAD + NVM_MAX_SIZE);
+    return 1;
+  }
+
+  /* Largest size of a library update, so that the records of every Id fit in a sector */
+  max_size = ((SimFlash.SectorSize - NVM_SECTOR_HEADER_LEN) / SIM_IDS) - NVM_RECORD_OVERHEAD;
+  max_size = (max_size > NVM_MAX_SIZE) ? NVM_MAX_SIZE : (max_size & ~3U);
+
+  Check_All(&store, "first boot", 0U);
+
+  for (op = 1; op <= count; op++)
+  {
+    id = (uint8_t)(1U + ((uint32_t)rand() % SIM_IDS));
+    rec = Ref[id];
+
+    if ((rand() % 100) < 5)
+    {
+      /* Deletion, e.g. a calibration restarted from scratch */
+      rec.Valid = 0;
+      rec.Size = 0;
+    }
+    else if ((Ref[id].Valid == 0U) || ((rand() % 100) >= 10))
+    {
+      /* New calibration data, of another size now and then (library update) */
+      rec.Valid = 1;
+      rec.Size = ((rand() % 100) < 3) ? (uint16_t)(1U + ((uint32_t)rand() % max_size)) : IdSize[id];
+
+      for (i = 0; i < rec.Size; i++)
+      {
+        rec.Data[i] = (uint8_t)rand();
+      }
+    }
+    else
+    {
+      /* Same data saved again */
+    }
+
+    /* Power failure at one of the flash ops of the write, counted on a copy */
+    ops = Count_Ops(&store, id, rec.Data, rec.Size);
+
+    if ((ops != 0U) && ((uint32_t)(rand() % 100) < fail_pct))
+    {
+      FailAt = Ops + 1U + (Rand32() % ops);
+    }
+
+    ret = NVM_Store_Write(&store, id, rec.Data, (rec.Valid == 1U) ? rec.Size : 0U);
+    FailAt = 0;
+
+    if (ops == 0U)
+    {
+      skipped++;
+    }
+    else
+    {
+      writes++;
+    }
+
+    if (PowerLost == 1U)
+    {
+      /* Reboot: the old or the new record of the Id, the others unchanged */
+      PowerLost = 0;
+      failures++;
+      total_writes += store.Writes;
+      (void)NVM_Store_Init(&store, &SimFlash);
+
+      if (Matches(&store, id, &rec) == 1U)
+      {
+        Ref[id] = rec;
+        got_new++;
+      }
+      else if (Matches(&store, id, &Ref[id]) == 1U)
+      {
+        kept_old++;
+      }
+      else
+      {
+        (void)printf("op %u: id %u is neither the old nor the new record after the power failure\n", op, id);
+        Errors++;
+      }
+
+      Check_All(&store, "power failure", op);
+    }
+    else
+    {
+      if (ret != NVM_OK)
+      {
+        (void)printf("op %u: write of id %u failed (%d)\n", op, id, (int)ret);
+        Errors++;
+      }
+      else
+      {
+        Ref[id] = rec;
+      }
+
+      if ((rand() % 50) == 0)
+      {
+        total_writes += store.Writes;
+        (void)NVM_Store_Init(&store, &SimFlash);
+        Check_All(&store, "reboot", op);
+      }
+      else
+      {
+        Check_All(&store, "write", op);
+      }
+    }
+  }
+
+  /* A corrupted record is reported, never returned */
+  for (id = 1; id <= SIM_IDS; id++)
+  {
+    if (Ref[id].Valid == 1U)
+    {
+      i = (((uint32_t)store.Active * SimFlash.SectorSize) + store.Last[id]) / 4U;
+      Flash[i + 1U] ^= 0x00000100U;
+
+      if (NVM_Store_Read(&store, id, buf, Ref[id].Size) != NVM_ERROR)
+      {
+        (void)printf("id %u: corrupted record not detected\n", id);
+        Errors++;
+      }
+
+      Flash[i + 1U] ^= 0x00000100U;
+    }
+  }
+
+  total_writes += store.Writes;
+
+  (void)printf("%u writes, %u skipped with the same data, %u power failures: %u kept the old record, %u the new one\n",
+               writes, skipped, failures, kept_old, got_new);
+  (void)printf("%u records and %u words programmed, sector erases %u and %u, %.1f records per erase\n",
+               total_writes, Programs, Erases[0], Erases[1],
+               (double)total_writes / (double)(((Erases[0] + Erases[1]) == 0U) ? 1U : (Erases[0] + Erases[1])));
+  (void)printf("%u programs of a word not erased, %u mismatches: %s\n", Violations, Errors,
+               ((Errors == 0U) && (Violations == 0U)) ? "store matches the reference" : "MISMATCH");
+
+  return ((Errors == 0U) && (Violations == 0U)) ? 0 : 1;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line help
+  * @param  None
+  * @retval None
+  */
+static void Usage(void)
+{
+  (void)fprintf(stderr,
+                "usage: nvm_sim [options]\n"
+                "  -n <writes>   calibration writes to simulate (default 20000)\n"
+                "  -k <bytes>    sector size, up to %u (default 2048)\n"
+                "  -p <percent>  writes interrupted by a power failure (default 10)\n"
+                "  -s <seed>     seed of the data and of the failures\n",
+                SIM_MAX_SECTOR);
+}
+
+/**
+  * @brief  Random 32 bits
+  * @param  None
+  * @retval Random value
+  */
+static uint32_t Rand32(void)
+{
+  return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+/**
+  * @brief  Flash model: erase a sector, a power failure leaves some words erased and
+  *         some bits set in the others
+  * @param  Sector sector 0 or 1
+  * @retval 0 on success, -1 otherwise
+  */
+static int32_t Sim_Erase(uint32_t Sector)
+{
+  uint32_t words = SimFlash.SectorSize / 4U;
+  uint32_t i;
+
+  if ((PowerLost == 1U) || (Sector > 1U))
+  {
+    return -1;
+  }
+
+  Ops++;
+  Erases[Sector]++;
+
+  for (i = 0; i < words; i++)
+  {
+    if (Ops != FailAt)
+    {
+      Flash[(Sector * words) + i] = SIM_ERASED;
+    }
+    else if ((rand() % 2) == 0)
+    {
+      Flash[(Sector * words) + i] = SIM_ERASED;
+    }
+    else
+    {
+      Flash[(Sector * words) + i] |= Rand32();
+    }
+  }
+
+  if (Ops == FailAt)
+  {
+    PowerLost = 1;
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Flash model: program a word, bits can only be cleared, a power failure
+  *         leaves some of the bits to clear set
+  * @param  Offset offset from the first sector [bytes]
+  * @param  Word word to program
+  * @retval 0 on success, -1 otherwise
+  */
+static int32_t Sim_Program(uint32_t Offset, uint32_t Word)
+{
+  uint32_t i = Offset / 4U;
+
+  if (PowerLost == 1U)
+  {
+    return -1;
+  }
+
+  if (((Offset % 4U) != 0U) || (Offset >= (2U * SimFlash.SectorSize)))
+  {
+    Violations++;
+    return -1;
+  }
+
+  Ops++;
+  Programs++;
+
+  if (Flash[i] != SIM_ERASED)
+  {
+    Violations++;
+    return -1;
+  }
+
+  if (Ops == FailAt)
+  {
+    Flash[i] &= Word | Rand32();
+    PowerLost = 1;
+    return -1;
+  }
+
+  Flash[i] &= Word;
+  return 0;
+}
+
+/**
+  * @brief  Flash model: read a word
+  * @param  Offset offset from the first sector [bytes]
+  * @retval The word
+  */
+static uint32_t Sim_Read(uint32_t Offset)
+{
+  if (Offset >= (2U * SimFlash.SectorSize))
+  {
+    Violations++;
+    return SIM_ERASED;
+  }
+
+  return Flash[Offset / 4U];
+}
+
+/**
+  * @brief  Flash ops of a write, run on a copy of the flash and of the store
+  * @param  Store pointer to the store
+  * @param  Id record identifier
+  * @param  Data pointer to the data
+  * @param  Size data size [bytes], 0 to delete
+  * @retval Erases and programs of the write
+  */
+static uint32_t Count_Ops(const NVM_Store_t *Store, uint8_t Id, const uint8_t *Data, uint16_t Size)
+{
+  NVM_Store_t copy = *Store;
+  uint32_t ops = Ops;
+  uint32_t erases[2] = {Erases[0], Erases[1]};
+  uint32_t programs = Programs;
+  uint32_t count;
+
+  (void)memcpy(FlashCopy, Flash, 2U * SimFlash.SectorSize);
+  (void)NVM_Store_Write(&copy, Id, Data, Size);
+  (void)memcpy(Flash, FlashCopy, 2U * SimFlash.SectorSize);
+
+  count = Ops - ops;
+  Ops = ops;
+  Erases[0] = erases[0];
+  Erases[1] = erases[1];
+  Programs = programs;
+  return count;
+}
+
+/**
+  * @brief  Compare the record read from the store with a reference one
+  * @param  Store pointer to the store
+  * @param  Id record identifier
+  * @param  Rec pointer to the reference record
+  * @retval 1 if they match, 0 otherwise
+  */
+static uint32_t Matches(NVM_Store_t *Store, uint8_t Id, const Ref_Record_t *Rec)
+{
+  uint8_t buf[NVM_MAX_SIZE];
+  int32_t ret = NVM_Store_Read(Store, Id, buf, (Rec->Valid == 1U) ? Rec->Size : IdSize[Id]);
+
+  if (Rec->Valid == 0U)
+  {
+    return (ret == NVM_NOT_FOUND) ? 1U : 0U;
+  }
+
+  return ((ret == NVM_OK) && (memcmp(buf, Rec->Data, Rec->Size) == 0)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Compare every record of the store with the reference
+  * @param  Store pointer to the store
+  * @param  When step of the check, for the report
+  * @param  Op write number
+  * @retval None
+  */
+static void Check_All(NVM_Store_t *Store, const char *When, uint32_t Op)
+{
+  uint8_t id;
+
+  for (id = 1; id <= SIM_IDS; id++)
+  {
+    if (Matches(Store, id, &Ref[id]) == 0U)
+    {
+      (void)printf("op %u (%s): id %u does not match the reference\n", Op, When, id);
+      Errors++;
+    }
+  }
+}
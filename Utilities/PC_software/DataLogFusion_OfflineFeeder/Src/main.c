@@ -0,0 +1,1004 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host feeder of the DataLogFusion bulk offline replay: a recorded
+  *          dataset is streamed to the board with CMD_Offline_Bulk_Data, paced
+  *          by the free records of the replies, and the achieved records per
+  *          second are reported
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <termios.h>
+#include "serial_protocol.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define FEED_BAUD_DEFAULT      921600U
+#define FEED_RECORD_LEN        52U     /* OFFLINE_RECORD_LEN of demo_serial.h */
+#define FEED_MAX_RECORDS       4U      /* Records per message, within Msg_MaxLen with a CRC-32 trailer */
+#define FEED_MAX_INFLIGHT      2U      /* Messages waiting for their reply: the UART_RX_BUFFER_SIZE bytes
+                                          of the board hold two full messages */
+#define FEED_REPLY_TIMEOUT_S   1.0
+#define FEED_POLL_PERIOD_S     0.002
+#define FEED_CSV_LINE_LEN      4096U
+#define FEED_CSV_MAX_COLUMNS   64U
+#define FEED_GEN_PERIOD_S      0.01    /* Synthetic dataset at ALGO_FREQ */
+
+/* Protocol, see serial_cmd.h */
+#define CMD_USE_OFFLINE_DATA    0x11U
+#define CMD_OFFLINE_BULK_START  0x1BU
+#define CMD_OFFLINE_BULK_DATA   0x1CU
+#define CMD_REPLY_ADD           0x80U
+#define DEV_ADDR                50U
+#define HOST_ADDR               0x01U
+
+/* Un-framer states, as in com.c */
+#define RX_STATE_IDLE    0U
+#define RX_STATE_DATA    1U
+#define RX_STATE_ESCAPE  2U
+#define RX_STATE_SKIP    3U
+
+/* Dataset CSV columns, as written by DataLogFusion_Ingest */
+#define COL_TIME   0U
+#define COL_PRESS  1U
+#define COL_TEMP   2U
+#define COL_HUM    3U
+#define COL_ACC_X  4U
+#define COL_COUNT  13U
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Streaming un-framer, same state machine as Rx_Parse_Byte in com.c
+  */
+typedef struct
+{
+  uint8_t Cobs;
+  uint8_t State;
+  uint8_t CobsCode;
+  uint8_t CobsLeft;
+  Msg_t Msg;
+} Parser_t;
+
+/**
+  * @brief  Bulk replay state reported by the CMD_Offline_Bulk_Data replies
+  */
+typedef struct
+{
+  uint32_t Free;        /* Free records of the board ring */
+  uint32_t Processed;   /* Records processed by the algorithms */
+  uint32_t ElapsedUs;   /* From the first record to the last one processed */
+  uint32_t BusyUs;      /* Time spent processing the records */
+} Bulk_State_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const CsvColumnName[COL_COUNT] =
+{
+  "time_s", "press", "temp", "hum",
+  "acc_x", "acc_y", "acc_z", "gyr_x", "gyr_y", "gyr_z", "mag_x", "mag_y", "mag_z"
+};
+
+static Parser_t Parser;
+static uint8_t UseCrc32 = 0;
+static int Fd = -1;
+static FILE *CaptureFile = NULL;
+static uint64_t OtherFrames = 0;
+static uint64_t FrameErrors = 0;
+static uint8_t *Records = NULL;
+static uint32_t RecordCount = 0;
+static double DatasetDuration = 0.0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static double Now_s(void);
+static int Open_Device(const char *Path, uint32_t Baud);
+static int Load_Dataset(const char *Path);
+static int Load_Csv(FILE *File);
+static int Add_Record(double TimeS, const float *Env, const int32_t *Axes);
+static int Generate_Dataset(uint32_t Count);
+static int Send_Command(uint8_t Cmd, const uint8_t *Payload, uint32_t Len);
+static int Wait_Reply(uint8_t Cmd, double Timeout, Msg_t *Reply);
+static int Read_Frames(double Timeout, uint8_t Cmd, Msg_t *Reply);
+static int32_t Parse_Byte(uint8_t Data);
+static int32_t Check_Integrity(Msg_t *Msg);
+static void Bulk_State_Get(Msg_t *Reply, Bulk_State_t *State);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Feeder entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 on success, 1 on error
+  */
+int main(int argc, char *argv[])
+{
+  const char *device = NULL;
+  const char *input = NULL;
+  const char *capture = NULL;
+  uint32_t baud = FEED_BAUD_DEFAULT;
+  uint32_t decimation = 0;
+  uint32_t gen_count = 0;
+  uint32_t per_msg = FEED_MAX_RECORDS;
+  uint32_t inflight[FEED_MAX_INFLIGHT];
+  uint32_t inflight_head = 0;
+  uint32_t inflight_count = 0;
+  uint32_t inflight_records = 0;
+  uint32_t sent = 0;
+  uint32_t count;
+  uint32_t credit;
+  uint32_t accepted;
+  uint8_t payload[1U + (FEED_MAX_RECORDS * FEED_RECORD_LEN)];
+  uint8_t arg[2];
+  const uint8_t poll_count = 0;
+  Bulk_State_t state = {0};
+  Msg_t reply;
+  double t0;
+  double t_reply;
+  double elapsed;
+  double rate;
+  int ret = 1;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "d:i:o:B:f:k:n:r:g:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'd':
+        device = optarg;
+        break;
+      case 'i':
+        input = optarg;
+        break;
+      case 'o':
+        capture = optarg;
+        break;
+      case 'B':
+        baud = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'f':
+        Parser.Cobs = (strcmp(optarg, "cobs") == 0) ? 1U : 0U;
+        break;
+      case 'k':
+        UseCrc32 = (strcmp(optarg, "crc32") == 0) ? 1U : 0U;
+        break;
+      case 'n':
+        decimation = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'r':
+        per_msg = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'g':
+        gen_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        Usage();
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+
+  if ((device == NULL) || ((input == NULL) == (gen_count == 0U)) || (decimation > 0xFFFFU)
+      || (per_msg == 0U) || (per_msg > FEED_MAX_RECORDS))
+  {
+    Usage();
+    return 1;
+  }
+
+  if (((input != NULL) ? Load_Dataset(input) : Generate_Dataset(gen_count)) != 0)
+  {
+    return 1;
+  }
+
+  if ((capture != NULL) && ((CaptureFile = fopen(capture, "wb")) == NULL))
+  {
+    perror(capture);
+    return 1;
+  }
+
+  Fd = Open_Device(device, baud);
+
+  if (Fd < 0)
+  {
+    return 1;
+  }
+
+  /* Start: the ring of the board is emptied, its size is the first credit */
+  Serialize(arg, decimation, 2);
+
+  if ((Send_Command(CMD_OFFLINE_BULK_START, arg, 2) != 0)
+      || (Wait_Reply(CMD_OFFLINE_BULK_START, FEED_REPLY_TIMEOUT_S, &reply) != 0) || (reply.Len < 5U))
+  {
+    (void)fprintf(stderr, "no reply to CMD_Offline_Bulk_Start\n");
+    goto exit;
+  }
+
+  state.Free = Deserialize(&reply.Data[3], 2);
+  t0 = Now_s();
+  t_reply = t0;
+
+  while ((sent < RecordCount) || (inflight_count != 0U))
+  {
+    /* The records in flight were counted as free by the last reply: the board never refuses
+     * a record, so the dataset is replayed in order */
+    credit = (state.Free > inflight_records) ? (state.Free - inflight_records) : 0U;
+    count = RecordCount - sent;
+    count = (count < per_msg) ? count : per_msg;
+    count = (count < credit) ? count : credit;
+
+    if ((count != 0U) && (inflight_count < FEED_MAX_INFLIGHT))
+    {
+      payload[0] = (uint8_t)count;
+      (void)memcpy(&payload[1], &Records[(size_t)sent * FEED_RECORD_LEN], (size_t)count * FEED_RECORD_LEN);
+
+      if (Send_Command(CMD_OFFLINE_BULK_DATA, payload, 1U + (count * FEED_RECORD_LEN)) != 0)
+      {
+        goto exit;
+      }
+
+      inflight[(inflight_head + inflight_count) % FEED_MAX_INFLIGHT] = count;
+      inflight_count++;
+      inflight_records += count;
+      sent += count;
+      continue;
+    }
+
+    /* Window full or no credit: wait for the next reply, or poll the board when its ring is full */
+    if (inflight_count == 0U)
+    {
+      if ((Read_Frames(FEED_POLL_PERIOD_S, 0U, NULL) < 0) || (Send_Command(CMD_OFFLINE_BULK_DATA, &poll_count, 1) != 0))
+      {
+        goto exit;
+      }
+
+      inflight[inflight_head] = 0;
+      inflight_count = 1;
+    }
+
+    if (Wait_Reply(CMD_OFFLINE_BULK_DATA, FEED_REPLY_TIMEOUT_S, &reply) != 0)
+    {
+      (void)fprintf(stderr, "reply lost after %u records sent, the replay is aborted\n", sent);
+      goto exit;
+    }
+
+    if (reply.Len < 18U)
+    {
+      (void)fprintf(stderr, "short CMD_Offline_Bulk_Data reply\n");
+      goto exit;
+    }
+
+    accepted = reply.Data[3];
+    Bulk_State_Get(&reply, &state);
+    t_reply = Now_s();
+
+    if (accepted != inflight[inflight_head])
+    {
+      (void)fprintf(stderr, "%u records of %u refused, the replay is aborted\n",
+                    inflight[inflight_head] - accepted, inflight[inflight_head]);
+      goto exit;
+    }
+
+    inflight_records -= accepted;
+    inflight_head = (inflight_head + 1U) % FEED_MAX_INFLIGHT;
+    inflight_count--;
+  }
+
+  /* All records accepted: poll until the board has processed them */
+  while (state.Processed < RecordCount)
+  {
+    if (Read_Frames(FEED_POLL_PERIOD_S, 0U, NULL) < 0)
+    {
+      goto exit;
+    }
+
+    if ((Send_Command(CMD_OFFLINE_BULK_DATA, &poll_count, 1) != 0)
+        || (Wait_Reply(CMD_OFFLINE_BULK_DATA, FEED_REPLY_TIMEOUT_S, &reply) != 0) || (reply.Len < 18U))
+    {
+      (void)fprintf(stderr, "no reply to the final poll\n");
+      goto exit;
+    }
+
+    Bulk_State_Get(&reply, &state);
+    t_reply = Now_s();
+  }
+
+  elapsed = t_reply - t0;
+  rate = (state.ElapsedUs != 0U) ? ((double)state.Processed * 1e6 / (double)state.ElapsedUs) : 0.0;
+
+  (void)printf("records %u, host time %.3f s, board time %.3f s\n", state.Processed, elapsed,
+               (double)state.ElapsedUs * 1e-6);
+  (void)printf("achieved %.1f records/s", rate);
+
+  if ((DatasetDuration > 0.0) && (state.ElapsedUs != 0U))
+  {
+    (void)printf(", %.1f x real time", DatasetDuration / ((double)state.ElapsedUs * 1e-6));
+  }
+
+  (void)printf("\nalgorithm bound %.1f records/s (%.1f us per record), board busy %.1f %%\n",
+               (state.BusyUs != 0U) ? ((double)state.Processed * 1e6 / (double)state.BusyUs) : 0.0,
+               (state.Processed != 0U) ? ((double)state.BusyUs / (double)state.Processed) : 0.0,
+               (state.ElapsedUs != 0U) ? (100.0 * (double)state.BusyUs / (double)state.ElapsedUs) : 0.0);
+  (void)printf("output frames %llu, frame errors %llu\n", (unsigned long long)OtherFrames,
+               (unsigned long long)FrameErrors);
+  ret = 0;
+
+exit:
+  /* Back to the sensors in any case */
+  arg[0] = 0;
+  if ((Send_Command(CMD_USE_OFFLINE_DATA, arg, 1) == 0) && (Wait_Reply(CMD_USE_OFFLINE_DATA, FEED_REPLY_TIMEOUT_S, &reply) != 0))
+  {
+    (void)fprintf(stderr, "no reply to CMD_Use_Offline_Data\n");
+  }
+
+  if (CaptureFile != NULL)
+  {
+    (void)fclose(CaptureFile);
+  }
+
+  (void)close(Fd);
+  free(Records);
+
+  return ret;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line help
+  * @param  None
+  * @retval None
+  */
+static void Usage(void)
+{
+  (void)fprintf(stderr,
+                "usage: datalog_replay -d <serial device> (-i <dataset> | -g <records>) [options]\n"
+                "  -i <dataset>       CSV file written by datalog_ingest, or raw %u bytes offline records\n"
+                "  -g <records>       synthetic dataset of <records> records at 100 Hz instead of -i\n"
+                "  -o <capture file>  write the frames received from the board, for datalog_ingest\n"
+                "  -n <decimation>    one output frame every <decimation> records, 0 for none (default 0)\n"
+                "  -r <records>       records per message, 1 to %u (default %u)\n"
+                "  -B <baud>          serial device baud rate (default %u)\n"
+                "  -f stuffing|cobs   framing, as set by CMD_Set_Framing (default stuffing)\n"
+                "  -k chk8|crc32      integrity trailer, as set by CMD_Set_Integrity (default chk8)\n",
+                FEED_RECORD_LEN, FEED_MAX_RECORDS, FEED_MAX_RECORDS, FEED_BAUD_DEFAULT);
+}
+
+/**
+  * @brief  Monotonic time
+  * @param  None
+  * @retval Time [s]
+  */
+static double Now_s(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/**
+  * @brief  Open the serial device in raw mode at the given baud rate
+  * @param  Path device path
+  * @param  Baud baud rate
+  * @retval File descriptor, -1 on error
+  */
+static int Open_Device(const char *Path, uint32_t Baud)
+{
+  struct termios tio;
+  speed_t speed;
+  int fd;
+
+  fd = open(Path, O_RDWR | O_NOCTTY);
+
+  if (fd < 0)
+  {
+    perror(Path);
+    return -1;
+  }
+
+  if (isatty(fd) == 0)
+  {
+    (void)fprintf(stderr, "%s is not a serial device\n", Path);
+    (void)close(fd);
+    return -1;
+  }
+
+  switch (Baud)
+  {
+    case 115200U:
+      speed = B115200;
+      break;
+    case 230400U:
+      speed = B230400;
+      break;
+    case 460800U:
+      speed = B460800;
+      break;
+    case 921600U:
+      speed = B921600;
+      break;
+    case 2000000U:
+      speed = B2000000;
+      break;
+    default:
+      (void)fprintf(stderr, "unsupported baud rate %u\n", Baud);
+      (void)close(fd);
+      return -1;
+  }
+
+  if (tcgetattr(fd, &tio) != 0)
+  {
+    perror("tcgetattr");
+    (void)close(fd);
+    return -1;
+  }
+
+  cfmakeraw(&tio);
+  (void)cfsetispeed(&tio, speed);
+  (void)cfsetospeed(&tio, speed);
+  tio.c_cflag |= (tcflag_t)(CLOCAL | CREAD);
+  tio.c_cc[VMIN] = 1;
+  tio.c_cc[VTIME] = 0;
+
+  if (tcsetattr(fd, TCSANOW, &tio) != 0)
+  {
+    perror("tcsetattr");
+    (void)close(fd);
+    return -1;
+  }
+
+  (void)tcflush(fd, TCIOFLUSH);
+
+  return fd;
+}
+
+/**
+  * @brief  Load the dataset, a CSV file if its first line is the datalog_ingest header, raw records otherwise
+  * @param  Path dataset path
+  * @retval 0 on success, -1 on error
+  */
+static int Load_Dataset(const char *Path)
+{
+  FILE *file;
+  long size;
+  int ret;
+  int c;
+
+  file = fopen(Path, "rb");
+
+  if (file == NULL)
+  {
+    perror(Path);
+    return -1;
+  }
+
+  c = fgetc(file);
+  (void)ungetc(c, file);
+
+  if (c == 's')
+  {
+    ret = Load_Csv(file);
+  }
+  else
+  {
+    ret = -1;
+
+    if ((fseek(file, 0, SEEK_END) == 0) && ((size = ftell(file)) > 0) && (fseek(file, 0, SEEK_SET) == 0))
+    {
+      RecordCount = (uint32_t)((size_t)size / FEED_RECORD_LEN);
+      Records = malloc((size_t)RecordCount * FEED_RECORD_LEN);
+
+      if ((Records != NULL) && (fread(Records, FEED_RECORD_LEN, RecordCount, file) == RecordCount))
+      {
+        ret = 0;
+      }
+    }
+  }
+
+  (void)fclose(file);
+
+  if ((ret != 0) || (RecordCount == 0U))
+  {
+    (void)fprintf(stderr, "%s: no offline record\n", Path);
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Load the rows of a datalog_ingest CSV file holding the three motion sensors
+  * @param  File CSV file, at the header line
+  * @retval 0 on success, -1 on error
+  */
+static int Load_Csv(FILE *File)
+{
+  static char line[FEED_CSV_LINE_LEN];
+  char *cell[FEED_CSV_MAX_COLUMNS];
+  int32_t index[COL_COUNT];
+  int32_t axes[9];
+  float env[3];
+  uint32_t cells;
+  uint32_t i;
+  uint32_t j;
+  char *p;
+
+  if (fgets(line, (int)sizeof(line), File) == NULL)
+  {
+    return -1;
+  }
+
+  for (i = 0; i < COL_COUNT; i++)
+  {
+    index[i] = -1;
+  }
+
+  for (j = 0, p = strtok(line, ",\r\n"); (p != NULL) && (j < FEED_CSV_MAX_COLUMNS); j++, p = strtok(NULL, ",\r\n"))
+  {
+    for (i = 0; i < COL_COUNT; i++)
+    {
+      if (strcmp(p, CsvColumnName[i]) == 0)
+      {
+        index[i] = (int32_t)j;
+      }
+    }
+  }
+
+  for (i = 0; i < COL_COUNT; i++)
+  {
+    if (index[i] < 0)
+    {
+      (void)fprintf(stderr, "column %s missing\n", CsvColumnName[i]);
+      return -1;
+    }
+  }
+
+  while (fgets(line, (int)sizeof(line), File) != NULL)
+  {
+    /* Split in place, keeping the empty cells of the fields not in the frame */
+    cells = 0;
+    p = line;
+
+    while ((p != NULL) && (cells < FEED_CSV_MAX_COLUMNS))
+    {
+      cell[cells] = p;
+      cells++;
+      p = strchr(p, ',');
+
+      if (p != NULL)
+      {
+        *p = '\0';
+        p++;
+      }
+    }
+
+    /* Only the rows of the three motion sensors are replayed */
+    for (i = 0; i < COL_COUNT; i++)
+    {
+      if (((uint32_t)index[i] >= cells) || ((i >= COL_ACC_X) && ((cell[index[i]][0] == '\0') || (cell[index[i]][0] == '\n'))))
+      {
+        break;
+      }
+    }
+
+    if (i < COL_COUNT)
+    {
+      continue;
+    }
+
+    for (i = 0; i < 3U; i++)
+    {
+      env[i] = (float)atof(cell[index[COL_PRESS + i]]);
+    }
+
+    for (i = 0; i < 9U; i++)
+    {
+      axes[i] = (int32_t)strtol(cell[index[COL_ACC_X + i]], NULL, 10);
+    }
+
+    if (Add_Record(atof(cell[index[COL_TIME]]), env, axes) != 0)
+    {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Append an offline record, in the layout of CMD_Offline_Data
+  * @param  TimeS time [s], taken modulo one day
+  * @param  Env pressure [hPa], temperature [degC], humidity [%]
+  * @param  Axes acceleration [mg], angular rate [mdps], magnetic field [mGauss]
+  * @retval 0 on success, -1 on error
+  */
+static int Add_Record(double TimeS, const float *Env, const int32_t *Axes)
+{
+  static double first_time = 0.0;
+  static uint32_t capacity = 0;
+  uint8_t *record;
+  uint8_t *records;
+  uint32_t centis;
+  uint32_t i;
+
+  if (RecordCount == capacity)
+  {
+    capacity = (capacity == 0U) ? 4096U : (2U * capacity);
+    records = realloc(Records, (size_t)capacity * FEED_RECORD_LEN);
+
+    if (records == NULL)
+    {
+      (void)fprintf(stderr, "out of memory\n");
+      return -1;
+    }
+
+    Records = records;
+  }
+
+  if (RecordCount == 0U)
+  {
+    first_time = TimeS;
+  }
+
+  DatasetDuration = TimeS - first_time;
+
+  record = &Records[(size_t)RecordCount * FEED_RECORD_LEN];
+  centis = (uint32_t)llround(fmod(TimeS, 86400.0) * 100.0) % 8640000U;
+  record[0] = (uint8_t)(centis / 360000U);
+  record[1] = (uint8_t)((centis / 6000U) % 60U);
+  record[2] = (uint8_t)((centis / 100U) % 60U);
+  record[3] = (uint8_t)(centis % 100U);
+
+  for (i = 0; i < 3U; i++)
+  {
+    FloatToArray(&record[4U + (4U * i)], Env[i]);
+  }
+
+  for (i = 0; i < 9U; i++)
+  {
+    Serialize_s32(&record[16U + (4U * i)], Axes[i], 4);
+  }
+
+  RecordCount++;
+
+  return 0;
+}
+
+/**
+  * @brief  Synthetic dataset: the board turning about the vertical at 90 dps, tilted by 20 degrees
+  * @param  Count number of records
+  * @retval 0 on success, -1 on error
+  */
+static int Generate_Dataset(uint32_t Count)
+{
+  const float env[3] = {1013.25f, 25.0f, 40.0f};
+  const double tilt = 20.0 * M_PI / 180.0;
+  int32_t axes[9];
+  double yaw;
+  double t;
+  uint32_t i;
+
+  for (i = 0; i < Count; i++)
+  {
+    t = (double)i * FEED_GEN_PERIOD_S;
+    yaw = 0.5 * M_PI * t;
+
+    axes[0] = (int32_t)lround(1000.0 * sin(tilt));
+    axes[1] = 0;
+    axes[2] = (int32_t)lround(1000.0 * cos(tilt));
+    axes[3] = (int32_t)lround(90000.0 * sin(tilt));
+    axes[4] = 0;
+    axes[5] = (int32_t)lround(90000.0 * cos(tilt));
+    axes[6] = (int32_t)lround(400.0 * cos(yaw));
+    axes[7] = (int32_t)lround(-400.0 * sin(yaw));
+    axes[8] = -300;
+
+    if (Add_Record(t, env, axes) != 0)
+    {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Frame and send a command
+  * @param  Cmd the command
+  * @param  Payload the command payload, from Msg->Data[3] on
+  * @param  Len the payload length
+  * @retval 0 on success, -1 on error
+  */
+static int Send_Command(uint8_t Cmd, const uint8_t *Payload, uint32_t Len)
+{
+  static uint8_t wire[COBS_MAX_LEN(Msg_MaxLen) * 2U];
+  static Msg_t msg;
+  size_t wire_len;
+  size_t done = 0;
+  ssize_t n;
+
+  msg.Data[0] = DEV_ADDR;
+  msg.Data[1] = HOST_ADDR;
+  msg.Data[2] = Cmd;
+  (void)memcpy(&msg.Data[3], Payload, Len);
+  msg.Len = 3U + Len;
+
+  if (UseCrc32 != 0U)
+  {
+    Serialize(&msg.Data[msg.Len], CRC32_Update(CRC32_INIT, msg.Data, msg.Len), CRC32_LEN);
+    msg.Len += CRC32_LEN;
+  }
+  else
+  {
+    CHK_ComputeAndAdd(&msg);
+  }
+
+  wire_len = (Parser.Cobs != 0U) ? (size_t)CobsEncode(wire, &msg) : (size_t)ByteStuffCopy(wire, &msg);
+
+  while (done < wire_len)
+  {
+    n = write(Fd, &wire[done], wire_len - done);
+
+    if (n < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+
+      perror("write");
+      return -1;
+    }
+
+    done += (size_t)n;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Wait for the reply to a command
+  * @param  Cmd the command
+  * @param  Timeout [s]
+  * @param  Reply the reply, integrity trailer removed
+  * @retval 0 on success, -1 on timeout or error
+  */
+static int Wait_Reply(uint8_t Cmd, double Timeout, Msg_t *Reply)
+{
+  return (Read_Frames(Timeout, Cmd, Reply) > 0) ? 0 : -1;
+}
+
+/**
+  * @brief  Read the frames received from the board, the output frames are counted and captured
+  * @param  Timeout [s]
+  * @param  Cmd the command whose reply ends the reading, 0 to read until the timeout
+  * @param  Reply the reply, integrity trailer removed
+  * @retval 1 if the reply is received, 0 on timeout, -1 on error
+  */
+static int Read_Frames(double Timeout, uint8_t Cmd, Msg_t *Reply)
+{
+  static uint8_t block[4096];
+  static size_t block_len = 0;
+  static size_t block_pos = 0;
+  struct pollfd pfd;
+  double deadline = Now_s() + Timeout;
+  double left;
+  ssize_t n;
+  int found = 0;
+
+  pfd.fd = Fd;
+  pfd.events = POLLIN;
+
+  while (found == 0)
+  {
+    /* Bytes left from the previous call first, they may follow the previous reply */
+    if (block_pos >= block_len)
+    {
+      left = deadline - Now_s();
+
+      if (left <= 0.0)
+      {
+        return 0;
+      }
+
+      if (poll(&pfd, 1, (int)ceil(left * 1000.0)) <= 0)
+      {
+        continue;
+      }
+
+      n = read(Fd, block, sizeof(block));
+
+      if (n < 0)
+      {
+        if (errno == EINTR)
+        {
+          continue;
+        }
+
+        perror("read");
+        return -1;
+      }
+
+      block_len = (size_t)n;
+      block_pos = 0;
+
+      if ((CaptureFile != NULL) && (n > 0))
+      {
+        (void)fwrite(block, 1, (size_t)n, CaptureFile);
+      }
+    }
+
+    while ((block_pos < block_len) && (found == 0))
+    {
+      if (Parse_Byte(block[block_pos]) != 0)
+      {
+        if (Check_Integrity(&Parser.Msg) == 0)
+        {
+          FrameErrors++;
+        }
+        else if ((Cmd != 0U) && (Parser.Msg.Len >= 3U) && (Parser.Msg.Data[2] == (uint8_t)(Cmd + CMD_REPLY_ADD)))
+        {
+          (void)memcpy(Reply->Data, Parser.Msg.Data, Parser.Msg.Len);
+          Reply->Len = Parser.Msg.Len;
+          found = 1;
+        }
+        else
+        {
+          OtherFrames++;
+        }
+      }
+
+      block_pos++;
+    }
+  }
+
+  return 1;
+}
+
+/**
+  * @brief  Un-frame one byte
+  * @param  Data the byte
+  * @retval 1 if Parser.Msg holds a complete frame, 0 otherwise
+  */
+static int32_t Parse_Byte(uint8_t Data)
+{
+  uint8_t eof = (Parser.Cobs != 0U) ? (uint8_t)Msg_COBS_EOF : (uint8_t)Msg_EOF;
+  int32_t append = 1;
+
+  if (Data == eof)
+  {
+    append = ((Parser.State == RX_STATE_DATA) && (Parser.CobsLeft == 0U)) ? 1 : 0;
+
+    /* Truncated escape sequence or COBS block */
+    if ((append == 0) && (Parser.State != RX_STATE_IDLE) && (Parser.State != RX_STATE_SKIP))
+    {
+      FrameErrors++;
+    }
+
+    Parser.State = RX_STATE_IDLE;
+    Parser.CobsCode = 0;
+    Parser.CobsLeft = 0;
+    return append;
+  }
+
+  if (Parser.State == RX_STATE_SKIP)
+  {
+    return 0;
+  }
+
+  if (Parser.State == RX_STATE_IDLE)
+  {
+    Parser.State = RX_STATE_DATA;
+    Parser.Msg.Len = 0;
+  }
+
+  if (Parser.Cobs != 0U)
+  {
+    if (Parser.CobsLeft == 0U)
+    {
+      append = ((Parser.CobsCode != 0U) && (Parser.CobsCode != COBS_MAX_CODE)) ? 1 : 0;
+      Parser.CobsCode = Data;
+      Parser.CobsLeft = Data - 1U;
+      Data = Msg_COBS_EOF;
+    }
+    else
+    {
+      Parser.CobsLeft--;
+    }
+  }
+  else if (Parser.State == RX_STATE_ESCAPE)
+  {
+    Parser.State = RX_STATE_DATA;
+
+    if (Data == (uint8_t)Msg_BS_EOF)
+    {
+      Data = Msg_EOF;
+    }
+    else if (Data != (uint8_t)Msg_BS)
+    {
+      Parser.State = RX_STATE_SKIP;
+      FrameErrors++;
+      return 0;
+    }
+  }
+  else if (Data == (uint8_t)Msg_BS)
+  {
+    Parser.State = RX_STATE_ESCAPE;
+    append = 0;
+  }
+
+  if (append != 0)
+  {
+    if (Parser.Msg.Len >= (uint32_t)Msg_MaxLen)
+    {
+      Parser.State = RX_STATE_SKIP;
+      FrameErrors++;
+      return 0;
+    }
+
+    Parser.Msg.Data[Parser.Msg.Len] = Data;
+    Parser.Msg.Len++;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Check and remove the integrity trailer
+  * @param  Msg pointer to the frame
+  * @retval 1 if the frame is valid, 0 otherwise
+  */
+static int32_t Check_Integrity(Msg_t *Msg)
+{
+  uint32_t len;
+
+  if (UseCrc32 != 0U)
+  {
+    if (Msg->Len < CRC32_LEN)
+    {
+      return 0;
+    }
+
+    len = Msg->Len - CRC32_LEN;
+    Msg->Len = len;
+    return (CRC32_Update(CRC32_INIT, Msg->Data, len) == Deserialize(&Msg->Data[len], CRC32_LEN)) ? 1 : 0;
+  }
+
+  if (Msg->Len == 0U)
+  {
+    return 0;
+  }
+
+  return (CHK_CheckAndRemove(Msg) != 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Read the replay state of a CMD_Offline_Bulk_Data reply
+  * @param  Reply the reply
+  * @param  State the replay state
+  * @retval None
+  */
+static void Bulk_State_Get(Msg_t *Reply, Bulk_State_t *State)
+{
+  State->Free = Deserialize(&Reply->Data[4], 2);
+  State->Processed = Deserialize(&Reply->Data[6], 4);
+  State->ElapsedUs = Deserialize(&Reply->Data[10], 4);
+  State->BusyUs = Deserialize(&Reply->Data[14], 4);
+}
@@ -0,0 +1,399 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host check of the DataLogFusion stage profiler: the firmware
+  *          profiler (profiler.c) times a simulated main loop with a stub
+  *          cycle counter, and its table is checked against a reference
+  *          aggregation of the same runs
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include "profiler.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_CLOCK_HZ        84000000U /* SystemCoreClock of the NUCLEO-F401RE */
+#define SIM_TICK_US         10000U    /* ALGO_FREQ 100 Hz */
+#define SIM_CMD_PERIOD      25U       /* One host command every SIM_CMD_PERIOD ticks */
+#define SIM_SPIKE_PERMILLE  10U       /* Runs three times longer, e.g. a bus retry or a preemption */
+#define SIM_START_CYCLES    0xFFF00000U /* Counter at start, wraps around during the first tick */
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Simulated stage: mean cycles of a run
+  */
+typedef struct
+{
+  const char *Name;
+  uint32_t MeanCycles;
+} Stage_Model_t;
+
+/**
+  * @brief  Reference aggregation, computed apart from profiler.c
+  */
+typedef struct
+{
+  uint32_t Count;
+  uint32_t Min;
+  uint32_t Max;
+  double Sum;
+  uint32_t Hist[PROF_HIST_BINS];
+} Ref_Stage_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* Mean cycles at 84 MHz: IKS02A1 reads at 400 kHz (see SCHED_x_BUS_US of app_mems.c), no
+ * environmental sensor, 9 axes Sensor Fusion, fixed layout frame */
+static const Stage_Model_t Model[PROF_STAGE_COUNT] =
+{
+  {"rx parse",   120U},
+  {"command",    2500U},
+  {"rtc",        1400U},
+  {"acc",        26900U},
+  {"gyr",        26900U},
+  {"mag",        17700U},
+  {"press",      0U},
+  {"temp",       0U},
+  {"hum",        0U},
+  {"fx",         61000U},
+  {"frame",      3900U},
+  {"uart send",  1300U},
+  {"tick",       0U},      /* Sum of the nested stages */
+  {"fifo",       0U},      /* Resampling off */
+};
+
+static uint32_t Cycles = SIM_START_CYCLES; /* Stub cycle counter */
+static uint64_t TotalCycles = 0;           /* Counter advance, without wrap around */
+static uint32_t ReadCost = 0;              /* Cycles spent by each counter read */
+static Ref_Stage_t Ref[PROF_STAGE_COUNT];
+static uint32_t Errors = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static uint32_t Run_Stage(uint8_t Stage);
+static uint32_t Work(uint8_t Stage);
+static void Ref_Add(uint8_t Stage, uint32_t RunCycles);
+static void Check(const char *What, uint8_t Stage, uint64_t Got, uint64_t Expected);
+static void Check_Table(void);
+static void Check_Units(void);
+static void Print_Table(uint32_t Ticks);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Stub of the DWT cycle counter, read by PROF_BEGIN and Prof_End
+  * @param  None
+  * @retval Counter value
+  */
+uint32_t Prof_Stub_GetCycles(void)
+{
+  uint32_t value = Cycles;
+
+  Cycles += ReadCost;
+  TotalCycles += ReadCost;
+  return value;
+}
+
+/**
+  * @brief  Simulation entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 if the profiler table matches the reference, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  uint32_t ticks = 1000U;
+  uint32_t tick;
+  uint32_t begin;
+  uint32_t expected;
+  uint8_t stage;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "t:o:s:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 't':
+        ticks = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'o':
+        ReadCost = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        srand((unsigned int)strtoul(optarg, NULL, 0));
+        break;
+      default:
+        Usage();
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+
+  if (ticks == 0U)
+  {
+    Usage();
+    return 1;
+  }
+
+  Check_Units();
+
+  /* Main loop of app_mems.c, one iteration per tick */
+  Prof_Init();
+
+  for (tick = 0; tick < ticks; tick++)
+  {
+    (void)Run_Stage(PROF_STAGE_RX_PARSE);
+
+    if ((tick % SIM_CMD_PERIOD) == 0U)
+    {
+      /* The reply is sent by the command handler */
+      begin = PROF_BEGIN();
+      expected = ReadCost + Work(PROF_STAGE_COMMAND) + Run_Stage(PROF_STAGE_UART_SEND);
+      Ref_Add(PROF_STAGE_COMMAND, expected);
+      Check("run", PROF_STAGE_COMMAND, Prof_End(PROF_STAGE_COMMAND, begin), expected);
+    }
+
+    begin = PROF_BEGIN();
+    expected = ReadCost;
+
+    for (stage = PROF_STAGE_RTC; stage <= PROF_STAGE_FRAME; stage++)
+    {
+      if (Model[stage].MeanCycles != 0U)
+      {
+        expected += Run_Stage(stage);
+      }
+    }
+
+    Ref_Add(PROF_STAGE_TICK, expected);
+    Check("run", PROF_STAGE_TICK, Prof_End(PROF_STAGE_TICK, begin), expected);
+  }
+
+  Check_Table();
+  Print_Table(ticks);
+
+  (void)printf("\n%u ticks, counter wrapped %u times, %u cycles per counter read: %s\n", ticks,
+               (unsigned int)((SIM_START_CYCLES + TotalCycles) >> 32), ReadCost,
+               (Errors == 0U) ? "table matches the reference" : "MISMATCH");
+
+  return (Errors == 0U) ? 0 : 1;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line help
+  * @param  None
+  * @retval None
+  */
+static void Usage(void)
+{
+  (void)fprintf(stderr,
+                "usage: prof_sim [options]\n"
+                "  -t <ticks>   ticks of %u us to simulate (default 1000)\n"
+                "  -o <cycles>  cycles spent by each counter read (default 0)\n"
+                "  -s <seed>    seed of the run durations\n",
+                SIM_TICK_US);
+}
+
+/**
+  * @brief  Run a stage between PROF_BEGIN and Prof_End, as app_mems.c does
+  * @param  Stage PROF_STAGE_x
+  * @retval Cycles expected for the run, counter reads included
+  */
+static uint32_t Run_Stage(uint8_t Stage)
+{
+  uint32_t begin = PROF_BEGIN();
+  uint32_t expected = Work(Stage) + ReadCost;
+
+  Ref_Add(Stage, expected);
+  Check("run", Stage, Prof_End(Stage, begin), expected);
+
+  return expected + ReadCost; /* Including the end read, for the enclosing stage */
+}
+
+/**
+  * @brief  Advance the counter by the duration of a run: +-10 % around the mean, and
+  *         three times longer for SIM_SPIKE_PERMILLE runs out of 1000
+  * @param  Stage PROF_STAGE_x
+  * @retval Cycles of the run
+  */
+static uint32_t Work(uint8_t Stage)
+{
+  uint32_t mean = Model[Stage].MeanCycles;
+  uint32_t run = mean - (mean / 10U) + (uint32_t)((uint64_t)(uint32_t)rand() * (mean / 5U) / RAND_MAX);
+
+  if ((uint32_t)(rand() % 1000) < SIM_SPIKE_PERMILLE)
+  {
+    run *= 3U;
+  }
+
+  Cycles += run;
+  TotalCycles += run;
+  return run;
+}
+
+/**
+  * @brief  Reference aggregation of a run
+  * @param  Stage PROF_STAGE_x
+  * @param  RunCycles cycles of the run
+  * @retval None
+  */
+static void Ref_Add(uint8_t Stage, uint32_t RunCycles)
+{
+  Ref_Stage_t *ref = &Ref[Stage];
+  int bin = (RunCycles == 0U) ? 0 : ((int)floor(log2((double)RunCycles)) - (int)PROF_HIST_SHIFT);
+
+  if (bin < 0)
+  {
+    bin = 0;
+  }
+  else if (bin >= (int)PROF_HIST_BINS)
+  {
+    bin = (int)PROF_HIST_BINS - 1;
+  }
+
+  ref->Min = ((ref->Count == 0U) || (RunCycles < ref->Min)) ? RunCycles : ref->Min;
+  ref->Max = (RunCycles > ref->Max) ? RunCycles : ref->Max;
+  ref->Count++;
+  ref->Sum += (double)RunCycles;
+  ref->Hist[bin]++;
+}
+
+/**
+  * @brief  Compare a value with its expected value
+  * @param  What name of the value
+  * @param  Stage PROF_STAGE_x
+  * @param  Got value
+  * @param  Expected expected value
+  * @retval None
+  */
+static void Check(const char *What, uint8_t Stage, uint64_t Got, uint64_t Expected)
+{
+  if (Got != Expected)
+  {
+    (void)fprintf(stderr, "%s %s: %llu, expected %llu\n", Model[Stage].Name, What, (unsigned long long)Got,
+                  (unsigned long long)Expected);
+    Errors++;
+  }
+}
+
+/**
+  * @brief  Compare the profiler table with the reference
+  * @param  None
+  * @retval None
+  */
+static void Check_Table(void)
+{
+  const Prof_Stage_t *stats;
+  uint8_t stage;
+  uint32_t bin;
+  uint32_t hist;
+
+  for (stage = 0; stage < PROF_STAGE_COUNT; stage++)
+  {
+    stats = Prof_Get(stage);
+
+    Check("count", stage, stats->Count, Ref[stage].Count);
+    Check("min", stage, stats->MinCycles, Ref[stage].Min);
+    Check("max", stage, stats->MaxCycles, Ref[stage].Max);
+    Check("sum", stage, stats->SumCycles, (uint64_t)Ref[stage].Sum);
+    Check("avg", stage, Prof_Avg(stats),
+          (Ref[stage].Count != 0U) ? (uint64_t)floor(Ref[stage].Sum / (double)Ref[stage].Count) : 0U);
+
+    for (bin = 0; bin < PROF_HIST_BINS; bin++)
+    {
+      hist = (Ref[stage].Hist[bin] < 0xFFFFU) ? Ref[stage].Hist[bin] : 0xFFFFU;
+      Check("histogram", stage, stats->Hist[bin], hist);
+    }
+  }
+}
+
+/**
+  * @brief  Check the histogram bin edges, the saturation and the reset
+  * @param  None
+  * @retval None
+  */
+static void Check_Units(void)
+{
+  static const uint32_t Edges[][2] =
+  {
+    {0U, 0U}, {1U, 0U}, {127U, 0U}, {128U, 1U}, {255U, 1U}, {256U, 2U},
+    {(1U << 20) - 1U, 13U}, {1U << 20, 14U}, {(1U << 21) - 1U, 14U}, {1U << 21, 15U}, {0xFFFFFFFFU, 15U},
+  };
+  const Prof_Stage_t *stats;
+  uint32_t i;
+
+  for (i = 0; i < (sizeof(Edges) / sizeof(Edges[0])); i++)
+  {
+    Check("bin", 0U, Prof_Hist_Bin(Edges[i][0]), Edges[i][1]);
+  }
+
+  Prof_Init();
+
+  for (i = 0; i < 70000U; i++)
+  {
+    Prof_Add(PROF_STAGE_FX, 200U);
+  }
+
+  Prof_Add(PROF_STAGE_COUNT, 200U); /* Out of range, ignored */
+  Prof_Add(PROF_STAGE_FRAME, 5U);
+
+  stats = Prof_Get(PROF_STAGE_FX);
+  Check("saturated count", PROF_STAGE_FX, stats->Count, 70000U);
+  Check("saturated bin", PROF_STAGE_FX, stats->Hist[1], 0xFFFFU);
+  Check("out of range", PROF_STAGE_FX, (Prof_Get(PROF_STAGE_COUNT) == NULL) ? 0U : 1U, 0U);
+
+  Prof_Reset(PROF_STAGE_FX);
+  Check("reset", PROF_STAGE_FX, Prof_Get(PROF_STAGE_FX)->Count, 0U);
+  Check("reset other", PROF_STAGE_FRAME, Prof_Get(PROF_STAGE_FRAME)->Count, 1U);
+  Check("reset avg", PROF_STAGE_FX, Prof_Avg(Prof_Get(PROF_STAGE_FX)), 0U);
+
+  Prof_Reset(PROF_STAGE_ALL);
+  Check("reset all", PROF_STAGE_FRAME, Prof_Get(PROF_STAGE_FRAME)->Count, 0U);
+}
+
+/**
+  * @brief  Print the table as returned by CMD_Get_Profile, with the share of the tick
+  * @param  Ticks number of ticks
+  * @retval None
+  */
+static void Print_Table(uint32_t Ticks)
+{
+  const Prof_Stage_t *stats;
+  uint32_t cycles_per_us = SIM_CLOCK_HZ / 1000000U;
+  uint8_t stage;
+  uint32_t bin;
+
+  (void)printf("%-10s %8s %8s %8s %8s %8s %7s  %s\n", "stage", "runs", "min us", "avg us", "max us", "us/tick",
+               "budget", "histogram from 2^7 cycles");
+
+  for (stage = 0; stage < PROF_STAGE_COUNT; stage++)
+  {
+    stats = Prof_Get(stage);
+
+    (void)printf("%-10s %8u %8.1f %8.1f %8.1f %8.1f %6.1f%% ", Model[stage].Name, stats->Count,
+                 (double)stats->MinCycles / cycles_per_us, (double)Prof_Avg(stats) / cycles_per_us,
+                 (double)stats->MaxCycles / cycles_per_us,
+                 (double)stats->SumCycles / cycles_per_us / Ticks,
+                 100.0 * (double)stats->SumCycles / cycles_per_us / Ticks / SIM_TICK_US);
+
+    for (bin = 0; bin < PROF_HIST_BINS; bin++)
+    {
+      (void)printf(" %u", stats->Hist[bin]);
+    }
+
+    (void)printf("\n");
+  }
+}
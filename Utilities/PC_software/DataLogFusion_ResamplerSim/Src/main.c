@@ -0,0 +1,339 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host benchmark of the DataLogFusion resampler: a sensor sampling a
+  *          sine wave at its own ODR is read in batches on the algorithm tick,
+  *          and the firmware resampler (resampler.c) output is compared with
+  *          the exact signal at the output times
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include "resampler.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_AMPLITUDE   1000.0  /* [mg] */
+#define SIM_WARMUP      50U     /* Ticks not measured, the input clock recovery settles */
+#define SIM_MODES       3U
+#define SIM_FIFO_LEN    64U     /* Samples read at most per tick */
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Result of a run at a frequency
+  */
+typedef struct
+{
+  double Gain;        /* Output amplitude at the input frequency, ratio of the input one */
+  double DelayUs;     /* Output delay on the exact signal at the output time, resampler latency excluded [us] */
+  double ErrorRms;    /* Error on the exact signal at the output time, ratio of the amplitude */
+  double OutRms;      /* Output RMS, ratio of the input one */
+  double StampRms;    /* Error of the recovered sample times [us] */
+  uint32_t Holds;
+} Result_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const char *ModeName[SIM_MODES] = {"off", "linear", "fir"};
+static const double Freqs[] = {0.5, 1.0, 2.0, 5.0, 10.0, 20.0, 30.0, 40.0, 60.0, 80.0, 150.0};
+
+static double Odr = 208.0;        /* Nominal sensor ODR [Hz] */
+static double AlgoFreq = 100.0;   /* Algorithm rate [Hz] */
+static double DriftPpm = 15000.0; /* Sensor ODR deviation from the nominal one [ppm] */
+static double JitterUs = 300.0;   /* FIFO read delay after the tick, uniform from 0 [us] */
+static uint32_t Ticks = 3000U;
+static uint32_t Errors = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static Result_t Run(uint8_t Mode, double Freq);
+static double Signal(double Freq, double TimeS);
+static void Check(const char *What, uint8_t Mode, double Freq, int Ok);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Benchmark entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 if the checks pass, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  Resampler_t rs;
+  Result_t res[SIM_MODES][sizeof(Freqs) / sizeof(Freqs[0])];
+  char latency[16];
+  uint32_t f;
+  uint8_t mode;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "r:a:d:j:t:s:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'r':
+        Odr = strtod(optarg, NULL);
+        break;
+      case 'a':
+        AlgoFreq = strtod(optarg, NULL);
+        break;
+      case 'd':
+        DriftPpm = strtod(optarg, NULL);
+        break;
+      case 'j':
+        JitterUs = strtod(optarg, NULL);
+        break;
+      case 't':
+        Ticks = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        srand((unsigned int)strtoul(optarg, NULL, 0));
+        break;
+      default:
+        Usage();
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+
+  if ((Odr <= 0.0) || (AlgoFreq <= 0.0) || (Ticks <= (2U * SIM_WARMUP)))
+  {
+    Usage();
+    return 1;
+  }
+
+  (void)printf("sensor ODR %.1f Hz nominal, %+.0f ppm, read at %.0f Hz with up to %.0f us of delay\n\n", Odr,
+               DriftPpm, AlgoFreq, JitterUs);
+  (void)printf("%-7s %9s  %6s %9s %9s %9s  %s\n", "mode", "latency", "freq", "gain dB", "delay us", "error %",
+               "out/in dB above the output Nyquist");
+
+  for (mode = 0; mode < SIM_MODES; mode++)
+  {
+    Resampler_Init(&rs, mode, (float)Odr, (float)AlgoFreq);
+
+    for (f = 0; f < (sizeof(Freqs) / sizeof(Freqs[0])); f++)
+    {
+      res[mode][f] = Run(mode, Freqs[f]);
+
+      if (Freqs[f] < (AlgoFreq / 2.0))
+      {
+        if (f == 0U)
+        {
+          (void)snprintf(latency, sizeof(latency), "%.1fms", (double)rs.DelayUs / 1000.0);
+        }
+
+        (void)printf("%-7s %9s  %6.1f %9.2f %9.0f %9.2f\n", (f == 0U) ? ModeName[mode] : "",
+                     (f == 0U) ? latency : "", Freqs[f], 20.0 * log10(res[mode][f].Gain),
+                     res[mode][f].DelayUs, 100.0 * res[mode][f].ErrorRms);
+      }
+      else if (Freqs[f] < (Odr / 2.0))
+      {
+        (void)printf("%-7s %9s  %6.1f %9s %9s %9s  %.1f\n", "", "", Freqs[f], "-", "-", "-",
+                     20.0 * log10(res[mode][f].OutRms));
+      }
+      else
+      {
+        /* Aliased by the sensor sampling itself */
+      }
+
+      Check("holds", mode, Freqs[f], res[mode][f].Holds == 0U);
+    }
+
+    (void)printf("%-7s recovered sample times %.0f us RMS from the exact ones\n\n", "", res[mode][0].StampRms);
+  }
+
+  /* Pass band: unity gain and no residual delay with resampling, lower error than without */
+  for (f = 0; f < (sizeof(Freqs) / sizeof(Freqs[0])); f++)
+  {
+    if (Freqs[f] <= (AlgoFreq / 20.0))
+    {
+      Check("gain", RESAMPLER_MODE_LINEAR, Freqs[f], fabs(20.0 * log10(res[RESAMPLER_MODE_LINEAR][f].Gain)) < 0.1);
+      Check("gain", RESAMPLER_MODE_FIR, Freqs[f], fabs(20.0 * log10(res[RESAMPLER_MODE_FIR][f].Gain)) < 0.1);
+      Check("delay", RESAMPLER_MODE_FIR, Freqs[f], fabs(res[RESAMPLER_MODE_FIR][f].DelayUs) < (100000.0 / Odr));
+      Check("error", RESAMPLER_MODE_FIR, Freqs[f],
+            res[RESAMPLER_MODE_FIR][f].ErrorRms < res[RESAMPLER_MODE_OFF][f].ErrorRms);
+      Check("error", RESAMPLER_MODE_LINEAR, Freqs[f],
+            res[RESAMPLER_MODE_LINEAR][f].ErrorRms < res[RESAMPLER_MODE_OFF][f].ErrorRms);
+    }
+  }
+
+  (void)printf("%s\n", (Errors == 0U) ? "checks passed" : "CHECKS FAILED");
+
+  return (Errors == 0U) ? 0 : 1;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line help
+  * @param  None
+  * @retval None
+  */
+static void Usage(void)
+{
+  (void)fprintf(stderr,
+                "usage: rs_sim [options]\n"
+                "  -r <Hz>     nominal sensor ODR (default 208)\n"
+                "  -a <Hz>     algorithm rate (default 100)\n"
+                "  -d <ppm>    sensor ODR deviation (default 15000)\n"
+                "  -j <us>     FIFO read delay after the tick, uniform from 0 (default 300)\n"
+                "  -t <ticks>  ticks per frequency (default 3000)\n"
+                "  -s <seed>   seed of the read delays\n");
+}
+
+/**
+  * @brief  Run the resampler on a sine wave
+  * @note   On each tick the samples produced up to the read are pushed as a FIFO batch, then
+  *         the output of the tick time is compared with the signal DelayUs before it.
+  * @param  Mode RESAMPLER_MODE_x
+  * @param  Freq sine wave frequency [Hz]
+  * @retval Result
+  */
+static Result_t Run(uint8_t Mode, double Freq)
+{
+  static Resampler_t rs;
+  int32_t batch[SIM_FIFO_LEN][RESAMPLER_AXES];
+  int32_t out[RESAMPLER_AXES];
+  Result_t res;
+  double period = 1.0 / (Odr * (1.0 + (DriftPpm * 1.0e-6)));
+  double phase0 = 0.3; /* Sensor sampling start [s], not aligned on the ticks */
+  double tick_s;
+  double read_s;
+  double t_out;
+  double ref;
+  double sum_err = 0.0;
+  double sum_out = 0.0;
+  double sum_stamp = 0.0;
+  double ss = 0.0;
+  double sc = 0.0;
+  double cc = 0.0;
+  double ys = 0.0;
+  double yc = 0.0;
+  double a;
+  double b;
+  double det;
+  uint64_t sample = 0;
+  uint32_t stamps = 0;
+  uint32_t count;
+  uint32_t tick;
+  uint32_t i;
+  uint32_t n = 0;
+
+  Resampler_Init(&rs, Mode, (float)Odr, (float)AlgoFreq);
+  (void)memset(&res, 0, sizeof(res));
+
+  for (tick = 0; tick < Ticks; tick++)
+  {
+    tick_s = 1.0 + ((double)tick / AlgoFreq);
+    read_s = tick_s + (JitterUs * 1.0e-6 * (double)rand() / (double)RAND_MAX);
+
+    /* FIFO batch: the samples produced up to the read, the oldest dropped if it overflowed */
+    count = 0;
+    while ((phase0 + ((double)sample * period)) <= read_s)
+    {
+      if (count == SIM_FIFO_LEN)
+      {
+        (void)memmove(batch[0], batch[1], sizeof(batch) - sizeof(batch[0]));
+        count--;
+      }
+
+      batch[count][0] = (int32_t)lround(Signal(Freq, phase0 + ((double)sample * period)));
+      batch[count][1] = -batch[count][0];
+      batch[count][2] = 0;
+      count++;
+      sample++;
+    }
+
+    Resampler_Push_Batch(&rs, (uint32_t)llround(read_s * 1.0e6), (const int32_t (*)[RESAMPLER_AXES])batch, count);
+
+    if (tick >= SIM_WARMUP)
+    {
+      for (i = 0; i < count; i++)
+      {
+        double exact = (phase0 + ((double)(sample - count + i) * period)) * 1.0e6;
+        double got = (double)rs.TimeUs[(rs.Pushed - count + i) & (RESAMPLER_BUF_LEN - 1U)];
+        double diff = got - fmod(exact, 4294967296.0);
+
+        sum_stamp += diff * diff;
+        stamps++;
+      }
+    }
+
+    /* Output of the tick, the timer time */
+    if ((Resampler_Get(&rs, (uint32_t)llround(tick_s * 1.0e6), out) == 0) && (tick >= SIM_WARMUP))
+    {
+      res.Holds++;
+    }
+
+    if (tick < SIM_WARMUP)
+    {
+      continue;
+    }
+
+    t_out = tick_s - ((double)rs.DelayUs * 1.0e-6);
+    ref = Signal(Freq, t_out);
+    sum_err += ((double)out[0] - ref) * ((double)out[0] - ref);
+    sum_out += (double)out[0] * (double)out[0];
+
+    /* Least squares fit of a sine and a cosine at the output times */
+    a = sin(2.0 * M_PI * Freq * t_out);
+    b = cos(2.0 * M_PI * Freq * t_out);
+    ss += a * a;
+    sc += a * b;
+    cc += b * b;
+    ys += (double)out[0] * a;
+    yc += (double)out[0] * b;
+    n++;
+  }
+
+  det = (ss * cc) - (sc * sc);
+  a = ((ys * cc) - (yc * sc)) / det;
+  b = ((yc * ss) - (ys * sc)) / det;
+
+  res.Gain = sqrt((a * a) + (b * b)) / SIM_AMPLITUDE;
+  res.DelayUs = atan2(-b, a) / (2.0 * M_PI * Freq) * 1.0e6;
+  res.ErrorRms = sqrt(sum_err / n) / SIM_AMPLITUDE;
+  res.OutRms = sqrt(sum_out / n) / (SIM_AMPLITUDE / sqrt(2.0));
+  res.StampRms = (stamps != 0U) ? sqrt(sum_stamp / stamps) : 0.0;
+
+  return res;
+}
+
+/**
+  * @brief  Input signal
+  * @param  Freq frequency [Hz]
+  * @param  TimeS time [s]
+  * @retval Value [mg]
+  */
+static double Signal(double Freq, double TimeS)
+{
+  return SIM_AMPLITUDE * sin(2.0 * M_PI * Freq * TimeS);
+}
+
+/**
+  * @brief  Account a check
+  * @param  What name of the check
+  * @param  Mode RESAMPLER_MODE_x
+  * @param  Freq frequency [Hz]
+  * @param  Ok not 0 if passed
+  * @retval None
+  */
+static void Check(const char *What, uint8_t Mode, double Freq, int Ok)
+{
+  if (Ok == 0)
+  {
+    (void)fprintf(stderr, "%s %.1f Hz: %s check failed\n", ModeName[Mode], Freq, What);
+    Errors++;
+  }
+}
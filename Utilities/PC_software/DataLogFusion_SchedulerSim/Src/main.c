@@ -0,0 +1,305 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host simulation of the DataLogFusion acquisition tick timeline: the
+  *          sensor tasks of app_mems.c are run by the firmware scheduler
+  *          (sensor_scheduler.c) and the bus time of each tick is reported,
+  *          against every sensor read on every tick
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "sensor_scheduler.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define ALGO_FREQ          100U                 /* As in app_mems.c */
+#define TICK_US            (1000000U / ALGO_FREQ)
+#define SCHED_ENV_PERIOD   ALGO_FREQ
+#define SCHED_PRESS_PHASE  (ALGO_FREQ / 4U)
+#define SCHED_TEMP_PHASE   (ALGO_FREQ / 2U)
+#define SCHED_HUM_PHASE    ((3U * ALGO_FREQ) / 4U)
+#define TASK_COUNT         6U
+
+/* SensorsEnabled masks, as in demo_serial.h */
+#define PRESSURE_SENSOR       0x00000001U
+#define TEMPERATURE_SENSOR    0x00000002U
+#define HUMIDITY_SENSOR       0x00000004U
+#define ACCELEROMETER_SENSOR  0x00000010U
+#define GYROSCOPE_SENSOR      0x00000020U
+#define MAGNETIC_SENSOR       0x00000040U
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Tick timeline statistics
+  */
+typedef struct
+{
+  uint64_t TotalUs;
+  uint32_t MaxUs;
+  uint32_t MaxTick;
+  uint32_t Overruns;   /* Ticks whose bus time exceeds the tick period */
+} Timeline_t;
+
+/**
+  * @brief  Board preset: bus time of a read of each sensor [us]
+  */
+typedef struct
+{
+  const char *Name;
+  uint16_t BusUs[TASK_COUNT];  /* ACC, GYR, MAG, HUM, TEMP, PRESS */
+  const char *Note;
+} Board_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const TaskName[TASK_COUNT] = {"acc", "gyr", "mag", "hum", "temp", "press"};
+
+static const Board_t Boards[] =
+{
+  {"iks02a1", {320U, 320U, 210U, 0U, 0U, 0U},
+   "ISM330DHCX, IIS2MDC at 400 kHz, no environmental sensor"},
+  {"iks4a1", {320U, 320U, 210U, 10250U, 110U, 180U},
+   "LSM6DSV16X, LIS2MDL, SHT40 (10 ms conversion wait), STTS22H, LPS22DF at 400 kHz"},
+};
+
+static uint32_t Runs[TASK_COUNT];
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static void Acc_Handler(void);
+static void Gyr_Handler(void);
+static void Mag_Handler(void);
+static void Hum_Handler(void);
+static void Temp_Handler(void);
+static void Press_Handler(void);
+static void Timeline_Add(Timeline_t *Timeline, uint32_t Tick, uint32_t BusUs);
+static void Timeline_Print(const char *Name, const Timeline_t *Timeline, uint32_t Ticks);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Simulation entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 on success, 1 on error
+  */
+int main(int argc, char *argv[])
+{
+  Sensor_Task_t tasks[TASK_COUNT] =
+  {
+    {Acc_Handler,   ACCELEROMETER_SENSOR, 1U,               0U,                0U},
+    {Gyr_Handler,   GYROSCOPE_SENSOR,     1U,               0U,                0U},
+    {Mag_Handler,   MAGNETIC_SENSOR,      1U,               0U,                0U},
+    {Hum_Handler,   HUMIDITY_SENSOR,      SCHED_ENV_PERIOD, SCHED_HUM_PHASE,   0U},
+    {Temp_Handler,  TEMPERATURE_SENSOR,   SCHED_ENV_PERIOD, SCHED_TEMP_PHASE,  0U},
+    {Press_Handler, PRESSURE_SENSOR,      SCHED_ENV_PERIOD, SCHED_PRESS_PHASE, 0U},
+  };
+  Sensor_Task_t every_tick[TASK_COUNT];
+  const Board_t *board = &Boards[0];
+  const char *csv_path = NULL;
+  FILE *csv = NULL;
+  Timeline_t sched = {0};
+  Timeline_t base = {0};
+  uint32_t enabled = 0x77U;
+  uint32_t ticks = 10U * ALGO_FREQ;
+  uint32_t bus_us;
+  uint32_t base_us;
+  uint32_t tick;
+  uint32_t i;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "b:e:t:c:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'b':
+        for (i = 0; i < (sizeof(Boards) / sizeof(Boards[0])); i++)
+        {
+          if (strcmp(optarg, Boards[i].Name) == 0)
+          {
+            board = &Boards[i];
+            break;
+          }
+        }
+
+        if (i == (sizeof(Boards) / sizeof(Boards[0])))
+        {
+          Usage();
+          return 1;
+        }
+        break;
+      case 'e':
+        enabled = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 't':
+        ticks = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'c':
+        csv_path = optarg;
+        break;
+      default:
+        Usage();
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+
+  if ((ticks == 0U) || (ticks == SENSOR_SCHED_TICK_ALL))
+  {
+    Usage();
+    return 1;
+  }
+
+  for (i = 0; i < TASK_COUNT; i++)
+  {
+    tasks[i].BusUs = board->BusUs[i];
+    every_tick[i] = tasks[i];
+    every_tick[i].Period = 1U;
+    every_tick[i].Phase = 0U;
+  }
+
+  if ((csv_path != NULL) && ((csv = fopen(csv_path, "w")) == NULL))
+  {
+    perror(csv_path);
+    return 1;
+  }
+
+  if (csv != NULL)
+  {
+    (void)fprintf(csv, "tick,sched_bus_us,every_tick_bus_us\n");
+  }
+
+  for (tick = 0; tick < ticks; tick++)
+  {
+    Sensor_Sched_Run(tasks, TASK_COUNT, tick, enabled);
+    bus_us = Sensor_Sched_BusUs(tasks, TASK_COUNT, tick, enabled);
+    base_us = Sensor_Sched_BusUs(every_tick, TASK_COUNT, tick, enabled);
+    Timeline_Add(&sched, tick, bus_us);
+    Timeline_Add(&base, tick, base_us);
+
+    if (csv != NULL)
+    {
+      (void)fprintf(csv, "%u,%u,%u\n", tick, bus_us, base_us);
+    }
+  }
+
+  if (csv != NULL)
+  {
+    (void)fclose(csv);
+  }
+
+  (void)printf("board %s: %s\n", board->Name, board->Note);
+  (void)printf("%u ticks of %u us, sensors 0x%02X\n\n", ticks, TICK_US, enabled);
+  (void)printf("%-6s %8s %8s %8s %8s\n", "sensor", "period", "phase", "bus us", "reads");
+
+  for (i = 0; i < TASK_COUNT; i++)
+  {
+    (void)printf("%-6s %8u %8u %8u %8u\n", TaskName[i], tasks[i].Period, tasks[i].Phase, tasks[i].BusUs, Runs[i]);
+  }
+
+  (void)printf("\n%-12s %12s %12s %12s %10s\n", "bus per tick", "mean us", "max us", "max at tick", "overruns");
+  Timeline_Print("scheduled", &sched, ticks);
+  Timeline_Print("every tick", &base, ticks);
+
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line help
+  * @param  None
+  * @retval None
+  */
+static void Usage(void)
+{
+  (void)fprintf(stderr,
+                "usage: sched_sim [options]\n"
+                "  -b iks02a1|iks4a1  bus times of the sensors of the board (default iks02a1)\n"
+                "  -e <mask>          SensorsEnabled mask (default 0x77)\n"
+                "  -t <ticks>         ticks of %u us to simulate (default %u)\n"
+                "  -c <file.csv>      per tick bus time, scheduled and every sensor on every tick\n",
+                TICK_US, 10U * ALGO_FREQ);
+}
+
+/**
+  * @brief  Simulated sensor handlers, counting the reads
+  * @param  None
+  * @retval None
+  */
+static void Acc_Handler(void)
+{
+  Runs[0]++;
+}
+
+static void Gyr_Handler(void)
+{
+  Runs[1]++;
+}
+
+static void Mag_Handler(void)
+{
+  Runs[2]++;
+}
+
+static void Hum_Handler(void)
+{
+  Runs[3]++;
+}
+
+static void Temp_Handler(void)
+{
+  Runs[4]++;
+}
+
+static void Press_Handler(void)
+{
+  Runs[5]++;
+}
+
+/**
+  * @brief  Account the bus time of a tick
+  * @param  Timeline pointer to the statistics
+  * @param  Tick the tick
+  * @param  BusUs bus time of the tick [us]
+  * @retval None
+  */
+static void Timeline_Add(Timeline_t *Timeline, uint32_t Tick, uint32_t BusUs)
+{
+  Timeline->TotalUs += BusUs;
+
+  if (BusUs > Timeline->MaxUs)
+  {
+    Timeline->MaxUs = BusUs;
+    Timeline->MaxTick = Tick;
+  }
+
+  if (BusUs > TICK_US)
+  {
+    Timeline->Overruns++;
+  }
+}
+
+/**
+  * @brief  Print the statistics of a timeline
+  * @param  Name timeline name
+  * @param  Timeline pointer to the statistics
+  * @param  Ticks number of ticks
+  * @retval None
+  */
+static void Timeline_Print(const char *Name, const Timeline_t *Timeline, uint32_t Ticks)
+{
+  (void)printf("%-12s %12.1f %12u %12u %10u\n", Name, (double)Timeline->TotalUs / (double)Ticks, Timeline->MaxUs,
+               Timeline->MaxTick, Timeline->Overruns);
+}
@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file    com_host_stub.h
+  * @author  MEMS Software Solutions Team
+  * @brief   Host stubs of the HAL UART, DMA and core definitions used by com.c,
+  *          included by com.h when COM_HOST_STUB is defined
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef COM_HOST_STUB_H
+#define COM_HOST_STUB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  HAL status
+  */
+typedef enum
+{
+  HAL_OK      = 0x00U,
+  HAL_ERROR   = 0x01U,
+  HAL_BUSY    = 0x02U,
+  HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+/**
+  * @brief  DMA stream model: transfer error flag and remaining data units
+  */
+typedef struct
+{
+  uint32_t TeFlag;
+  uint32_t Counter;
+} DMA_HandleTypeDef;
+
+/**
+  * @brief  UART handle, the fields used by com.c
+  */
+typedef struct
+{
+  void *Instance;
+  uint8_t *pRxBuffPtr;
+  uint16_t RxXferSize;
+  volatile uint32_t ErrorCode;
+  volatile uint32_t gState;
+  volatile uint32_t RxState;
+  DMA_HandleTypeDef *hdmarx;
+} UART_HandleTypeDef;
+
+#ifdef COM_HOST_CRC
+/**
+  * @brief  CRC unit registers
+  */
+typedef struct
+{
+  volatile uint32_t DR;
+  volatile uint32_t IDR;
+  volatile uint32_t CR;
+} CRC_TypeDef;
+#endif /* COM_HOST_CRC */
+
+/* Exported defines ----------------------------------------------------------*/
+#define RESET                       0U
+#define COM1                        0U
+
+#define HAL_UART_STATE_READY        0x20U
+#define HAL_UART_STATE_BUSY_TX      0x21U
+#define HAL_UART_STATE_BUSY_RX      0x22U
+#define HAL_UART_ERROR_NONE         0x00U
+
+#ifdef COM_HOST_CRC
+/* com.c feeds whole words to the CRC unit model of the host program */
+#define HAL_CRC_MODULE_ENABLED
+#define CRC                         (&SimCrc)
+#define CRC_CR_RESET                0x01U
+#endif /* COM_HOST_CRC */
+
+/* Exported macro ------------------------------------------------------------*/
+#define __HAL_DMA_GET_TE_FLAG_INDEX(__HANDLE__)       0U
+#define __HAL_DMA_GET_FLAG(__HANDLE__, __FLAG__)      ((__HANDLE__)->TeFlag)
+#define __HAL_DMA_GET_COUNTER(__HANDLE__)             ((__HANDLE__)->Counter)
+
+#ifdef COM_HOST_CRC
+#define WRITE_REG(REG, VAL)         Sim_Crc_Write(&(REG), (VAL))
+#define READ_REG(REG)               Sim_Crc_Read(&(REG))
+#endif /* COM_HOST_CRC */
+
+/* Exported variables --------------------------------------------------------*/
+extern UART_HandleTypeDef hcom_uart[];
+#ifdef COM_HOST_CRC
+extern CRC_TypeDef SimCrc;
+#endif /* COM_HOST_CRC */
+
+/* Exported functions --------------------------------------------------------*/
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+uint32_t __get_PRIMASK(void);
+void __disable_irq(void);
+void __set_PRIMASK(uint32_t priMask);
+#ifdef COM_HOST_CRC
+void Sim_Crc_Write(volatile uint32_t *Reg, uint32_t Value);
+uint32_t Sim_Crc_Read(volatile uint32_t *Reg);
+#endif /* COM_HOST_CRC */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COM_HOST_STUB_H */
@@ -0,0 +1,1626 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host check of the serial protocol of the DataLogFusion application:
+  *          com.c and serial_protocol.c run on a stub UART with DMA, and their
+  *          output is checked against reference models
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "com.h"
+#include "profiler.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_WIRE_SIZE       (64U * 1024U * 1024U) /* Bytes sent on the stub UART */
+#define SIM_SEQ_LEN         4U                    /* Sequence number at the payload beginning */
+#define SIM_PAYLOAD_MAX     40U                   /* Longest queue check payload */
+#define BENCH_LEN           240U                  /* Benchmark payload, a typical data frame */
+#define BENCH_MSGS          4096U                 /* Benchmark payloads per pass */
+#define BENCH_PASSES        200U
+#define CRC32_POLY          0x04C11DB7U           /* CRC-32/MPEG-2 polynomial */
+#define CRC32_CHECK         0x0376E6E7U           /* CRC-32/MPEG-2 of "123456789" */
+#define CRC_FLIP_MSGS       64U                   /* Messages with every single bit corrupted */
+#define CRC_FLIP_LEN_MAX    60U                   /* Longest payload of these messages */
+#define RX_FUZZ_GARBAGE_MAX ((uint32_t)Msg_MaxLen + 64U) /* Longest garbage burst, too long frames included */
+#define RX_BENCH_FRAMES     1024U                 /* Benchmark frames */
+#define RX_BENCH_LEN        240U                  /* Benchmark frame payload, trailer included */
+#define RX_BENCH_CHUNK      16U                   /* Bytes received between two main loop passes */
+#define RX_BENCH_IDLE       8U                    /* Main loop passes without new bytes after each chunk */
+#define RX_BENCH_PASSES     20U
+#define UART_MSG_MAX_SIZE   Msg_MaxLen
+#define BUILDER_OVERSIZE    16U                   /* Builder payloads up to Msg_MaxLen plus this */
+#define BUILDER_PUT_MAX     32U                   /* Longest UART_FramePut chunk */
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Reference model of the transmit queue
+  */
+typedef struct
+{
+  uint32_t Waiting[UART_TX_QUEUE_LEN]; /* Sequence numbers waiting for the line, oldest first */
+  uint32_t Count;
+  int64_t Active;                      /* Sequence number on the line, -1 if none */
+  uint8_t FailNext;                    /* The next transmission start fails */
+  Uart_TxStats_t Stats;
+  uint32_t *pSent;                     /* Sequence numbers expected on the line */
+  uint32_t SentLen;
+} Ref_Queue_t;
+
+/**
+  * @brief  Frame of a reception fuzz stream
+  */
+typedef struct
+{
+  uint32_t Start;     /* Offset of the first byte in the stream */
+  uint32_t Stop;      /* Offset following the delimiter */
+  uint8_t Intact;     /* The frame reaches the parser unchanged */
+} Rx_Frame_t;
+
+/* Private variables ---------------------------------------------------------*/
+UART_HandleTypeDef hcom_uart[1];
+
+static uint8_t SimUsart;                /* Identity of the UART instance */
+static DMA_HandleTypeDef SimDmaRx;
+static uint8_t *SimTxData = NULL;       /* Transfer on the line */
+static uint16_t SimTxSize = 0;
+static uint8_t SimTxFailNext = 0;       /* The next HAL_UART_Transmit_DMA fails */
+static uint32_t SimPrimask = 0;
+static uint8_t *Wire;                   /* Bytes completely sent on the line */
+static uint32_t WireLen = 0;
+static uint32_t SimCycles = 0;
+#ifdef COM_HOST_CRC
+CRC_TypeDef SimCrc;
+static uint32_t SimCrcWords = 0;        /* Words fed to the CRC unit */
+#endif /* COM_HOST_CRC */
+static uint32_t RandState = 1U;
+static uint16_t LegacyStartOfMsg = 0;   /* Parse position of Legacy_ReceivedMSG */
+static uint32_t Errors = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static uint32_t Rand32(void);
+static void Payload_Build(uint32_t Seq, Msg_t *Msg);
+static void Sim_Reset(void);
+static void Sim_TxComplete(void);
+static void Sim_TxError(void);
+static void Ref_StartNext(Ref_Queue_t *Ref);
+static void Ref_Send(Ref_Queue_t *Ref, uint32_t Seq);
+static uint32_t Wire_Check(const Ref_Queue_t *Ref);
+static void Check_TxQueue(uint32_t Count);
+static void Msg_Random(Msg_t *Msg);
+static int32_t Stuff_Reference(uint8_t *Dest, const Msg_t *Source);
+static void Check_Framing(uint32_t Count);
+static double Time_Now(void);
+static void Bench_Stuffing(void);
+static uint32_t Sim_Receive(const uint8_t *Data, uint32_t Len, uint32_t Chunk, Msg_t *Out, uint32_t OutMax);
+static uint32_t Frame_Encode(uint8_t *Dest, Msg_t *Msg, uint8_t Framing);
+static uint32_t Crc_Reference(uint32_t Crc, const uint8_t *Data, uint32_t Len);
+static void Check_Crc(uint32_t Count);
+static uint32_t Sim_RxError(void);
+static uint32_t Rx_Stream_Build(uint8_t *Stream, Rx_Frame_t *Frames, Msg_t *Expected, uint32_t Count, uint8_t Framing,
+                                uint8_t Integrity, uint8_t Noise);
+static void Check_RxParser(uint32_t Count);
+static int32_t Legacy_ReceivedMSG(Msg_t *Msg);
+static void Bench_RxParser(void);
+static uint32_t Sim_TxCapture(uint8_t *Dest);
+static void Check_FrameBuilder(uint32_t Count);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Simulation entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 if every check passes, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  uint32_t count = 200000U;
+  uint32_t frames = 200000U;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:f:s:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'n':
+        count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'f':
+        frames = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        RandState = (uint32_t)strtoul(optarg, NULL, 0) | 1U;
+        break;
+      default:
+        Usage();
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+
+  Wire = (uint8_t *)malloc(SIM_WIRE_SIZE);
+
+  if (Wire == NULL)
+  {
+    printf("Out of memory\n");
+    return 1;
+  }
+
+  Check_TxQueue(count);
+  Check_Framing(frames);
+  Bench_Stuffing();
+  Check_Crc(frames / 10U);
+  Check_RxParser(frames / 10U);
+  Bench_RxParser();
+  Check_FrameBuilder(frames / 10U);
+
+  free(Wire);
+
+  printf("%s: %u errors\n", (Errors == 0U) ? "PASS" : "FAIL", Errors);
+  return (Errors == 0U) ? 0 : 1;
+}
+
+/**
+  * @brief  Stub of the UART DMA transmission: the transfer stays on the line until
+  *         Sim_TxComplete or Sim_TxError
+  * @param  huart UART handle
+  * @param  pData pointer to the bytes
+  * @param  Size number of bytes
+  * @retval HAL_OK, HAL_BUSY if a transfer is on the line, HAL_ERROR if a failure is injected
+  */
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  if (huart->gState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if (SimTxFailNext != 0U)
+  {
+    SimTxFailNext = 0;
+    return HAL_ERROR;
+  }
+
+  huart->gState = HAL_UART_STATE_BUSY_TX;
+  SimTxData = pData;
+  SimTxSize = Size;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stub of the UART DMA reception to idle
+  * @param  huart UART handle
+  * @param  pData pointer to the reception buffer
+  * @param  Size reception buffer size
+  * @retval HAL_OK
+  */
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  huart->RxState = HAL_UART_STATE_BUSY_RX;
+  huart->pRxBuffPtr = pData;
+  huart->hdmarx->Counter = Size;
+  huart->hdmarx->TeFlag = RESET;
+  return HAL_OK;
+}
+
+/**
+  * @brief  PRIMASK stub
+  * @retval PRIMASK value
+  */
+uint32_t __get_PRIMASK(void)
+{
+  return SimPrimask;
+}
+
+/**
+  * @brief  Interrupt disable stub
+  * @retval None
+  */
+void __disable_irq(void)
+{
+  SimPrimask = 1;
+}
+
+/**
+  * @brief  PRIMASK restore stub
+  * @param  priMask PRIMASK value
+  * @retval None
+  */
+void __set_PRIMASK(uint32_t priMask)
+{
+  SimPrimask = priMask;
+}
+
+/**
+  * @brief  Cycle counter of the profiler
+  * @retval Cycles
+  */
+uint32_t Prof_Stub_GetCycles(void)
+{
+  return SimCycles++;
+}
+
+#ifdef COM_HOST_CRC
+/**
+  * @brief  CRC unit model: a CR reset loads the initial value, a DR write runs
+  *         the 32 bits of the word through the CRC, most significant bit first
+  * @param  Reg pointer to the register
+  * @param  Value written value
+  * @retval None
+  */
+void Sim_Crc_Write(volatile uint32_t *Reg, uint32_t Value)
+{
+  uint32_t crc;
+  uint32_t i;
+
+  if (Reg == &SimCrc.DR)
+  {
+    crc = SimCrc.DR ^ Value;
+
+    for (i = 0; i < 32U; i++)
+    {
+      crc = ((crc & 0x80000000U) != 0U) ? ((crc << 1) ^ CRC32_POLY) : (crc << 1);
+    }
+
+    SimCrc.DR = crc;
+    SimCrcWords++;
+  }
+  else if ((Reg == &SimCrc.CR) && ((Value & CRC_CR_RESET) != 0U))
+  {
+    SimCrc.DR = CRC32_INIT;
+  }
+  else
+  {
+    *Reg = Value;
+  }
+}
+
+/**
+  * @brief  CRC unit model register read
+  * @param  Reg pointer to the register
+  * @retval Register value
+  */
+uint32_t Sim_Crc_Read(volatile uint32_t *Reg)
+{
+  return *Reg;
+}
+#endif /* COM_HOST_CRC */
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line help
+  * @retval None
+  */
+static void Usage(void)
+{
+  printf("Usage: serial_sim [-n events] [-f messages] [-s seed]\n");
+  printf("  -n  transmit queue events, 200000 by default\n");
+  printf("  -f  framing check messages, 200000 by default\n");
+  printf("  -s  random seed\n");
+}
+
+/**
+  * @brief  Pseudo random number (xorshift32)
+  * @retval Random value
+  */
+static uint32_t Rand32(void)
+{
+  RandState ^= RandState << 13;
+  RandState ^= RandState >> 17;
+  RandState ^= RandState << 5;
+  return RandState;
+}
+
+/**
+  * @brief  Payload of a sequence number: the number LSB first, then bytes depending on it,
+  *         one in four being Msg_EOF or Msg_BS
+  * @param  Seq sequence number
+  * @param  Msg pointer to the message to be filled
+  * @retval None
+  */
+static void Payload_Build(uint32_t Seq, Msg_t *Msg)
+{
+  uint32_t state = (Seq * 0x9E3779B9U) | 1U;
+  uint32_t i;
+
+  Serialize(Msg->Data, Seq, SIM_SEQ_LEN);
+  Msg->Len = SIM_SEQ_LEN + (Seq % (SIM_PAYLOAD_MAX - SIM_SEQ_LEN + 1U));
+
+  for (i = SIM_SEQ_LEN; i < Msg->Len; i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    Msg->Data[i] = ((state & 0x300U) == 0U) ? (uint8_t)(Msg_EOF + (state & 1U)) : (uint8_t)state;
+  }
+}
+
+/**
+  * @brief  Reset the stub UART and the com.c reception
+  * @retval None
+  */
+static void Sim_Reset(void)
+{
+  memset(&hcom_uart[COM1], 0, sizeof(UART_HandleTypeDef));
+  memset(&SimDmaRx, 0, sizeof(DMA_HandleTypeDef));
+  hcom_uart[COM1].Instance = &SimUsart;
+  hcom_uart[COM1].hdmarx = &SimDmaRx;
+  hcom_uart[COM1].gState = HAL_UART_STATE_READY;
+  hcom_uart[COM1].RxState = HAL_UART_STATE_READY;
+  SimTxData = NULL;
+  SimTxSize = 0;
+  SimTxFailNext = 0;
+  WireLen = 0;
+  UART_StartReceiveMsg();
+}
+
+/**
+  * @brief  End of the transfer on the line: its bytes are read from the slot at the end,
+  *         a slot reused while on the line gives a corrupted frame
+  * @retval None
+  */
+static void Sim_TxComplete(void)
+{
+  if ((WireLen + SimTxSize) <= SIM_WIRE_SIZE)
+  {
+    memcpy(&Wire[WireLen], SimTxData, SimTxSize);
+    WireLen += SimTxSize;
+  }
+
+  hcom_uart[COM1].gState = HAL_UART_STATE_READY;
+  HAL_UART_TxCpltCallback(&hcom_uart[COM1]);
+}
+
+/**
+  * @brief  Transfer on the line aborted by an error, its bytes are lost
+  * @retval None
+  */
+static void Sim_TxError(void)
+{
+  hcom_uart[COM1].gState = HAL_UART_STATE_READY;
+  HAL_UART_ErrorCallback(&hcom_uart[COM1]);
+}
+
+/**
+  * @brief  Reference: start the oldest waiting frame, if any
+  * @param  Ref pointer to the reference queue
+  * @retval None
+  */
+static void Ref_StartNext(Ref_Queue_t *Ref)
+{
+  while (Ref->Count != 0U)
+  {
+    uint32_t seq = Ref->Waiting[0];
+
+    memmove(&Ref->Waiting[0], &Ref->Waiting[1], (UART_TX_QUEUE_LEN - 1U) * sizeof(uint32_t));
+    Ref->Count--;
+
+    if (Ref->FailNext == 0U)
+    {
+      Ref->Active = seq;
+      return;
+    }
+
+    Ref->FailNext = 0;
+    Ref->Stats.Dropped++;
+    Ref->Stats.Depth--;
+  }
+}
+
+/**
+  * @brief  Reference: queue a frame
+  * @param  Ref pointer to the reference queue
+  * @param  Seq sequence number of the frame
+  * @retval None
+  */
+static void Ref_Send(Ref_Queue_t *Ref, uint32_t Seq)
+{
+  uint32_t used = Ref->Count + ((Ref->Active >= 0) ? 1U : 0U);
+
+  if (used == UART_TX_QUEUE_LEN)
+  {
+#if (UART_TX_QUEUE_POLICY == UART_TX_OVERWRITE_OLDEST)
+    memmove(&Ref->Waiting[0], &Ref->Waiting[1], (UART_TX_QUEUE_LEN - 1U) * sizeof(uint32_t));
+    Ref->Count--;
+    Ref->Stats.Overwritten++;
+    Ref->Stats.Depth--;
+#else
+    Ref->Stats.Dropped++;
+    return;
+#endif /* UART_TX_QUEUE_POLICY */
+  }
+
+  Ref->Waiting[Ref->Count] = Seq;
+  Ref->Count++;
+  Ref->Stats.Queued++;
+  Ref->Stats.Depth++;
+
+  if (Ref->Stats.Depth > Ref->Stats.MaxDepth)
+  {
+    Ref->Stats.MaxDepth = Ref->Stats.Depth;
+  }
+
+  if (Ref->Active < 0)
+  {
+    Ref_StartNext(Ref);
+  }
+}
+
+/**
+  * @brief  Un-frame the bytes sent on the line and compare them with the expected frames
+  * @param  Ref pointer to the reference queue
+  * @retval Number of mismatches
+  */
+static uint32_t Wire_Check(const Ref_Queue_t *Ref)
+{
+  static Msg_t msg;
+  static Msg_t expected;
+  uint32_t pos = 0;
+  uint32_t frame = 0;
+  uint32_t errors = 0;
+
+  while (pos < WireLen)
+  {
+    uint8_t *eof = memchr(&Wire[pos], Msg_EOF, WireLen - pos);
+
+    if (eof == NULL)
+    {
+      errors++;
+      break;
+    }
+
+    if ((frame >= Ref->SentLen) || (ReverseByteStuffCopy(&msg, &Wire[pos]) == 0) || (msg.Len == 0U) ||
+        (CHK_CheckAndRemove(&msg) == 0))
+    {
+      errors++;
+    }
+    else
+    {
+      Payload_Build(Ref->pSent[frame], &expected);
+
+      if ((msg.Len != expected.Len) || (memcmp(msg.Data, expected.Data, msg.Len) != 0))
+      {
+        errors++;
+      }
+    }
+
+    pos = (uint32_t)(eof - Wire) + 1U;
+    frame++;
+  }
+
+  if (frame != Ref->SentLen)
+  {
+    errors++;
+  }
+
+  return errors;
+}
+
+/**
+  * @brief  Transmit queue check: random sends, transfer ends, transfer errors and failed
+  *         transmission starts, the statistics compared with a reference model after each
+  *         event and the frames on the line with the expected ones at the end
+  * @param  Count number of events
+  * @retval None
+  */
+static void Check_TxQueue(uint32_t Count)
+{
+  static Msg_t msg;
+  Ref_Queue_t ref;
+  Uart_TxStats_t stats;
+  uint32_t seq = 0;
+  uint32_t mismatches = 0;
+  uint32_t i;
+
+  memset(&ref, 0, sizeof(ref));
+  ref.Active = -1;
+  ref.pSent = (uint32_t *)malloc(Count * sizeof(uint32_t));
+
+  if (ref.pSent == NULL)
+  {
+    printf("Out of memory\n");
+    Errors++;
+    return;
+  }
+
+  Sim_Reset();
+  (void)UART_SetFraming(UART_FRAMING_STUFFING);
+  (void)UART_SetIntegrity(UART_INTEGRITY_CHK8);
+  UART_GetTxStats(&stats);
+  ref.Stats = stats;
+
+  for (i = 0; i < Count; i++)
+  {
+    uint32_t r = Rand32() % 100U;
+
+    /* Failure of the next transmission start, with its own draw to keep the event mix */
+    if ((Rand32() % 50U) == 0U)
+    {
+      ref.FailNext = 1;
+      SimTxFailNext = 1;
+    }
+
+    if ((r < 55U) || (hcom_uart[COM1].gState == HAL_UART_STATE_READY))
+    {
+      Payload_Build(seq, &msg);
+      Ref_Send(&ref, seq);
+      UART_SendMsg(&msg);
+      seq++;
+    }
+    else if (r < 95U)
+    {
+      ref.pSent[ref.SentLen] = (uint32_t)ref.Active;
+      ref.SentLen++;
+      ref.Stats.Sent++;
+      ref.Stats.Depth--;
+      ref.Active = -1;
+      Ref_StartNext(&ref);
+      Sim_TxComplete();
+    }
+    else
+    {
+      ref.Stats.Dropped++;
+      ref.Stats.Depth--;
+      ref.Active = -1;
+      Ref_StartNext(&ref);
+      Sim_TxError();
+    }
+
+    UART_GetTxStats(&stats);
+
+    if ((stats.Queued != ref.Stats.Queued) || (stats.Sent != ref.Stats.Sent) || (stats.Dropped != ref.Stats.Dropped) ||
+        (stats.Overwritten != ref.Stats.Overwritten) || (stats.Depth != ref.Stats.Depth) ||
+        (stats.MaxDepth != ref.Stats.MaxDepth) || (SimPrimask != 0U))
+    {
+      mismatches++;
+    }
+  }
+
+  /* Drain the queue */
+  ref.FailNext = 0;
+  SimTxFailNext = 0;
+  while (hcom_uart[COM1].gState != HAL_UART_STATE_READY)
+  {
+    ref.pSent[ref.SentLen] = (uint32_t)ref.Active;
+    ref.SentLen++;
+    ref.Stats.Sent++;
+    ref.Stats.Depth--;
+    ref.Active = -1;
+    Ref_StartNext(&ref);
+    Sim_TxComplete();
+  }
+
+  UART_GetTxStats(&stats);
+
+  /* Every queued frame has been sent, dropped on a failure or overwritten */
+  if ((stats.Depth != 0U) || (stats.Sent != ref.Stats.Sent) || (stats.Dropped != ref.Stats.Dropped) ||
+      (stats.Queued != (stats.Sent + stats.Overwritten + (stats.Dropped - (seq - stats.Queued)))))
+  {
+    mismatches++;
+  }
+
+  mismatches += Wire_Check(&ref);
+
+  printf("Transmit queue (%s policy): %u events, %u frames queued, %u sent, %u dropped, %u overwritten, max depth %u, %u mismatches %s\n",
+         (UART_TX_QUEUE_POLICY == UART_TX_OVERWRITE_OLDEST) ? "overwrite oldest" : "drop newest", Count, stats.Queued,
+         stats.Sent, stats.Dropped, stats.Overwritten, stats.MaxDepth, mismatches, (mismatches == 0U) ? "PASS" : "FAIL");
+
+  Errors += mismatches;
+  free(ref.pSent);
+}
+
+/**
+  * @brief  Random message of random length, one in three being escape heavy (most bytes
+  *         Msg_EOF, Msg_BS or Msg_COBS_EOF) and one in three zero free with long runs
+  * @param  Msg pointer to the message to be filled
+  * @retval None
+  */
+static void Msg_Random(Msg_t *Msg)
+{
+  static const uint8_t special[] = {Msg_EOF, Msg_BS, Msg_BS_EOF, Msg_COBS_EOF};
+  uint32_t kind = Rand32() % 3U;
+  uint32_t i;
+
+  Msg->Len = Rand32() % ((uint32_t)Msg_MaxLen + 1U);
+
+  for (i = 0; i < Msg->Len; i++)
+  {
+    uint32_t r = Rand32();
+
+    switch (kind)
+    {
+      case 0:
+        Msg->Data[i] = (uint8_t)r;
+        break;
+
+      case 1:
+        Msg->Data[i] = ((r & 0x300U) != 0U) ? special[r & 3U] : (uint8_t)(r >> 16);
+        break;
+
+      default:
+        Msg->Data[i] = (uint8_t)((r % 255U) + 1U);
+        break;
+    }
+  }
+}
+
+/**
+  * @brief  Reference byte stuffing, one byte at a time
+  * @param  Dest destination
+  * @param  Source source
+  * @retval Total number of bytes processed
+  */
+static int32_t Stuff_Reference(uint8_t *Dest, const Msg_t *Source)
+{
+  int32_t count = 0;
+  uint32_t i;
+
+  for (i = 0; i < Source->Len; i++)
+  {
+    count += ByteStuffCopyByte(&Dest[count], Source->Data[i]);
+  }
+
+  Dest[count] = Msg_EOF;
+  count++;
+  return count;
+}
+
+/**
+  * @brief  Framing check on random and escape heavy messages: ByteStuffCopy byte identical
+  *         to the byte by byte stuffing, and both framings decoded back to the message with
+  *         the delimiter only at the end and within their worst case length
+  * @param  Count number of messages
+  * @retval None
+  */
+static void Check_Framing(uint32_t Count)
+{
+  static Msg_t msg;
+  static Msg_t decoded;
+  static uint8_t stuffed[(2U * (uint32_t)Msg_MaxLen) + 1U];
+  static uint8_t expected[(2U * (uint32_t)Msg_MaxLen) + 1U];
+  static uint8_t cobs[COBS_MAX_LEN((uint32_t)Msg_MaxLen)];
+  uint32_t stuff_errors = 0;
+  uint32_t cobs_errors = 0;
+  uint32_t i;
+
+  for (i = 0; i < Count; i++)
+  {
+    int32_t len;
+    int32_t ref_len;
+
+    Msg_Random(&msg);
+
+    /* Byte stuffing */
+    len = ByteStuffCopy(stuffed, &msg);
+    ref_len = Stuff_Reference(expected, &msg);
+
+    if ((len != ref_len) || (memcmp(stuffed, expected, (size_t)len) != 0) ||
+        (memchr(stuffed, Msg_EOF, (size_t)len - 1U) != NULL) || (ReverseByteStuffCopy(&decoded, stuffed) == 0) ||
+        (decoded.Len != msg.Len) || (memcmp(decoded.Data, msg.Data, msg.Len) != 0))
+    {
+      stuff_errors++;
+    }
+
+    /* COBS */
+    len = CobsEncode(cobs, &msg);
+    memset(&decoded, 0, sizeof(decoded));
+
+    if (((uint32_t)len > COBS_MAX_LEN(msg.Len)) || (cobs[len - 1] != (uint8_t)Msg_COBS_EOF) ||
+        (memchr(cobs, Msg_COBS_EOF, (size_t)len - 1U) != NULL) || (CobsDecode(&decoded, cobs, (uint32_t)len - 1U) == 0) ||
+        (decoded.Len != msg.Len) || (memcmp(decoded.Data, msg.Data, msg.Len) != 0))
+    {
+      cobs_errors++;
+    }
+  }
+
+  printf("Byte stuffing: %u messages, %u mismatches %s\n", Count, stuff_errors, (stuff_errors == 0U) ? "PASS" : "FAIL");
+  printf("COBS: %u messages, %u mismatches %s\n", Count, cobs_errors, (cobs_errors == 0U) ? "PASS" : "FAIL");
+  Errors += stuff_errors + cobs_errors;
+}
+
+/**
+  * @brief  Monotonic time
+  * @retval Time in seconds
+  */
+static double Time_Now(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/**
+  * @brief  Byte stuffing benchmark on random payloads of a typical data frame length:
+  *         ByteStuffCopy against the byte by byte stuffing, best pass of each
+  * @retval None
+  */
+static void Bench_Stuffing(void)
+{
+  static Msg_t msgs[BENCH_MSGS];
+  static uint8_t stuffed[(2U * (uint32_t)Msg_MaxLen) + 1U];
+  double best_word = 1e9;
+  double best_byte = 1e9;
+  volatile int32_t sink = 0;
+  uint32_t pass;
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0; i < BENCH_MSGS; i++)
+  {
+    msgs[i].Len = BENCH_LEN;
+
+    for (j = 0; j < BENCH_LEN; j++)
+    {
+      msgs[i].Data[j] = (uint8_t)Rand32();
+    }
+  }
+
+  for (pass = 0; pass < BENCH_PASSES; pass++)
+  {
+    double t0 = Time_Now();
+    double t1;
+    double t2;
+
+    for (i = 0; i < BENCH_MSGS; i++)
+    {
+      sink += ByteStuffCopy(stuffed, &msgs[i]);
+    }
+
+    t1 = Time_Now();
+
+    for (i = 0; i < BENCH_MSGS; i++)
+    {
+      sink += Stuff_Reference(stuffed, &msgs[i]);
+    }
+
+    t2 = Time_Now();
+    best_word = ((t1 - t0) < best_word) ? (t1 - t0) : best_word;
+    best_byte = ((t2 - t1) < best_byte) ? (t2 - t1) : best_byte;
+  }
+
+  (void)sink;
+  printf("Byte stuffing of %u-byte payloads: word at a time %.1f ns, byte by byte %.1f ns, speedup %.1fx\n", BENCH_LEN,
+         best_word * 1e9 / BENCH_MSGS, best_byte * 1e9 / BENCH_MSGS, best_byte / best_word);
+}
+
+/**
+  * @brief  Receive bytes on the stub UART: the reception DMA writes them into UartRxBuffer
+  *         in circular mode and an idle line event follows each chunk, then
+  *         UART_ReceivedMSG is called until it has nothing left
+  * @param  Data pointer to the bytes
+  * @param  Len number of bytes
+  * @param  Chunk bytes between two reception events, at most Msg_MaxLen
+  * @param  Out received messages, can be NULL
+  * @param  OutMax size of Out
+  * @retval Number of received messages
+  */
+static uint32_t Sim_Receive(const uint8_t *Data, uint32_t Len, uint32_t Chunk, Msg_t *Out, uint32_t OutMax)
+{
+  static Msg_t msg;
+  uint32_t received = 0;
+  uint32_t pos = 0;
+  uint32_t end;
+
+  while (pos < Len)
+  {
+    end = ((Len - pos) > Chunk) ? (pos + Chunk) : Len;
+
+    for (; pos < end; pos++)
+    {
+      /* Bytes received while the reception DMA is stopped are lost */
+      if (hcom_uart[COM1].RxState != HAL_UART_STATE_BUSY_RX)
+      {
+        continue;
+      }
+
+      UartRxBuffer[(uint32_t)UART_RX_BUFFER_SIZE - SimDmaRx.Counter] = Data[pos];
+      SimDmaRx.Counter--;
+
+      if (SimDmaRx.Counter == 0U)
+      {
+        SimDmaRx.Counter = UART_RX_BUFFER_SIZE;
+      }
+    }
+
+    HAL_UARTEx_RxEventCallback(&hcom_uart[COM1], (uint16_t)((uint32_t)UART_RX_BUFFER_SIZE - SimDmaRx.Counter));
+
+    while (UART_ReceivedMSG(&msg) != 0)
+    {
+      if ((Out != NULL) && (received < OutMax))
+      {
+        Out[received] = msg;
+      }
+
+      received++;
+    }
+  }
+
+  return received;
+}
+
+/**
+  * @brief  Frame a message, trailer included
+  * @param  Dest destination, at least UART_TX_BUFFER_SIZE bytes
+  * @param  Msg pointer to the message
+  * @param  Framing UART_FRAMING_STUFFING or UART_FRAMING_COBS
+  * @retval Number of framed bytes, delimiter included
+  */
+static uint32_t Frame_Encode(uint8_t *Dest, Msg_t *Msg, uint8_t Framing)
+{
+  return (Framing == UART_FRAMING_COBS) ? (uint32_t)CobsEncode(Dest, Msg) : (uint32_t)ByteStuffCopy(Dest, Msg);
+}
+
+/**
+  * @brief  Reference CRC-32/MPEG-2, one bit at a time
+  * @param  Crc initial value
+  * @param  Data pointer to the bytes
+  * @param  Len number of bytes
+  * @retval The CRC value
+  */
+static uint32_t Crc_Reference(uint32_t Crc, const uint8_t *Data, uint32_t Len)
+{
+  uint32_t i;
+  uint32_t bit;
+
+  for (i = 0; i < Len; i++)
+  {
+    Crc ^= (uint32_t)Data[i] << 24;
+
+    for (bit = 0; bit < 8U; bit++)
+    {
+      Crc = ((Crc & 0x80000000U) != 0U) ? ((Crc << 1) ^ CRC32_POLY) : (Crc << 1);
+    }
+  }
+
+  return Crc;
+}
+
+/**
+  * @brief  CRC-32 check: the check value, CRC32_Update and the UART_SendMsg trailer
+  *         against the bit by bit reference on random messages, then every single bit
+  *         corruption of short frames rejected by the reception in both framings
+  * @param  Count number of random messages
+  * @retval None
+  */
+static void Check_Crc(uint32_t Count)
+{
+  static const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  static Msg_t msg;
+  static Msg_t sent;
+  static Msg_t decoded;
+  static uint8_t frame[UART_TX_BUFFER_SIZE];
+  uint32_t value_errors = 0;
+  uint32_t flip_errors = 0;
+  uint32_t flips = 0;
+  uint32_t framing;
+  uint32_t bit;
+  uint32_t len;
+  uint32_t i;
+
+  Sim_Reset();
+  (void)UART_SetFraming(UART_FRAMING_STUFFING);
+  (void)UART_SetIntegrity(UART_INTEGRITY_CRC32);
+
+  if ((CRC32_Update(CRC32_INIT, check, sizeof(check)) != CRC32_CHECK) ||
+      (Crc_Reference(CRC32_INIT, check, sizeof(check)) != CRC32_CHECK))
+  {
+    value_errors++;
+  }
+
+  /* Trailer of the sent frames, the first one being the check string */
+  for (i = 0; i < Count; i++)
+  {
+    if (i == 0U)
+    {
+      memcpy(msg.Data, check, sizeof(check));
+      msg.Len = sizeof(check);
+    }
+    else
+    {
+      Msg_Random(&msg);
+      msg.Len %= (uint32_t)Msg_MaxLen - CRC32_LEN + 1U;
+    }
+
+    sent = msg;
+    UART_SendMsg(&sent);
+
+    if ((ReverseByteStuffCopy(&decoded, SimTxData) == 0) || (decoded.Len != (msg.Len + CRC32_LEN)) ||
+        (memcmp(decoded.Data, msg.Data, msg.Len) != 0) ||
+        (Deserialize(&decoded.Data[msg.Len], CRC32_LEN) != Crc_Reference(CRC32_INIT, msg.Data, msg.Len)) ||
+        (CRC32_Update(CRC32_INIT, msg.Data, msg.Len) != Crc_Reference(CRC32_INIT, msg.Data, msg.Len)))
+    {
+      value_errors++;
+    }
+
+    WireLen = 0;
+    Sim_TxComplete();
+  }
+
+  /* Single bit corruptions of the payload and of the trailer */
+  for (framing = UART_FRAMING_STUFFING; framing <= UART_FRAMING_COBS; framing++)
+  {
+    Sim_Reset();
+    (void)UART_SetFraming((uint8_t)framing);
+    (void)UART_SetIntegrity(UART_INTEGRITY_CRC32);
+
+    for (i = 0; i < CRC_FLIP_MSGS; i++)
+    {
+      if (i == 0U)
+      {
+        memcpy(msg.Data, check, sizeof(check));
+        msg.Len = sizeof(check);
+      }
+      else
+      {
+        Msg_Random(&msg);
+        msg.Len %= CRC_FLIP_LEN_MAX + 1U;
+      }
+
+      Serialize(&msg.Data[msg.Len], Crc_Reference(CRC32_INIT, msg.Data, msg.Len), CRC32_LEN);
+      msg.Len += CRC32_LEN;
+
+      /* The intact frame is received */
+      len = Frame_Encode(frame, &msg, (uint8_t)framing);
+
+      if ((Sim_Receive(frame, len, Msg_MaxLen, &decoded, 1) != 1U) || (decoded.Len != (msg.Len - CRC32_LEN)) ||
+          (memcmp(decoded.Data, msg.Data, decoded.Len) != 0))
+      {
+        flip_errors++;
+      }
+
+      for (bit = 0; bit < (msg.Len * 8U); bit++)
+      {
+        msg.Data[bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+        len = Frame_Encode(frame, &msg, (uint8_t)framing);
+
+        if (Sim_Receive(frame, len, Msg_MaxLen, NULL, 0) != 0U)
+        {
+          flip_errors++;
+        }
+
+        msg.Data[bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+        flips++;
+      }
+    }
+  }
+
+#ifdef COM_HOST_CRC
+  printf("CRC-32 (CRC unit model, %u words): ", SimCrcWords);
+
+  if (SimCrcWords == 0U)
+  {
+    value_errors++;
+  }
+#else
+  printf("CRC-32 (software): ");
+#endif /* COM_HOST_CRC */
+  printf("check value 0x%08X, %u trailers, %u mismatches %s\n", CRC32_Update(CRC32_INIT, check, sizeof(check)), Count,
+         value_errors, (value_errors == 0U) ? "PASS" : "FAIL");
+  printf("CRC-32 single bit corruptions: %u frames, %u accepted %s\n", flips, flip_errors,
+         (flip_errors == 0U) ? "PASS" : "FAIL");
+
+  Errors += value_errors + flip_errors;
+}
+
+/**
+  * @brief  Blocking UART error stopping the reception DMA, as seen by the interrupt: the error
+  *         callback may run while the main loop parses, it must leave the parser unchanged
+  * @retval 1 if the callback changed the parser state or did not request the restart, 0 otherwise
+  */
+static uint32_t Sim_RxError(void)
+{
+  Uart_Engine_t before = UartEngine;
+
+  hcom_uart[COM1].RxState = HAL_UART_STATE_READY;
+  HAL_UART_ErrorCallback(&hcom_uart[COM1]);
+
+  return ((UartEngine.StartOfMsg != before.StartOfMsg) || (UartEngine.RxState != before.RxState) ||
+          (UartEngine.RxCobsCode != before.RxCobsCode) || (UartEngine.RxCobsLeft != before.RxCobsLeft) ||
+          (UartEngine.RxRestart == 0U)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Build a reception fuzz stream of random messages with their trailer, one in four
+  *         corrupted. Without noise the corruption is a bit flip of the payload or trailer,
+  *         the frame staying well formed. With noise it is a bit flip, a dropped byte or an
+  *         inserted byte on the line, the delimiter excepted, and one frame in eight follows
+  *         a garbage burst ended by a delimiter.
+  * @param  Stream stream bytes to be filled
+  * @param  Frames frames to be filled, garbage bursts included
+  * @param  Expected payloads of the frames
+  * @param  Count number of messages
+  * @param  Framing UART_FRAMING_STUFFING or UART_FRAMING_COBS
+  * @param  Integrity UART_INTEGRITY_CHK8 or UART_INTEGRITY_CRC32
+  * @param  Noise 1 for the line noise corruptions
+  * @retval Number of frames
+  */
+static uint32_t Rx_Stream_Build(uint8_t *Stream, Rx_Frame_t *Frames, Msg_t *Expected, uint32_t Count, uint8_t Framing,
+                                uint8_t Integrity, uint8_t Noise)
+{
+  static Msg_t msg;
+  uint8_t eof = (Framing == UART_FRAMING_COBS) ? (uint8_t)Msg_COBS_EOF : (uint8_t)Msg_EOF;
+  uint32_t trailer = (Integrity == UART_INTEGRITY_CRC32) ? CRC32_LEN : 1U;
+  uint32_t frames = 0;
+  uint32_t pos = 0;
+  uint32_t len;
+  uint32_t at;
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0; i < Count; i++)
+  {
+    /* Garbage burst, the longest ones exceeding Msg_MaxLen */
+    if ((Noise != 0U) && ((Rand32() % 8U) == 0U))
+    {
+      len = 1U + (Rand32() % RX_FUZZ_GARBAGE_MAX);
+      Frames[frames].Start = pos;
+
+      for (j = 0; j < len; j++)
+      {
+        Stream[pos] = (uint8_t)Rand32();
+        pos++;
+      }
+
+      Stream[pos] = eof;
+      pos++;
+      Frames[frames].Stop = pos;
+      Frames[frames].Intact = 0;
+      frames++;
+    }
+
+    Msg_Random(&msg);
+    msg.Len %= (uint32_t)Msg_MaxLen - trailer + 1U;
+    Expected[frames] = msg;
+
+    if (Integrity == UART_INTEGRITY_CRC32)
+    {
+      Serialize(&msg.Data[msg.Len], Crc_Reference(CRC32_INIT, msg.Data, msg.Len), CRC32_LEN);
+      msg.Len += CRC32_LEN;
+    }
+    else
+    {
+      CHK_ComputeAndAdd(&msg);
+    }
+
+    Frames[frames].Intact = ((Rand32() % 4U) != 0U) ? 1U : 0U;
+
+    if ((Frames[frames].Intact == 0U) && (Noise == 0U))
+    {
+      at = Rand32() % (msg.Len * 8U);
+      msg.Data[at / 8U] ^= (uint8_t)(1U << (at % 8U));
+    }
+
+    Frames[frames].Start = pos;
+    len = Frame_Encode(&Stream[pos], &msg, Framing);
+
+    if ((Frames[frames].Intact == 0U) && (Noise != 0U))
+    {
+      at = pos + (Rand32() % (len - 1U));
+
+      switch (Rand32() % 3U)
+      {
+        case 0:
+          Stream[at] ^= (uint8_t)(1U << (Rand32() % 8U));
+          break;
+
+        case 1:
+          memmove(&Stream[at], &Stream[at + 1U], (pos + len) - at - 1U);
+          len--;
+          break;
+
+        default:
+          memmove(&Stream[at + 1U], &Stream[at], (pos + len) - at);
+          Stream[at] = (uint8_t)Rand32();
+          len++;
+          break;
+      }
+    }
+
+    pos += len;
+    Frames[frames].Stop = pos;
+    frames++;
+  }
+
+  Frames[frames].Start = pos; /* End of the stream */
+  return frames;
+}
+
+/**
+  * @brief  Reception fuzz for every framing and integrity pair: streams split at random
+  *         points, with corrupted frames, garbage bursts and UART errors, the received
+  *         messages compared with the intact ones.
+  *         Every intact frame has to be received, in order. No corrupted frame may pass
+  *         the CRC-32 trailer, nor the 8-bit checksum when the corruption is a payload or
+  *         trailer bit flip. On a noisy line the 8-bit checksum misses a dropped or
+  *         inserted zero byte and one in 256 other changes of the frame length, which the
+  *         zero heavy messages make more frequent: the passes are only bounded to one in
+  *         32 corrupted frames.
+  * @param  Count number of messages per stream
+  * @retval None
+  */
+static void Check_RxParser(uint32_t Count)
+{
+  static Msg_t received_one;
+  uint8_t *stream = (uint8_t *)malloc(Count * (UART_TX_BUFFER_SIZE + RX_FUZZ_GARBAGE_MAX + 2U));
+  Rx_Frame_t *frames = (Rx_Frame_t *)malloc(((2U * Count) + 1U) * sizeof(Rx_Frame_t));
+  Msg_t *expected = (Msg_t *)malloc(2U * Count * sizeof(Msg_t));
+  Msg_t *received = (Msg_t *)malloc(4U * Count * sizeof(Msg_t));
+  uint32_t framing;
+  uint32_t integrity;
+  uint32_t noise;
+
+  if ((stream == NULL) || (frames == NULL) || (expected == NULL) || (received == NULL))
+  {
+    printf("Out of memory\n");
+    Errors++;
+    free(stream);
+    free(frames);
+    free(expected);
+    free(received);
+    return;
+  }
+
+  for (framing = UART_FRAMING_STUFFING; framing <= UART_FRAMING_COBS; framing++)
+  {
+    for (integrity = UART_INTEGRITY_CHK8; integrity <= UART_INTEGRITY_CRC32; integrity++)
+    {
+      for (noise = 0; noise <= 1U; noise++)
+      {
+        uint32_t n = Rx_Stream_Build(stream, frames, expected, Count, (uint8_t)framing, (uint8_t)integrity, (uint8_t)noise);
+        uint32_t count = 0;
+        uint32_t corrupted = 0;
+        uint32_t intact = 0;
+        uint32_t missing = 0;
+        uint32_t passed = 0;
+        uint32_t race = 0;
+        uint32_t rx_errors = 0;
+        uint32_t pos = 0;
+        uint32_t f = 0;
+        uint32_t errors;
+        uint32_t i;
+        uint32_t j;
+
+        Sim_Reset();
+        (void)UART_SetFraming((uint8_t)framing);
+        (void)UART_SetIntegrity((uint8_t)integrity);
+
+        /* Reception in random fragments, with UART errors between them on noisy lines */
+        while (pos < frames[n].Start)
+        {
+          uint32_t len = 1U + (Rand32() % (uint32_t)Msg_MaxLen);
+
+          len = ((frames[n].Start - pos) < len) ? (frames[n].Start - pos) : len;
+          count += Sim_Receive(&stream[pos], len, len, &received[count], (4U * Count) - count);
+          pos += len;
+
+          if ((noise != 0U) && ((Rand32() % 64U) == 0U))
+          {
+            race += Sim_RxError();
+            rx_errors++;
+
+            /* The frame being received is lost */
+            while (frames[f].Stop <= pos)
+            {
+              f++;
+            }
+
+            if (frames[f].Start < pos)
+            {
+              frames[f].Intact = 0;
+            }
+
+            /* Main loop pass restarting the reception */
+            (void)UART_ReceivedMSG(&received_one);
+          }
+        }
+
+        /* Every intact frame in order, the other received messages being corrupted passes */
+        for (i = 0; i < n; i++)
+        {
+          corrupted += (frames[i].Intact == 0U) ? 1U : 0U;
+        }
+
+        j = 0;
+
+        for (i = 0; i < count; i++)
+        {
+          while ((j < n) && (frames[j].Intact == 0U))
+          {
+            j++;
+          }
+
+          if ((j < n) && (received[i].Len == expected[j].Len) &&
+              (memcmp(received[i].Data, expected[j].Data, received[i].Len) == 0))
+          {
+            intact++;
+            j++;
+          }
+          else
+          {
+            passed++;
+          }
+        }
+
+        missing = (n - corrupted) - intact;
+        errors = missing + race;
+
+        if ((integrity == UART_INTEGRITY_CRC32) || (noise == 0U))
+        {
+          errors += passed;
+        }
+        else if ((passed * 32U) > corrupted)
+        {
+          errors++;
+        }
+        else
+        {
+          /* Within the 8-bit checksum detection */
+        }
+
+        printf("Reception %s %s %s: %u frames, %u corrupted, %u UART errors (%u changing the parser), %u intact received, %u missing, %u corrupted passed %s\n",
+               (framing == UART_FRAMING_COBS) ? "COBS" : "stuffing", (integrity == UART_INTEGRITY_CRC32) ? "CRC-32" : "CHK8",
+               (noise != 0U) ? "line noise" : "bit flips", n, corrupted, rx_errors, race, intact, missing, passed,
+               (errors == 0U) ? "PASS" : "FAIL");
+        Errors += errors;
+      }
+    }
+  }
+
+  free(stream);
+  free(frames);
+  free(expected);
+  free(received);
+}
+
+/**
+  * @brief  Parser of UART_ReceivedMSG before the incremental one, byte stuffing only: each
+  *         call looks for the delimiter from the beginning of the pending frame
+  * @param  Msg the pointer to the message to be received
+  * @retval 1 if a complete message is found, 0 otherwise
+  */
+static int32_t Legacy_ReceivedMSG(Msg_t *Msg)
+{
+  uint16_t i;
+  uint16_t j;
+  uint16_t k;
+  uint16_t j2;
+  uint16_t length;
+  uint16_t dma_counter;
+  uint16_t source = 0;
+  uint8_t inc;
+
+  dma_counter = (uint16_t)UART_RX_BUFFER_SIZE - (uint16_t)SimDmaRx.Counter;
+
+  if (dma_counter >= LegacyStartOfMsg)
+  {
+    length = dma_counter - LegacyStartOfMsg;
+  }
+  else
+  {
+    length = (uint16_t)UART_RX_BUFFER_SIZE + dma_counter - LegacyStartOfMsg;
+  }
+
+  j = LegacyStartOfMsg;
+
+  for (k = 0; k < length; k++)
+  {
+    uint8_t data = UartRxBuffer[j];
+
+    j++;
+
+    if (j >= (uint16_t)UART_RX_BUFFER_SIZE)
+    {
+      j = 0;
+    }
+
+    if (data == (uint8_t)Msg_EOF)
+    {
+      j = LegacyStartOfMsg;
+
+      for (i = 0; i < k; i += inc)
+      {
+        j2 = (j + 1U) % (uint16_t)UART_RX_BUFFER_SIZE;
+
+        if (source >= Msg_MaxLen)
+        {
+          LegacyStartOfMsg = j;
+          return 0;
+        }
+
+        inc = (uint8_t)ReverseByteStuffCopyByte2(UartRxBuffer[j], UartRxBuffer[j2], &Msg->Data[source]);
+
+        if (inc == 0U)
+        {
+          LegacyStartOfMsg = j2;
+          return 0;
+        }
+
+        j = (j + inc) % (uint16_t)UART_RX_BUFFER_SIZE;
+        source++;
+      }
+
+      Msg->Len = source;
+      LegacyStartOfMsg = (j + 1U) % (uint16_t)UART_RX_BUFFER_SIZE;
+      return (CHK_CheckAndRemove(Msg) != 0) ? 1 : 0;
+    }
+  }
+
+  if (length > (uint16_t)UART_MSG_MAX_SIZE)
+  {
+    LegacyStartOfMsg = dma_counter;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Reception benchmark: frames of a typical data frame length arrive RX_BENCH_CHUNK
+  *         bytes at a time, the main loop passing RX_BENCH_IDLE more times without new bytes.
+  *         The incremental parser is compared with the previous one, best pass of each.
+  * @retval None
+  */
+static void Bench_RxParser(void)
+{
+  static Msg_t msg;
+  uint8_t *stream = (uint8_t *)malloc(RX_BENCH_FRAMES * UART_TX_BUFFER_SIZE);
+  double best[2] = {1e9, 1e9};
+  uint32_t received[2] = {0, 0};
+  uint32_t len = 0;
+  uint32_t parser;
+  uint32_t pass;
+  uint32_t pos;
+  uint32_t i;
+  uint32_t j;
+
+  if (stream == NULL)
+  {
+    printf("Out of memory\n");
+    Errors++;
+    return;
+  }
+
+  for (i = 0; i < RX_BENCH_FRAMES; i++)
+  {
+    msg.Len = RX_BENCH_LEN - 1U;
+
+    for (j = 0; j < msg.Len; j++)
+    {
+      msg.Data[j] = (uint8_t)Rand32();
+    }
+
+    CHK_ComputeAndAdd(&msg);
+    len += (uint32_t)ByteStuffCopy(&stream[len], &msg);
+  }
+
+  for (pass = 0; pass < RX_BENCH_PASSES; pass++)
+  {
+    for (parser = 0; parser < 2U; parser++)
+    {
+      double t0;
+      double t1;
+
+      Sim_Reset();
+      (void)UART_SetFraming(UART_FRAMING_STUFFING);
+      (void)UART_SetIntegrity(UART_INTEGRITY_CHK8);
+      LegacyStartOfMsg = 0;
+      received[parser] = 0;
+      t0 = Time_Now();
+
+      for (pos = 0; pos < len; pos += RX_BENCH_CHUNK)
+      {
+        uint32_t end = ((pos + RX_BENCH_CHUNK) < len) ? (pos + RX_BENCH_CHUNK) : len;
+
+        for (i = pos; i < end; i++)
+        {
+          UartRxBuffer[(uint32_t)UART_RX_BUFFER_SIZE - SimDmaRx.Counter] = stream[i];
+          SimDmaRx.Counter = (SimDmaRx.Counter == 1U) ? UART_RX_BUFFER_SIZE : (SimDmaRx.Counter - 1U);
+        }
+
+        HAL_UARTEx_RxEventCallback(&hcom_uart[COM1], (uint16_t)((uint32_t)UART_RX_BUFFER_SIZE - SimDmaRx.Counter));
+
+        for (i = 0; i < (1U + RX_BENCH_IDLE); i++)
+        {
+          if (parser == 0U)
+          {
+            received[parser] += (uint32_t)UART_ReceivedMSG(&msg);
+          }
+          else
+          {
+            received[parser] += (uint32_t)Legacy_ReceivedMSG(&msg);
+          }
+        }
+      }
+
+      t1 = Time_Now();
+      best[parser] = ((t1 - t0) < best[parser]) ? (t1 - t0) : best[parser];
+    }
+  }
+
+  printf("Reception of %u-byte frames by %u-byte chunks: incremental %.0f ns/frame, previous %.0f ns/frame, speedup %.1fx\n",
+         RX_BENCH_LEN, RX_BENCH_CHUNK, best[0] * 1e9 / RX_BENCH_FRAMES, best[1] * 1e9 / RX_BENCH_FRAMES, best[1] / best[0]);
+
+  /* Both parsers have to receive every frame for the timings to be comparable */
+  if ((received[0] != RX_BENCH_FRAMES) || (received[1] != RX_BENCH_FRAMES))
+  {
+    printf("Reception benchmark: %u and %u frames received out of %u FAIL\n", received[0], received[1], RX_BENCH_FRAMES);
+    Errors++;
+  }
+
+  free(stream);
+}
+
+/**
+  * @brief  Copy the frame on the line and end its transfer
+  * @param  Dest destination, at least UART_TX_BUFFER_SIZE bytes
+  * @retval Number of bytes, 0 if no frame is on the line
+  */
+static uint32_t Sim_TxCapture(uint8_t *Dest)
+{
+  uint32_t len = 0;
+
+  if (hcom_uart[COM1].gState != HAL_UART_STATE_READY)
+  {
+    len = SimTxSize;
+    memcpy(Dest, SimTxData, len);
+    Sim_TxComplete();
+  }
+
+  return len;
+}
+
+/**
+  * @brief  Frame builder check for every framing and integrity pair: random payloads,
+  *         escape and zero heavy ones included, are written with UART_FramePut,
+  *         UART_FrameSerialize and UART_FrameFloat in random chunks and have to give the
+  *         same bytes as UART_SendMsg. Payloads without room for the trailer in a Msg,
+  *         some longer than Msg_MaxLen, have to be dropped by both, the builder counting
+  *         them as dropped and giving its slot back.
+  * @param  Count number of payloads per pair
+  * @retval None
+  */
+static void Check_FrameBuilder(uint32_t Count)
+{
+  static Msg_t msg;
+  static uint8_t payload[(uint32_t)Msg_MaxLen + BUILDER_OVERSIZE];
+  static uint8_t built[UART_TX_BUFFER_SIZE];
+  static uint8_t sent[UART_TX_BUFFER_SIZE];
+  Uart_Frame_t frame;
+  Uart_TxStats_t before;
+  Uart_TxStats_t after;
+  uint32_t framing;
+  uint32_t integrity;
+
+  for (framing = UART_FRAMING_STUFFING; framing <= UART_FRAMING_COBS; framing++)
+  {
+    for (integrity = UART_INTEGRITY_CHK8; integrity <= UART_INTEGRITY_CRC32; integrity++)
+    {
+      uint32_t trailer = (integrity == UART_INTEGRITY_CRC32) ? CRC32_LEN : 1U;
+      uint32_t mismatches = 0;
+      uint32_t oversize = 0;
+      uint32_t i;
+
+      Sim_Reset();
+      (void)UART_SetFraming((uint8_t)framing);
+      (void)UART_SetIntegrity((uint8_t)integrity);
+
+      for (i = 0; i < Count; i++)
+      {
+        uint32_t len = Rand32() % ((uint32_t)Msg_MaxLen + BUILDER_OVERSIZE + 1U);
+        uint32_t built_len;
+        uint32_t sent_len = 0;
+        uint32_t pos = 0;
+        uint32_t left;
+        uint32_t n;
+        float value;
+
+        Msg_Random(&msg);
+        memcpy(payload, msg.Data, sizeof(msg.Data));
+
+        for (n = Msg_MaxLen; n < len; n++)
+        {
+          payload[n] = (uint8_t)Rand32();
+        }
+
+        UART_GetTxStats(&before);
+
+        if (UART_FrameBegin(&frame) == 0)
+        {
+          mismatches++;
+        }
+
+        while (pos < len)
+        {
+          left = len - pos;
+
+          switch (Rand32() % 4U)
+          {
+            case 0:
+              n = 1U + (Rand32() % ((left < BUILDER_PUT_MAX) ? left : BUILDER_PUT_MAX));
+              UART_FramePut(&frame, &payload[pos], n);
+              break;
+
+            case 1:
+              n = 1U + (Rand32() % ((left < 4U) ? left : 4U));
+              UART_FrameSerialize(&frame, Deserialize(&payload[pos], n), n);
+              break;
+
+            case 2:
+              n = (left < 4U) ? 0U : 4U;
+
+              if (n != 0U)
+              {
+                memcpy(&value, &payload[pos], 4);
+                UART_FrameFloat(&frame, value);
+              }
+              break;
+
+            default:
+              n = 0;
+              UART_FramePut(&frame, &payload[pos], 0);
+              break;
+          }
+
+          pos += n;
+        }
+
+        UART_FrameEnd(&frame);
+        built_len = Sim_TxCapture(built);
+        UART_GetTxStats(&after);
+
+        if ((len + trailer) > (uint32_t)Msg_MaxLen)
+        {
+          /* UART_SendMsg drops it too, a Msg cannot hold more than Msg_MaxLen bytes */
+          if (len <= (uint32_t)Msg_MaxLen)
+          {
+            memcpy(msg.Data, payload, len);
+            msg.Len = len;
+            UART_SendMsg(&msg);
+            sent_len = Sim_TxCapture(sent);
+          }
+
+          if ((built_len != 0U) || (sent_len != 0U) || (after.Dropped != (before.Dropped + 1U)) || (after.Depth != 0U))
+          {
+            mismatches++;
+          }
+
+          oversize++;
+        }
+        else
+        {
+          memcpy(msg.Data, payload, len);
+          msg.Len = len;
+          UART_SendMsg(&msg);
+          sent_len = Sim_TxCapture(sent);
+
+          if ((built_len == 0U) || (built_len != sent_len) || (memcmp(built, sent, built_len) != 0) ||
+              (after.Sent != (before.Sent + 1U)))
+          {
+            mismatches++;
+          }
+        }
+      }
+
+      printf("Frame builder %s %s: %u payloads, %u oversize dropped, %u mismatches %s\n",
+             (framing == UART_FRAMING_COBS) ? "COBS" : "stuffing", (integrity == UART_INTEGRITY_CRC32) ? "CRC-32" : "CHK8",
+             Count, oversize, mismatches, (mismatches == 0U) ? "PASS" : "FAIL");
+      Errors += mismatches;
+    }
+  }
+}
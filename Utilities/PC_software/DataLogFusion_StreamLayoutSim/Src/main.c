@@ -0,0 +1,808 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host check of the streaming frame layout of the DataLogFusion
+  *          application (stream_layout.c)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <unistd.h>
+#include "stream_layout.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define STREAM_HEADER_LEN     3U
+#define STREAMING_MSG_LENGTH  119U  /* Fixed frame, see demo_serial.h */
+#define SENSOR_MASKS          256U  /* SensorsEnabled values, one byte */
+#define SELECTIONS            (STREAM_FIELD_ALL + 1U)
+#define FIXED_SAMPLES         100000U
+#define QUAT_TOLERANCE        1e-3f /* Layout check only, see the round trip check */
+#define ROUND_TRIP_SAMPLES    2000000U
+#define QUAT_COMPONENT_MAX    5.5e-5 /* Compact round trip error bounds */
+#define QUAT_ANGLE_MAX        0.0075 /* [deg] */
+#define ANGLE_MAX             0.005  /* [deg] */
+#define G_MAX                 0.0005 /* [g] */
+#define FLOAT_SLACK           4.0    /* Float rounding of the values and codes [float epsilon] */
+#define RAD_TO_DEG            57.29577951308232
+
+/* SensorsEnabled masks, see demo_serial.h */
+#define PRESSURE_SENSOR       0x00000001U
+#define TEMPERATURE_SENSOR    0x00000002U
+#define HUMIDITY_SENSOR       0x00000004U
+#define ACCELEROMETER_SENSOR  0x00000010U
+#define GYROSCOPE_SENSOR      0x00000020U
+#define MAGNETIC_SENSOR       0x00000040U
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t RandState = 1U;
+static uint32_t Errors = 0;
+
+/* Field sizes [bytes], by bit index, from the field list of stream_layout.h */
+static const uint32_t RefSize[STREAM_FIELD_COUNT] = {4, 4, 4, 4, 12, 12, 12, 16, 12, 12, 12, 4, 4, 4};
+static const uint32_t RefSizeCompact[STREAM_FIELD_COUNT] = {4, 4, 4, 4, 12, 12, 12, 6, 6, 6, 6, 2, 2, 4};
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static uint32_t Rand32(void);
+static float Rand_Float(float Min, float Max);
+static void Sample_Random(Stream_Sample_t *Sample);
+static uint32_t Ref_Fields(uint32_t Select, uint32_t SensorsEnabled);
+static void Frame_Build(uint32_t Fields, const Stream_Sample_t *Sample, Msg_t *Msg);
+static void Fixed_Reference(const Stream_Sample_t *Sample, Msg_t *Msg);
+static uint32_t Check_Descriptor(uint32_t Fields);
+static uint32_t Check_Decode(uint32_t Fields, const Stream_Sample_t *Sample, Msg_t *Msg);
+static void Check_Layouts(void);
+static void Check_Fixed(void);
+static void Quaternion_Random(float *Quaternion);
+static void Compact_RoundTrip(uint32_t Field, const Stream_Sample_t *Sample, Stream_Sample_t *Decoded);
+static double Quaternion_Error(const float *Quaternion, const float *Decoded, double *Angle);
+static uint32_t Check_Scalar(uint32_t Field, const float *Value, const float *Decoded, double Expected, double Bound,
+                             double *MaxError);
+static void Check_RoundTrip(uint32_t Count);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Simulation entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 if every check passes, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  uint32_t count = ROUND_TRIP_SAMPLES;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:s:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'n':
+        count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        RandState = (uint32_t)strtoul(optarg, NULL, 0) | 1U;
+        break;
+      default:
+        Usage();
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+
+  Check_Layouts();
+  Check_Fixed();
+  Check_RoundTrip(count);
+
+  printf("%s: %u errors\n", (Errors == 0U) ? "PASS" : "FAIL", Errors);
+  return (Errors == 0U) ? 0 : 1;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line help
+  * @retval None
+  */
+static void Usage(void)
+{
+  printf("Usage: layout_sim [-n samples] [-s seed]\n");
+  printf("  -n  compact round trip samples, 2000000 by default\n");
+  printf("  -s  random seed\n");
+}
+
+/**
+  * @brief  Pseudo random number (xorshift32)
+  * @retval Random value
+  */
+static uint32_t Rand32(void)
+{
+  RandState ^= RandState << 13;
+  RandState ^= RandState >> 17;
+  RandState ^= RandState << 5;
+  return RandState;
+}
+
+/**
+  * @brief  Uniform random float
+  * @param  Min lowest value
+  * @param  Max highest value
+  * @retval Random value
+  */
+static float Rand_Float(float Min, float Max)
+{
+  return Min + ((Max - Min) * ((float)(Rand32() >> 8) / 16777216.0f));
+}
+
+/**
+  * @brief  Random sample within the sensor and Sensor Fusion ranges
+  * @param  Sample pointer to the sample to be filled
+  * @retval None
+  */
+static void Sample_Random(Stream_Sample_t *Sample)
+{
+  float norm = 0.0f;
+  uint32_t i;
+
+  for (i = 0; i < 4U; i++)
+  {
+    Sample->Time[i] = (uint8_t)Rand32();
+    Sample->Quaternion[i] = Rand_Float(-1.0f, 1.0f);
+    norm += Sample->Quaternion[i] * Sample->Quaternion[i];
+  }
+
+  norm = sqrtf(norm);
+
+  for (i = 0; i < 4U; i++)
+  {
+    Sample->Quaternion[i] /= norm;
+  }
+
+  Sample->Press = Rand_Float(260.0f, 1260.0f);
+  Sample->Temp = Rand_Float(-40.0f, 85.0f);
+  Sample->Hum = Rand_Float(0.0f, 100.0f);
+
+  for (i = 0; i < 3U; i++)
+  {
+    Sample->Acc[i] = (int32_t)Rand32();
+    Sample->Gyr[i] = (int32_t)Rand32();
+    Sample->Mag[i] = (int32_t)Rand32();
+    Sample->Gravity[i] = Rand_Float(-1.0f, 1.0f);
+    Sample->LinearAcc[i] = Rand_Float(-16.0f, 16.0f);
+  }
+
+  Sample->Rotation[0] = Rand_Float(0.0f, 360.0f);
+  Sample->Rotation[1] = Rand_Float(-180.0f, 180.0f);
+  Sample->Rotation[2] = Rand_Float(-90.0f, 90.0f);
+  Sample->Heading = Rand_Float(0.0f, 360.0f);
+  Sample->HeadingErr = Rand_Float(0.0f, 180.0f);
+  Sample->ElapsedUs = Rand32();
+}
+
+/**
+  * @brief  Reference of Stream_Layout_Fields for a selection without STREAM_LAYOUT_FIXED
+  * @param  Select requested fields and STREAM_LAYOUT_COMPACT flag
+  * @param  SensorsEnabled enabled sensors mask
+  * @retval Expected fields and STREAM_LAYOUT_COMPACT flag
+  */
+static uint32_t Ref_Fields(uint32_t Select, uint32_t SensorsEnabled)
+{
+  uint32_t available = STREAM_FIELD_TIME | STREAM_LAYOUT_COMPACT;
+
+  available |= ((SensorsEnabled & PRESSURE_SENSOR) != 0U) ? STREAM_FIELD_PRESS : 0U;
+  available |= ((SensorsEnabled & TEMPERATURE_SENSOR) != 0U) ? STREAM_FIELD_TEMP : 0U;
+  available |= ((SensorsEnabled & HUMIDITY_SENSOR) != 0U) ? STREAM_FIELD_HUM : 0U;
+  available |= ((SensorsEnabled & ACCELEROMETER_SENSOR) != 0U) ? STREAM_FIELD_ACC : 0U;
+  available |= ((SensorsEnabled & GYROSCOPE_SENSOR) != 0U) ? STREAM_FIELD_GYR : 0U;
+  available |= ((SensorsEnabled & MAGNETIC_SENSOR) != 0U) ? STREAM_FIELD_MAG : 0U;
+
+  /* Sensor Fusion needs the three motion sensors */
+  if ((SensorsEnabled & (ACCELEROMETER_SENSOR | GYROSCOPE_SENSOR | MAGNETIC_SENSOR)) ==
+      (ACCELEROMETER_SENSOR | GYROSCOPE_SENSOR | MAGNETIC_SENSOR))
+  {
+    available |= STREAM_FIELD_FUSION;
+  }
+
+  return Select & available;
+}
+
+/**
+  * @brief  Build a streaming frame as the application does, field after field
+  * @param  Fields fields in the frame and STREAM_LAYOUT_COMPACT flag
+  * @param  Sample pointer to the sample
+  * @param  Msg pointer to the frame, from the message header on
+  * @retval None
+  */
+static void Frame_Build(uint32_t Fields, const Stream_Sample_t *Sample, Msg_t *Msg)
+{
+  uint32_t field;
+
+  Msg->Data[0] = 0x01;
+  Msg->Data[1] = 0x80;
+  Msg->Data[2] = 0x1A;
+  Msg->Len = STREAM_HEADER_LEN;
+
+  for (field = STREAM_FIELD_TIME; field <= STREAM_FIELD_ALL; field <<= 1)
+  {
+    if ((Fields & field) != 0U)
+    {
+      Msg->Len += Stream_Layout_Field(field | (Fields & STREAM_LAYOUT_COMPACT), Sample, &Msg->Data[Msg->Len]);
+    }
+  }
+}
+
+/**
+  * @brief  Fixed frame as sent before the layouts: every field, sensor values LSB first
+  * @param  Sample pointer to the sample
+  * @param  Msg pointer to the frame, from the message header on
+  * @retval None
+  */
+static void Fixed_Reference(const Stream_Sample_t *Sample, Msg_t *Msg)
+{
+  uint8_t *dest = &Msg->Data[STREAM_HEADER_LEN];
+  uint32_t i;
+
+  Msg->Data[0] = 0x01;
+  Msg->Data[1] = 0x80;
+  Msg->Data[2] = 0x1A;
+
+  memcpy(dest, Sample->Time, 4);
+  dest += 4;
+  FloatToArray(dest, Sample->Press);
+  dest += 4;
+  FloatToArray(dest, Sample->Temp);
+  dest += 4;
+  FloatToArray(dest, Sample->Hum);
+  dest += 4;
+
+  for (i = 0; i < 3U; i++)
+  {
+    Serialize(&dest[4U * i], (uint32_t)Sample->Acc[i], 4);
+    Serialize(&dest[12U + (4U * i)], (uint32_t)Sample->Gyr[i], 4);
+    Serialize(&dest[24U + (4U * i)], (uint32_t)Sample->Mag[i], 4);
+  }
+
+  dest += 36;
+
+  for (i = 0; i < 4U; i++)
+  {
+    FloatToArray(dest, Sample->Quaternion[i]);
+    dest += 4;
+  }
+
+  for (i = 0; i < 3U; i++)
+  {
+    FloatToArray(&dest[4U * i], Sample->Rotation[i]);
+    FloatToArray(&dest[12U + (4U * i)], Sample->Gravity[i]);
+    FloatToArray(&dest[24U + (4U * i)], Sample->LinearAcc[i]);
+  }
+
+  dest += 36;
+  FloatToArray(dest, Sample->Heading);
+  dest += 4;
+  FloatToArray(dest, Sample->HeadingErr);
+  dest += 4;
+  Serialize(dest, Sample->ElapsedUs, 4);
+  dest += 4;
+
+  Msg->Len = (uint32_t)(dest - Msg->Data);
+}
+
+/**
+  * @brief  Check the layout descriptor: fields in bit order, contiguous offsets from the
+  *         message header on, sizes of the field list, frame length and field count
+  * @param  Fields fields in the frame and STREAM_LAYOUT_COMPACT flag
+  * @retval Number of mismatches
+  */
+static uint32_t Check_Descriptor(uint32_t Fields)
+{
+  const uint32_t *size = ((Fields & STREAM_LAYOUT_COMPACT) != 0U) ? RefSizeCompact : RefSize;
+  uint8_t desc[STREAM_LAYOUT_DESC_MAX_LEN];
+  uint32_t offset = STREAM_HEADER_LEN;
+  uint32_t pos = STREAM_LAYOUT_DESC_HEADER_LEN;
+  uint32_t count = 0;
+  uint32_t errors = 0;
+  uint32_t len;
+  uint32_t i;
+
+  len = Stream_Layout_Describe(Fields, desc);
+
+  for (i = 0; i < STREAM_FIELD_COUNT; i++)
+  {
+    if ((Fields & (1UL << i)) != 0U)
+    {
+      if ((pos >= len) || (desc[pos] != i) || (desc[pos + 1U] != offset) || (desc[pos + 2U] != size[i]))
+      {
+        errors++;
+      }
+
+      pos += STREAM_LAYOUT_DESC_FIELD_LEN;
+      offset += size[i];
+      count++;
+    }
+  }
+
+  if ((len != pos) || (Deserialize(desc, 4) != Fields) || (desc[4] != offset) || (desc[5] != count) ||
+      ((STREAM_HEADER_LEN + Stream_Layout_Len(Fields)) != offset))
+  {
+    errors++;
+  }
+
+  return errors;
+}
+
+/**
+  * @brief  Decode a frame and compare with the sample: the fields in the frame byte
+  *         identical, compact fixed point ones re-encoded identical, the compact quaternion
+  *         close to the sample one, the other fields 0; frames one byte too short or too
+  *         long rejected
+  * @param  Fields fields in the frame and STREAM_LAYOUT_COMPACT flag
+  * @param  Sample pointer to the encoded sample
+  * @param  Msg pointer to the frame
+  * @retval Number of mismatches
+  */
+static uint32_t Check_Decode(uint32_t Fields, const Stream_Sample_t *Sample, Msg_t *Msg)
+{
+  static const Stream_Sample_t zero;
+  Stream_Sample_t decoded;
+  uint8_t expected[STREAM_FIELD_MAX_SIZE];
+  uint8_t actual[STREAM_FIELD_MAX_SIZE];
+  uint32_t errors = 0;
+  uint32_t field;
+  uint32_t size;
+  uint32_t i;
+
+  if (Stream_Layout_Decode(Fields, Msg, &decoded) != 0)
+  {
+    return 1;
+  }
+
+  for (field = STREAM_FIELD_TIME; field <= STREAM_FIELD_ALL; field <<= 1)
+  {
+    uint32_t flags = field | (Fields & STREAM_LAYOUT_COMPACT);
+
+    if ((Fields & field) == 0U)
+    {
+      size = Stream_Layout_Field(field, &zero, expected);
+      (void)Stream_Layout_Field(field, &decoded, actual);
+    }
+    else if (((Fields & STREAM_LAYOUT_COMPACT) != 0U) && (field == STREAM_FIELD_QUATERNION))
+    {
+      /* The largest component is rebuilt from the norm, q and -q being the same rotation */
+      float sign = (Sample->Quaternion[0] * decoded.Quaternion[0] + Sample->Quaternion[1] * decoded.Quaternion[1] +
+                    Sample->Quaternion[2] * decoded.Quaternion[2] + Sample->Quaternion[3] * decoded.Quaternion[3] < 0.0f)
+                   ? -1.0f : 1.0f;
+
+      for (i = 0; i < 4U; i++)
+      {
+        if (fabsf((sign * Sample->Quaternion[i]) - decoded.Quaternion[i]) > QUAT_TOLERANCE)
+        {
+          errors++;
+        }
+      }
+
+      continue;
+    }
+    else
+    {
+      size = Stream_Layout_Field(flags, Sample, expected);
+      (void)Stream_Layout_Field(flags, &decoded, actual);
+    }
+
+    if (memcmp(expected, actual, size) != 0)
+    {
+      errors++;
+    }
+  }
+
+  /* Frame length not matching the layout */
+  Msg->Len--;
+  errors += (Stream_Layout_Decode(Fields, Msg, &decoded) != -1) ? 1U : 0U;
+  Msg->Len += 2U;
+  errors += (Stream_Layout_Decode(Fields, Msg, &decoded) != -1) ? 1U : 0U;
+  Msg->Len--;
+
+  return errors;
+}
+
+/**
+  * @brief  Layout check: every field selection, with and without STREAM_LAYOUT_COMPACT,
+  *         for every enabled sensors mask. The fields kept, the descriptor and the frame
+  *         length are compared with the field list, and the frame is decoded back.
+  * @retval None
+  */
+static void Check_Layouts(void)
+{
+  static Msg_t msg;
+  Stream_Sample_t sample;
+  uint32_t select_errors = 0;
+  uint32_t layout_errors = 0;
+  uint32_t decode_errors = 0;
+  uint32_t layouts = 0;
+  uint32_t compact;
+  uint32_t select;
+  uint32_t mask;
+
+  for (compact = 0; compact <= STREAM_LAYOUT_COMPACT; compact += STREAM_LAYOUT_COMPACT)
+  {
+    for (select = 0; select < SELECTIONS; select++)
+    {
+      Sample_Random(&sample);
+
+      for (mask = 0; mask < SENSOR_MASKS; mask++)
+      {
+        uint32_t fields = Stream_Layout_Fields(select | compact, mask);
+
+        if (fields != Ref_Fields(select | compact, mask))
+        {
+          select_errors++;
+          continue;
+        }
+
+        layouts++;
+        layout_errors += Check_Descriptor(fields);
+        Frame_Build(fields, &sample, &msg);
+
+        if (msg.Len != (STREAM_HEADER_LEN + Stream_Layout_Len(fields)))
+        {
+          layout_errors++;
+        }
+
+        decode_errors += Check_Decode(fields, &sample, &msg);
+      }
+    }
+  }
+
+  printf("Selections: %u selections x %u sensor masks x 2, %u mismatches %s\n", SELECTIONS, SENSOR_MASKS, select_errors,
+         (select_errors == 0U) ? "PASS" : "FAIL");
+  printf("Layouts: %u layouts, %u descriptor or length mismatches, %u decode mismatches %s\n", layouts, layout_errors,
+         decode_errors, ((layout_errors + decode_errors) == 0U) ? "PASS" : "FAIL");
+  Errors += select_errors + layout_errors + decode_errors;
+}
+
+/**
+  * @brief  Fixed layout check: with STREAM_LAYOUT_FIXED every field is sent whatever the
+  *         enabled sensors and the compact flag, in a STREAMING_MSG_LENGTH frame byte
+  *         identical to the frame sent before the layouts
+  * @retval None
+  */
+static void Check_Fixed(void)
+{
+  static Msg_t msg;
+  static Msg_t expected;
+  Stream_Sample_t sample;
+  uint32_t errors = 0;
+  uint32_t mask;
+  uint32_t i;
+
+  for (mask = 0; mask < SENSOR_MASKS; mask++)
+  {
+    if ((Stream_Layout_Fields(STREAM_LAYOUT_FIXED | (Rand32() & STREAM_LAYOUT_SELECT_MASK), mask) != STREAM_FIELD_ALL) ||
+        (Stream_Layout_Fields(STREAM_LAYOUT_FIXED | STREAM_LAYOUT_COMPACT, mask) != STREAM_FIELD_ALL))
+    {
+      errors++;
+    }
+  }
+
+  for (i = 0; i < FIXED_SAMPLES; i++)
+  {
+    Sample_Random(&sample);
+    Frame_Build(Stream_Layout_Fields(STREAM_LAYOUT_FIXED, 0), &sample, &msg);
+    Fixed_Reference(&sample, &expected);
+
+    if ((msg.Len != STREAMING_MSG_LENGTH) || (expected.Len != STREAMING_MSG_LENGTH) ||
+        (memcmp(msg.Data, expected.Data, msg.Len) != 0))
+    {
+      errors++;
+    }
+  }
+
+  printf("Fixed layout: %u frames of %u bytes, %u mismatches %s\n", FIXED_SAMPLES, STREAMING_MSG_LENGTH, errors,
+         (errors == 0U) ? "PASS" : "FAIL");
+  Errors += errors;
+}
+
+/**
+  * @brief  Random unit quaternion, one in two being a hard case for the smallest three
+  *         encoding: along an axis, two or four largest components of the same magnitude
+  *         (the largest one chosen by a rounding error), components at the int15 limit
+  * @param  Quaternion pointer to the quaternion (x, y, z, w)
+  * @retval None
+  */
+static void Quaternion_Random(float *Quaternion)
+{
+  float norm = 0.0f;
+  float a;
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0; i < 4U; i++)
+  {
+    Quaternion[i] = Rand_Float(-1.0f, 1.0f);
+  }
+
+  i = Rand32() % 4U;
+  j = (i + 1U + (Rand32() % 3U)) % 4U;
+
+  switch (Rand32() % 8U)
+  {
+    case 0:
+      memset(Quaternion, 0, 4U * sizeof(float));
+      Quaternion[i] = ((Rand32() & 1U) != 0U) ? 1.0f : -1.0f;
+      break;
+
+    case 1:
+      a = Rand_Float(0.5f, 1.0f);
+      Quaternion[i] = a;
+      Quaternion[j] = ((Rand32() & 1U) != 0U) ? a : -a;
+      Quaternion[(i + 1U) % 4U] = ((i + 1U) % 4U == j) ? Quaternion[j] : Rand_Float(-0.1f, 0.1f);
+      Quaternion[(j + 1U) % 4U] = ((j + 1U) % 4U == i) ? Quaternion[i] : Rand_Float(-0.1f, 0.1f);
+      break;
+
+    case 2:
+      for (j = 0; j < 4U; j++)
+      {
+        Quaternion[j] = ((Rand32() & 1U) != 0U) ? 0.5f : -0.5f;
+      }
+      break;
+
+    case 3:
+      /* Second largest component at 1 / sqrt(2), the int15 limit */
+      memset(Quaternion, 0, 4U * sizeof(float));
+      Quaternion[i] = 0.70710678f;
+      Quaternion[j] = ((Rand32() & 1U) != 0U) ? 0.70710678f : -0.70710678f;
+      break;
+
+    default:
+      break;
+  }
+
+  for (i = 0; i < 4U; i++)
+  {
+    norm += Quaternion[i] * Quaternion[i];
+  }
+
+  norm = sqrtf(norm);
+
+  for (i = 0; i < 4U; i++)
+  {
+    Quaternion[i] /= norm;
+  }
+}
+
+/**
+  * @brief  Encode one compact field of a sample into a frame and decode the frame
+  * @param  Field the field (one STREAM_FIELD_x)
+  * @param  Sample pointer to the sample
+  * @param  Decoded pointer to the decoded sample
+  * @retval None
+  */
+static void Compact_RoundTrip(uint32_t Field, const Stream_Sample_t *Sample, Stream_Sample_t *Decoded)
+{
+  static Msg_t msg;
+
+  Frame_Build(Field | STREAM_LAYOUT_COMPACT, Sample, &msg);
+  (void)Stream_Layout_Decode(Field | STREAM_LAYOUT_COMPACT, &msg, Decoded);
+}
+
+/**
+  * @brief  Error of a decoded quaternion, q and -q being the same rotation
+  * @param  Quaternion pointer to the encoded quaternion
+  * @param  Decoded pointer to the decoded quaternion
+  * @param  Angle rotation angle between the two quaternions [deg]
+  * @retval Largest component error
+  */
+static double Quaternion_Error(const float *Quaternion, const float *Decoded, double *Angle)
+{
+  double dot = 0.0;
+  double norm_q = 0.0;
+  double norm_d = 0.0;
+  double error = 0.0;
+  double sign;
+  double cos_half;
+  uint32_t i;
+
+  for (i = 0; i < 4U; i++)
+  {
+    dot += (double)Quaternion[i] * (double)Decoded[i];
+    norm_q += (double)Quaternion[i] * (double)Quaternion[i];
+    norm_d += (double)Decoded[i] * (double)Decoded[i];
+  }
+
+  sign = (dot < 0.0) ? -1.0 : 1.0;
+
+  for (i = 0; i < 4U; i++)
+  {
+    error = fmax(error, fabs((sign * (double)Quaternion[i]) - (double)Decoded[i]));
+  }
+
+  cos_half = fabs(dot) / sqrt(norm_q * norm_d);
+  *Angle = 2.0 * acos((cos_half > 1.0) ? 1.0 : cos_half) * RAD_TO_DEG;
+  return error;
+}
+
+/**
+  * @brief  Compare a decoded fixed point value with the expected one
+  * @param  Field the field, for the report
+  * @param  Value pointer to the encoded value
+  * @param  Decoded pointer to the decoded value
+  * @param  Expected expected decoded value
+  * @param  Bound largest error
+  * @param  MaxError largest error seen, updated
+  * @retval 1 if the error exceeds the bound, 0 otherwise
+  */
+static uint32_t Check_Scalar(uint32_t Field, const float *Value, const float *Decoded, double Expected, double Bound,
+                             double *MaxError)
+{
+  double error = fabs((double)*Decoded - Expected);
+
+  (void)Field;
+  (void)Value;
+  *MaxError = fmax(*MaxError, error);
+
+  return (error > (Bound + (fabs(Expected) * FLT_EPSILON * FLOAT_SLACK))) ? 1U : 0U;
+}
+
+/**
+  * @brief  Compact round trip check: random values in range and hard case quaternions
+  *         decoded within the error bounds, values out of range saturated, NaN decoded as
+  *         the lowest code and quaternions with a non finite component as the identity
+  * @param  Count number of samples
+  * @retval None
+  */
+static void Check_RoundTrip(uint32_t Count)
+{
+  static const float identity[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+  const float special[3] = {NAN, INFINITY, -INFINITY};
+  Stream_Sample_t sample;
+  Stream_Sample_t decoded;
+  double quat_error = 0.0;
+  double quat_angle = 0.0;
+  double angle_error = 0.0;
+  double g_error = 0.0;
+  double saturated = 0.0;
+  uint32_t quat_errors = 0;
+  uint32_t value_errors = 0;
+  uint32_t special_errors = 0;
+  uint32_t i;
+  uint32_t j;
+
+  memset(&sample, 0, sizeof(sample));
+
+  for (i = 0; i < Count; i++)
+  {
+    double angle;
+    double error;
+
+    Quaternion_Random(sample.Quaternion);
+    Compact_RoundTrip(STREAM_FIELD_QUATERNION, &sample, &decoded);
+    error = Quaternion_Error(sample.Quaternion, decoded.Quaternion, &angle);
+    quat_error = fmax(quat_error, error);
+    quat_angle = fmax(quat_angle, angle);
+
+    if ((error > QUAT_COMPONENT_MAX) || (angle > QUAT_ANGLE_MAX))
+    {
+      quat_errors++;
+    }
+
+    /* In range values, up to the code limits */
+    sample.Rotation[0] = Rand_Float(0.0f, 655.35f);
+    sample.Rotation[1] = Rand_Float(-327.68f, 327.67f);
+    sample.Rotation[2] = Rand_Float(-327.68f, 327.67f);
+    sample.Heading = Rand_Float(0.0f, 655.35f);
+    sample.HeadingErr = Rand_Float(0.0f, 655.35f);
+
+    for (j = 0; j < 3U; j++)
+    {
+      sample.Gravity[j] = Rand_Float(-32.768f, 32.767f);
+      sample.LinearAcc[j] = Rand_Float(-32.768f, 32.767f);
+    }
+
+    Compact_RoundTrip(STREAM_FIELD_ROTATION, &sample, &decoded);
+
+    for (j = 0; j < 3U; j++)
+    {
+      value_errors += Check_Scalar(STREAM_FIELD_ROTATION, &sample.Rotation[j], &decoded.Rotation[j],
+                                   (double)sample.Rotation[j], ANGLE_MAX, &angle_error);
+    }
+
+    Compact_RoundTrip(STREAM_FIELD_HEADING, &sample, &decoded);
+    value_errors += Check_Scalar(STREAM_FIELD_HEADING, &sample.Heading, &decoded.Heading, (double)sample.Heading,
+                                 ANGLE_MAX, &angle_error);
+    Compact_RoundTrip(STREAM_FIELD_HEADING_ERR, &sample, &decoded);
+    value_errors += Check_Scalar(STREAM_FIELD_HEADING_ERR, &sample.HeadingErr, &decoded.HeadingErr,
+                                 (double)sample.HeadingErr, ANGLE_MAX, &angle_error);
+    Compact_RoundTrip(STREAM_FIELD_GRAVITY, &sample, &decoded);
+
+    for (j = 0; j < 3U; j++)
+    {
+      value_errors += Check_Scalar(STREAM_FIELD_GRAVITY, &sample.Gravity[j], &decoded.Gravity[j],
+                                   (double)sample.Gravity[j], G_MAX, &g_error);
+    }
+
+    Compact_RoundTrip(STREAM_FIELD_LINEAR_ACC, &sample, &decoded);
+
+    for (j = 0; j < 3U; j++)
+    {
+      value_errors += Check_Scalar(STREAM_FIELD_LINEAR_ACC, &sample.LinearAcc[j], &decoded.LinearAcc[j],
+                                   (double)sample.LinearAcc[j], G_MAX, &g_error);
+    }
+  }
+
+  /* Out of range values saturated, NaN as the lowest code */
+  for (i = 0; i < 5U; i++)
+  {
+    const float in[5] = {1000.0f, -1000.0f, INFINITY, -INFINITY, NAN};
+    const double out_u16[5] = {655.35, 0.0, 655.35, 0.0, 0.0};
+    const double out_s16_deg[5] = {327.67, -327.68, 327.67, -327.68, -327.68};
+    const double out_s16_g[5] = {32.767, -32.768, 32.767, -32.768, -32.768};
+
+    sample.Rotation[0] = in[i];
+    sample.Rotation[1] = in[i];
+    sample.Rotation[2] = in[i];
+    sample.Heading = in[i];
+    sample.HeadingErr = in[i];
+
+    for (j = 0; j < 3U; j++)
+    {
+      sample.Gravity[j] = in[i];
+      sample.LinearAcc[j] = in[i];
+    }
+
+    Compact_RoundTrip(STREAM_FIELD_ROTATION, &sample, &decoded);
+    special_errors += Check_Scalar(STREAM_FIELD_ROTATION, &sample.Rotation[0], &decoded.Rotation[0], out_u16[i], 0.0,
+                                   &saturated);
+    special_errors += Check_Scalar(STREAM_FIELD_ROTATION, &sample.Rotation[1], &decoded.Rotation[1], out_s16_deg[i], 0.0,
+                                   &saturated);
+    special_errors += Check_Scalar(STREAM_FIELD_ROTATION, &sample.Rotation[2], &decoded.Rotation[2], out_s16_deg[i], 0.0,
+                                   &saturated);
+    Compact_RoundTrip(STREAM_FIELD_HEADING, &sample, &decoded);
+    special_errors += Check_Scalar(STREAM_FIELD_HEADING, &sample.Heading, &decoded.Heading, out_u16[i], 0.0, &saturated);
+    Compact_RoundTrip(STREAM_FIELD_HEADING_ERR, &sample, &decoded);
+    special_errors += Check_Scalar(STREAM_FIELD_HEADING_ERR, &sample.HeadingErr, &decoded.HeadingErr, out_u16[i], 0.0,
+                                   &saturated);
+    Compact_RoundTrip(STREAM_FIELD_GRAVITY, &sample, &decoded);
+    special_errors += Check_Scalar(STREAM_FIELD_GRAVITY, &sample.Gravity[0], &decoded.Gravity[0], out_s16_g[i], 0.0,
+                                   &saturated);
+    Compact_RoundTrip(STREAM_FIELD_LINEAR_ACC, &sample, &decoded);
+    special_errors += Check_Scalar(STREAM_FIELD_LINEAR_ACC, &sample.LinearAcc[0], &decoded.LinearAcc[0], out_s16_g[i],
+                                   0.0, &saturated);
+  }
+
+  /* Quaternions with a NaN or infinite component */
+  for (i = 0; i < 4U; i++)
+  {
+    for (j = 0; j < 3U; j++)
+    {
+      Quaternion_Random(sample.Quaternion);
+      sample.Quaternion[i] = special[j];
+      Compact_RoundTrip(STREAM_FIELD_QUATERNION, &sample, &decoded);
+
+      if (memcmp(decoded.Quaternion, identity, sizeof(identity)) != 0)
+      {
+        special_errors++;
+      }
+    }
+  }
+
+  printf("Compact quaternion: %u samples, max component error %.2e (bound %.1e), max rotation %.5f deg (bound %.4f) %s\n",
+         Count, quat_error, QUAT_COMPONENT_MAX, quat_angle, QUAT_ANGLE_MAX, (quat_errors == 0U) ? "PASS" : "FAIL");
+  printf("Compact values: max angle error %.5f deg (bound %.3f), max acceleration error %.3f mg (bound %.1f), float rounding included %s\n",
+         angle_error, ANGLE_MAX, g_error * 1000.0, G_MAX * 1000.0, (value_errors == 0U) ? "PASS" : "FAIL");
+  printf("Compact saturation, NaN and infinity: %u mismatches %s\n", special_errors,
+         (special_errors == 0U) ? "PASS" : "FAIL");
+  Errors += quat_errors + value_errors + special_errors;
+}
@@ -0,0 +1,534 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host simulation of the sensor boot: the component drivers of the
+  *          sensors exiting from deep power down run on a simulated I2C bus
+  *          and time base, initialized one after the other as before, then
+  *          with their boot times started together, and the time to the
+  *          last initialized sensor is reported
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lis2dux12.h"
+#include "lis2duxs12.h"
+#include "iis2dulpx.h"
+#include "st1vafe3bx.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_DEVICES         4U
+#define SIM_OTHER_ADDRESS   0x7EU  /* Sensors without boot time */
+#define SIM_CALL_US         20.0   /* Bus driver overhead of a transfer [us] */
+#define SIM_TICK_CALL_US    1.0    /* Time of a GetTick call in a polling loop [us] */
+#define SIM_MAX_TIME_US     10.0e6 /* Give up a scenario after 10 s */
+
+/* Private types -------------------------------------------------------------*/
+typedef enum
+{
+  DEV_DEEP_POWER_DOWN,
+  DEV_BOOTING,
+  DEV_READY,
+} Dev_State_t;
+
+/**
+  * @brief  Simulated device
+  */
+typedef struct
+{
+  const char *Name;
+  uint8_t Address;     /* Bus address in the simulation, one per device */
+  uint8_t Id;          /* WHO_AM_I value */
+  double BootUs;       /* Boot time of the device model [us] */
+  Dev_State_t State;
+  double ReadyUs;      /* End of the boot */
+  double InitUs;       /* Time at the end of its init */
+  uint32_t Early;      /* Accesses during the boot */
+  uint8_t Reg[256];
+} Sim_Device_t;
+
+/* Private variables ---------------------------------------------------------*/
+static Sim_Device_t Dev[SIM_DEVICES] =
+{
+  {"LIS2DUX12",  0x10U, LIS2DUX12_ID,  0.0, DEV_DEEP_POWER_DOWN, 0.0, 0.0, 0U, {0}},
+  {"LIS2DUXS12", 0x12U, LIS2DUXS12_ID, 0.0, DEV_DEEP_POWER_DOWN, 0.0, 0.0, 0U, {0}},
+  {"IIS2DULPX",  0x14U, IIS2DULPX_ID,  0.0, DEV_DEEP_POWER_DOWN, 0.0, 0.0, 0U, {0}},
+  {"ST1VAFE3BX", 0x16U, ST1VAFE3BX_ID, 0.0, DEV_DEEP_POWER_DOWN, 0.0, 0.0, 0U, {0}},
+};
+
+static uint32_t DevNbr = SIM_DEVICES;
+static uint32_t OtherSensors = 3;     /* Sensors without boot time, initialized first as in the examples */
+static uint32_t OtherTransfers = 40;  /* Register accesses of their init */
+static double BusKhz = 400.0;
+static double NowUs = 0.0;
+static uint32_t Transfers = 0;
+
+static LIS2DUX12_Object_t Lis2dux12;
+static LIS2DUXS12_Object_t Lis2duxs12;
+static IIS2DULPX_Object_t Iis2dulpx;
+static ST1VAFE3BX_Object_t St1vafe3bx;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static int32_t Bus_Init(void);
+static int32_t Bus_DeInit(void);
+static int32_t Bus_Transfer(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length, uint8_t Write);
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Get_Tick(void);
+static void Delay(uint32_t Ms);
+static void Reset_Devices(void);
+static int32_t Register_Start(uint32_t Index, uint8_t Wait);
+static int32_t Boot_Poll(uint32_t Index, uint8_t *Done);
+static int32_t Init_Device(uint32_t Index);
+static void Init_Others(void);
+static double Run(uint8_t Concurrent);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Simulation entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 if every sensor is initialized without access during its boot, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  double boot_ms[SIM_DEVICES] = {25.0, 25.0, 25.0, 25.0};
+  double seq_us;
+  double conc_us;
+  uint32_t i;
+  uint32_t early = 0;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:b:o:t:k:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'n':
+        DevNbr = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'b':
+      {
+        char *p = optarg;
+        for (i = 0; (i < SIM_DEVICES) && (*p != '\0'); i++)
+        {
+          boot_ms[i] = strtod(p, &p);
+          if (*p == ',')
+          {
+            p++;
+          }
+        }
+        for (; i < SIM_DEVICES; i++)
+        {
+          boot_ms[i] = boot_ms[i - 1U];
+        }
+        break;
+      }
+      case 'o':
+        OtherSensors = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 't':
+        OtherTransfers = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'k':
+        BusKhz = strtod(optarg, NULL);
+        break;
+      default:
+        Usage();
+        return 1;
+    }
+  }
+
+  if ((DevNbr == 0U) || (DevNbr > SIM_DEVICES) || (BusKhz <= 0.0))
+  {
+    Usage();
+    return 1;
+  }
+
+  for (i = 0; i < SIM_DEVICES; i++)
+  {
+    Dev[i].BootUs = boot_ms[i] * 1000.0;
+  }
+
+  printf("%u sensor(s) with boot time, %u other sensor(s) of %u transfers, I2C at %.0f kHz\n\n",
+         (unsigned)DevNbr, (unsigned)OtherSensors, (unsigned)OtherTransfers, BusKhz);
+
+  seq_us = Run(0U);
+  for (i = 0; i < DevNbr; i++)
+  {
+    early += Dev[i].Early;
+  }
+  conc_us = Run(1U);
+  for (i = 0; i < DevNbr; i++)
+  {
+    early += Dev[i].Early;
+  }
+
+  if ((early != 0U) || (seq_us < 0.0) || (conc_us < 0.0))
+  {
+    printf("\nFAILED: %u access(es) during a boot or init error\n", (unsigned)early);
+    return 1;
+  }
+
+  printf("\nBoot to last sensor initialized: %.2f ms one after the other, %.2f ms with the boot times together"
+         " (-%.0f %%)\n", seq_us / 1000.0, conc_us / 1000.0, 100.0 * (seq_us - conc_us) / seq_us);
+
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the options
+  * @retval None
+  */
+static void Usage(void)
+{
+  printf("Usage: boot_sim [-n devices] [-b ms[,ms...]] [-o sensors] [-t transfers] [-k kHz]\n"
+         "  -n  sensors with boot time, 1 to %u: LIS2DUX12, LIS2DUXS12, IIS2DULPX, ST1VAFE3BX (default %u)\n"
+         "  -b  boot time of each device model, the last one repeated (default 25 ms)\n"
+         "  -o  sensors without boot time, initialized first (default 3)\n"
+         "  -t  register accesses of their init (default 40)\n"
+         "  -k  I2C clock (default 400 kHz)\n", (unsigned)SIM_DEVICES, (unsigned)SIM_DEVICES);
+}
+
+/**
+  * @brief  Bus init of the IO interface
+  * @retval 0
+  */
+static int32_t Bus_Init(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Bus deinit of the IO interface
+  * @retval 0
+  */
+static int32_t Bus_DeInit(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  I2C transfer: a device in deep power down wakes up on its address, NACKed,
+  *         and does not answer until the end of its boot
+  * @param  Address the device address
+  * @param  Reg the register address
+  * @param  pData the data
+  * @param  Length the data length
+  * @param  Write 1 for a write, 0 for a read
+  * @retval 0 if acknowledged, -1 otherwise
+  */
+static int32_t Bus_Transfer(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length, uint8_t Write)
+{
+  /* Address, register and data bytes of 9 bits, a restart and the address again for a read */
+  double bytes = (Write == 1U) ? (2.0 + Length) : (3.0 + Length);
+  uint32_t i;
+
+  NowUs += SIM_CALL_US + (bytes * 9.0 * 1000.0 / BusKhz);
+  Transfers++;
+
+  if (Address == SIM_OTHER_ADDRESS)
+  {
+    return 0;
+  }
+
+  for (i = 0; i < DevNbr; i++)
+  {
+    Sim_Device_t *dev = &Dev[i];
+
+    if (dev->Address != Address)
+    {
+      continue;
+    }
+
+    if ((dev->State == DEV_BOOTING) && (NowUs >= dev->ReadyUs))
+    {
+      dev->State = DEV_READY;
+    }
+
+    if (dev->State == DEV_DEEP_POWER_DOWN)
+    {
+      dev->State = DEV_BOOTING;
+      dev->ReadyUs = NowUs + dev->BootUs;
+      return -1;
+    }
+
+    if (dev->State == DEV_BOOTING)
+    {
+      dev->Early++;
+      return -1;
+    }
+
+    if (Write == 1U)
+    {
+      memcpy(&dev->Reg[Reg & 0xFFU], pData, Length);
+    }
+    else
+    {
+      memcpy(pData, &dev->Reg[Reg & 0xFFU], Length);
+    }
+
+    return 0;
+  }
+
+  return -1;
+}
+
+/**
+  * @brief  Read registers, IO interface of the drivers
+  * @param  Address the device address
+  * @param  Reg the register address
+  * @param  pData the data read
+  * @param  Length the data length
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  return Bus_Transfer(Address, Reg, pData, Length, 0U);
+}
+
+/**
+  * @brief  Write registers, IO interface of the drivers
+  * @param  Address the device address
+  * @param  Reg the register address
+  * @param  pData the data to write
+  * @param  Length the data length
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  return Bus_Transfer(Address, Reg, pData, Length, 1U);
+}
+
+/**
+  * @brief  Time base of the drivers, each call takes a bit of time in the polling loops
+  * @retval Time [ms]
+  */
+static int32_t Get_Tick(void)
+{
+  NowUs += SIM_TICK_CALL_US;
+  return (int32_t)(NowUs / 1000.0);
+}
+
+/**
+  * @brief  Delay of the drivers, as HAL_Delay: one more tick to wait at least Ms
+  * @param  Ms the delay [ms]
+  * @retval None
+  */
+static void Delay(uint32_t Ms)
+{
+  NowUs = (floor(NowUs / 1000.0) + (double)Ms + 1.0) * 1000.0;
+}
+
+/**
+  * @brief  Power-up: every device in deep power down, the objects cleared
+  * @retval None
+  */
+static void Reset_Devices(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < SIM_DEVICES; i++)
+  {
+    memset(Dev[i].Reg, 0, sizeof(Dev[i].Reg));
+    Dev[i].Reg[LIS2DUX12_WHO_AM_I] = Dev[i].Id;
+    Dev[i].State = DEV_DEEP_POWER_DOWN;
+    Dev[i].ReadyUs = 0.0;
+    Dev[i].InitUs = 0.0;
+    Dev[i].Early = 0U;
+  }
+
+  memset(&Lis2dux12, 0, sizeof(Lis2dux12));
+  memset(&Lis2duxs12, 0, sizeof(Lis2duxs12));
+  memset(&Iis2dulpx, 0, sizeof(Iis2dulpx));
+  memset(&St1vafe3bx, 0, sizeof(St1vafe3bx));
+  NowUs = 0.0;
+  Transfers = 0U;
+}
+
+/**
+  * @brief  Register the bus of a device, as the BSP probe
+  * @param  Index the device
+  * @param  Wait 1 for RegisterBusIO, waiting for the boot time, 0 for RegisterBusIO_Start
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Register_Start(uint32_t Index, uint8_t Wait)
+{
+  int32_t ret = -1;
+
+#define SIM_IO(T, Obj, Fn)                                    \
+  do                                                          \
+  {                                                           \
+    T io_ctx = {Bus_Init, Bus_DeInit, 0U /* I2C */,           \
+                Dev[Index].Address, Bus_Write, Bus_Read,      \
+                Get_Tick, Delay};                             \
+    ret = (Wait == 1U) ? Fn(&(Obj), &io_ctx)                  \
+                       : Fn##_Start(&(Obj), &io_ctx);         \
+  } while (0)
+
+  switch (Index)
+  {
+    case 0:
+      SIM_IO(LIS2DUX12_IO_t, Lis2dux12, LIS2DUX12_RegisterBusIO);
+      break;
+    case 1:
+      SIM_IO(LIS2DUXS12_IO_t, Lis2duxs12, LIS2DUXS12_RegisterBusIO);
+      break;
+    case 2:
+      SIM_IO(IIS2DULPX_IO_t, Iis2dulpx, IIS2DULPX_RegisterBusIO);
+      break;
+    default:
+      SIM_IO(ST1VAFE3BX_IO_t, St1vafe3bx, ST1VAFE3BX_RegisterBusIO);
+      break;
+  }
+
+#undef SIM_IO
+
+  return ret;
+}
+
+/**
+  * @brief  Check the end of the boot of a device
+  * @param  Index the device
+  * @param  Done 1 at the end of the boot
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Boot_Poll(uint32_t Index, uint8_t *Done)
+{
+  switch (Index)
+  {
+    case 0:
+      return LIS2DUX12_Boot_Poll(&Lis2dux12, Done);
+    case 1:
+      return LIS2DUXS12_Boot_Poll(&Lis2duxs12, Done);
+    case 2:
+      return IIS2DULPX_Boot_Poll(&Iis2dulpx, Done);
+    default:
+      return ST1VAFE3BX_Boot_Poll(&St1vafe3bx, Done);
+  }
+}
+
+/**
+  * @brief  Check the WHO_AM_I and initialize a device, as the BSP probe
+  * @param  Index the device
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Init_Device(uint32_t Index)
+{
+  uint8_t id = 0;
+  int32_t ret;
+
+  switch (Index)
+  {
+    case 0:
+      ret = LIS2DUX12_Set_Mem_Bank(&Lis2dux12, LIS2DUX12_MAIN_MEM_BANK);
+      ret += LIS2DUX12_ReadID(&Lis2dux12, &id);
+      ret += LIS2DUX12_Init(&Lis2dux12);
+      break;
+    case 1:
+      ret = LIS2DUXS12_Set_Mem_Bank(&Lis2duxs12, LIS2DUXS12_MAIN_MEM_BANK);
+      ret += LIS2DUXS12_ReadID(&Lis2duxs12, &id);
+      ret += LIS2DUXS12_Init(&Lis2duxs12);
+      break;
+    case 2:
+      ret = IIS2DULPX_Set_Mem_Bank(&Iis2dulpx, IIS2DULPX_MAIN_MEM_BANK);
+      ret += IIS2DULPX_ReadID(&Iis2dulpx, &id);
+      ret += IIS2DULPX_Init(&Iis2dulpx);
+      break;
+    default:
+      ret = ST1VAFE3BX_Set_Mem_Bank(&St1vafe3bx, ST1VAFE3BX_MAIN_MEM_BANK);
+      ret += ST1VAFE3BX_ReadID(&St1vafe3bx, &id);
+      ret += ST1VAFE3BX_Init(&St1vafe3bx);
+      break;
+  }
+
+  Dev[Index].InitUs = NowUs;
+
+  return ((ret == 0) && (id == Dev[Index].Id)) ? 0 : -1;
+}
+
+/**
+  * @brief  Init of the sensors without boot time, register accesses only
+  * @retval None
+  */
+static void Init_Others(void)
+{
+  uint8_t data = 0;
+  uint32_t i;
+
+  for (i = 0; i < (OtherSensors * OtherTransfers); i++)
+  {
+    (void)Bus_Transfer(SIM_OTHER_ADDRESS, 0U, &data, 1U, (uint8_t)(i & 1U));
+  }
+}
+
+/**
+  * @brief  Run a boot scenario and print the timing of each device
+  * @param  Concurrent 0: each device is registered and initialized in turn, waiting for its
+  *         boot time, 1: the boot of every device is started first
+  * @retval Time to the last device initialized [us], -1 on error
+  */
+static double Run(uint8_t Concurrent)
+{
+  uint8_t done;
+  uint32_t i;
+  int32_t ret = 0;
+
+  Reset_Devices();
+
+  if (Concurrent == 1U)
+  {
+    for (i = 0; i < DevNbr; i++)
+    {
+      ret |= Register_Start(i, 0U);
+    }
+  }
+
+  Init_Others();
+
+  for (i = 0; i < DevNbr; i++)
+  {
+    if (Concurrent == 0U)
+    {
+      ret |= Register_Start(i, 1U);
+    }
+    else
+    {
+      done = 0U;
+      while ((ret == 0) && (done == 0U) && (NowUs < SIM_MAX_TIME_US))
+      {
+        ret |= Boot_Poll(i, &done);
+      }
+    }
+
+    ret |= Init_Device(i);
+  }
+
+  printf("%s:\n", (Concurrent == 1U) ? "Boot times together (RegisterBusIO_Start, Boot_Poll)"
+         : "One after the other (RegisterBusIO)");
+  for (i = 0; i < DevNbr; i++)
+  {
+    printf("  %-10s boot %5.1f ms, ready at %7.2f ms, initialized at %7.2f ms, %u access(es) during the boot\n",
+           Dev[i].Name, Dev[i].BootUs / 1000.0, Dev[i].ReadyUs / 1000.0, Dev[i].InitUs / 1000.0,
+           (unsigned)Dev[i].Early);
+  }
+  printf("  %u transfers, %.2f ms\n", (unsigned)Transfers, NowUs / 1000.0);
+
+  return (ret == 0) ? NowUs : -1.0;
+}
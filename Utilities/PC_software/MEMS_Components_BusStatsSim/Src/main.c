@@ -0,0 +1,563 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host check of the bus transaction statistics of the component
+  *          drivers: the LSM6DSO, LIS2MDL and LPS22HH drivers run random
+  *          sequences on simulated buses, and the counters of each object are
+  *          compared after each step with the transactions seen by the bus
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "mems_bus_stats.h"
+#include "lsm6dso.h"
+#include "lis2mdl.h"
+#include "lps22hh.h"
+
+#if (USE_MEMS_BUS_STATS != 1U)
+#error "Build with -DUSE_MEMS_BUS_STATS=1U"
+#endif /* USE_MEMS_BUS_STATS */
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_DEVICES         3U      /* LSM6DSO, LIS2MDL, LPS22HH */
+#define SIM_REGS            0x80U
+#define SIM_OPS             10U
+#define SIM_TIME_START      0xFFFF0000U /* The bus time counter wraps during the run */
+#define SIM_TXN_TIME        40U     /* Bus time of a transaction, in GetTime units */
+#define SIM_BYTE_TIME       23U     /* Bus time of a data byte */
+#define SIM_IDLE_TIME       1000U   /* Maximum time between two steps, not on the bus */
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Simulated device: flat register model and counters seen by the bus
+  */
+typedef struct
+{
+  const char *Name;
+  uint16_t Address;
+  uint8_t IdReg;
+  uint8_t Id;
+  uint8_t Regs[SIM_REGS];
+  MEMS_BusStats_t *pStats;       /* Counters of the component object */
+  MEMS_BusStats_t Ref;           /* Counters of the bus model */
+  uint32_t Fails;                /* Failed transactions injected */
+} Sim_Device_t;
+
+/* Private variables ---------------------------------------------------------*/
+static LSM6DSO_Object_t Lsm;
+static LIS2MDL_Object_t Mag;
+static LPS22HH_Object_t Press;
+
+static Sim_Device_t Dev[SIM_DEVICES] =
+{
+  {.Name = "LSM6DSO", .Address = LSM6DSO_I2C_ADD_H, .IdReg = LSM6DSO_WHO_AM_I, .Id = LSM6DSO_ID, .pStats = &Lsm.BusStats},
+  {.Name = "LIS2MDL", .Address = LIS2MDL_I2C_ADD, .IdReg = LIS2MDL_WHO_AM_I, .Id = LIS2MDL_ID, .pStats = &Mag.BusStats},
+  {.Name = "LPS22HH", .Address = LPS22HH_I2C_ADD_H, .IdReg = LPS22HH_WHO_AM_I, .Id = LPS22HH_ID, .pStats = &Press.BusStats},
+};
+
+static const float Odr[] = {1.0f, 10.0f, 12.5f, 26.0f, 50.0f, 104.0f, 200.0f, 416.0f, 1666.0f, 6667.0f};
+
+static uint64_t RandState = 1U;
+static uint32_t SimTime = SIM_TIME_START;
+static int32_t Tick = 0;
+static uint32_t FailPermille = 50U;
+static uint32_t NoTimePermille = 100U;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static uint32_t Rand(void);
+static Sim_Device_t *Find_Device(uint16_t Address);
+static int32_t Bus_Init(void);
+static int32_t Bus_DeInit(void);
+static int32_t Bus_Transfer(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length, uint8_t Write);
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Get_Tick(void);
+static void Delay(uint32_t Ms);
+static uint32_t Get_Time(void);
+static int32_t Register(void);
+static void Lsm_Op(uint32_t Op, uint32_t Arg);
+static void Mag_Op(uint32_t Op, uint32_t Arg);
+static void Press_Op(uint32_t Op, uint32_t Arg);
+static int32_t Check(uint32_t Index, uint32_t Step, uint32_t Op);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Check entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 if the counters of the objects always match the bus, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  uint32_t steps = 200000U;
+  uint32_t seed = 1U;
+  uint32_t step;
+  uint32_t i;
+  uint32_t op;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:s:e:t:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'n':
+        steps = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'e':
+        FailPermille = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 't':
+        NoTimePermille = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        Usage();
+        return 1;
+    }
+  }
+
+  RandState = ((uint64_t)seed << 32) | 0x9E3779B9U;
+
+  for (i = 0U; i < SIM_DEVICES; i++)
+  {
+    for (op = 0U; op < SIM_REGS; op++)
+    {
+      Dev[i].Regs[op] = (uint8_t)Rand();
+    }
+    Dev[i].Regs[Dev[i].IdReg & 0x7FU] = Dev[i].Id;
+  }
+
+  if (Register() != 0)
+  {
+    (void)printf("FAILED: bus registration\n");
+    return 1;
+  }
+
+  for (step = 0U; step < steps; step++)
+  {
+    i = Rand() % SIM_DEVICES;
+    op = Rand() % SIM_OPS;
+
+    /* Time spent out of the bus, not counted */
+    SimTime += Rand() % SIM_IDLE_TIME;
+
+    /* Objects without timestamp hook only count the transactions */
+    Dev[i].pStats->GetTime = ((Rand() % 1000U) < NoTimePermille) ? NULL : Get_Time;
+
+    switch (i)
+    {
+      case 0U:
+        Lsm_Op(op, Rand());
+        break;
+      case 1U:
+        Mag_Op(op, Rand());
+        break;
+      default:
+        Press_Op(op, Rand());
+        break;
+    }
+
+    if (Check(i, step, op) != 0)
+    {
+      return 1;
+    }
+  }
+
+  for (i = 0U; i < SIM_DEVICES; i++)
+  {
+    (void)printf("%-8s reads %8u (%8u bytes)  writes %8u (%8u bytes)  errors %6u  bus time %10u\n",
+                 Dev[i].Name, (unsigned)Dev[i].pStats->Reads, (unsigned)Dev[i].pStats->ReadBytes,
+                 (unsigned)Dev[i].pStats->Writes, (unsigned)Dev[i].pStats->WriteBytes,
+                 (unsigned)Dev[i].pStats->Errors, (unsigned)Dev[i].pStats->BusTime);
+
+    if ((FailPermille != 0U) && (Dev[i].Fails == 0U))
+    {
+      (void)printf("FAILED: %s, no failed transaction injected\n", Dev[i].Name);
+      return 1;
+    }
+  }
+
+  (void)printf("PASSED: %u steps, bus time counter wrapped %s\n", (unsigned)steps,
+               (SimTime < SIM_TIME_START) ? "yes" : "no");
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the command line options
+  * @retval None
+  */
+static void Usage(void)
+{
+  (void)printf("Usage: bus_stats_sim [-n steps] [-s seed] [-e failed per mille] [-t no timestamp per mille]\n");
+}
+
+/**
+  * @brief  Pseudo-random number, xorshift64*
+  * @retval 32-bit random value
+  */
+static uint32_t Rand(void)
+{
+  RandState ^= RandState >> 12;
+  RandState ^= RandState << 25;
+  RandState ^= RandState >> 27;
+  return (uint32_t)((RandState * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/**
+  * @brief  Device at a bus address
+  * @param  Address the bus address
+  * @retval The device, NULL if none
+  */
+static Sim_Device_t *Find_Device(uint16_t Address)
+{
+  uint32_t i;
+
+  for (i = 0U; i < SIM_DEVICES; i++)
+  {
+    if (Dev[i].Address == Address)
+    {
+      return &Dev[i];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Bus initialization stub
+  * @retval 0
+  */
+static int32_t Bus_Init(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Bus deinitialization stub
+  * @retval 0
+  */
+static int32_t Bus_DeInit(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Transaction on the simulated bus, counted by the bus model
+  * @param  Address the device address
+  * @param  Reg the register address, the auto-increment bit ignored
+  * @param  pData the data
+  * @param  Length the number of bytes
+  * @param  Write 1 for a write, 0 for a read
+  * @retval 0 in case of success, -1 for an injected failure
+  */
+static int32_t Bus_Transfer(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length, uint8_t Write)
+{
+  Sim_Device_t *pDev = Find_Device(Address);
+  uint32_t start = SimTime;
+  uint32_t reg = (uint32_t)Reg & 0x7FU;
+  int32_t ret = 0;
+  uint32_t i;
+
+  if (pDev == NULL)
+  {
+    (void)printf("FAILED: transaction at unknown address 0x%02X\n", Address);
+    exit(1);
+  }
+
+  if ((Rand() % 1000U) < FailPermille)
+  {
+    ret = -1;
+    pDev->Fails++;
+  }
+
+  for (i = 0U; i < Length; i++)
+  {
+    if (Write != 0U)
+    {
+      pDev->Regs[(reg + i) % SIM_REGS] = pData[i];
+    }
+    else
+    {
+      pData[i] = pDev->Regs[(reg + i) % SIM_REGS];
+    }
+  }
+
+  SimTime += SIM_TXN_TIME + (SIM_BYTE_TIME * (uint32_t)Length) + (Rand() % 8U);
+
+  if (Write != 0U)
+  {
+    pDev->Ref.Writes++;
+    pDev->Ref.WriteBytes += Length;
+  }
+  else
+  {
+    pDev->Ref.Reads++;
+    pDev->Ref.ReadBytes += Length;
+  }
+  if (ret != 0)
+  {
+    pDev->Ref.Errors++;
+  }
+  if (pDev->pStats->GetTime != NULL)
+  {
+    pDev->Ref.BusTime += SimTime - start;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Bus read stub
+  * @param  Address the device address
+  * @param  Reg the register address
+  * @param  pData the read data
+  * @param  Length the number of bytes
+  * @retval 0 in case of success, -1 for an injected failure
+  */
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  return Bus_Transfer(Address, Reg, pData, Length, 0U);
+}
+
+/**
+  * @brief  Bus write stub
+  * @param  Address the device address
+  * @param  Reg the register address
+  * @param  pData the written data
+  * @param  Length the number of bytes
+  * @retval 0 in case of success, -1 for an injected failure
+  */
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  return Bus_Transfer(Address, Reg, pData, Length, 1U);
+}
+
+/**
+  * @brief  Millisecond tick stub, advanced at each call
+  * @retval The tick
+  */
+static int32_t Get_Tick(void)
+{
+  Tick++;
+  return Tick;
+}
+
+/**
+  * @brief  Delay stub, the time is not on the bus
+  * @param  Ms the delay in ms
+  * @retval None
+  */
+static void Delay(uint32_t Ms)
+{
+  SimTime += Ms * 1000U;
+}
+
+/**
+  * @brief  Timestamp hook of the statistics
+  * @retval The simulated time
+  */
+static uint32_t Get_Time(void)
+{
+  return SimTime;
+}
+
+/**
+  * @brief  Register the simulated buses to the three objects
+  * @retval 0 in case of success, 1 otherwise
+  */
+static int32_t Register(void)
+{
+  LSM6DSO_IO_t lsm_io = {Bus_Init, Bus_DeInit, LSM6DSO_I2C_BUS, LSM6DSO_I2C_ADD_H, Bus_Write, Bus_Read, Get_Tick, Delay};
+  LIS2MDL_IO_t mag_io = {Bus_Init, Bus_DeInit, LIS2MDL_I2C_BUS, LIS2MDL_I2C_ADD, Bus_Write, Bus_Read, Get_Tick, Delay};
+  LPS22HH_IO_t press_io = {Bus_Init, Bus_DeInit, LPS22HH_I2C_BUS, LPS22HH_I2C_ADD_H, Bus_Write, Bus_Read, Get_Tick, Delay};
+
+  if ((LSM6DSO_RegisterBusIO(&Lsm, &lsm_io) != LSM6DSO_OK)
+      || (LIS2MDL_RegisterBusIO(&Mag, &mag_io) != LIS2MDL_OK)
+      || (LPS22HH_RegisterBusIO(&Press, &press_io) != LPS22HH_OK))
+  {
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Random LSM6DSO operation
+  * @param  Op the operation
+  * @param  Arg the random argument
+  * @retval None
+  */
+static void Lsm_Op(uint32_t Op, uint32_t Arg)
+{
+  LSM6DSO_Axes_t axes;
+  uint8_t data;
+
+  switch (Op)
+  {
+    case 0U:
+      (void)LSM6DSO_Init(&Lsm);
+      break;
+    case 1U:
+      (void)LSM6DSO_ReadID(&Lsm, &data);
+      break;
+    case 2U:
+      (void)(((Arg & 1U) != 0U) ? LSM6DSO_ACC_Enable(&Lsm) : LSM6DSO_ACC_Disable(&Lsm));
+      break;
+    case 3U:
+      (void)(((Arg & 1U) != 0U) ? LSM6DSO_GYRO_Enable(&Lsm) : LSM6DSO_GYRO_Disable(&Lsm));
+      break;
+    case 4U:
+      (void)LSM6DSO_ACC_SetOutputDataRate(&Lsm, Odr[Arg % (sizeof(Odr) / sizeof(Odr[0]))]);
+      break;
+    case 5U:
+      (void)LSM6DSO_GYRO_SetOutputDataRate(&Lsm, Odr[Arg % (sizeof(Odr) / sizeof(Odr[0]))]);
+      break;
+    case 6U:
+      (void)LSM6DSO_ACC_SetFullScale(&Lsm, (int32_t)(2U << (Arg % 4U)));
+      break;
+    case 7U:
+      (void)(((Arg & 1U) != 0U) ? LSM6DSO_ACC_GetAxes(&Lsm, &axes) : LSM6DSO_GYRO_GetAxes(&Lsm, &axes));
+      break;
+    case 8U:
+      (void)LSM6DSO_Read_Reg(&Lsm, (uint8_t)(Arg % SIM_REGS), &data);
+      break;
+    default:
+      (void)LSM6DSO_Write_Reg(&Lsm, (uint8_t)(Arg % SIM_REGS), (uint8_t)(Arg >> 8));
+      break;
+  }
+}
+
+/**
+  * @brief  Random LIS2MDL operation
+  * @param  Op the operation
+  * @param  Arg the random argument
+  * @retval None
+  */
+static void Mag_Op(uint32_t Op, uint32_t Arg)
+{
+  LIS2MDL_Axes_t axes;
+  uint8_t data;
+
+  switch (Op)
+  {
+    case 0U:
+      (void)LIS2MDL_Init(&Mag);
+      break;
+    case 1U:
+      (void)LIS2MDL_ReadID(&Mag, &data);
+      break;
+    case 2U:
+    case 3U:
+      (void)(((Arg & 1U) != 0U) ? LIS2MDL_MAG_Enable(&Mag) : LIS2MDL_MAG_Disable(&Mag));
+      break;
+    case 4U:
+    case 5U:
+      (void)LIS2MDL_MAG_SetOutputDataRate(&Mag, Odr[Arg % (sizeof(Odr) / sizeof(Odr[0]))]);
+      break;
+    case 6U:
+    case 7U:
+      (void)LIS2MDL_MAG_GetAxes(&Mag, &axes);
+      break;
+    case 8U:
+      (void)LIS2MDL_Read_Reg(&Mag, (uint8_t)(Arg % SIM_REGS), &data);
+      break;
+    default:
+      (void)LIS2MDL_Write_Reg(&Mag, (uint8_t)(Arg % SIM_REGS), (uint8_t)(Arg >> 8));
+      break;
+  }
+}
+
+/**
+  * @brief  Random LPS22HH operation
+  * @param  Op the operation
+  * @param  Arg the random argument
+  * @retval None
+  */
+static void Press_Op(uint32_t Op, uint32_t Arg)
+{
+  float press;
+  float temp;
+  uint8_t data;
+
+  switch (Op)
+  {
+    case 0U:
+      (void)LPS22HH_Init(&Press);
+      break;
+    case 1U:
+      (void)LPS22HH_ReadID(&Press, &data);
+      break;
+    case 2U:
+      (void)(((Arg & 1U) != 0U) ? LPS22HH_PRESS_Enable(&Press) : LPS22HH_PRESS_Disable(&Press));
+      break;
+    case 3U:
+      (void)(((Arg & 1U) != 0U) ? LPS22HH_TEMP_Enable(&Press) : LPS22HH_TEMP_Disable(&Press));
+      break;
+    case 4U:
+      (void)LPS22HH_PRESS_SetOutputDataRate(&Press, Odr[Arg % 6U]);
+      break;
+    case 5U:
+      (void)LPS22HH_PRESS_GetPressure(&Press, &press);
+      break;
+    case 6U:
+      (void)LPS22HH_TEMP_GetTemperature(&Press, &temp);
+      break;
+    case 7U:
+      (void)LPS22HH_FIFO_Get_Data(&Press, &press, &temp);
+      break;
+    case 8U:
+      (void)LPS22HH_Read_Reg(&Press, (uint8_t)(Arg % SIM_REGS), &data);
+      break;
+    default:
+      (void)LPS22HH_Write_Reg(&Press, (uint8_t)(Arg % SIM_REGS), (uint8_t)(Arg >> 8));
+      break;
+  }
+}
+
+/**
+  * @brief  Compare the counters of an object with the bus model
+  * @param  Index the device
+  * @param  Step the step number
+  * @param  Op the operation of the step
+  * @retval 0 if they match, 1 otherwise
+  */
+static int32_t Check(uint32_t Index, uint32_t Step, uint32_t Op)
+{
+  const MEMS_BusStats_t *pStats = Dev[Index].pStats;
+  const MEMS_BusStats_t *pRef = &Dev[Index].Ref;
+
+  if ((pStats->Reads != pRef->Reads) || (pStats->ReadBytes != pRef->ReadBytes)
+      || (pStats->Writes != pRef->Writes) || (pStats->WriteBytes != pRef->WriteBytes)
+      || (pStats->Errors != pRef->Errors) || (pStats->BusTime != pRef->BusTime))
+  {
+    (void)printf("FAILED: %s, step %u, operation %u\n", Dev[Index].Name, (unsigned)Step, (unsigned)Op);
+    (void)printf("  object: reads %u/%u writes %u/%u errors %u time %u\n",
+                 (unsigned)pStats->Reads, (unsigned)pStats->ReadBytes, (unsigned)pStats->Writes,
+                 (unsigned)pStats->WriteBytes, (unsigned)pStats->Errors, (unsigned)pStats->BusTime);
+    (void)printf("  bus:    reads %u/%u writes %u/%u errors %u time %u\n",
+                 (unsigned)pRef->Reads, (unsigned)pRef->ReadBytes, (unsigned)pRef->Writes,
+                 (unsigned)pRef->WriteBytes, (unsigned)pRef->Errors, (unsigned)pRef->BusTime);
+    return 1;
+  }
+
+  return 0;
+}
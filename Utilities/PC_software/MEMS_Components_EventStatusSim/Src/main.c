@@ -0,0 +1,1059 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host check of the event status of the LSM6DSV16X, LSM6DSOX and
+  *          ISM330DHCX component drivers: the events are polled on simulated
+  *          register models with random detections enabled and random source
+  *          registers, and the status and bus transactions are compared with
+  *          the previous implementation of XXX_ACC_Get_Event_Status
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lsm6dsv16x.h"
+#include "lsm6dsox.h"
+#include "ism330dhcx.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_DEVICES         3U      /* LSM6DSV16X, LSM6DSOX, ISM330DHCX */
+#define SIM_FEATURES        7U
+#define SIM_REGS            0x100U
+#define SIM_FUNC_CFG_ACCESS 0x01U
+#define SIM_CTRL3           0x12U   /* CTRL3, CTRL3_C */
+#define SIM_BANK_EMB        0x80U   /* FUNC_CFG_ACCESS bank bits */
+#define SIM_BANK_SHUB       0x40U
+#define SIM_IF_INC          0x04U
+#define SIM_EMB_STATUS      0x12U   /* EMB_FUNC_STATUS */
+#define SIM_EMB_SRC         0x64U   /* EMB_FUNC_SRC */
+#define SIM_EMB_INT1        0x0AU   /* EMB_FUNC_INT1 */
+#define SIM_EMB_INT2        0x0EU   /* EMB_FUNC_INT2 */
+#define SIM_EMB_ROUTE       0x18U   /* EMB_FUNC_INTx step detector and tilt bits */
+#define SIM_IS_STEP_DET     0x08U   /* EMB_FUNC_STATUS bits */
+#define SIM_IS_TILT         0x10U
+#define SIM_STEP_DETECTED   0x20U   /* EMB_FUNC_SRC bit */
+#define SIM_CALL_US         20.0    /* Bus driver overhead of a transfer [us] */
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Register model of a device type
+  */
+typedef struct
+{
+  const char *Name;
+  uint8_t Src;                   /* WAKE_UP_SRC, followed by TAP_SRC and D6D_SRC */
+  uint8_t EmbStatusMain;         /* EMB_FUNC_STATUS_MAINPAGE, 0 if none */
+  uint8_t Features;              /* Detections of the driver, in the order of FeatureName */
+  uint8_t Int2Route;             /* EMB_FUNC_INT2 bits reported by the event status */
+} Sim_Desc_t;
+
+/**
+  * @brief  Simulated device
+  */
+typedef struct
+{
+  const Sim_Desc_t *Desc;
+  uint8_t Main[SIM_REGS];
+  uint8_t Emb[SIM_REGS];
+  uint8_t Shub[SIM_REGS];
+  uint32_t Reads;
+  uint32_t Writes;
+  uint32_t Bytes;
+  double BusUs;
+} Sim_Model_t;
+
+/**
+  * @brief  Bus use of the event polls
+  */
+typedef struct
+{
+  uint32_t Polls;
+  uint32_t Transactions;
+  uint32_t MaxTransactions;
+  uint32_t Bytes;
+  double BusUs;
+} Sim_Cost_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const Sim_Desc_t Desc[SIM_DEVICES] =
+{
+  {"LSM6DSV16X", LSM6DSV16X_WAKE_UP_SRC, LSM6DSV16X_EMB_FUNC_STATUS_MAINPAGE, 7U, SIM_EMB_ROUTE},
+  {"LSM6DSOX", LSM6DSOX_WAKE_UP_SRC, LSM6DSOX_EMB_FUNC_STATUS_MAINPAGE, 7U, SIM_IS_TILT},
+  {"ISM330DHCX", ISM330DHCX_WAKE_UP_SRC, 0x00U, 5U, 0x00U},
+};
+
+static const char *const FeatureName[SIM_FEATURES] =
+{
+  "free-fall", "wake-up", "single tap", "double tap", "6D", "tilt", "pedometer"
+};
+
+static Sim_Model_t Model[SIM_DEVICES];
+static LSM6DSV16X_Object_t Lsm6dsv16x;
+static LSM6DSOX_Object_t Lsm6dsox;
+static ISM330DHCX_Object_t Ism330dhcx;
+
+static uint64_t RandState = 1U;
+static uint32_t Tick = 0U;
+static double BusKhz = 400.0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static uint32_t Rand(void);
+static int32_t Bus_Init(void);
+static int32_t Bus_DeInit(void);
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Get_Tick(void);
+static void Delay(uint32_t Ms);
+static uint8_t *Model_Reg(Sim_Model_t *pModel, uint32_t Reg);
+static void Model_Sources(Sim_Model_t *pModel);
+static int32_t Power_Up(uint32_t Dev);
+static int32_t Feature(uint32_t Dev, uint32_t Feat, uint32_t Pin, uint32_t Enable);
+static int32_t Poll(uint32_t Dev, uint32_t Ref, uint8_t *pStatus, Sim_Cost_t *pCost);
+static int32_t Ref_Lsm6dsv16x_Event_Status(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Event_Status_t *Status);
+static int32_t Ref_Lsm6dsox_Event_Status(LSM6DSOX_Object_t *pObj, LSM6DSOX_Event_Status_t *Status);
+static int32_t Ref_Ism330dhcx_Event_Status(ISM330DHCX_Object_t *pObj, ISM330DHCX_Event_Status_t *Status);
+static void Report(const char *Name, const Sim_Cost_t *pCost);
+
+int main(int argc, char *argv[])
+{
+  /* Previous and burst implementations, without and with the embedded functions routed */
+  Sim_Cost_t cost[2][2];
+  uint32_t events[SIM_FEATURES];
+  uint32_t steps = 20000U;
+  uint32_t seed = 1U;
+  uint32_t dev;
+  uint32_t step;
+  uint32_t op;
+  uint32_t emb;
+  uint8_t status[2];
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:s:k:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'n':
+        steps = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'k':
+        BusKhz = strtod(optarg, NULL);
+        break;
+      default:
+        Usage();
+        return 1;
+    }
+  }
+
+  if (BusKhz <= 0.0)
+  {
+    Usage();
+    return 1;
+  }
+
+  printf("%u random steps per device, seed %u, I2C at %.0f kHz, register shadow %s\n",
+         (unsigned)steps, (unsigned)seed, BusKhz, (USE_MEMS_REG_SHADOW == 1U) ? "on" : "off");
+
+  for (dev = 0; dev < SIM_DEVICES; dev++)
+  {
+    printf("\n%s\n", Desc[dev].Name);
+
+    RandState = ((uint64_t)seed << 8) | (dev + 1U);
+    memset(cost, 0, sizeof(cost));
+    memset(events, 0, sizeof(events));
+
+    if (Power_Up(dev) != 0)
+    {
+      printf("FAILED: init\n");
+      return 1;
+    }
+
+    for (step = 1; step <= steps; step++)
+    {
+      op = Rand() % ((2U * Desc[dev].Features) + 1U);
+
+      if (op < (2U * Desc[dev].Features))
+      {
+        if (Feature(dev, op >> 1, Rand() % 2U, op & 1U) != 0)
+        {
+          printf("FAILED: step %u, %s %s\n", (unsigned)step, ((op & 1U) != 0U) ? "enable" : "disable",
+                 FeatureName[op >> 1]);
+          return 1;
+        }
+      }
+      else if ((Rand() % 16U) == 0U)
+      {
+        /* MCU reset, the sensor keeping its configuration */
+        if (Power_Up(dev) != 0)
+        {
+          printf("FAILED: step %u, init\n", (unsigned)step);
+          return 1;
+        }
+      }
+      else
+      {
+        /* Poll only */
+      }
+
+      Model_Sources(&Model[dev]);
+      emb = (((Model[dev].Emb[SIM_EMB_INT1] & SIM_EMB_ROUTE) | (Model[dev].Emb[SIM_EMB_INT2] & Desc[dev].Int2Route))
+             != 0U) ? 1U : 0U;
+
+      if ((Poll(dev, 1U, &status[0], &cost[0][emb]) != 0) || (Poll(dev, 0U, &status[1], &cost[1][emb]) != 0))
+      {
+        printf("FAILED: step %u, event status\n", (unsigned)step);
+        return 1;
+      }
+
+      if (status[0] != status[1])
+      {
+        printf("FAILED: step %u, status 0x%02X instead of 0x%02X\n", (unsigned)step, status[1], status[0]);
+        return 1;
+      }
+
+      for (op = 0; op < SIM_FEATURES; op++)
+      {
+        events[op] += ((uint32_t)status[1] >> op) & 1U;
+      }
+    }
+
+    Report("previous", cost[0]);
+    Report("burst", cost[1]);
+    printf("  events reported:");
+    for (op = 0; op < Desc[dev].Features; op++)
+    {
+      printf("%s %s %u", (op == 0U) ? "" : ",", FeatureName[op], (unsigned)events[op]);
+    }
+    printf("\n");
+  }
+
+  printf("\nPASSED\n");
+
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the options
+  * @retval None
+  */
+static void Usage(void)
+{
+  printf("Usage: event_sim [-n steps] [-s seed] [-k kHz]\n"
+         "  -n  random steps per device, each one followed by an event poll (default 20000)\n"
+         "  -s  random seed (default 1)\n"
+         "  -k  I2C clock for the bus time (default 400 kHz)\n");
+}
+
+/**
+  * @brief  Random number, xorshift64*
+  * @retval 32 random bits
+  */
+static uint32_t Rand(void)
+{
+  RandState ^= RandState >> 12;
+  RandState ^= RandState << 25;
+  RandState ^= RandState >> 27;
+
+  return (uint32_t)((RandState * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/**
+  * @brief  Bus init of the IO interface
+  * @retval 0
+  */
+static int32_t Bus_Init(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Bus deinit of the IO interface
+  * @retval 0
+  */
+static int32_t Bus_DeInit(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Read registers, IO interface of the drivers, the address selecting the model
+  * @param  Address the model index
+  * @param  Reg the register address
+  * @param  pData the data read
+  * @param  Length the data length
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  Sim_Model_t *m = &Model[Address];
+  uint32_t inc = ((m->Main[SIM_CTRL3] & SIM_IF_INC) != 0U) ? 1U : 0U;
+  uint8_t *p;
+  uint16_t i;
+
+  m->Reads++;
+  m->Bytes += Length;
+  m->BusUs += SIM_CALL_US + ((3.0 + Length) * 9.0 * 1000.0 / BusKhz);
+
+  for (i = 0; i < Length; i++)
+  {
+    p = Model_Reg(m, Reg + (i * inc));
+
+    if (p == NULL)
+    {
+      return -1;
+    }
+
+    pData[i] = *p;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Write registers, IO interface of the drivers, the address selecting the model
+  * @param  Address the model index
+  * @param  Reg the register address
+  * @param  pData the data to write
+  * @param  Length the data length
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  Sim_Model_t *m = &Model[Address];
+  uint32_t inc = ((m->Main[SIM_CTRL3] & SIM_IF_INC) != 0U) ? 1U : 0U;
+  uint8_t *p;
+  uint16_t i;
+
+  m->Writes++;
+  m->Bytes += Length;
+  m->BusUs += SIM_CALL_US + ((2.0 + Length) * 9.0 * 1000.0 / BusKhz);
+
+  for (i = 0; i < Length; i++)
+  {
+    p = Model_Reg(m, Reg + (i * inc));
+
+    if (p == NULL)
+    {
+      return -1;
+    }
+
+    if ((p == &m->Main[SIM_CTRL3]) && ((pData[i] & 0x01U) != 0U))
+    {
+      /* Software reset, the reset bit read at 0 at once */
+      memset(m->Main, 0, sizeof(m->Main));
+      memset(m->Emb, 0, sizeof(m->Emb));
+      memset(m->Shub, 0, sizeof(m->Shub));
+      m->Main[SIM_CTRL3] = SIM_IF_INC;
+    }
+    else
+    {
+      *p = pData[i];
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Time base of the drivers, one ms at each call
+  * @retval Time [ms]
+  */
+static int32_t Get_Tick(void)
+{
+  return (int32_t)Tick++;
+}
+
+/**
+  * @brief  Delay of the drivers
+  * @param  Ms the delay [ms]
+  * @retval None
+  */
+static void Delay(uint32_t Ms)
+{
+  Tick += Ms;
+}
+
+/**
+  * @brief  Register of the selected bank, FUNC_CFG_ACCESS being in all the banks
+  * @param  pModel the model
+  * @param  Reg the register address
+  * @retval Register pointer, NULL if out of the map
+  */
+static uint8_t *Model_Reg(Sim_Model_t *pModel, uint32_t Reg)
+{
+  uint8_t bank = pModel->Main[SIM_FUNC_CFG_ACCESS];
+
+  if (Reg >= SIM_REGS)
+  {
+    return NULL;
+  }
+
+  if (Reg == SIM_FUNC_CFG_ACCESS)
+  {
+    return &pModel->Main[Reg];
+  }
+
+  if ((bank & SIM_BANK_EMB) != 0U)
+  {
+    return &pModel->Emb[Reg];
+  }
+
+  if ((bank & SIM_BANK_SHUB) != 0U)
+  {
+    return &pModel->Shub[Reg];
+  }
+
+  return &pModel->Main[Reg];
+}
+
+/**
+  * @brief  New random values of the source registers: WAKE_UP_SRC, TAP_SRC, D6D_SRC, and the
+  *         step detector and tilt status, in EMB_FUNC_STATUS, EMB_FUNC_SRC and their copy
+  *         EMB_FUNC_STATUS_MAINPAGE
+  * @param  pModel the model
+  * @retval None
+  */
+static void Model_Sources(Sim_Model_t *pModel)
+{
+  uint8_t emb = (uint8_t)(Rand() & (SIM_IS_STEP_DET | SIM_IS_TILT));
+  uint32_t i;
+
+  for (i = 0; i < 3U; i++)
+  {
+    pModel->Main[pModel->Desc->Src + i] = (uint8_t)Rand();
+  }
+
+  if (pModel->Desc->EmbStatusMain != 0U)
+  {
+    pModel->Main[pModel->Desc->EmbStatusMain] = emb;
+    pModel->Emb[SIM_EMB_STATUS] = emb;
+    pModel->Emb[SIM_EMB_SRC] = ((emb & SIM_IS_STEP_DET) != 0U) ? SIM_STEP_DETECTED : 0U;
+  }
+}
+
+/**
+  * @brief  MCU reset: registration and init of the driver object, the device keeping its
+  *         registers, at the first call with the interrupt routing of a previous run
+  * @param  Dev the device type
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Power_Up(uint32_t Dev)
+{
+  Sim_Model_t *m = &Model[Dev];
+  int32_t ret;
+
+  if (m->Desc == NULL)
+  {
+    m->Desc = &Desc[Dev];
+    m->Main[SIM_CTRL3] = SIM_IF_INC;
+    m->Main[SIM_FUNC_CFG_ACCESS] = SIM_BANK_EMB;
+    m->Emb[SIM_EMB_INT1] = (uint8_t)(Rand() & SIM_EMB_ROUTE);
+    m->Emb[SIM_EMB_INT2] = (uint8_t)(Rand() & SIM_EMB_ROUTE);
+  }
+
+  if (Dev == 0U)
+  {
+    LSM6DSV16X_IO_t io = {Bus_Init, Bus_DeInit, LSM6DSV16X_I2C_BUS, (uint8_t)Dev, Bus_Write, Bus_Read, Get_Tick, Delay};
+
+    memset(&Lsm6dsv16x, 0, sizeof(Lsm6dsv16x));
+    ret = LSM6DSV16X_RegisterBusIO(&Lsm6dsv16x, &io);
+    ret = (ret == LSM6DSV16X_OK) ? LSM6DSV16X_Init(&Lsm6dsv16x) : ret;
+  }
+  else if (Dev == 1U)
+  {
+    LSM6DSOX_IO_t io = {Bus_Init, Bus_DeInit, LSM6DSOX_I2C_BUS, (uint8_t)Dev, Bus_Write, Bus_Read, Get_Tick, Delay};
+
+    memset(&Lsm6dsox, 0, sizeof(Lsm6dsox));
+    ret = LSM6DSOX_RegisterBusIO(&Lsm6dsox, &io);
+    ret = (ret == LSM6DSOX_OK) ? LSM6DSOX_Init(&Lsm6dsox) : ret;
+  }
+  else
+  {
+    ISM330DHCX_IO_t io = {Bus_Init, Bus_DeInit, ISM330DHCX_I2C_BUS, (uint8_t)Dev, Bus_Write, Bus_Read, Get_Tick, Delay};
+
+    memset(&Ism330dhcx, 0, sizeof(Ism330dhcx));
+    ret = ISM330DHCX_RegisterBusIO(&Ism330dhcx, &io);
+    ret = (ret == ISM330DHCX_OK) ? ISM330DHCX_Init(&Ism330dhcx) : ret;
+  }
+
+  return (ret == 0) ? 0 : -1;
+}
+
+/**
+  * @brief  Enable or disable a detection with the driver
+  * @param  Dev the device type
+  * @param  Feat the detection, index of FeatureName
+  * @param  Pin the interrupt pin, 0 for INT1, 1 for INT2
+  * @param  Enable 1 to enable, 0 to disable
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t Feature(uint32_t Dev, uint32_t Feat, uint32_t Pin, uint32_t Enable)
+{
+  int32_t ret = -1;
+
+  if (Dev == 0U)
+  {
+    LSM6DSV16X_Object_t *p = &Lsm6dsv16x;
+    LSM6DSV16X_SensorIntPin_t pin = (Pin == 0U) ? LSM6DSV16X_INT1_PIN : LSM6DSV16X_INT2_PIN;
+
+    switch (Feat)
+    {
+      case 0:
+        ret = (Enable == 1U) ? LSM6DSV16X_ACC_Enable_Free_Fall_Detection(p, pin)
+              : LSM6DSV16X_ACC_Disable_Free_Fall_Detection(p);
+        break;
+      case 1:
+        ret = (Enable == 1U) ? LSM6DSV16X_ACC_Enable_Wake_Up_Detection(p, pin)
+              : LSM6DSV16X_ACC_Disable_Wake_Up_Detection(p);
+        break;
+      case 2:
+        ret = (Enable == 1U) ? LSM6DSV16X_ACC_Enable_Single_Tap_Detection(p, pin)
+              : LSM6DSV16X_ACC_Disable_Single_Tap_Detection(p);
+        break;
+      case 3:
+        ret = (Enable == 1U) ? LSM6DSV16X_ACC_Enable_Double_Tap_Detection(p, pin)
+              : LSM6DSV16X_ACC_Disable_Double_Tap_Detection(p);
+        break;
+      case 4:
+        ret = (Enable == 1U) ? LSM6DSV16X_ACC_Enable_6D_Orientation(p, pin)
+              : LSM6DSV16X_ACC_Disable_6D_Orientation(p);
+        break;
+      case 5:
+        ret = (Enable == 1U) ? LSM6DSV16X_ACC_Enable_Tilt_Detection(p, pin)
+              : LSM6DSV16X_ACC_Disable_Tilt_Detection(p);
+        break;
+      default:
+        ret = (Enable == 1U) ? LSM6DSV16X_ACC_Enable_Pedometer(p, pin)
+              : LSM6DSV16X_ACC_Disable_Pedometer(p);
+        break;
+    }
+  }
+  else if (Dev == 1U)
+  {
+    LSM6DSOX_Object_t *p = &Lsm6dsox;
+    LSM6DSOX_SensorIntPin_t pin = (Pin == 0U) ? LSM6DSOX_INT1_PIN : LSM6DSOX_INT2_PIN;
+
+    switch (Feat)
+    {
+      case 0:
+        ret = (Enable == 1U) ? LSM6DSOX_ACC_Enable_Free_Fall_Detection(p, pin)
+              : LSM6DSOX_ACC_Disable_Free_Fall_Detection(p);
+        break;
+      case 1:
+        ret = (Enable == 1U) ? LSM6DSOX_ACC_Enable_Wake_Up_Detection(p, pin)
+              : LSM6DSOX_ACC_Disable_Wake_Up_Detection(p);
+        break;
+      case 2:
+        ret = (Enable == 1U) ? LSM6DSOX_ACC_Enable_Single_Tap_Detection(p, pin)
+              : LSM6DSOX_ACC_Disable_Single_Tap_Detection(p);
+        break;
+      case 3:
+        ret = (Enable == 1U) ? LSM6DSOX_ACC_Enable_Double_Tap_Detection(p, pin)
+              : LSM6DSOX_ACC_Disable_Double_Tap_Detection(p);
+        break;
+      case 4:
+        ret = (Enable == 1U) ? LSM6DSOX_ACC_Enable_6D_Orientation(p, pin)
+              : LSM6DSOX_ACC_Disable_6D_Orientation(p);
+        break;
+      case 5:
+        ret = (Enable == 1U) ? LSM6DSOX_ACC_Enable_Tilt_Detection(p, pin)
+              : LSM6DSOX_ACC_Disable_Tilt_Detection(p);
+        break;
+      default:
+        /* Step detector on INT1 only */
+        ret = (Enable == 1U) ? LSM6DSOX_ACC_Enable_Pedometer(p) : LSM6DSOX_ACC_Disable_Pedometer(p);
+        break;
+    }
+  }
+  else
+  {
+    ISM330DHCX_Object_t *p = &Ism330dhcx;
+    ISM330DHCX_SensorIntPin_t pin = (Pin == 0U) ? ISM330DHCX_INT1_PIN : ISM330DHCX_INT2_PIN;
+
+    switch (Feat)
+    {
+      case 0:
+        ret = (Enable == 1U) ? ISM330DHCX_ACC_Enable_Free_Fall_Detection(p, pin)
+              : ISM330DHCX_ACC_Disable_Free_Fall_Detection(p);
+        break;
+      case 1:
+        ret = (Enable == 1U) ? ISM330DHCX_ACC_Enable_Wake_Up_Detection(p, pin)
+              : ISM330DHCX_ACC_Disable_Wake_Up_Detection(p);
+        break;
+      case 2:
+        ret = (Enable == 1U) ? ISM330DHCX_ACC_Enable_Single_Tap_Detection(p, pin)
+              : ISM330DHCX_ACC_Disable_Single_Tap_Detection(p);
+        break;
+      case 3:
+        ret = (Enable == 1U) ? ISM330DHCX_ACC_Enable_Double_Tap_Detection(p, pin)
+              : ISM330DHCX_ACC_Disable_Double_Tap_Detection(p);
+        break;
+      default:
+        ret = (Enable == 1U) ? ISM330DHCX_ACC_Enable_6D_Orientation(p, pin)
+              : ISM330DHCX_ACC_Disable_6D_Orientation(p);
+        break;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Event poll, with the driver or the previous implementation
+  * @param  Dev the device type
+  * @param  Ref 1 for the previous implementation, 0 for the driver
+  * @param  pStatus the events, one bit per detection in the order of FeatureName
+  * @param  pCost the bus use, updated
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Poll(uint32_t Dev, uint32_t Ref, uint8_t *pStatus, Sim_Cost_t *pCost)
+{
+  Sim_Model_t *m = &Model[Dev];
+  LSM6DSV16X_Event_Status_t s0;
+  LSM6DSOX_Event_Status_t s1;
+  ISM330DHCX_Event_Status_t s2;
+  uint32_t n;
+  int32_t ret;
+
+  m->Reads = 0U;
+  m->Writes = 0U;
+  m->Bytes = 0U;
+  m->BusUs = 0.0;
+
+  if (Dev == 0U)
+  {
+    ret = (Ref == 1U) ? Ref_Lsm6dsv16x_Event_Status(&Lsm6dsv16x, &s0) : LSM6DSV16X_ACC_Get_Event_Status(&Lsm6dsv16x, &s0);
+    *pStatus = (uint8_t)(s0.FreeFallStatus | (s0.WakeUpStatus << 1) | (s0.TapStatus << 2) | (s0.DoubleTapStatus << 3)
+                         | (s0.D6DOrientationStatus << 4) | (s0.TiltStatus << 5) | (s0.StepStatus << 6));
+  }
+  else if (Dev == 1U)
+  {
+    ret = (Ref == 1U) ? Ref_Lsm6dsox_Event_Status(&Lsm6dsox, &s1) : LSM6DSOX_ACC_Get_Event_Status(&Lsm6dsox, &s1);
+    *pStatus = (uint8_t)(s1.FreeFallStatus | (s1.WakeUpStatus << 1) | (s1.TapStatus << 2) | (s1.DoubleTapStatus << 3)
+                         | (s1.D6DOrientationStatus << 4) | (s1.TiltStatus << 5) | (s1.StepStatus << 6));
+  }
+  else
+  {
+    ret = (Ref == 1U) ? Ref_Ism330dhcx_Event_Status(&Ism330dhcx, &s2) : ISM330DHCX_ACC_Get_Event_Status(&Ism330dhcx, &s2);
+    *pStatus = (uint8_t)(s2.FreeFallStatus | (s2.WakeUpStatus << 1) | (s2.TapStatus << 2) | (s2.DoubleTapStatus << 3)
+                         | (s2.D6DOrientationStatus << 4) | (s2.TiltStatus << 5) | (s2.StepStatus << 6));
+  }
+
+  /* Left in the main bank */
+  if ((ret != 0) || ((m->Main[SIM_FUNC_CFG_ACCESS] & (SIM_BANK_EMB | SIM_BANK_SHUB)) != 0U))
+  {
+    return -1;
+  }
+
+  n = m->Reads + m->Writes;
+  pCost->Polls++;
+  pCost->Transactions += n;
+  pCost->MaxTransactions = (n > pCost->MaxTransactions) ? n : pCost->MaxTransactions;
+  pCost->Bytes += m->Bytes;
+  pCost->BusUs += m->BusUs;
+
+  return 0;
+}
+
+/**
+  * @brief  Previous implementation of LSM6DSV16X_ACC_Get_Event_Status, the reference
+  * @param  pObj the device pObj
+  * @param  Status the status of all hardware events
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t Ref_Lsm6dsv16x_Event_Status(LSM6DSV16X_Object_t *pObj, LSM6DSV16X_Event_Status_t *Status)
+{
+  lsm6dsv16x_emb_func_status_t emb_func_status;
+  lsm6dsv16x_wake_up_src_t wake_up_src;
+  lsm6dsv16x_tap_src_t tap_src;
+  lsm6dsv16x_d6d_src_t d6d_src;
+  lsm6dsv16x_emb_func_src_t func_src;
+
+  lsm6dsv16x_md1_cfg_t md1_cfg;
+  lsm6dsv16x_md2_cfg_t md2_cfg;
+
+  lsm6dsv16x_emb_func_int1_t int1_ctrl;
+  lsm6dsv16x_emb_func_int2_t int2_ctrl;
+
+  (void)memset((void *)Status, 0x0, sizeof(LSM6DSV16X_Event_Status_t));
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_WAKE_UP_SRC, (uint8_t *)&wake_up_src, 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_TAP_SRC, (uint8_t *)&tap_src, 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_D6D_SRC, (uint8_t *)&d6d_src, 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_SRC, (uint8_t *)&func_src, 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&int1_ctrl, 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&int2_ctrl, 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_EMB_FUNC_STATUS, (uint8_t *)&emb_func_status, 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_mem_bank_set(&(pObj->Ctx), LSM6DSV16X_MAIN_MEM_BANK) != 0)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_MD1_CFG, (uint8_t *)&md1_cfg, 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&(pObj->Ctx), LSM6DSV16X_MD2_CFG, (uint8_t *)&md2_cfg, 1) != LSM6DSV16X_OK)
+  {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if ((md1_cfg.int1_ff == 1U) || (md2_cfg.int2_ff == 1U))
+  {
+    if (wake_up_src.ff_ia == 1U)
+    {
+      Status->FreeFallStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_wu == 1U) || (md2_cfg.int2_wu == 1U))
+  {
+    if (wake_up_src.wu_ia == 1U)
+    {
+      Status->WakeUpStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_single_tap == 1U) || (md2_cfg.int2_single_tap == 1U))
+  {
+    if (tap_src.single_tap == 1U)
+    {
+      Status->TapStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_double_tap == 1U) || (md2_cfg.int2_double_tap == 1U))
+  {
+    if (tap_src.double_tap == 1U)
+    {
+      Status->DoubleTapStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_6d == 1U) || (md2_cfg.int2_6d == 1U))
+  {
+    if (d6d_src.d6d_ia == 1U)
+    {
+      Status->D6DOrientationStatus = 1;
+    }
+  }
+
+  if (int1_ctrl.int1_step_detector == 1U || int2_ctrl.int2_step_detector == 1U)
+  {
+    if (func_src.step_detected == 1U)
+    {
+      Status->StepStatus = 1;
+    }
+  }
+
+  if ((int1_ctrl.int1_tilt == 1U) || (int2_ctrl.int2_tilt == 1U))
+  {
+    if (emb_func_status.is_tilt == 1U)
+    {
+      Status->TiltStatus = 1;
+    }
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Previous implementation of LSM6DSOX_ACC_Get_Event_Status, the reference
+  * @param  pObj the device pObj
+  * @param  Status the status of all hardware events
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t Ref_Lsm6dsox_Event_Status(LSM6DSOX_Object_t *pObj, LSM6DSOX_Event_Status_t *Status)
+{
+  uint8_t tilt_ia;
+  lsm6dsox_wake_up_src_t wake_up_src;
+  lsm6dsox_tap_src_t tap_src;
+  lsm6dsox_d6d_src_t d6d_src;
+  lsm6dsox_emb_func_src_t func_src;
+  lsm6dsox_md1_cfg_t md1_cfg;
+  lsm6dsox_md2_cfg_t md2_cfg;
+  lsm6dsox_emb_func_int1_t int1_ctrl;
+  lsm6dsox_emb_func_int2_t int2_ctrl;
+
+  (void)memset((void *)Status, 0x0, sizeof(LSM6DSOX_Event_Status_t));
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_WAKE_UP_SRC, (uint8_t *)&wake_up_src, 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_TAP_SRC, (uint8_t *)&tap_src, 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_D6D_SRC, (uint8_t *)&d6d_src, 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_mem_bank_set(&(pObj->Ctx), LSM6DSOX_EMBEDDED_FUNC_BANK) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_EMB_FUNC_SRC, (uint8_t *)&func_src, 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_EMB_FUNC_INT1, (uint8_t *)&int1_ctrl, 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_EMB_FUNC_INT2, (uint8_t *)&int2_ctrl, 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_mem_bank_set(&(pObj->Ctx), LSM6DSOX_USER_BANK) != 0)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_MD1_CFG, (uint8_t *)&md1_cfg, 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_read_reg(&(pObj->Ctx), LSM6DSOX_MD2_CFG, (uint8_t *)&md2_cfg, 1) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if (lsm6dsox_tilt_flag_data_ready_get(&(pObj->Ctx), &tilt_ia) != LSM6DSOX_OK)
+  {
+    return LSM6DSOX_ERROR;
+  }
+
+  if ((md1_cfg.int1_ff == 1U) || (md2_cfg.int2_ff == 1U))
+  {
+    if (wake_up_src.ff_ia == 1U)
+    {
+      Status->FreeFallStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_wu == 1U) || (md2_cfg.int2_wu == 1U))
+  {
+    if (wake_up_src.wu_ia == 1U)
+    {
+      Status->WakeUpStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_single_tap == 1U) || (md2_cfg.int2_single_tap == 1U))
+  {
+    if (tap_src.single_tap == 1U)
+    {
+      Status->TapStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_double_tap == 1U) || (md2_cfg.int2_double_tap == 1U))
+  {
+    if (tap_src.double_tap == 1U)
+    {
+      Status->DoubleTapStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_6d == 1U) || (md2_cfg.int2_6d == 1U))
+  {
+    if (d6d_src.d6d_ia == 1U)
+    {
+      Status->D6DOrientationStatus = 1;
+    }
+  }
+
+  if (int1_ctrl.int1_step_detector == 1U)
+  {
+    if (func_src.step_detected == 1U)
+    {
+      Status->StepStatus = 1;
+    }
+  }
+
+  if ((int1_ctrl.int1_tilt == 1U) || (int2_ctrl.int2_tilt == 1U))
+  {
+    if (tilt_ia == 1U)
+    {
+      Status->TiltStatus = 1;
+    }
+  }
+
+  return LSM6DSOX_OK;
+}
+
+/**
+  * @brief  Previous implementation of ISM330DHCX_ACC_Get_Event_Status, the reference
+  * @param  pObj the device pObj
+  * @param  Status the status of all hardware events
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t Ref_Ism330dhcx_Event_Status(ISM330DHCX_Object_t *pObj, ISM330DHCX_Event_Status_t *Status)
+{
+  ism330dhcx_wake_up_src_t wake_up_src;
+  ism330dhcx_tap_src_t tap_src;
+  ism330dhcx_d6d_src_t d6d_src;
+  ism330dhcx_md1_cfg_t md1_cfg;
+  ism330dhcx_md2_cfg_t md2_cfg;
+  ism330dhcx_int1_ctrl_t int1_ctrl;
+
+  (void)memset((void *)Status, 0x0, sizeof(ISM330DHCX_Event_Status_t));
+
+  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_WAKE_UP_SRC, (uint8_t *)&wake_up_src, 1) != ISM330DHCX_OK)
+  {
+    return ISM330DHCX_ERROR;
+  }
+
+  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_TAP_SRC, (uint8_t *)&tap_src, 1) != ISM330DHCX_OK)
+  {
+    return ISM330DHCX_ERROR;
+  }
+
+  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_D6D_SRC, (uint8_t *)&d6d_src, 1) != ISM330DHCX_OK)
+  {
+    return ISM330DHCX_ERROR;
+  }
+
+  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_MD1_CFG, (uint8_t *)&md1_cfg, 1) != ISM330DHCX_OK)
+  {
+    return ISM330DHCX_ERROR;
+  }
+
+  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_MD2_CFG, (uint8_t *)&md2_cfg, 1) != ISM330DHCX_OK)
+  {
+    return ISM330DHCX_ERROR;
+  }
+
+  if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_INT1_CTRL, (uint8_t *)&int1_ctrl, 1) != ISM330DHCX_OK)
+  {
+    return ISM330DHCX_ERROR;
+  }
+
+  if ((md1_cfg.int1_ff == 1U) || (md2_cfg.int2_ff == 1U))
+  {
+    if (wake_up_src.ff_ia == 1U)
+    {
+      Status->FreeFallStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_wu == 1U) || (md2_cfg.int2_wu == 1U))
+  {
+    if (wake_up_src.wu_ia == 1U)
+    {
+      Status->WakeUpStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_single_tap == 1U) || (md2_cfg.int2_single_tap == 1U))
+  {
+    if (tap_src.single_tap == 1U)
+    {
+      Status->TapStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_double_tap == 1U) || (md2_cfg.int2_double_tap == 1U))
+  {
+    if (tap_src.double_tap == 1U)
+    {
+      Status->DoubleTapStatus = 1;
+    }
+  }
+
+  if ((md1_cfg.int1_6d == 1U) || (md2_cfg.int2_6d == 1U))
+  {
+    if (d6d_src.d6d_ia == 1U)
+    {
+      Status->D6DOrientationStatus = 1;
+    }
+  }
+
+  return ISM330DHCX_OK;
+}
+
+/**
+  * @brief  Print the bus use of the event polls
+  * @param  Name the implementation
+  * @param  pCost the bus use without and with the step detector or tilt routed
+  * @retval None
+  */
+static void Report(const char *Name, const Sim_Cost_t *pCost)
+{
+  static const char *const route[2] = {"without step/tilt routed", "with step/tilt routed"};
+  uint32_t i;
+
+  for (i = 0; i < 2U; i++)
+  {
+    if (pCost[i].Polls == 0U)
+    {
+      continue;
+    }
+
+    printf("  %-8s %-24s %6u polls: %5.2f transactions (max %u), %5.1f bytes, %6.1f us per poll\n",
+           Name, route[i], (unsigned)pCost[i].Polls,
+           (double)pCost[i].Transactions / pCost[i].Polls, (unsigned)pCost[i].MaxTransactions,
+           (double)pCost[i].Bytes / pCost[i].Polls, pCost[i].BusUs / pCost[i].Polls);
+  }
+}
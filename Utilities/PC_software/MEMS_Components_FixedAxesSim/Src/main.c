@@ -0,0 +1,453 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host check of the axis conversion of the LSM6DSV16X, LSM6DSO16IS,
+  *          ISM330DHCX, ISM330IS and ISM6HG256X component drivers: for each
+  *          full scale, every raw value is read through the output and FIFO
+  *          registers of a simulated device and the axes are compared with the
+  *          float product of the raw value and the sensitivity
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lsm6dsv16x.h"
+#include "lsm6dso16is.h"
+#include "ism330dhcx.h"
+#include "ism330is.h"
+#include "ism6hg256x.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_DEVICES     5U
+#define SIM_REGS        0x100U
+#define SIM_OUT_G       0x22U   /* OUTX_L_G */
+#define SIM_OUT_A       0x28U   /* OUTX_L_A */
+#define SIM_OUT_HG      0x34U   /* UI_OUTX_L_A_OIS_HG */
+#define SIM_FIFO_OUT    0x79U   /* FIFO_DATA_OUT_X_L */
+#define SIM_MAX_FS      8U
+
+/* Private macros ------------------------------------------------------------*/
+/* Adapters of the driver functions to the untyped path table */
+#define SIM_AXES(Prefix, Fn) \
+  static int32_t Sim_##Prefix##_##Fn(void *pObj, int32_t *pAxes) \
+  { \
+    Prefix##_Axes_t axes; \
+    int32_t ret = Prefix##_##Fn((Prefix##_Object_t *)pObj, &axes); \
+    pAxes[0] = axes.x; \
+    pAxes[1] = axes.y; \
+    pAxes[2] = axes.z; \
+    return ret; \
+  }
+
+#define SIM_SENSOR(Prefix, Sensor) \
+  static int32_t Sim_##Prefix##_##Sensor##_SetFullScale(void *pObj, int32_t FullScale) \
+  { \
+    return Prefix##_##Sensor##_SetFullScale((Prefix##_Object_t *)pObj, FullScale); \
+  } \
+  static int32_t Sim_##Prefix##_##Sensor##_GetFullScale(void *pObj, int32_t *pFullScale) \
+  { \
+    return Prefix##_##Sensor##_GetFullScale((Prefix##_Object_t *)pObj, pFullScale); \
+  } \
+  static int32_t Sim_##Prefix##_##Sensor##_GetSensitivity(void *pObj, float *pSensitivity) \
+  { \
+    return Prefix##_##Sensor##_GetSensitivity((Prefix##_Object_t *)pObj, pSensitivity); \
+  }
+
+/* Private types -------------------------------------------------------------*/
+/**
+  * @brief  Axis read path of a driver, with the sensor giving its sensitivity
+  */
+typedef struct
+{
+  uint32_t Dev;
+  const char *Name;
+  uint8_t Reg;                                    /* First output register */
+  const int32_t *FullScale;                       /* Full scales to try, 0 terminated */
+  int32_t (*SetFullScale)(void *pObj, int32_t FullScale);
+  int32_t (*GetFullScale)(void *pObj, int32_t *pFullScale);
+  int32_t (*GetSensitivity)(void *pObj, float *pSensitivity);
+  int32_t (*GetAxes)(void *pObj, int32_t *pAxes);
+} Sim_Path_t;
+
+/**
+  * @brief  Comparison of a path at a full scale
+  */
+typedef struct
+{
+  uint32_t Values;        /* Axis values compared */
+  uint32_t Exact;         /* Values with an exact float product */
+  uint32_t Equal;         /* Values equal to the float path */
+  uint32_t ExactDiff;     /* Values with an exact float product and not equal */
+  uint32_t FarDiff;       /* Values not within 1 toward zero of the float path */
+} Sim_Result_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const int32_t AccFs[] = {2, 4, 8, 16, 0};
+static const int32_t HgFs[] = {32, 64, 128, 256, 320, 0};
+static const int32_t GyroFs[] = {125, 250, 500, 1000, 2000, 4000, 0};
+
+static uint8_t Regs[SIM_DEVICES][SIM_REGS];
+static LSM6DSV16X_Object_t Lsm6dsv16x;
+static LSM6DSO16IS_Object_t Lsm6dso16is;
+static ISM330DHCX_Object_t Ism330dhcx;
+static ISM330IS_Object_t Ism330is;
+static ISM6HG256X_Object_t Ism6hg256x;
+static void *const Obj[SIM_DEVICES] = {&Lsm6dsv16x, &Lsm6dso16is, &Ism330dhcx, &Ism330is, &Ism6hg256x};
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t Bus_Init(void);
+static int32_t Bus_DeInit(void);
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Get_Tick(void);
+static void Delay(uint32_t Ms);
+static int32_t Register(void);
+static int32_t Check_Path(const Sim_Path_t *pPath, int32_t FullScale, float Sensitivity, Sim_Result_t *pResult);
+
+
+/* Adapters ------------------------------------------------------------------*/
+SIM_SENSOR(LSM6DSV16X, ACC)
+SIM_SENSOR(LSM6DSV16X, GYRO)
+SIM_AXES(LSM6DSV16X, ACC_GetAxes)
+SIM_AXES(LSM6DSV16X, GYRO_GetAxes)
+SIM_AXES(LSM6DSV16X, FIFO_ACC_Get_Axes)
+SIM_AXES(LSM6DSV16X, FIFO_GYRO_Get_Axes)
+
+SIM_SENSOR(LSM6DSO16IS, ACC)
+SIM_SENSOR(LSM6DSO16IS, GYRO)
+SIM_AXES(LSM6DSO16IS, ACC_GetAxes)
+SIM_AXES(LSM6DSO16IS, GYRO_GetAxes)
+
+SIM_SENSOR(ISM330DHCX, ACC)
+SIM_SENSOR(ISM330DHCX, GYRO)
+SIM_AXES(ISM330DHCX, ACC_GetAxes)
+SIM_AXES(ISM330DHCX, GYRO_GetAxes)
+SIM_AXES(ISM330DHCX, FIFO_ACC_Get_Axes)
+SIM_AXES(ISM330DHCX, FIFO_GYRO_Get_Axes)
+SIM_AXES(ISM330DHCX, FIFO_ACC_Get_Axis)
+SIM_AXES(ISM330DHCX, FIFO_GYRO_Get_Axis)
+
+SIM_SENSOR(ISM330IS, ACC)
+SIM_SENSOR(ISM330IS, GYRO)
+SIM_AXES(ISM330IS, ACC_GetAxes)
+SIM_AXES(ISM330IS, GYRO_GetAxes)
+
+SIM_SENSOR(ISM6HG256X, ACC)
+SIM_SENSOR(ISM6HG256X, ACC_HG)
+SIM_SENSOR(ISM6HG256X, GYRO)
+SIM_AXES(ISM6HG256X, ACC_GetAxes)
+SIM_AXES(ISM6HG256X, ACC_HG_GetAxes)
+SIM_AXES(ISM6HG256X, GYRO_GetAxes)
+SIM_AXES(ISM6HG256X, FIFO_ACC_Get_Axes)
+SIM_AXES(ISM6HG256X, FIFO_GYRO_Get_Axes)
+
+#define SIM_PATH(Dev, Prefix, Sensor, Fs, Reg, Fn) \
+  { Dev, #Prefix "_" #Fn, Reg, Fs, Sim_##Prefix##_##Sensor##_SetFullScale, Sim_##Prefix##_##Sensor##_GetFullScale, \
+    Sim_##Prefix##_##Sensor##_GetSensitivity, Sim_##Prefix##_##Fn }
+
+static const Sim_Path_t Path[] =
+{
+  SIM_PATH(0U, LSM6DSV16X, ACC, AccFs, SIM_OUT_A, ACC_GetAxes),
+  SIM_PATH(0U, LSM6DSV16X, GYRO, GyroFs, SIM_OUT_G, GYRO_GetAxes),
+  SIM_PATH(0U, LSM6DSV16X, ACC, AccFs, SIM_FIFO_OUT, FIFO_ACC_Get_Axes),
+  SIM_PATH(0U, LSM6DSV16X, GYRO, GyroFs, SIM_FIFO_OUT, FIFO_GYRO_Get_Axes),
+  SIM_PATH(1U, LSM6DSO16IS, ACC, AccFs, SIM_OUT_A, ACC_GetAxes),
+  SIM_PATH(1U, LSM6DSO16IS, GYRO, GyroFs, SIM_OUT_G, GYRO_GetAxes),
+  SIM_PATH(2U, ISM330DHCX, ACC, AccFs, SIM_OUT_A, ACC_GetAxes),
+  SIM_PATH(2U, ISM330DHCX, GYRO, GyroFs, SIM_OUT_G, GYRO_GetAxes),
+  SIM_PATH(2U, ISM330DHCX, ACC, AccFs, SIM_FIFO_OUT, FIFO_ACC_Get_Axes),
+  SIM_PATH(2U, ISM330DHCX, GYRO, GyroFs, SIM_FIFO_OUT, FIFO_GYRO_Get_Axes),
+  SIM_PATH(2U, ISM330DHCX, ACC, AccFs, SIM_FIFO_OUT, FIFO_ACC_Get_Axis),
+  SIM_PATH(2U, ISM330DHCX, GYRO, GyroFs, SIM_FIFO_OUT, FIFO_GYRO_Get_Axis),
+  SIM_PATH(3U, ISM330IS, ACC, AccFs, SIM_OUT_A, ACC_GetAxes),
+  SIM_PATH(3U, ISM330IS, GYRO, GyroFs, SIM_OUT_G, GYRO_GetAxes),
+  SIM_PATH(4U, ISM6HG256X, ACC, AccFs, SIM_OUT_A, ACC_GetAxes),
+  SIM_PATH(4U, ISM6HG256X, ACC_HG, HgFs, SIM_OUT_HG, ACC_HG_GetAxes),
+  SIM_PATH(4U, ISM6HG256X, GYRO, GyroFs, SIM_OUT_G, GYRO_GetAxes),
+  SIM_PATH(4U, ISM6HG256X, ACC, AccFs, SIM_FIFO_OUT, FIFO_ACC_Get_Axes),
+  SIM_PATH(4U, ISM6HG256X, GYRO, GyroFs, SIM_FIFO_OUT, FIFO_GYRO_Get_Axes),
+};
+
+#define SIM_PATHS  (sizeof(Path) / sizeof(Path[0]))
+
+/* Main ----------------------------------------------------------------------*/
+int main(void)
+{
+  uint32_t p;
+  uint32_t i;
+  uint32_t fails = 0U;
+  uint32_t checked = 0U;
+
+  printf("Axis conversion: %s path\n", (USE_MEMS_FIXED_POINT_AXES == 1U) ? "integer" : "float");
+
+  if (Register() != 0)
+  {
+    printf("FAILED: bus registration\n");
+    return 1;
+  }
+
+  for (p = 0U; p < SIM_PATHS; p++)
+  {
+    const Sim_Path_t *path = &Path[p];
+    int32_t done[SIM_MAX_FS];
+    uint32_t done_nb = 0U;
+
+    printf("%s\n", path->Name);
+
+    for (i = 0U; path->FullScale[i] != 0; i++)
+    {
+      Sim_Result_t res;
+      int32_t fs = 0;
+      float sens = 0.0f;
+      uint32_t j;
+      uint32_t seen = 0U;
+
+      if ((path->SetFullScale(Obj[path->Dev], path->FullScale[i]) != 0)
+          || (path->GetFullScale(Obj[path->Dev], &fs) != 0)
+          || (path->GetSensitivity(Obj[path->Dev], &sens) != 0))
+      {
+        printf("  FAILED: full scale %ld\n", (long)path->FullScale[i]);
+        fails++;
+        continue;
+      }
+
+      /* A full scale not supported is set to the next one */
+      for (j = 0U; j < done_nb; j++)
+      {
+        seen |= (done[j] == fs) ? 1U : 0U;
+      }
+      if ((seen != 0U) || (done_nb == SIM_MAX_FS))
+      {
+        continue;
+      }
+      done[done_nb] = fs;
+      done_nb++;
+
+      if (Check_Path(path, fs, sens, &res) != 0)
+      {
+        printf("  FAILED: bus error at full scale %ld\n", (long)fs);
+        fails++;
+        continue;
+      }
+      checked++;
+
+      printf("  FS %5ld  sensitivity %-9g exact %5.1f %%  equal %6.2f %%  %s\n", (long)fs, (double)sens,
+             100.0 * (double)res.Exact / (double)res.Values, 100.0 * (double)res.Equal / (double)res.Values,
+             ((res.ExactDiff != 0U) || (res.FarDiff != 0U)) ? "FAILED" : "ok");
+
+      if ((res.ExactDiff != 0U) || (res.FarDiff != 0U))
+      {
+        printf("    %lu differences with an exact float product, %lu larger than 1\n",
+               (unsigned long)res.ExactDiff, (unsigned long)res.FarDiff);
+        fails++;
+      }
+    }
+  }
+
+  if ((fails != 0U) || (checked == 0U))
+  {
+    printf("FAILED: %lu path and full scale mismatches\n", (unsigned long)fails);
+    return 1;
+  }
+
+  printf("PASSED: %lu paths and full scales, all raw values\n", (unsigned long)checked);
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Check an axis path at a full scale with all the raw values
+  * @param  pPath the path
+  * @param  FullScale the full scale set
+  * @param  Sensitivity the sensitivity reported by the driver
+  * @param  pResult the comparison
+  * @retval 0 in case of success, -1 on a driver error
+  * @note   Each axis gets a different raw value, the three axes covering the whole range.
+  *         The integer path has to be equal to the float one when the float product is exact,
+  *         and within 1 toward zero otherwise, the float path equal in any case.
+  */
+static int32_t Check_Path(const Sim_Path_t *pPath, int32_t FullScale, float Sensitivity, Sim_Result_t *pResult)
+{
+  uint8_t *regs = Regs[pPath->Dev];
+  uint32_t v;
+  uint32_t a;
+
+  (void)FullScale;
+  (void)memset(pResult, 0, sizeof(*pResult));
+
+  for (v = 0U; v < 0x10000U; v++)
+  {
+    uint16_t raw[3];
+    int32_t axes[3];
+
+    raw[0] = (uint16_t)v;
+    raw[1] = (uint16_t)(v ^ 0x8000U);
+    raw[2] = (uint16_t)(0xFFFFU - v);
+
+    for (a = 0U; a < 3U; a++)
+    {
+      regs[pPath->Reg + (2U * a)] = (uint8_t)(raw[a] & 0xFFU);
+      regs[pPath->Reg + (2U * a) + 1U] = (uint8_t)(raw[a] >> 8);
+    }
+
+    if (pPath->GetAxes(Obj[pPath->Dev], axes) != 0)
+    {
+      return -1;
+    }
+
+    for (a = 0U; a < 3U; a++)
+    {
+      int16_t r = (int16_t)raw[a];
+      float prod = (float)r * Sensitivity;
+      int32_t ref = (int32_t)prod;
+      int32_t val = axes[a];
+      uint32_t exact = ((double)prod == ((double)r * (double)Sensitivity)) ? 1U : 0U;
+
+      pResult->Values++;
+      pResult->Exact += exact;
+
+      if (val == ref)
+      {
+        pResult->Equal++;
+      }
+      else if ((exact != 0U) || (USE_MEMS_FIXED_POINT_AXES != 1U))
+      {
+        pResult->ExactDiff++;
+      }
+      else if (!(((ref > 0) && (val == (ref - 1))) || ((ref < 0) && (val == (ref + 1)))))
+      {
+        pResult->FarDiff++;
+      }
+      else
+      {
+        /* Float product rounded away from zero to the next integer */
+      }
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Register the bus of the simulated devices
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Register(void)
+{
+  LSM6DSV16X_IO_t io0 = {Bus_Init, Bus_DeInit, LSM6DSV16X_I2C_BUS, 0U, Bus_Write, Bus_Read, Get_Tick, Delay};
+  LSM6DSO16IS_IO_t io1 = {Bus_Init, Bus_DeInit, LSM6DSO16IS_I2C_BUS, 1U, Bus_Write, Bus_Read, Get_Tick, Delay};
+  ISM330DHCX_IO_t io2 = {Bus_Init, Bus_DeInit, ISM330DHCX_I2C_BUS, 2U, Bus_Write, Bus_Read, Get_Tick, Delay};
+  ISM330IS_IO_t io3 = {Bus_Init, Bus_DeInit, ISM330IS_I2C_BUS, 3U, Bus_Write, Bus_Read, Get_Tick, Delay};
+  ISM6HG256X_IO_t io4 = {Bus_Init, Bus_DeInit, ISM6HG256X_I2C_BUS, 4U, Bus_Write, Bus_Read, Get_Tick, Delay};
+
+  if ((LSM6DSV16X_RegisterBusIO(&Lsm6dsv16x, &io0) != LSM6DSV16X_OK)
+      || (LSM6DSO16IS_RegisterBusIO(&Lsm6dso16is, &io1) != LSM6DSO16IS_OK)
+      || (ISM330DHCX_RegisterBusIO(&Ism330dhcx, &io2) != ISM330DHCX_OK)
+      || (ISM330IS_RegisterBusIO(&Ism330is, &io3) != ISM330IS_OK)
+      || (ISM6HG256X_RegisterBusIO(&Ism6hg256x, &io4) != ISM6HG256X_OK))
+  {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Bus init
+  * @retval 0
+  */
+static int32_t Bus_Init(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Bus deinit
+  * @retval 0
+  */
+static int32_t Bus_DeInit(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Read registers of a simulated device, with address auto-increment
+  * @param  Address the device, index in Regs
+  * @param  Reg the first register
+  * @param  pData the data read
+  * @param  Length the number of registers
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  uint16_t i;
+
+  if (Address >= SIM_DEVICES)
+  {
+    return -1;
+  }
+
+  for (i = 0U; i < Length; i++)
+  {
+    pData[i] = Regs[Address][(Reg + i) & (SIM_REGS - 1U)];
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Write registers of a simulated device, with address auto-increment
+  * @param  Address the device, index in Regs
+  * @param  Reg the first register
+  * @param  pData the data to write
+  * @param  Length the number of registers
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  uint16_t i;
+
+  if (Address >= SIM_DEVICES)
+  {
+    return -1;
+  }
+
+  for (i = 0U; i < Length; i++)
+  {
+    Regs[Address][(Reg + i) & (SIM_REGS - 1U)] = pData[i];
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Time base
+  * @retval 0
+  */
+static int32_t Get_Tick(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Delay
+  * @param  Ms the delay [ms]
+  * @retval None
+  */
+static void Delay(uint32_t Ms)
+{
+  (void)Ms;
+}
@@ -0,0 +1,1128 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MEMS Software Solutions Team
+  * @brief   Host check of the register shadow of the LSM6DSV16X and ISM330DHCX
+  *          component drivers: two objects of each driver, one with the
+  *          shadow, run the same random configuration sequences on simulated
+  *          register models, and their results, register images and shadow
+  *          content are compared after each step
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lsm6dsv16x.h"
+#include "ism330dhcx.h"
+
+#if (USE_MEMS_REG_SHADOW != 1U)
+#error "Build with -DUSE_MEMS_REG_SHADOW=1U"
+#endif /* USE_MEMS_REG_SHADOW */
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_DEVICES         2U      /* LSM6DSV16X, ISM330DHCX */
+#define SIM_REGS            0x80U
+#define SIM_FUNC_CFG_ACCESS 0x01U
+#define SIM_WHO_AM_I        0x0FU
+#define SIM_CTRL3           0x12U   /* CTRL3, CTRL3_C */
+#define SIM_COUNTER_BDR     0x0BU   /* COUNTER_BDR_REG1 */
+#define SIM_BANK_EMB        0x80U   /* FUNC_CFG_ACCESS bank bits */
+#define SIM_BANK_SHUB       0x40U
+#define SIM_BOOT            0x80U   /* CTRL3 bits */
+#define SIM_IF_INC          0x04U
+#define SIM_SW_RESET        0x01U
+#define SIM_OPS             19U
+#define SIM_OUT_LEN         48U
+#define SIM_CALL_US         20.0    /* Bus driver overhead of a transfer [us] */
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint8_t First;
+  uint8_t Last;
+} Sim_Range_t;
+
+/**
+  * @brief  Register model of a device type
+  */
+typedef struct
+{
+  const char *Name;
+  uint8_t Id;                    /* WHO_AM_I value */
+  uint8_t Ctrl3Default;
+  uint8_t FuncCfgMask;           /* FUNC_CFG_ACCESS bits kept */
+  uint8_t SwPor;                 /* FUNC_CFG_ACCESS sw_por bit, 0 if none */
+  uint8_t RstCounterBdr;         /* COUNTER_BDR_REG1 bit cleared by the device, 0 if none */
+  const Sim_Range_t *ReadOnly;   /* Main bank registers with a new value at each read, writes ignored */
+  const Sim_Range_t *Aux;        /* Main bank registers also written by the auxiliary SPI */
+} Sim_Desc_t;
+
+/**
+  * @brief  Simulated device
+  */
+typedef struct
+{
+  const Sim_Desc_t *Desc;
+  uint8_t Main[SIM_REGS];
+  uint8_t Emb[SIM_REGS];
+  uint8_t Shub[SIM_REGS];
+  uint32_t VolatileReads;        /* Read-only registers read in the step */
+  uint32_t WriteNbr;             /* Write transactions since the start, for the failures */
+  uint32_t Reads;
+  uint32_t Writes;
+  uint32_t Bytes;
+  double BusUs;
+} Sim_Model_t;
+
+/**
+  * @brief  Result of an operation, compared between the two objects
+  */
+typedef struct
+{
+  int32_t Ret;
+  uint8_t Out[SIM_OUT_LEN];
+} Sim_Result_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const Sim_Range_t Lsm6dsv16xReadOnly[] =
+{
+  {0x00U, 0x00U}, {0x0FU, 0x0FU}, {0x1AU, 0x4AU}, {0x4CU, 0x4FU}, {0x78U, 0x7FU}, {0xFFU, 0x00U}
+};
+static const Sim_Range_t Lsm6dsv16xAux[] =
+{
+  {0x64U, 0x6AU}, {0x6EU, 0x72U}, {0xFFU, 0x00U}
+};
+static const Sim_Range_t Ism330dhcxReadOnly[] =
+{
+  {0x00U, 0x00U}, {0x0FU, 0x0FU}, {0x1AU, 0x55U}, {0x60U, 0x6EU}, {0x76U, 0x7FU}, {0xFFU, 0x00U}
+};
+static const Sim_Range_t Ism330dhcxAux[] =
+{
+  {0x6FU, 0x72U}, {0xFFU, 0x00U}
+};
+
+static const Sim_Desc_t Desc[SIM_DEVICES] =
+{
+  {"LSM6DSV16X", LSM6DSV16X_ID, 0x44U, 0xC9U, 0x04U, 0x00U, Lsm6dsv16xReadOnly, Lsm6dsv16xAux},
+  {"ISM330DHCX", ISM330DHCX_ID, 0x04U, 0xC0U, 0x00U, 0x40U, Ism330dhcxReadOnly, Ism330dhcxAux},
+};
+
+static const char *const OpName[SIM_OPS] =
+{
+  "acc odr", "gyro odr", "acc fs", "gyro fs", "acc enable", "gyro enable", "fifo", "wake-up",
+  "free-fall", "tap/6D", "embedded", "write reg", "mem bank", "reset", "init", "getters",
+  "burst", "shadow", "modes"
+};
+
+/* Model 2 * d + 0 without shadow, 2 * d + 1 with shadow, d the device type */
+static Sim_Model_t Model[2U * SIM_DEVICES];
+static LSM6DSV16X_Object_t Lsm[2];
+static ISM330DHCX_Object_t Ism[2];
+
+static uint64_t RandState = 1U;
+static uint32_t Step = 0U;
+static uint32_t FailPermille = 0U;
+static double BusKhz = 400.0;
+static uint32_t OpCount[SIM_OPS];
+
+/* Private function prototypes -----------------------------------------------*/
+static void Usage(void);
+static uint32_t Rand(void);
+static uint32_t Hash(uint32_t A, uint32_t B, uint32_t C);
+static uint8_t In_Ranges(const Sim_Range_t *pRange, uint32_t Reg);
+static int32_t Bus_Init(void);
+static int32_t Bus_DeInit(void);
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t Get_Tick(void);
+static void Delay(uint32_t Ms);
+static void Model_Reset(Sim_Model_t *pModel);
+static uint8_t *Model_Reg(Sim_Model_t *pModel, uint32_t Reg);
+static void Model_Aux(Sim_Model_t *pModel);
+static void Counters_Clear(void);
+static void Register(uint32_t Dev);
+static MEMS_RegShadow_t *Shadow(uint32_t Dev);
+static void Lsm_Op(uint32_t Obj, uint32_t Op, uint32_t Arg, Sim_Result_t *pRes);
+static void Ism_Op(uint32_t Obj, uint32_t Op, uint32_t Arg, Sim_Result_t *pRes);
+static void Run_Op(uint32_t Dev, uint32_t Op, uint32_t Arg, Sim_Result_t *pRes);
+static int32_t Check(uint32_t Dev, uint32_t Op, const Sim_Result_t *pRes);
+static int32_t Reconfigure(uint32_t Dev);
+static void Report(uint32_t Dev, const char *Phase);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Check entry point
+  * @param  argc number of arguments
+  * @param  argv see Usage
+  * @retval 0 if the objects with and without shadow always agree, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  Sim_Result_t res[2];
+  uint32_t steps = 20000U;
+  uint32_t seed = 1U;
+  uint32_t dev;
+  uint32_t op;
+  uint32_t arg;
+  uint32_t i;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:s:e:k:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 'n':
+        steps = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'e':
+        FailPermille = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'k':
+        BusKhz = strtod(optarg, NULL);
+        break;
+      default:
+        Usage();
+        return 1;
+    }
+  }
+
+  if ((BusKhz <= 0.0) || (FailPermille > 1000U))
+  {
+    Usage();
+    return 1;
+  }
+
+  printf("%u random steps per device, seed %u, %u per mille of failed writes, I2C at %.0f kHz\n",
+         (unsigned)steps, (unsigned)seed, (unsigned)FailPermille, BusKhz);
+
+  for (dev = 0; dev < SIM_DEVICES; dev++)
+  {
+    printf("\n%s\n", Desc[dev].Name);
+
+    /* Init and output data rate / full scale switching, without bus failure */
+    if (Reconfigure(dev) != 0)
+    {
+      return 1;
+    }
+
+    /* Random configuration sequences */
+    RandState = ((uint64_t)seed << 8) | (dev + 1U);
+    Register(dev);
+    Counters_Clear();
+    memset(OpCount, 0, sizeof(OpCount));
+
+    for (Step = 1; Step <= steps; Step++)
+    {
+      op = Rand() % SIM_OPS;
+      arg = Rand();
+      OpCount[op]++;
+
+      Model_Aux(&Model[2U * dev]);
+      Model_Aux(&Model[(2U * dev) + 1U]);
+
+      for (i = 0; i < 2U; i++)
+      {
+        Model[(2U * dev) + i].VolatileReads = 0U;
+        memset(&res[i], 0, sizeof(Sim_Result_t));
+        Run_Op((2U * dev) + i, op, arg, &res[i]);
+      }
+
+      if (memcmp(&res[0], &res[1], sizeof(Sim_Result_t)) != 0)
+      {
+        printf("FAILED: step %u, %s: results differ (ret %d / %d)\n", (unsigned)Step, OpName[op],
+               (int)res[0].Ret, (int)res[1].Ret);
+        return 1;
+      }
+
+      if (Check(dev, op, &res[1]) != 0)
+      {
+        return 1;
+      }
+    }
+
+    Report(dev, "random sequences");
+    printf("  operations:");
+    for (op = 0; op < SIM_OPS; op++)
+    {
+      printf("%s %s %u", (op == 0U) ? "" : ",", OpName[op], (unsigned)OpCount[op]);
+    }
+    printf("\n");
+  }
+
+  printf("\nPASSED\n");
+
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print the options
+  * @retval None
+  */
+static void Usage(void)
+{
+  printf("Usage: shadow_sim [-n steps] [-s seed] [-e per mille] [-k kHz]\n"
+         "  -n  random configuration steps per device (default 20000)\n"
+         "  -s  random seed (default 1)\n"
+         "  -e  write transactions failing, per mille (default 0)\n"
+         "  -k  I2C clock for the bus time (default 400 kHz)\n");
+}
+
+/**
+  * @brief  Random number, xorshift64*
+  * @retval 32 random bits
+  */
+static uint32_t Rand(void)
+{
+  RandState ^= RandState >> 12;
+  RandState ^= RandState << 25;
+  RandState ^= RandState >> 27;
+
+  return (uint32_t)((RandState * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/**
+  * @brief  Value derived from three numbers, the same for the two models of a device
+  * @param  A first number
+  * @param  B second number
+  * @param  C third number
+  * @retval 32 bits hash
+  */
+static uint32_t Hash(uint32_t A, uint32_t B, uint32_t C)
+{
+  uint32_t h = (A * 0x9E3779B1U) ^ (B * 0x85EBCA77U) ^ (C * 0xC2B2AE3DU);
+
+  h ^= h >> 15;
+  h *= 0x2C1B3C6DU;
+  h ^= h >> 12;
+  h *= 0x297A2D39U;
+  h ^= h >> 15;
+
+  return h;
+}
+
+/**
+  * @brief  Check if a register is in a list of ranges
+  * @param  pRange the ranges, ended by a range with First > Last
+  * @param  Reg the register address
+  * @retval 1 if in a range, 0 otherwise
+  */
+static uint8_t In_Ranges(const Sim_Range_t *pRange, uint32_t Reg)
+{
+  for (; pRange->First <= pRange->Last; pRange++)
+  {
+    if ((Reg >= pRange->First) && (Reg <= pRange->Last))
+    {
+      return 1U;
+    }
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  Bus init of the IO interface
+  * @retval 0
+  */
+static int32_t Bus_Init(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Bus deinit of the IO interface
+  * @retval 0
+  */
+static int32_t Bus_DeInit(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Read registers, IO interface of the drivers: the address selects the model,
+  *         the read-only registers get a new value at each read
+  * @param  Address the model index
+  * @param  Reg the register address
+  * @param  pData the data read
+  * @param  Length the data length
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Bus_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  Sim_Model_t *m = &Model[Address];
+  uint32_t inc = ((m->Main[SIM_CTRL3] & SIM_IF_INC) != 0U) ? 1U : 0U;
+  uint32_t reg;
+  uint8_t *p;
+  uint16_t i;
+
+  m->Reads++;
+  m->Bytes += Length;
+  m->BusUs += SIM_CALL_US + ((3.0 + Length) * 9.0 * 1000.0 / BusKhz);
+
+  for (i = 0; i < Length; i++)
+  {
+    reg = Reg + (i * inc);
+    p = Model_Reg(m, reg);
+
+    if (p == NULL)
+    {
+      return -1;
+    }
+
+    if ((p == &m->Main[reg]) && (In_Ranges(m->Desc->ReadOnly, reg) == 1U))
+    {
+      pData[i] = (reg == SIM_WHO_AM_I) ? m->Desc->Id
+                 : (uint8_t)Hash(Step, reg, m->VolatileReads++);
+    }
+    else
+    {
+      pData[i] = *p;
+
+      /* boot and sw_reset read once at 1, then cleared by the device */
+      if (p == &m->Main[SIM_CTRL3])
+      {
+        *p &= (uint8_t)~(SIM_BOOT | SIM_SW_RESET);
+      }
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Write registers, IO interface of the drivers, some of them fail with -e
+  * @param  Address the model index
+  * @param  Reg the register address
+  * @param  pData the data to write
+  * @param  Length the data length
+  * @retval 0 in case of success, -1 otherwise
+  */
+static int32_t Bus_Write(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  Sim_Model_t *m = &Model[Address];
+  uint32_t inc = ((m->Main[SIM_CTRL3] & SIM_IF_INC) != 0U) ? 1U : 0U;
+  uint32_t reg;
+  uint8_t *p;
+  uint8_t val;
+  uint16_t i;
+
+  m->Writes++;
+  m->Bytes += Length;
+  m->BusUs += SIM_CALL_US + ((2.0 + Length) * 9.0 * 1000.0 / BusKhz);
+  m->WriteNbr++;
+
+  /* Failed transaction, the first bytes may have been written */
+  if ((FailPermille != 0U) && ((Hash(m->WriteNbr, 0x5EEDU, 0U) % 1000U) < FailPermille))
+  {
+    Length = (uint16_t)(Hash(m->WriteNbr, 0x5EEDU, 1U) % (Length + 1U));
+    m->WriteNbr |= 0x80000000U;
+  }
+
+  for (i = 0; i < Length; i++)
+  {
+    reg = Reg + (i * inc);
+    p = Model_Reg(m, reg);
+    val = pData[i];
+
+    if (p == NULL)
+    {
+      return -1;
+    }
+
+    if (p != &m->Main[reg])
+    {
+      *p = val;
+    }
+    else if (In_Ranges(m->Desc->ReadOnly, reg) == 1U)
+    {
+      /* Read-only */
+    }
+    else if (reg == SIM_FUNC_CFG_ACCESS)
+    {
+      if ((val & m->Desc->SwPor) != 0U)
+      {
+        Model_Reset(m);
+      }
+      else
+      {
+        *p = val & m->Desc->FuncCfgMask;
+      }
+    }
+    else if ((reg == SIM_CTRL3) && ((val & SIM_SW_RESET) != 0U))
+    {
+      Model_Reset(m);
+      m->Main[SIM_CTRL3] |= SIM_SW_RESET;
+    }
+    else if (reg == SIM_COUNTER_BDR)
+    {
+      *p = val & (uint8_t)~m->Desc->RstCounterBdr;
+    }
+    else
+    {
+      *p = val;
+    }
+  }
+
+  if ((m->WriteNbr & 0x80000000U) != 0U)
+  {
+    m->WriteNbr &= 0x7FFFFFFFU;
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Time base of the drivers, not used by these ones
+  * @retval 0
+  */
+static int32_t Get_Tick(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Delay of the drivers, no time in the model
+  * @param  Ms the delay [ms]
+  * @retval None
+  */
+static void Delay(uint32_t Ms)
+{
+  (void)Ms;
+}
+
+/**
+  * @brief  Reset of the device registers to their default value
+  * @param  pModel the model
+  * @retval None
+  */
+static void Model_Reset(Sim_Model_t *pModel)
+{
+  memset(pModel->Main, 0, sizeof(pModel->Main));
+  memset(pModel->Emb, 0, sizeof(pModel->Emb));
+  memset(pModel->Shub, 0, sizeof(pModel->Shub));
+  pModel->Main[SIM_CTRL3] = pModel->Desc->Ctrl3Default;
+}
+
+/**
+  * @brief  Register of the selected bank, FUNC_CFG_ACCESS being in all the banks
+  * @param  pModel the model
+  * @param  Reg the register address
+  * @retval Register pointer, NULL if out of the map
+  */
+static uint8_t *Model_Reg(Sim_Model_t *pModel, uint32_t Reg)
+{
+  uint8_t bank = pModel->Main[SIM_FUNC_CFG_ACCESS];
+
+  if (Reg >= SIM_REGS)
+  {
+    return NULL;
+  }
+
+  if (Reg == SIM_FUNC_CFG_ACCESS)
+  {
+    return &pModel->Main[Reg];
+  }
+
+  if ((bank & SIM_BANK_EMB) != 0U)
+  {
+    return &pModel->Emb[Reg];
+  }
+
+  if ((bank & SIM_BANK_SHUB) != 0U)
+  {
+    return &pModel->Shub[Reg];
+  }
+
+  return &pModel->Main[Reg];
+}
+
+/**
+  * @brief  Write of the auxiliary SPI registers, now and then between two steps
+  * @param  pModel the model
+  * @retval None
+  */
+static void Model_Aux(Sim_Model_t *pModel)
+{
+  uint32_t reg;
+
+  if ((Hash(Step, 0xA0U, 0U) % 8U) != 0U)
+  {
+    return;
+  }
+
+  for (reg = 0; reg < SIM_REGS; reg++)
+  {
+    if (In_Ranges(pModel->Desc->Aux, reg) == 1U)
+    {
+      pModel->Main[reg] = (uint8_t)Hash(Step, reg, 0xA0U);
+    }
+  }
+}
+
+/**
+  * @brief  Clear the bus counters of every model
+  * @retval None
+  */
+static void Counters_Clear(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < (2U * SIM_DEVICES); i++)
+  {
+    Model[i].Reads = 0U;
+    Model[i].Writes = 0U;
+    Model[i].Bytes = 0U;
+    Model[i].BusUs = 0.0;
+  }
+}
+
+/**
+  * @brief  Power-up of the two models of a device and registration of its two objects,
+  *         the shadow disabled on the first one
+  * @param  Dev the device type
+  * @retval None
+  */
+static void Register(uint32_t Dev)
+{
+  uint32_t i;
+
+  for (i = 0; i < 2U; i++)
+  {
+    Sim_Model_t *m = &Model[(2U * Dev) + i];
+
+    memset(m, 0, sizeof(Sim_Model_t));
+    m->Desc = &Desc[Dev];
+    Model_Reset(m);
+    /* Left in another bank by a previous run */
+    m->Main[SIM_FUNC_CFG_ACCESS] = SIM_BANK_EMB;
+
+    if (Dev == 0U)
+    {
+      LSM6DSV16X_IO_t io = {Bus_Init, Bus_DeInit, LSM6DSV16X_I2C_BUS, (uint8_t)((2U * Dev) + i),
+                            Bus_Write, Bus_Read, Get_Tick, Delay
+                           };
+
+      memset(&Lsm[i], 0, sizeof(Lsm[i]));
+      (void)LSM6DSV16X_RegisterBusIO(&Lsm[i], &io);
+      (void)LSM6DSV16X_Set_Reg_Shadow(&Lsm[i], i);
+    }
+    else
+    {
+      ISM330DHCX_IO_t io = {Bus_Init, Bus_DeInit, ISM330DHCX_I2C_BUS, (uint8_t)((2U * Dev) + i),
+                            Bus_Write, Bus_Read, Get_Tick, Delay
+                           };
+
+      memset(&Ism[i], 0, sizeof(Ism[i]));
+      (void)ISM330DHCX_RegisterBusIO(&Ism[i], &io);
+      (void)ISM330DHCX_Set_Reg_Shadow(&Ism[i], i);
+    }
+  }
+}
+
+/**
+  * @brief  Shadow of the object with the shadow enabled
+  * @param  Dev the device type
+  * @retval Shadow pointer
+  */
+static MEMS_RegShadow_t *Shadow(uint32_t Dev)
+{
+  return (Dev == 0U) ? &Lsm[1].Shadow : &Ism[1].Shadow;
+}
+
+/**
+  * @brief  Operation on a LSM6DSV16X object
+  * @param  Obj the object, 0 or 1
+  * @param  Op the operation
+  * @param  Arg random parameters of the operation
+  * @param  pRes the result
+  * @retval None
+  */
+static void Lsm_Op(uint32_t Obj, uint32_t Op, uint32_t Arg, Sim_Result_t *pRes)
+{
+  static const float odr[] = {0.0f, 7.5f, 15.0f, 30.0f, 60.0f, 120.0f, 240.0f, 480.0f, 960.0f, 1920.0f, 3840.0f,
+                              7680.0f
+                             };
+  static const int32_t acc_fs[] = {2, 4, 8, 16};
+  static const int32_t gyro_fs[] = {125, 250, 500, 1000, 2000, 4000};
+  static const uint8_t fifo_mode[] = {0U, 1U, 3U, 4U, 6U};
+  LSM6DSV16X_Object_t *p = &Lsm[Obj];
+  LSM6DSV16X_SensorIntPin_t pin = ((Arg & 1U) != 0U) ? LSM6DSV16X_INT2_PIN : LSM6DSV16X_INT1_PIN;
+  uint32_t sel = (Arg >> 1) & 3U;
+  uint8_t *out = pRes->Out;
+  int32_t r = 0;
+
+  switch (Op)
+  {
+    case 0:
+      r = LSM6DSV16X_ACC_SetOutputDataRate(p, odr[(Arg >> 4) % 12U]);
+      break;
+    case 1:
+      r = LSM6DSV16X_GYRO_SetOutputDataRate(p, odr[(Arg >> 4) % 12U]);
+      break;
+    case 2:
+      r = LSM6DSV16X_ACC_SetFullScale(p, acc_fs[(Arg >> 4) % 4U]);
+      break;
+    case 3:
+      r = LSM6DSV16X_GYRO_SetFullScale(p, gyro_fs[(Arg >> 4) % 6U]);
+      break;
+    case 4:
+      r = ((Arg & 1U) != 0U) ? LSM6DSV16X_ACC_Enable(p) : LSM6DSV16X_ACC_Disable(p);
+      break;
+    case 5:
+      r = ((Arg & 1U) != 0U) ? LSM6DSV16X_GYRO_Enable(p) : LSM6DSV16X_GYRO_Disable(p);
+      break;
+    case 6:
+      r = (sel == 0U) ? LSM6DSV16X_FIFO_Set_Mode(p, fifo_mode[(Arg >> 4) % 5U])
+          : (sel == 1U) ? LSM6DSV16X_FIFO_Set_Watermark_Level(p, (uint8_t)(Arg >> 8))
+          : (sel == 2U) ? LSM6DSV16X_FIFO_ACC_Set_BDR(p, odr[(Arg >> 4) % 12U])
+          :               LSM6DSV16X_FIFO_GYRO_Set_BDR(p, odr[(Arg >> 4) % 12U]);
+      break;
+    case 7:
+      r = (sel == 0U) ? LSM6DSV16X_ACC_Disable_Wake_Up_Detection(p)
+          : (sel == 1U) ? LSM6DSV16X_ACC_Set_Wake_Up_Threshold(p, (Arg >> 8) & 0x3FU)
+          :               LSM6DSV16X_ACC_Enable_Wake_Up_Detection(p, pin);
+      break;
+    case 8:
+      r = (sel == 0U) ? LSM6DSV16X_ACC_Disable_Free_Fall_Detection(p)
+          : (sel == 1U) ? LSM6DSV16X_ACC_Set_Free_Fall_Threshold(p, (uint8_t)((Arg >> 8) & 7U))
+          : (sel == 2U) ? LSM6DSV16X_ACC_Set_Free_Fall_Duration(p, (uint8_t)((Arg >> 8) & 0x3FU))
+          :               LSM6DSV16X_ACC_Enable_Free_Fall_Detection(p, pin);
+      break;
+    case 9:
+      r = (sel == 0U) ? LSM6DSV16X_ACC_Enable_Single_Tap_Detection(p, pin)
+          : (sel == 1U) ? LSM6DSV16X_ACC_Disable_Single_Tap_Detection(p)
+          : (sel == 2U) ? LSM6DSV16X_ACC_Enable_6D_Orientation(p, pin)
+          :               LSM6DSV16X_ACC_Disable_6D_Orientation(p);
+      break;
+    case 10:
+      r = (sel == 0U) ? LSM6DSV16X_ACC_Enable_Pedometer(p, pin)
+          : (sel == 1U) ? LSM6DSV16X_ACC_Disable_Pedometer(p)
+          : (sel == 2U) ? LSM6DSV16X_ACC_Enable_Tilt_Detection(p, pin)
+          :               LSM6DSV16X_ACC_Disable_Tilt_Detection(p);
+      break;
+    case 11:
+      r = LSM6DSV16X_Write_Reg(p, (uint8_t)((Arg >> 8) & 0x7FU), (uint8_t)(Arg >> 16));
+      break;
+    case 12:
+      /* Back to the main bank most of the time */
+      r = LSM6DSV16X_Set_Mem_Bank(p, (uint8_t)((sel == 3U) ? (1U + ((Arg >> 4) & 1U)) : 0U));
+      break;
+    case 13:
+      r = (sel == 0U) ? lsm6dsv16x_sw_por(&p->Ctx)
+          : (sel == 1U) ? lsm6dsv16x_reboot(&p->Ctx)
+          :               lsm6dsv16x_sw_reset(&p->Ctx);
+      break;
+    case 14:
+      p->is_initialized = 0U;
+      r = LSM6DSV16X_Init(p);
+      break;
+    case 15:
+    {
+      float f[4] = {0};
+      int32_t fs[2] = {0};
+      uint16_t samples = 0;
+      uint8_t reg = 0;
+      LSM6DSV16X_Event_Status_t status;
+
+      memset(&status, 0, sizeof(status));
+      r = LSM6DSV16X_ACC_GetOutputDataRate(p, &f[0]);
+      r += LSM6DSV16X_GYRO_GetOutputDataRate(p, &f[1]);
+      r += LSM6DSV16X_ACC_GetSensitivity(p, &f[2]);
+      r += LSM6DSV16X_GYRO_GetSensitivity(p, &f[3]);
+      r += LSM6DSV16X_ACC_GetFullScale(p, &fs[0]);
+      r += LSM6DSV16X_GYRO_GetFullScale(p, &fs[1]);
+      r += LSM6DSV16X_ACC_Get_Event_Status(p, &status);
+      r += LSM6DSV16X_FIFO_Get_Num_Samples(p, &samples);
+      r += LSM6DSV16X_Read_Reg(p, (uint8_t)((Arg >> 8) & 0x7FU), &reg);
+      memcpy(&out[0], f, sizeof(f));
+      memcpy(&out[16], fs, sizeof(fs));
+      memcpy(&out[24], &status, sizeof(status));
+      memcpy(&out[28], &samples, sizeof(samples));
+      out[30] = reg;
+      break;
+    }
+    case 16:
+    {
+      /* Multi-byte transactions of the register driver over random ranges */
+      uint8_t reg = (uint8_t)((Arg >> 8) & 0x7FU);
+      uint16_t len = (uint16_t)(1U + ((Arg >> 16) % 16U));
+      uint8_t buf[16];
+      uint16_t i;
+
+      if ((reg + len) > SIM_REGS)
+      {
+        len = (uint16_t)(SIM_REGS - reg);
+      }
+
+      if (sel == 0U)
+      {
+        for (i = 0; i < len; i++)
+        {
+          buf[i] = (uint8_t)Hash(Arg, i, 0U);
+        }
+        r = lsm6dsv16x_write_reg(&p->Ctx, reg, buf, len);
+      }
+      else if (sel == 1U)
+      {
+        lsm6dsv16x_xl_offset_mg_t ofs;
+
+        buf[0] = (uint8_t)(Arg >> 8);
+        buf[1] = (uint8_t)(Arg >> 16);
+        buf[2] = (uint8_t)(Arg >> 24);
+        r = lsm6dsv16x_write_reg(&p->Ctx, LSM6DSV16X_X_OFS_USR, buf, 3);
+        r += lsm6dsv16x_xl_offset_mg_get(&p->Ctx, &ofs);
+        memcpy(out, &ofs, sizeof(ofs));
+      }
+      else
+      {
+        r = lsm6dsv16x_read_reg(&p->Ctx, reg, out, len);
+      }
+      break;
+    }
+    case 17:
+      /* Shadow discarded and enabled again, disabled on the object without shadow */
+      r = LSM6DSV16X_Set_Reg_Shadow(p, (uint8_t)Obj);
+      break;
+    default:
+      r = (sel == 0U) ? LSM6DSV16X_DRDY_Set_Mode(p, (uint8_t)((Arg >> 4) & 1U))
+          : (sel == 1U) ? LSM6DSV16X_ACC_Set_Filter_Mode(p, (uint8_t)((Arg >> 4) & 1U), (uint8_t)((Arg >> 8) & 7U))
+          : (sel == 2U) ? LSM6DSV16X_ACC_Set_Power_Mode(p, (uint8_t)((Arg >> 4) & 7U))
+          :               LSM6DSV16X_GYRO_Set_Power_Mode(p, (uint8_t)((Arg >> 4) & 7U));
+      break;
+  }
+
+  pRes->Ret = r;
+  out[40] = p->is_initialized;
+  out[41] = p->acc_is_enabled;
+  out[42] = p->gyro_is_enabled;
+  out[43] = (uint8_t)p->acc_odr;
+  out[44] = (uint8_t)p->gyro_odr;
+}
+
+/**
+  * @brief  Operation on an ISM330DHCX object
+  * @param  Obj the object, 0 or 1
+  * @param  Op the operation
+  * @param  Arg random parameters of the operation
+  * @param  pRes the result
+  * @retval None
+  */
+static void Ism_Op(uint32_t Obj, uint32_t Op, uint32_t Arg, Sim_Result_t *pRes)
+{
+  static const float odr[] = {0.0f, 12.5f, 26.0f, 52.0f, 104.0f, 208.0f, 416.0f, 833.0f, 1666.0f, 3332.0f,
+                              6667.0f, 1.6f
+                             };
+  static const int32_t acc_fs[] = {2, 4, 8, 16};
+  static const int32_t gyro_fs[] = {125, 250, 500, 1000, 2000, 4000};
+  static const uint8_t fifo_mode[] = {0U, 1U, 3U, 4U, 6U};
+  ISM330DHCX_Object_t *p = &Ism[Obj];
+  ISM330DHCX_SensorIntPin_t pin = ((Arg & 1U) != 0U) ? ISM330DHCX_INT2_PIN : ISM330DHCX_INT1_PIN;
+  uint32_t sel = (Arg >> 1) & 3U;
+  uint8_t *out = pRes->Out;
+  int32_t r = 0;
+
+  switch (Op)
+  {
+    case 0:
+      r = ISM330DHCX_ACC_SetOutputDataRate(p, odr[(Arg >> 4) % 12U]);
+      break;
+    case 1:
+      r = ISM330DHCX_GYRO_SetOutputDataRate(p, odr[(Arg >> 4) % 11U]);
+      break;
+    case 2:
+      r = ISM330DHCX_ACC_SetFullScale(p, acc_fs[(Arg >> 4) % 4U]);
+      break;
+    case 3:
+      r = ISM330DHCX_GYRO_SetFullScale(p, gyro_fs[(Arg >> 4) % 6U]);
+      break;
+    case 4:
+      r = ((Arg & 1U) != 0U) ? ISM330DHCX_ACC_Enable(p) : ISM330DHCX_ACC_Disable(p);
+      break;
+    case 5:
+      r = ((Arg & 1U) != 0U) ? ISM330DHCX_GYRO_Enable(p) : ISM330DHCX_GYRO_Disable(p);
+      break;
+    case 6:
+      r = (sel == 0U) ? ISM330DHCX_FIFO_Set_Mode(p, fifo_mode[(Arg >> 4) % 5U])
+          : (sel == 1U) ? ISM330DHCX_FIFO_Set_Watermark_Level(p, (uint16_t)((Arg >> 8) & 0x1FFU))
+          : (sel == 2U) ? ISM330DHCX_FIFO_ACC_Set_BDR(p, odr[(Arg >> 4) % 11U])
+          :               ISM330DHCX_FIFO_GYRO_Set_BDR(p, odr[(Arg >> 4) % 11U]);
+      break;
+    case 7:
+      r = (sel == 0U) ? ISM330DHCX_ACC_Disable_Wake_Up_Detection(p)
+          : (sel == 1U) ? ISM330DHCX_ACC_Set_Wake_Up_Threshold(p, (uint8_t)((Arg >> 8) & 0x3FU))
+          :               ISM330DHCX_ACC_Enable_Wake_Up_Detection(p, pin);
+      break;
+    case 8:
+      r = (sel == 0U) ? ISM330DHCX_ACC_Disable_Free_Fall_Detection(p)
+          : (sel == 1U) ? ISM330DHCX_ACC_Set_Free_Fall_Threshold(p, (uint8_t)((Arg >> 8) & 7U))
+          : (sel == 2U) ? ISM330DHCX_ACC_Set_Free_Fall_Duration(p, (uint8_t)((Arg >> 8) & 0x3FU))
+          :               ISM330DHCX_ACC_Enable_Free_Fall_Detection(p, pin);
+      break;
+    case 9:
+      r = (sel == 0U) ? ISM330DHCX_ACC_Enable_Single_Tap_Detection(p, pin)
+          : (sel == 1U) ? ISM330DHCX_ACC_Disable_Single_Tap_Detection(p)
+          : (sel == 2U) ? ISM330DHCX_ACC_Enable_6D_Orientation(p, pin)
+          :               ISM330DHCX_ACC_Disable_6D_Orientation(p);
+      break;
+    case 10:
+      r = (sel == 0U) ? ISM330DHCX_Set_Interrupt_Latch(p, (uint8_t)((Arg >> 4) & 1U))
+          : (sel == 1U) ? ISM330DHCX_Set_INT1_Drdy(p, (uint8_t)((Arg >> 4) & 1U))
+          : (sel == 2U) ? ISM330DHCX_ACC_Set_SelfTest(p, (uint8_t)((Arg >> 4) % 3U))
+          :               ISM330DHCX_GYRO_Set_SelfTest(p, (uint8_t)((Arg >> 4) % 3U));
+      break;
+    case 11:
+      r = ISM330DHCX_Write_Reg(p, (uint8_t)((Arg >> 8) & 0x7FU), (uint8_t)(Arg >> 16));
+      break;
+    case 12:
+      /* Back to the main bank most of the time */
+      r = ISM330DHCX_Set_Mem_Bank(p, (uint8_t)((sel == 3U) ? (1U + ((Arg >> 4) & 1U)) : 0U));
+      break;
+    case 13:
+      r = ((Arg & 8U) != 0U) ? ism330dhcx_boot_set(&p->Ctx, PROPERTY_ENABLE)
+          : ism330dhcx_reset_set(&p->Ctx, PROPERTY_ENABLE);
+      break;
+    case 14:
+      p->is_initialized = 0U;
+      r = ISM330DHCX_Init(p);
+      break;
+    case 15:
+    {
+      float f[4] = {0};
+      int32_t fs[2] = {0};
+      uint16_t samples = 0;
+      uint8_t reg = 0;
+      ISM330DHCX_Event_Status_t status;
+
+      memset(&status, 0, sizeof(status));
+      r = ISM330DHCX_ACC_GetOutputDataRate(p, &f[0]);
+      r += ISM330DHCX_GYRO_GetOutputDataRate(p, &f[1]);
+      r += ISM330DHCX_ACC_GetSensitivity(p, &f[2]);
+      r += ISM330DHCX_GYRO_GetSensitivity(p, &f[3]);
+      r += ISM330DHCX_ACC_GetFullScale(p, &fs[0]);
+      r += ISM330DHCX_GYRO_GetFullScale(p, &fs[1]);
+      r += ISM330DHCX_ACC_Get_Event_Status(p, &status);
+      r += ISM330DHCX_FIFO_Get_Num_Samples(p, &samples);
+      r += ISM330DHCX_Read_Reg(p, (uint8_t)((Arg >> 8) & 0x7FU), &reg);
+      memcpy(&out[0], f, sizeof(f));
+      memcpy(&out[16], fs, sizeof(fs));
+      memcpy(&out[24], &status, sizeof(status));
+      memcpy(&out[28], &samples, sizeof(samples));
+      out[30] = reg;
+      break;
+    }
+    case 16:
+    {
+      /* Multi-byte transactions of the register driver over random ranges */
+      uint8_t reg = (uint8_t)((Arg >> 8) & 0x7FU);
+      uint16_t len = (uint16_t)(1U + ((Arg >> 16) % 16U));
+      uint8_t buf[16];
+      uint16_t i;
+
+      if ((reg + len) > SIM_REGS)
+      {
+        len = (uint16_t)(SIM_REGS - reg);
+      }
+
+      if (sel == 0U)
+      {
+        for (i = 0; i < len; i++)
+        {
+          buf[i] = (uint8_t)Hash(Arg, i, 0U);
+        }
+        r = ism330dhcx_write_reg(&p->Ctx, reg, buf, len);
+      }
+      else if (sel == 1U)
+      {
+        buf[0] = (uint8_t)(Arg >> 8);
+        buf[1] = (uint8_t)(Arg >> 16);
+        buf[2] = (uint8_t)(Arg >> 24);
+        r = ism330dhcx_write_reg(&p->Ctx, ISM330DHCX_X_OFS_USR, buf, 3);
+        r += ism330dhcx_xl_usr_offset_x_get(&p->Ctx, &out[0]);
+        r += ism330dhcx_xl_usr_offset_y_get(&p->Ctx, &out[1]);
+        r += ism330dhcx_xl_usr_offset_z_get(&p->Ctx, &out[2]);
+      }
+      else
+      {
+        r = ism330dhcx_read_reg(&p->Ctx, reg, out, len);
+      }
+      break;
+    }
+    case 17:
+      /* Shadow discarded and enabled again, disabled on the object without shadow */
+      r = ISM330DHCX_Set_Reg_Shadow(p, (uint8_t)Obj);
+      break;
+    default:
+      r = (sel == 0U) ? ISM330DHCX_DRDY_Set_Mode(p, (uint8_t)((Arg >> 4) & 1U))
+          : (sel == 1U) ? ISM330DHCX_ACC_Enable_HP_Filter(p, ISM330DHCX_HP_ODR_DIV_100)
+          : (sel == 2U) ? ISM330DHCX_FIFO_Set_Stop_On_Fth(p, (uint8_t)((Arg >> 4) & 1U))
+          :               ISM330DHCX_FIFO_Set_INT1_FIFO_Threshold(p, (uint8_t)((Arg >> 4) & 1U));
+      break;
+  }
+
+  pRes->Ret = r;
+  out[40] = p->is_initialized;
+  out[41] = p->acc_is_enabled;
+  out[42] = p->gyro_is_enabled;
+  out[43] = (uint8_t)p->acc_odr;
+  out[44] = (uint8_t)p->gyro_odr;
+}
+
+/**
+  * @brief  Operation on an object
+  * @param  Obj the model and object index, 2 * device type + object
+  * @param  Op the operation
+  * @param  Arg random parameters of the operation
+  * @param  pRes the result
+  * @retval None
+  */
+static void Run_Op(uint32_t Obj, uint32_t Op, uint32_t Arg, Sim_Result_t *pRes)
+{
+  if ((Obj / 2U) == 0U)
+  {
+    Lsm_Op(Obj % 2U, Op, Arg, pRes);
+  }
+  else
+  {
+    Ism_Op(Obj % 2U, Op, Arg, pRes);
+  }
+}
+
+/**
+  * @brief  Compare the register images of the two models of a device, and the
+  *         shadow content with the registers of the model
+  * @param  Dev the device type
+  * @param  Op the last operation
+  * @param  pRes the result of the last operation
+  * @retval 0 if consistent, -1 otherwise
+  */
+static int32_t Check(uint32_t Dev, uint32_t Op, const Sim_Result_t *pRes)
+{
+  const Sim_Model_t *a = &Model[2U * Dev];
+  const Sim_Model_t *b = &Model[(2U * Dev) + 1U];
+  const MEMS_RegShadow_t *s = Shadow(Dev);
+  uint32_t reg;
+
+  (void)pRes;
+
+  if ((memcmp(a->Main, b->Main, sizeof(a->Main)) != 0) || (memcmp(a->Emb, b->Emb, sizeof(a->Emb)) != 0)
+      || (memcmp(a->Shub, b->Shub, sizeof(a->Shub)) != 0))
+  {
+    printf("FAILED: step %u, %s: register images differ\n", (unsigned)Step, OpName[Op]);
+    return -1;
+  }
+
+  for (reg = 0; reg < SIM_REGS; reg++)
+  {
+    if (((s->Valid[reg >> 3] & (1U << (reg & 7U))) != 0U) && (s->Value[reg] != b->Main[reg]))
+    {
+      printf("FAILED: step %u, %s: shadow of register 0x%02X is 0x%02X, device 0x%02X\n", (unsigned)Step,
+             OpName[Op], (unsigned)reg, (unsigned)s->Value[reg], (unsigned)b->Main[reg]);
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Init then output data rate and full scale switching of a device, compared
+  * @param  Dev the device type
+  * @retval 0 if the objects agree, -1 otherwise
+  */
+static int32_t Reconfigure(uint32_t Dev)
+{
+  Sim_Result_t res[2];
+  uint32_t fail;
+  uint32_t cycle;
+  uint32_t op;
+  uint32_t i;
+
+  RandState = 0x5EEDU;
+  fail = FailPermille;
+  FailPermille = 0U;
+  Register(Dev);
+  Counters_Clear();
+  Step = 0U;
+
+  for (i = 0; i < 2U; i++)
+  {
+    Run_Op((2U * Dev) + i, 14U, 0U, &res[i]);
+  }
+
+  if ((res[0].Ret != 0) || (memcmp(&res[0], &res[1], sizeof(Sim_Result_t)) != 0) || (Check(Dev, 14U, &res[1]) != 0))
+  {
+    printf("FAILED: init\n");
+    return -1;
+  }
+
+  Report(Dev, "init");
+  Counters_Clear();
+
+  /* Both sensors enabled, then 10 switches of their output data rate and full scale */
+  for (cycle = 0; cycle < 11U; cycle++)
+  {
+    for (op = 0; op < 6U; op++)
+    {
+      uint32_t arg = (op >= 4U) ? 1U : ((cycle * 0x35U) << 4);
+
+      if ((cycle == 0U) != (op >= 4U))
+      {
+        continue;
+      }
+
+      for (i = 0; i < 2U; i++)
+      {
+        memset(&res[i], 0, sizeof(Sim_Result_t));
+        Run_Op((2U * Dev) + i, op, arg, &res[i]);
+      }
+
+      if ((res[0].Ret != 0) || (memcmp(&res[0], &res[1], sizeof(Sim_Result_t)) != 0)
+          || (Check(Dev, op, &res[1]) != 0))
+      {
+        printf("FAILED: %s switching\n", OpName[op]);
+        return -1;
+      }
+    }
+  }
+
+  Report(Dev, "ODR/FS switching");
+  FailPermille = fail;
+
+  return 0;
+}
+
+/**
+  * @brief  Print the bus transactions of the two objects of a device
+  * @param  Dev the device type
+  * @param  Phase the phase name
+  * @retval None
+  */
+static void Report(uint32_t Dev, const char *Phase)
+{
+  const Sim_Model_t *a = &Model[2U * Dev];
+  const Sim_Model_t *b = &Model[(2U * Dev) + 1U];
+  double ta = (double)a->Reads + (double)a->Writes;
+  double tb = (double)b->Reads + (double)b->Writes;
+
+  printf("  %-17s %6u reads %6u writes %8.2f ms | shadow %6u reads %6u writes %8.2f ms"
+         " (-%.0f %% transactions)\n", Phase, (unsigned)a->Reads, (unsigned)a->Writes, a->BusUs / 1000.0,
+         (unsigned)b->Reads, (unsigned)b->Writes, b->BusUs / 1000.0,
+         (ta > 0.0) ? (100.0 * (ta - tb) / ta) : 0.0);
+}
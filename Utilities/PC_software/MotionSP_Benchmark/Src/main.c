@@ -0,0 +1,1434 @@
+/**
+  ******************************************************************************
+  * @file           : main.c
+  * @author         : System Research & Applications Team - Catania Lab
+  * @brief          : Host benchmark of the MotionSP pipeline on synthetic
+  *                   vibration signals
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2014-2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/resource.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "MotionSP.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_ODR_DEFAULT     3330.0f  //!< Simulated accelerometer ODR in Hz
+#define BENCH_FRAMES_DEFAULT  2000U    //!< Default number of analyzed FFT frames
+#define BENCH_FIFO_SAMPLES    32U      //!< Samples delivered to the time domain for each block, as the FIFO on target
+#define BENCH_AVG_FRAMES      8U       //!< FFT frames averaged before the results are published
+#define BENCH_ENV_DECIMATION  4U       //!< Envelope decimation factor
+#define BENCH_ENV_BAND_LOW    1000.0f  //!< Envelope band-pass low cut-off in Hz
+#define BENCH_ENV_BAND_HIGH   1500.0f  //!< Envelope band-pass high cut-off in Hz
+
+#define SHAFT_FREQ            24.5f    //!< Shaft rotation frequency in Hz
+#define BEARING_FAULT_FREQ    87.3f    //!< Bearing outer race fault repetition frequency in Hz
+#define RESONANCE_FREQ        1250.0f  //!< Structural resonance excited by the bearing impacts in Hz
+#define RESONANCE_DAMPING     180.0f   //!< Decay rate of the resonance in 1/s
+
+#define TD_CHECK_CIRC_ROUNDS  3U       //!< Circular buffer rounds fed by the time domain check
+#define TD_CHECK_RESTART_POS  1501U    //!< Sample restarting the filters in the middle of the time domain check
+#define TD_CHECK_TIMING_RUNS  9U       //!< Timed runs of each time domain path, the fastest one is compared
+#define TWO_CTX_SAMPLES       32768U   //!< Samples fed to each context by the two contexts check
+#define AM_CHECK_WINDOWS      4U       //!< FFT windows fed by the amplitude modulation check
+#define AM_CHECK_CARRIER      1250.0f  //!< Carrier of the amplitude modulation check in Hz, inside the envelope band
+#define FEATURES_TOLERANCE    0.005f   //!< Relative tolerance of the frame features
+#define TONE_CHECK_BLOCKS     16U      //!< Goertzel blocks fed by the tone bank check
+#define TONE_TOLERANCE        0.002f   //!< Goertzel to FFT amplitude difference, relative to the largest tone
+#define KERNEL_TOLERANCE      1e-5     //!< DSP kernel error, relative to the largest reference output
+#define SPECTRUM_TOLERANCE    0.01f    //!< Relative tolerance of the averaged spectrum peaks
+#define ENVELOPE_RATIO_MIN    3.0f     //!< Envelope fault line over the envelope maximum without modulation
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH_CYCLES()        ((double)__rdtsc()) //!< Time stamp counter
+#define BENCH_CYCLES_UNIT     "TSC cycles"
+#else
+#define BENCH_CYCLES()        Now_ns()
+#define BENCH_CYCLES_UNIT     "ns"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Latency statistics in ns
+  */
+typedef struct
+{
+  double Sum;
+  double Min;
+  double Max;
+  uint32_t Num;
+} LatencyStats_t;
+
+/**
+  * @brief  MotionSP context with its memory and the frame scheduling of the application
+  */
+typedef struct
+{
+  MotionSP_Ctx_t Ctx;
+  float *pCtxMem;
+  float *pEnvMem;
+  uint32_t CtxMemSize;
+  uint32_t EnvMemSize;
+  uint16_t Hop;             //!< Samples between two frames
+  uint16_t HopCnt;          //!< Samples since the last frame
+  uint32_t FedCnt;          //!< Samples fed since the start
+  uint32_t FrameCnt;        //!< Analyzed frames
+  uint32_t AvgCnt;          //!< Frames of the current average
+  uint8_t Restart;          //!< Restart the time domain filters on the next sample
+  LatencyStats_t TdStats;   //!< Time domain block latency
+  LatencyStats_t FdStats;   //!< Frequency domain frame latency
+} Pipeline_t;
+
+/**
+  * @brief  Amplitude modulated vibration of one axis, as seen in the circular buffer
+  *         A * (1 + Depth * cos(2*PI*Fault*t)) * cos(2*PI*Carrier*t)
+  */
+typedef struct
+{
+  uint16_t CarrierBin;      //!< Carrier frequency as FFT bin
+  uint16_t FaultBin;        //!< Fault (modulation) frequency as FFT bin
+  float Depth;              //!< Modulation depth
+  float Amplitude;          //!< Carrier amplitude in m/s^2
+} AmAxis_t;
+
+/* Private variables ---------------------------------------------------------*/
+static Pipeline_t Bench;
+static uint32_t RandState = 0x2545F491U;
+static const float ToneFreq[] = {SHAFT_FREQ, 2 * SHAFT_FREQ, BEARING_FAULT_FREQ};
+
+/* Private function prototypes -----------------------------------------------*/
+static double Now_ns(void);
+static void Stats_Add(LatencyStats_t *pStats, double Value);
+static float Noise_Gauss(void);
+static void Signal_Generate(SensorVal_f_t *pSamples, uint16_t Samples, uint32_t FirstIndex, float Odr);
+static void Print_Usage(const char *pName);
+static uint8_t Check_TimeDomainBlock(uint16_t CircSize, float Odr);
+static void Legacy_Reset(uint16_t CircSize, float Odr, Td_Type_t TdType);
+static double Td_RunPerSample(const SensorVal_f_t *pSamples, uint32_t Samples, Td_Type_t TdType, sAcceleroParam_t *pRef);
+static double Td_RunBlock(const SensorVal_f_t *pSamples, uint32_t Samples, Td_Type_t TdType, const sAcceleroParam_t *pRef,
+                          uint32_t *pBlocks, uint32_t *pMismatches);
+static uint8_t Pipeline_Init(Pipeline_t *pPipe, uint16_t FftSize, uint8_t Ovl, float Odr, uint8_t Envelope);
+static void Pipeline_DeInit(Pipeline_t *pPipe);
+static void Pipeline_Feed(Pipeline_t *pPipe, const SensorVal_f_t *pSamples, uint16_t Samples);
+static uint8_t Pipeline_Compare(const Pipeline_t *pA, const Pipeline_t *pB);
+static uint8_t Check_TwoContexts(uint16_t FftSize, uint8_t Ovl, float Odr, uint8_t Envelope);
+static uint8_t Check_EnvelopeFeatures(uint16_t FftSize, uint8_t Ovl, float Odr);
+static void Signal_AmGenerate(SensorVal_f_t *pSamples, uint32_t Samples, const AmAxis_t *pAm, uint16_t FftSize);
+static uint8_t Check_Relative(const char *pName, float Value, double Expected);
+static uint8_t Check_ToneBank(uint16_t FftSize, float Odr);
+static uint8_t Check_Kernels(uint16_t FftSize);
+static uint8_t Check_Spectrum(uint16_t FftSize, uint8_t Ovl, float Odr);
+static uint8_t Check_Error(const char *pName, double MaxErr, double MaxRef);
+static float Rand_Uniform(void);
+static double Ctx_FeedAll(MotionSP_Ctx_t *pCtx, const SensorVal_f_t *pSamples, uint32_t Samples);
+
+/**
+  * @brief  Benchmark entry point
+  * @param  argc number of arguments
+  * @param  argv arguments: [fft_size] [frames] [overlap %] [envelope 0/1]
+  * @retval 0 in case of success, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  uint16_t fftSize = FFT_SIZE_1024;
+  uint32_t frames = BENCH_FRAMES_DEFAULT;
+  uint8_t ovl = FFT_OVL_DEFAULT;
+  uint8_t envelope = 1;
+  float odr = BENCH_ODR_DEFAULT;
+  uint16_t circSize;
+  SensorVal_f_t block[BENCH_FIFO_SAMPLES];
+  uint32_t sampleIdx = 0;
+  uint8_t failed = 0;
+  double tStart, tTotal;
+  struct rusage usage;
+
+  if (argc > 1)
+  {
+    fftSize = (uint16_t)atoi(argv[1]);
+  }
+  if (argc > 2)
+  {
+    frames = (uint32_t)atoi(argv[2]);
+  }
+  if (argc > 3)
+  {
+    ovl = (uint8_t)atoi(argv[3]);
+  }
+  if (argc > 4)
+  {
+    envelope = (uint8_t)atoi(argv[4]);
+  }
+
+  if ((fftSize < FFT_SIZE_256) || (fftSize > FFT_SIZE_MAX) || (ovl < FFT_OVL_MIN) || (ovl > FFT_OVL_MAX) || (frames == 0))
+  {
+    Print_Usage(argv[0]);
+    return 1;
+  }
+
+  /* Same circular buffer sizing as the VibrationMonitoring application */
+  circSize = (uint16_t)((fftSize * CIRC_BUFFER_RATIO_NUM) / CIRC_BUFFER_RATIO_DEN);
+
+  /* The legacy circular buffer is statically sized */
+  if (Check_TimeDomainBlock((circSize < CIRC_BUFFER_SIZE_MAX) ? circSize : CIRC_BUFFER_SIZE_MAX, odr) != 0)
+  {
+    failed = 1;
+  }
+
+  if (Check_TwoContexts(fftSize, ovl, odr, envelope) != 0)
+  {
+    failed = 1;
+  }
+
+  if (Check_EnvelopeFeatures(fftSize, ovl, odr) != 0)
+  {
+    failed = 1;
+  }
+
+  if ((Check_Kernels(fftSize) != 0) || (Check_Spectrum(fftSize, ovl, odr) != 0))
+  {
+    failed = 1;
+  }
+
+  if (Check_ToneBank(fftSize, odr) != 0)
+  {
+    failed = 1;
+  }
+
+  if (Pipeline_Init(&Bench, fftSize, ovl, odr, envelope) != 0)
+  {
+    printf("Pipeline init failed\n");
+    return 1;
+  }
+
+  tStart = Now_ns();
+
+  while (Bench.FrameCnt < frames)
+  {
+    Signal_Generate(block, BENCH_FIFO_SAMPLES, sampleIdx, odr);
+    sampleIdx += BENCH_FIFO_SAMPLES;
+    Pipeline_Feed(&Bench, block, BENCH_FIFO_SAMPLES);
+  }
+
+  tTotal = Now_ns() - tStart;
+  getrusage(RUSAGE_SELF, &usage);
+
+  printf("MotionSP host benchmark (%s DSP kernels)\n",
+#ifdef MOTIONSP_PORTABLE_DSP
+         "portable"
+#else
+         "CMSIS"
+#endif
+        );
+  printf("  FFT size %u, overlap %u%%, ODR %.0f Hz, envelope %s\n", fftSize, ovl, odr, (envelope != 0) ? "on" : "off");
+  printf("  Samples %lu, frames %lu, wall time %.3f ms\n", (unsigned long)sampleIdx, (unsigned long)Bench.FrameCnt, tTotal / 1e6);
+  printf("  Throughput: %.1f frames/s, %.2f x real time\n", Bench.FrameCnt / (tTotal / 1e9),
+         (sampleIdx / odr) / (tTotal / 1e9));
+  printf("  Frame latency (frequency domain): avg %.2f us, min %.2f us, max %.2f us\n",
+         Bench.FdStats.Sum / Bench.FdStats.Num / 1e3, Bench.FdStats.Min / 1e3, Bench.FdStats.Max / 1e3);
+  printf("  Block latency (time domain, %u samples): avg %.2f us, max %.2f us\n", BENCH_FIFO_SAMPLES,
+         Bench.TdStats.Sum / Bench.TdStats.Num / 1e3, Bench.TdStats.Max / 1e3);
+  printf("  RAM: context %lu B + buffers %lu B + envelope %lu B = %lu B (process peak RSS %ld kB)\n",
+         (unsigned long)sizeof(MotionSP_Ctx_t), (unsigned long)(Bench.CtxMemSize * sizeof(float)),
+         (unsigned long)(Bench.EnvMemSize * sizeof(float)),
+         (unsigned long)(sizeof(MotionSP_Ctx_t) + ((Bench.CtxMemSize + Bench.EnvMemSize) * sizeof(float))), usage.ru_maxrss);
+  printf("  Peak X: %.2f Hz %.3f m/s^2, envelope X max at %.2f Hz, tone %.1f Hz X %.3f m/s^2\n",
+         Bench.Ctx.MagResults.X_Index * odr / fftSize, Bench.Ctx.MagResults.X_Value,
+         (envelope != 0) ? (Bench.Ctx.Envelope.Max.X.loc * Bench.Ctx.Envelope.BinFreqStep) : 0.0f,
+         ToneFreq[0], Bench.Ctx.ToneBank.Tone[0].Amplitude.AXIS_X);
+
+  printf("%s\n", (failed != 0) ? "FAIL" : "PASS");
+
+  Pipeline_DeInit(&Bench);
+
+  return (failed != 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Allocate and initialize a MotionSP context with its tone bank and envelope
+  * @param  pPipe pointer to the pipeline
+  * @param  FftSize FFT size
+  * @param  Ovl FFT overlap in %
+  * @param  Odr sampling frequency in Hz
+  * @param  Envelope 1 to enable the envelope spectrum
+  * @retval 0 in case of success, 1 otherwise
+  */
+static uint8_t Pipeline_Init(Pipeline_t *pPipe, uint16_t FftSize, uint8_t Ovl, float Odr, uint8_t Envelope)
+{
+  /* Same circular buffer sizing and hop as the VibrationMonitoring application */
+  uint16_t circSize = (uint16_t)((FftSize * CIRC_BUFFER_RATIO_NUM) / CIRC_BUFFER_RATIO_DEN);
+
+  memset((void *)pPipe, 0, sizeof(Pipeline_t));
+  pPipe->Hop = (uint16_t)(FftSize - ((FftSize * Ovl) / 100));
+  pPipe->Restart = 1;
+  pPipe->TdStats.Min = 1e18;
+  pPipe->FdStats.Min = 1e18;
+
+  pPipe->CtxMemSize = MOTIONSP_CTX_MEM_SIZE(FftSize, circSize);
+  pPipe->pCtxMem = (float *)malloc(pPipe->CtxMemSize * sizeof(float));
+
+  if ((pPipe->pCtxMem == NULL) || (MotionSP_CtxInit(&pPipe->Ctx, pPipe->pCtxMem, pPipe->CtxMemSize, FftSize, circSize) != 0))
+  {
+    return 1;
+  }
+
+  MotionSP_CtxSetOdr(&pPipe->Ctx, Odr);
+  MotionSP_CtxFeaturesEnable(&pPipe->Ctx, 1);
+
+  if (Envelope != 0)
+  {
+    pPipe->EnvMemSize = MOTIONSP_ENV_MEM_SIZE(FftSize, BENCH_ENV_DECIMATION);
+    pPipe->pEnvMem = (float *)malloc(pPipe->EnvMemSize * sizeof(float));
+
+    if ((pPipe->pEnvMem == NULL) || (MotionSP_CtxEnvelopeInit(&pPipe->Ctx, pPipe->pEnvMem, pPipe->EnvMemSize, BENCH_ENV_BAND_LOW,
+                                                             BENCH_ENV_BAND_HIGH, BENCH_ENV_DECIMATION) != 0))
+    {
+      return 1;
+    }
+  }
+
+  if (MotionSP_CtxToneBankInit(&pPipe->Ctx, ToneFreq, (uint8_t)(sizeof(ToneFreq) / sizeof(ToneFreq[0])), FftSize) != 0)
+  {
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Free the memory of a pipeline
+  * @param  pPipe pointer to the pipeline
+  * @return none
+  */
+static void Pipeline_DeInit(Pipeline_t *pPipe)
+{
+  free(pPipe->pEnvMem);
+  free(pPipe->pCtxMem);
+  pPipe->pEnvMem = NULL;
+  pPipe->pCtxMem = NULL;
+}
+
+/**
+  * @brief  Feed a block of samples, launching a frame every hop samples once the buffer is filled
+  * @param  pPipe pointer to the pipeline
+  * @param  pSamples pointer to the samples in mg
+  * @param  Samples number of samples
+  * @return none
+  */
+static void Pipeline_Feed(Pipeline_t *pPipe, const SensorVal_f_t *pSamples, uint16_t Samples)
+{
+  MotionSP_Ctx_t *pCtx = &pPipe->Ctx;
+  uint16_t done = 0;
+  double t0;
+
+  while (done < Samples)
+  {
+    uint16_t chunk = Samples - done;
+
+    if (chunk > (pPipe->Hop - pPipe->HopCnt))
+    {
+      chunk = (uint16_t)(pPipe->Hop - pPipe->HopCnt);
+    }
+
+    t0 = Now_ns();
+    chunk = MotionSP_CtxTimeDomainProcessBlock(pCtx, &pSamples[done], chunk, pPipe->Restart);
+    Stats_Add(&pPipe->TdStats, Now_ns() - t0);
+
+    pPipe->Restart = 0;
+    done += chunk;
+    pPipe->HopCnt += chunk;
+    pPipe->FedCnt += chunk;
+
+    if ((pPipe->HopCnt == pPipe->Hop) && (pPipe->FedCnt >= pCtx->Parameters.FftSize))
+    {
+      pPipe->HopCnt = 0;
+      pCtx->CircBuffIndexForFft = pCtx->AccCircBuff.IdPos; /* Last written sample */
+      pPipe->AvgCnt++;
+
+      t0 = Now_ns();
+      (void)MotionSP_CtxFrequencyDomainProcess(pCtx, (uint8_t)(pPipe->AvgCnt == BENCH_AVG_FRAMES));
+      Stats_Add(&pPipe->FdStats, Now_ns() - t0);
+
+      if (pPipe->AvgCnt == BENCH_AVG_FRAMES)
+      {
+        pPipe->AvgCnt = 0;
+      }
+      pPipe->FrameCnt++;
+    }
+    else if (pPipe->HopCnt == pPipe->Hop)
+    {
+      pPipe->HopCnt = 0;
+    }
+  }
+}
+
+/**
+  * @brief  Compare the results and the states of two pipelines fed with the same samples
+  * @param  pA pointer to the first pipeline
+  * @param  pB pointer to the second pipeline
+  * @retval 0 if they are equal, 1 otherwise
+  */
+static uint8_t Pipeline_Compare(const Pipeline_t *pA, const Pipeline_t *pB)
+{
+  const MotionSP_Ctx_t *pCa = &pA->Ctx;
+  const MotionSP_Ctx_t *pCb = &pB->Ctx;
+  uint32_t magBytes = (uint32_t)pCa->MagSize * sizeof(float);
+  uint32_t circBytes = (uint32_t)pCa->AccCircBuff.Size * sizeof(float);
+  uint32_t envBytes = (uint32_t)(pCa->Envelope.FftSize / 2U) * sizeof(float);
+
+  if ((pA->FrameCnt != pB->FrameCnt) || (pCa->AccCircBuff.IdPos != pCb->AccCircBuff.IdPos) || (pCa->AvgRdy != pCb->AvgRdy) ||
+      (memcmp(&pCa->TimeDomain, &pCb->TimeDomain, sizeof(sAcceleroParam_t)) != 0) ||
+      (memcmp(&pCa->TdState, &pCb->TdState, sizeof(sTimeDomainState_t)) != 0) ||
+      (memcmp(&pCa->SumCnt, &pCb->SumCnt, sizeof(sSumCnt_t)) != 0) ||
+      (memcmp(&pCa->MagResults, &pCb->MagResults, sizeof(sAxesMagResults_t)) != 0) ||
+      (memcmp(&pCa->Features, &pCb->Features, sizeof(sFrameFeatures_t)) != 0) ||
+      (memcmp(&pCa->ToneBank, &pCb->ToneBank, sizeof(sToneBank_t)) != 0) ||
+      (memcmp(&pCa->Envelope.Max, &pCb->Envelope.Max, sizeof(pCa->Envelope.Max)) != 0))
+  {
+    return 1;
+  }
+
+  if ((memcmp(pCa->AccCircBuff.Array.X, pCb->AccCircBuff.Array.X, circBytes) != 0) ||
+      (memcmp(pCa->AccCircBuff.Array.Y, pCb->AccCircBuff.Array.Y, circBytes) != 0) ||
+      (memcmp(pCa->AccCircBuff.Array.Z, pCb->AccCircBuff.Array.Z, circBytes) != 0) ||
+      (memcmp(pCa->AvgMag.X, pCb->AvgMag.X, magBytes) != 0) ||
+      (memcmp(pCa->AvgMag.Y, pCb->AvgMag.Y, magBytes) != 0) ||
+      (memcmp(pCa->AvgMag.Z, pCb->AvgMag.Z, magBytes) != 0))
+  {
+    return 1;
+  }
+
+  if ((envBytes != 0U) &&
+      ((memcmp(pCa->Envelope.Mag.X, pCb->Envelope.Mag.X, envBytes) != 0) ||
+       (memcmp(pCa->Envelope.Mag.Y, pCb->Envelope.Mag.Y, envBytes) != 0) ||
+       (memcmp(pCa->Envelope.Mag.Z, pCb->Envelope.Mag.Z, envBytes) != 0)))
+  {
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Check that two MotionSP contexts do not share any state
+  * @param  FftSize FFT size
+  * @param  Ovl FFT overlap in %
+  * @param  Odr sampling frequency in Hz
+  * @param  Envelope 1 to enable the envelope spectrum
+  * @retval 0 in case of success, 1 otherwise
+  *
+  * @details More details
+  * Two signals are processed by two contexts, each one alone, then by two other contexts
+  * with interleaved blocks of different sizes. The interleaved contexts have to end with
+  * the same results and states as the ones run alone, and the global API variables have
+  * to be left untouched.
+  */
+static uint8_t Check_TwoContexts(uint16_t FftSize, uint8_t Ovl, float Odr, uint8_t Envelope)
+{
+  static Pipeline_t Alone[2];
+  static Pipeline_t Shared[2];
+  SensorVal_f_t *pSignal[2];
+  sAcceleroParam_t timeDomain = sTimeDomain;
+  sAcceleroODR_t accOdr = AcceleroODR;
+  uint16_t idPos = AccCircBuffer.IdPos;
+  uint32_t savedRand = RandState;
+  uint32_t pos[2] = {0, 0};
+  uint8_t failed = 0;
+
+  pSignal[0] = (SensorVal_f_t *)malloc(TWO_CTX_SAMPLES * sizeof(SensorVal_f_t));
+  pSignal[1] = (SensorVal_f_t *)malloc(TWO_CTX_SAMPLES * sizeof(SensorVal_f_t));
+
+  if ((pSignal[0] == NULL) || (pSignal[1] == NULL))
+  {
+    printf("Two contexts check: out of memory\n");
+    free(pSignal[0]);
+    free(pSignal[1]);
+    return 1;
+  }
+
+  /* The second sensor sees a later, attenuated and rotated vibration */
+  Signal_Generate(pSignal[0], TWO_CTX_SAMPLES, 0, Odr);
+  Signal_Generate(pSignal[1], TWO_CTX_SAMPLES, TWO_CTX_SAMPLES, Odr);
+  for (uint32_t i = 0; i < TWO_CTX_SAMPLES; i++)
+  {
+    SensorVal_f_t v = pSignal[1][i];
+
+    pSignal[1][i].AXIS_X = 0.5f * v.AXIS_Z;
+    pSignal[1][i].AXIS_Y = 0.5f * v.AXIS_X;
+    pSignal[1][i].AXIS_Z = 0.5f * v.AXIS_Y;
+  }
+  RandState = savedRand;
+
+  for (uint8_t c = 0; c < 2U; c++)
+  {
+    if ((Pipeline_Init(&Alone[c], FftSize, Ovl, Odr, Envelope) != 0) || (Pipeline_Init(&Shared[c], FftSize, Ovl, Odr, Envelope) != 0))
+    {
+      printf("Two contexts check: init failed\n");
+      failed = 1;
+    }
+  }
+
+  if (failed == 0U)
+  {
+    for (uint32_t i = 0; i < TWO_CTX_SAMPLES; i += BENCH_FIFO_SAMPLES)
+    {
+      Pipeline_Feed(&Alone[0], &pSignal[0][i], BENCH_FIFO_SAMPLES);
+    }
+    for (uint32_t i = 0; i < TWO_CTX_SAMPLES; i += BENCH_FIFO_SAMPLES)
+    {
+      Pipeline_Feed(&Alone[1], &pSignal[1][i], BENCH_FIFO_SAMPLES);
+    }
+
+    /* Blocks of 17 and 29 samples, not aligned on the hop nor on each other */
+    while ((pos[0] < TWO_CTX_SAMPLES) || (pos[1] < TWO_CTX_SAMPLES))
+    {
+      static const uint16_t Chunk[2] = {17, 29};
+
+      for (uint8_t c = 0; c < 2U; c++)
+      {
+        uint32_t n = TWO_CTX_SAMPLES - pos[c];
+
+        if (n > Chunk[c])
+        {
+          n = Chunk[c];
+        }
+        Pipeline_Feed(&Shared[c], &pSignal[c][pos[c]], (uint16_t)n);
+        pos[c] += n;
+      }
+    }
+
+    for (uint8_t c = 0; c < 2U; c++)
+    {
+      if ((Shared[c].FrameCnt == 0U) || (Pipeline_Compare(&Shared[c], &Alone[c]) != 0))
+      {
+        failed = 1;
+      }
+    }
+
+    /* Sanity check of the comparison: the two signals give different results */
+    if (Pipeline_Compare(&Shared[0], &Shared[1]) == 0)
+    {
+      failed = 1;
+    }
+
+    if ((memcmp(&timeDomain, &sTimeDomain, sizeof(sAcceleroParam_t)) != 0) ||
+        (memcmp(&accOdr, &AcceleroODR, sizeof(sAcceleroODR_t)) != 0) || (idPos != AccCircBuffer.IdPos))
+    {
+      failed = 1;
+    }
+  }
+
+  printf("Two contexts interleaved vs alone: %lu frames each %s\n", (unsigned long)Shared[0].FrameCnt,
+         (failed == 0U) ? "PASS" : "FAIL");
+
+  for (uint8_t c = 0; c < 2U; c++)
+  {
+    Pipeline_DeInit(&Alone[c]);
+    Pipeline_DeInit(&Shared[c]);
+  }
+  free(pSignal[0]);
+  free(pSignal[1]);
+
+  return failed;
+}
+
+/**
+  * @brief  Check the envelope spectrum and the frame features on amplitude modulated signals
+  * @param  FftSize FFT size
+  * @param  Ovl FFT overlap in %
+  * @param  Odr sampling frequency in Hz
+  * @retval 0 in case of success, 1 otherwise
+  *
+  * @details More details
+  * Each axis carries a resonance at the middle of the envelope band, modulated at its own
+  * fault frequency, all the frequencies on FFT bins so that each window holds whole periods.
+  * The envelope spectrum maximum has to be at the fault frequency and at least ENVELOPE_RATIO_MIN
+  * times the one of the same carrier without modulation. RMS, peak, crest factor and kurtosis
+  * have to match their analytic values:
+  *   RMS  = A * sqrt((1 + m^2/2) / 2)
+  *   Peak = A * (1 + m)
+  *   Kurtosis = 1.5 * (1 + 3*m^2 + 3/8*m^4) / (1 + m^2/2)^2
+  */
+static uint8_t Check_EnvelopeFeatures(uint16_t FftSize, uint8_t Ovl, float Odr)
+{
+  static const float FaultFreq[NUM_AXES] = {BEARING_FAULT_FREQ, 143.1f, 61.7f}; /* Outer race, inner race, cage */
+  static const float Depth[NUM_AXES] = {0.5f, 0.8f, 0.3f};
+  static const float Amplitude[NUM_AXES] = {2.0f, 0.7f, 4.0f};
+  static const sFrameFeatures_t NoFeatures;
+  static Pipeline_t Am;
+  static Pipeline_t Carrier;
+  uint32_t samples = AM_CHECK_WINDOWS * (uint32_t)FftSize;
+  SensorVal_f_t *pSamples = (SensorVal_f_t *)malloc(samples * sizeof(SensorVal_f_t));
+  float binStep = Odr / FftSize;
+  AmAxis_t am[NUM_AXES];
+  AmAxis_t carrier[NUM_AXES];
+  uint8_t featuresOff;
+  uint8_t failed = 0;
+
+  if ((pSamples == NULL) || (Pipeline_Init(&Am, FftSize, Ovl, Odr, 1) != 0) || (Pipeline_Init(&Carrier, FftSize, Ovl, Odr, 1) != 0))
+  {
+    printf("Envelope and features check: init failed\n");
+    free(pSamples);
+    Pipeline_DeInit(&Am);
+    Pipeline_DeInit(&Carrier);
+    return 1;
+  }
+
+  /* The unmodulated carrier is used only for the envelope, its features stay cleared */
+  MotionSP_CtxFeaturesEnable(&Carrier.Ctx, 0);
+
+  for (uint8_t axis = 0; axis < NUM_AXES; axis++)
+  {
+    am[axis].CarrierBin = (uint16_t)lroundf(AM_CHECK_CARRIER / binStep);
+    am[axis].FaultBin = (uint16_t)lroundf(FaultFreq[axis] / binStep);
+    am[axis].Depth = Depth[axis];
+    am[axis].Amplitude = Amplitude[axis];
+    carrier[axis] = am[axis];
+    carrier[axis].Depth = 0.0f;
+  }
+
+  Signal_AmGenerate(pSamples, samples, am, FftSize);
+  for (uint32_t i = 0; i < samples; i += BENCH_FIFO_SAMPLES)
+  {
+    Pipeline_Feed(&Am, &pSamples[i], BENCH_FIFO_SAMPLES);
+  }
+
+  Signal_AmGenerate(pSamples, samples, carrier, FftSize);
+  for (uint32_t i = 0; i < samples; i += BENCH_FIFO_SAMPLES)
+  {
+    Pipeline_Feed(&Carrier, &pSamples[i], BENCH_FIFO_SAMPLES);
+  }
+
+  for (uint8_t axis = 0; axis < NUM_AXES; axis++)
+  {
+    const sMaxOnArray_t *pEnvMax = (axis == 0U) ? &Am.Ctx.Envelope.Max.X : ((axis == 1U) ? &Am.Ctx.Envelope.Max.Y : &Am.Ctx.Envelope.Max.Z);
+    const sMaxOnArray_t *pRefMax = (axis == 0U) ? &Carrier.Ctx.Envelope.Max.X : ((axis == 1U) ? &Carrier.Ctx.Envelope.Max.Y : &Carrier.Ctx.Envelope.Max.Z);
+    const float *pRms = &Am.Ctx.Features.Rms.AXIS_X + axis;
+    const float *pPeak = &Am.Ctx.Features.Peak.AXIS_X + axis;
+    const float *pCrest = &Am.Ctx.Features.CrestFactor.AXIS_X + axis;
+    const float *pKurt = &Am.Ctx.Features.Kurtosis.AXIS_X + axis;
+    double a = am[axis].Amplitude;
+    double m = am[axis].Depth;
+    double rms = a * sqrt((1.0 + (m * m / 2.0)) / 2.0);
+    double peak = a * (1.0 + m);
+    double kurt = 1.5 * (1.0 + (3.0 * m * m) + (0.375 * m * m * m * m)) / ((1.0 + (m * m / 2.0)) * (1.0 + (m * m / 2.0)));
+    float faultFreq = am[axis].FaultBin * binStep;
+    float envFreq = pEnvMax->loc * Am.Ctx.Envelope.BinFreqStep;
+    uint8_t envOk = (fabsf(envFreq - faultFreq) < (0.5f * Am.Ctx.Envelope.BinFreqStep)) &&
+                    (pEnvMax->value >= (ENVELOPE_RATIO_MIN * pRefMax->value)) ? 1U : 0U;
+
+    printf("Envelope %c: fault %.2f Hz, peak at %.2f Hz, %.1f x the unmodulated carrier %s\n", 'X' + axis, faultFreq, envFreq,
+           pEnvMax->value / pRefMax->value, (envOk != 0U) ? "PASS" : "FAIL");
+
+    if (envOk == 0U)
+    {
+      failed = 1;
+    }
+
+    printf("Features %c (m = %.1f):", 'X' + axis, m);
+    failed |= Check_Relative("RMS", *pRms, rms);
+    failed |= Check_Relative("peak", *pPeak, peak);
+    failed |= Check_Relative("crest", *pCrest, peak / rms);
+    failed |= Check_Relative("kurtosis", *pKurt, kurt);
+    printf("\n");
+  }
+
+  featuresOff = (memcmp(&Carrier.Ctx.Features, &NoFeatures, sizeof(sFrameFeatures_t)) == 0) ? 1U : 0U;
+  printf("Features disabled: not evaluated %s\n", (featuresOff != 0U) ? "PASS" : "FAIL");
+
+  if (featuresOff == 0U)
+  {
+    failed = 1;
+  }
+
+  Pipeline_DeInit(&Am);
+  Pipeline_DeInit(&Carrier);
+  free(pSamples);
+
+  return failed;
+}
+
+/**
+  * @brief  Check the DSP kernels against double precision references
+  * @param  FftSize FFT size
+  * @retval 0 in case of success, 1 otherwise
+  *
+  * @details More details
+  * On uniform random data: real FFT in the packed CMSIS-DSP layout against a direct DFT,
+  * inverse FFT round trip, complex magnitude, DF1 biquad cascade of the envelope filters,
+  * sine, cosine and square root. The maximum error has to be within KERNEL_TOLERANCE of
+  * the largest reference output.
+  */
+static uint8_t Check_Kernels(uint16_t FftSize)
+{
+  arm_rfft_fast_instance_f32 fftS;
+  arm_biquad_casd_df1_inst_f32 biquad;
+  float coeffs[2 * 5] = {0.4208f, -0.8416f, 0.4208f, 0.4669f, -0.2164f, 0.1241f, 0.2483f, 0.1241f, 0.7496f, -0.2462f};
+  float state[2 * 4] = {0};
+  double refState[2][4] = {{0}};
+  float *pIn = (float *)malloc(FftSize * sizeof(float));
+  float *pOut = (float *)malloc(FftSize * sizeof(float));
+  float *pTmp = (float *)malloc(FftSize * sizeof(float));
+  uint32_t savedRand = RandState;
+  double maxErr;
+  double maxRef;
+  uint8_t failed = 0;
+
+  if ((pIn == NULL) || (pOut == NULL) || (pTmp == NULL) || (arm_rfft_fast_init_f32(&fftS, FftSize) != ARM_MATH_SUCCESS))
+  {
+    printf("Kernels check: init failed\n");
+    free(pIn);
+    free(pOut);
+    free(pTmp);
+    return 1;
+  }
+
+  for (uint16_t i = 0; i < FftSize; i++)
+  {
+    pIn[i] = Rand_Uniform();
+  }
+  RandState = savedRand;
+
+  /* Forward FFT: X[0] and X[N/2] real parts first, then X[k] for 0 < k < N/2 */
+  memcpy(pTmp, pIn, FftSize * sizeof(float));
+  arm_rfft_fast_f32(&fftS, pTmp, pOut, 0);
+  maxErr = 0.0;
+  maxRef = 0.0;
+  for (uint16_t k = 0; k < (FftSize / 2U); k++)
+  {
+    double re[2] = {0.0, 0.0};
+    double im = 0.0;
+
+    for (uint16_t n = 0; n < FftSize; n++)
+    {
+      double w = -2.0 * PI * (double)((k * (uint32_t)n) % FftSize) / FftSize;
+
+      re[0] += pIn[n] * cos(w);
+      im += pIn[n] * sin(w);
+      if (k == 0U)
+      {
+        re[1] += ((n & 1U) != 0U) ? -pIn[n] : pIn[n];
+      }
+    }
+
+    maxRef = fmax(maxRef, hypot(re[0], im));
+    if (k == 0U)
+    {
+      maxErr = fmax(maxErr, fmax(fabs(pOut[0] - re[0]), fabs(pOut[1] - re[1])));
+    }
+    else
+    {
+      maxErr = fmax(maxErr, hypot(pOut[2U * k] - re[0], pOut[(2U * k) + 1U] - im));
+    }
+  }
+  printf("Kernels vs double:");
+  failed |= Check_Error("rfft", maxErr, maxRef);
+
+  /* Complex magnitude */
+  arm_cmplx_mag_f32(pOut, pTmp, FftSize / 2U);
+  maxErr = 0.0;
+  for (uint16_t k = 0; k < (FftSize / 2U); k++)
+  {
+    maxErr = fmax(maxErr, fabs(pTmp[k] - hypot(pOut[2U * k], pOut[(2U * k) + 1U])));
+  }
+  failed |= Check_Error("cmplx_mag", maxErr, maxRef);
+
+  /* Inverse FFT round trip */
+  arm_rfft_fast_f32(&fftS, pOut, pTmp, 1);
+  maxErr = 0.0;
+  for (uint16_t n = 0; n < FftSize; n++)
+  {
+    maxErr = fmax(maxErr, fabs(pTmp[n] - pIn[n]));
+  }
+  failed |= Check_Error("rfft inverse", maxErr, 1.0);
+
+  /* Biquad cascade, band-pass of the envelope */
+  arm_biquad_cascade_df1_init_f32(&biquad, 2, coeffs, state);
+  arm_biquad_cascade_df1_f32(&biquad, pIn, pOut, FftSize);
+  maxErr = 0.0;
+  maxRef = 0.0;
+  for (uint16_t n = 0; n < FftSize; n++)
+  {
+    double x = pIn[n];
+
+    for (uint8_t st = 0; st < 2U; st++)
+    {
+      const float *pC = &coeffs[5U * st];
+      double *pS = refState[st];
+      double y = (pC[0] * x) + (pC[1] * pS[0]) + (pC[2] * pS[1]) + (pC[3] * pS[2]) + (pC[4] * pS[3]);
+
+      pS[1] = pS[0];
+      pS[0] = x;
+      pS[3] = pS[2];
+      pS[2] = y;
+      x = y;
+    }
+    maxRef = fmax(maxRef, fabs(x));
+    maxErr = fmax(maxErr, fabs(pOut[n] - x));
+  }
+  failed |= Check_Error("biquad", maxErr, maxRef);
+
+  /* Sine, cosine and square root */
+  maxErr = 0.0;
+  for (int32_t i = -4096; i <= 4096; i++)
+  {
+    float x = (float)i * (2.0f * PI / 1024.0f);
+    float root;
+
+    (void)arm_sqrt_f32(fabsf(x), &root);
+    maxErr = fmax(maxErr, fabs(arm_sin_f32(x) - sin(x)));
+    maxErr = fmax(maxErr, fabs(arm_cos_f32(x) - cos(x)));
+    maxErr = fmax(maxErr, fabs(root - sqrt(fabs(x))) / fmax(1.0, sqrt(fabs(x))));
+  }
+  failed |= Check_Error("sin cos sqrt", maxErr, 1.0);
+  printf("\n");
+
+  free(pIn);
+  free(pOut);
+  free(pTmp);
+
+  return failed;
+}
+
+/**
+  * @brief  Check the kernel error and print it
+  * @param  pName kernel name
+  * @param  MaxErr maximum absolute error
+  * @param  MaxRef largest reference output
+  * @retval 0 in case of success, 1 otherwise
+  */
+static uint8_t Check_Error(const char *pName, double MaxErr, double MaxRef)
+{
+  uint8_t ok = (MaxErr <= (KERNEL_TOLERANCE * MaxRef)) ? 1U : 0U;
+
+  printf(" %s %.1e %s", pName, MaxErr / MaxRef, (ok != 0U) ? "PASS" : "FAIL");
+
+  return (ok != 0U) ? 0U : 1U;
+}
+
+/**
+  * @brief  Check the averaged spectrum of pure tones
+  * @param  FftSize FFT size
+  * @param  Ovl FFT overlap in %
+  * @param  Odr sampling frequency in Hz
+  * @retval 0 in case of success, 1 otherwise
+  *
+  * @details More details
+  * Each axis carries a tone on its own FFT bin, compensated for the DC removal filter.
+  * After two averages, the maximum of the published spectrum of each axis has to be on
+  * the tone bin, with the tone amplitude within SPECTRUM_TOLERANCE.
+  */
+static uint8_t Check_Spectrum(uint16_t FftSize, uint8_t Ovl, float Odr)
+{
+  static const float Freq[NUM_AXES] = {SHAFT_FREQ, RESONANCE_FREQ, 400.0f};
+  static const float Amplitude[NUM_AXES] = {1.5f, 0.3f, 6.0f};
+  static Pipeline_t Spectrum;
+  uint16_t hop = (uint16_t)(FftSize - ((FftSize * Ovl) / 100));
+  uint32_t samples = FftSize + ((2U * BENCH_AVG_FRAMES) * (uint32_t)hop) + BENCH_FIFO_SAMPLES;
+  SensorVal_f_t *pSamples = (SensorVal_f_t *)malloc(samples * sizeof(SensorVal_f_t));
+  AmAxis_t tone[NUM_AXES];
+  uint32_t done = 0;
+  uint8_t failed = 0;
+
+  if ((pSamples == NULL) || (Pipeline_Init(&Spectrum, FftSize, Ovl, Odr, 0) != 0))
+  {
+    printf("Spectrum check: init failed\n");
+    free(pSamples);
+    Pipeline_DeInit(&Spectrum);
+    return 1;
+  }
+
+  for (uint8_t axis = 0; axis < NUM_AXES; axis++)
+  {
+    tone[axis].CarrierBin = (uint16_t)lroundf(Freq[axis] * FftSize / Odr);
+    tone[axis].FaultBin = 0;
+    tone[axis].Depth = 0.0f;
+    tone[axis].Amplitude = Amplitude[axis];
+  }
+  Signal_AmGenerate(pSamples, samples, tone, FftSize);
+
+  while ((Spectrum.FrameCnt < (2U * BENCH_AVG_FRAMES)) && ((done + BENCH_FIFO_SAMPLES) <= samples))
+  {
+    Pipeline_Feed(&Spectrum, &pSamples[done], BENCH_FIFO_SAMPLES);
+    done += BENCH_FIFO_SAMPLES;
+  }
+
+  for (uint8_t axis = 0; axis < NUM_AXES; axis++)
+  {
+    uint32_t index = (axis == 0U) ? Spectrum.Ctx.MagResults.X_Index : ((axis == 1U) ? Spectrum.Ctx.MagResults.Y_Index : Spectrum.Ctx.MagResults.Z_Index);
+    float value = (axis == 0U) ? Spectrum.Ctx.MagResults.X_Value : ((axis == 1U) ? Spectrum.Ctx.MagResults.Y_Value : Spectrum.Ctx.MagResults.Z_Value);
+    uint8_t ok = (index == tone[axis].CarrierBin) && (fabsf(value - Amplitude[axis]) <= (SPECTRUM_TOLERANCE * Amplitude[axis])) ? 1U : 0U;
+
+    printf("Spectrum %c: tone bin %u %.4f m/s^2, peak bin %lu %.4f m/s^2 %s\n", 'X' + axis, tone[axis].CarrierBin, Amplitude[axis],
+           (unsigned long)index, value, (ok != 0U) ? "PASS" : "FAIL");
+
+    if (ok == 0U)
+    {
+      failed = 1;
+    }
+  }
+
+  if (Spectrum.FrameCnt < (2U * BENCH_AVG_FRAMES))
+  {
+    failed = 1;
+  }
+
+  Pipeline_DeInit(&Spectrum);
+  free(pSamples);
+
+  return failed;
+}
+
+/**
+  * @brief  Compare the Goertzel tone bank with the full FFT in cycles and accuracy
+  * @param  FftSize FFT size, also used as Goertzel block size
+  * @param  Odr sampling frequency in Hz
+  * @retval 0 in case of success, 1 otherwise
+  *
+  * @details More details
+  * The tones of the benchmark are moved to the nearest FFT bin and tracked on the benchmark
+  * signal. At the end of the run, the amplitudes of the last Goertzel block have to match
+  * the rectangular window FFT magnitudes, scaled by 2/FftSize, of the same samples within
+  * TONE_TOLERANCE of the largest tone. The cost of the bank is the time domain processing
+  * time with the bank less the one without, compared with the FFT and magnitude of each axis.
+  */
+static uint8_t Check_ToneBank(uint16_t FftSize, float Odr)
+{
+  static MotionSP_Ctx_t Tones;
+  static MotionSP_Ctx_t NoTones;
+  uint8_t num = (uint8_t)(sizeof(ToneFreq) / sizeof(ToneFreq[0]));
+  uint16_t circSize = (uint16_t)((FftSize * CIRC_BUFFER_RATIO_NUM) / CIRC_BUFFER_RATIO_DEN);
+  uint32_t memSize = MOTIONSP_CTX_MEM_SIZE(FftSize, circSize);
+  uint32_t samples = TONE_CHECK_BLOCKS * (uint32_t)FftSize;
+  float *pMem = (float *)malloc(2U * memSize * sizeof(float));
+  float *pFft = (float *)malloc(2U * FftSize * sizeof(float));
+  SensorVal_f_t *pSamples = (SensorVal_f_t *)malloc(samples * sizeof(SensorVal_f_t));
+  float *pCirc[NUM_AXES];
+  float binStep = Odr / FftSize;
+  float freq[sizeof(ToneFreq) / sizeof(ToneFreq[0])];
+  uint16_t bin[sizeof(ToneFreq) / sizeof(ToneFreq[0])];
+  float mag[NUM_AXES][sizeof(ToneFreq) / sizeof(ToneFreq[0])];
+  float maxAmp = 0.0f;
+  float maxDiff = 0.0f;
+  double goertzelCycles, fftCycles, t0;
+  uint32_t savedRand = RandState;
+  uint8_t failed = 0;
+
+  if ((pMem == NULL) || (pFft == NULL) || (pSamples == NULL) ||
+      (MotionSP_CtxInit(&Tones, pMem, memSize, FftSize, circSize) != 0) ||
+      (MotionSP_CtxInit(&NoTones, &pMem[memSize], memSize, FftSize, circSize) != 0))
+  {
+    printf("Tone bank check: init failed\n");
+    free(pMem);
+    free(pFft);
+    free(pSamples);
+    return 1;
+  }
+
+  for (uint8_t t = 0; t < num; t++)
+  {
+    bin[t] = (uint16_t)lroundf(ToneFreq[t] / binStep);
+    freq[t] = bin[t] * binStep;
+  }
+
+  MotionSP_CtxSetOdr(&Tones, Odr);
+  MotionSP_CtxSetOdr(&NoTones, Odr);
+  (void)MotionSP_CtxToneBankInit(&Tones, freq, num, FftSize);
+
+  Signal_Generate(pSamples, (uint16_t)samples, 0, Odr);
+  RandState = savedRand;
+
+  goertzelCycles = Ctx_FeedAll(&Tones, pSamples, samples) - Ctx_FeedAll(&NoTones, pSamples, samples);
+
+  /* Full spectrum of the last block, rectangular window */
+  pCirc[0] = Tones.AccCircBuff.Array.X;
+  pCirc[1] = Tones.AccCircBuff.Array.Y;
+  pCirc[2] = Tones.AccCircBuff.Array.Z;
+  fftCycles = 0.0;
+  for (uint8_t axis = 0; axis < NUM_AXES; axis++)
+  {
+    (void)MotionSP_fftInBuild(pFft, FftSize, pCirc[axis], circSize, Tones.AccCircBuff.IdPos);
+    t0 = BENCH_CYCLES();
+    arm_rfft_fast_f32(&Tones.FftS, pFft, &pFft[FftSize], 0);
+    arm_cmplx_mag_f32(&pFft[FftSize], pFft, FftSize / 2);
+    fftCycles += BENCH_CYCLES() - t0;
+
+    for (uint8_t t = 0; t < num; t++)
+    {
+      mag[axis][t] = pFft[bin[t]] * 2.0f / FftSize;
+      if (mag[axis][t] > maxAmp)
+      {
+        maxAmp = mag[axis][t];
+      }
+    }
+  }
+
+  for (uint8_t axis = 0; axis < NUM_AXES; axis++)
+  {
+    for (uint8_t t = 0; t < num; t++)
+    {
+      float goertzel = (&Tones.ToneBank.Tone[t].Amplitude.AXIS_X)[axis];
+      float diff = fabsf(goertzel - mag[axis][t]);
+
+      printf("Tone %c %7.2f Hz: Goertzel %.5f, FFT %.5f m/s^2\n", 'X' + axis, freq[t], goertzel, mag[axis][t]);
+      if (diff > maxDiff)
+      {
+        maxDiff = diff;
+      }
+    }
+  }
+
+  if ((Tones.ToneBank.Ready == 0U) || (maxDiff > (TONE_TOLERANCE * maxAmp)))
+  {
+    failed = 1;
+  }
+
+  printf("Tone bank vs FFT: max difference %.2e m/s^2 (%.4f%% of the largest tone), %u tones %.0f vs FFT %.0f %s/block of %u samples %s\n",
+         maxDiff, 100.0f * maxDiff / maxAmp, num, goertzelCycles / TONE_CHECK_BLOCKS, fftCycles, BENCH_CYCLES_UNIT, FftSize,
+         (failed == 0U) ? "PASS" : "FAIL");
+
+  free(pMem);
+  free(pFft);
+  free(pSamples);
+
+  return failed;
+}
+
+/**
+  * @brief  Feed samples to the time domain processing of a context, restarting on the first one
+  * @param  pCtx pointer to the context
+  * @param  pSamples pointer to the samples in mg
+  * @param  Samples number of samples
+  * @return Processing time
+  */
+static double Ctx_FeedAll(MotionSP_Ctx_t *pCtx, const SensorVal_f_t *pSamples, uint32_t Samples)
+{
+  uint32_t done = 0;
+  double cycles = 0.0;
+  double t0;
+
+  while (done < Samples)
+  {
+    uint32_t n = Samples - done;
+
+    if (n > BENCH_FIFO_SAMPLES)
+    {
+      n = BENCH_FIFO_SAMPLES;
+    }
+
+    t0 = BENCH_CYCLES();
+    done += MotionSP_CtxTimeDomainProcessBlock(pCtx, &pSamples[done], (uint16_t)n, (done == 0U) ? 1U : 0U);
+    cycles += BENCH_CYCLES() - t0;
+  }
+
+  return cycles;
+}
+
+/**
+  * @brief  Check a value against its expected one, with FEATURES_TOLERANCE relative tolerance
+  * @param  pName value name
+  * @param  Value value to check
+  * @param  Expected expected value
+  * @retval 0 in case of success, 1 otherwise
+  */
+static uint8_t Check_Relative(const char *pName, float Value, double Expected)
+{
+  uint8_t ok = (fabs(Value - Expected) <= (FEATURES_TOLERANCE * fabs(Expected))) ? 1U : 0U;
+
+  printf(" %s %.4f/%.4f %s", pName, Value, Expected, (ok != 0U) ? "PASS" : "FAIL");
+
+  return (ok != 0U) ? 0U : 1U;
+}
+
+/**
+  * @brief  Amplitude modulated samples in mg, compensating the DC removal of the time domain processing
+  * @param  pSamples pointer to the output samples
+  * @param  Samples number of samples
+  * @param  pAm pointer to the NUM_AXES axis signals
+  * @param  FftSize FFT size, the frequencies are given as bins
+  * @return none
+  *
+  * @details More details
+  * The signal is the sum of the carrier and of the two side bands. Each one is divided by the
+  * gain and delayed by the phase of the DC removal high-pass filter, so that after the filter
+  * transient the circular buffer holds exactly the modulated signal.
+  */
+static void Signal_AmGenerate(SensorVal_f_t *pSamples, uint32_t Samples, const AmAxis_t *pAm, uint16_t FftSize)
+{
+  float *pAxis[NUM_AXES] = {&pSamples->AXIS_X, &pSamples->AXIS_Y, &pSamples->AXIS_Z};
+
+  for (uint8_t axis = 0; axis < NUM_AXES; axis++)
+  {
+    int32_t bin[3] = {pAm[axis].CarrierBin, pAm[axis].CarrierBin + pAm[axis].FaultBin, pAm[axis].CarrierBin - pAm[axis].FaultBin};
+    double amp[3] = {pAm[axis].Amplitude, pAm[axis].Amplitude * pAm[axis].Depth / 2.0, pAm[axis].Amplitude * pAm[axis].Depth / 2.0};
+    double gain[3];
+    double phase[3];
+
+    /* H(w) = s * (1 - e^-jw) / (1 - s * e^-jw) */
+    for (uint8_t c = 0; c < 3U; c++)
+    {
+      double w = 2.0 * PI * bin[c] / FftSize;
+      double s = DC_SMOOTH;
+
+      gain[c] = s * hypot(1.0 - cos(w), sin(w)) / hypot(1.0 - (s * cos(w)), s * sin(w));
+      phase[c] = atan2(sin(w), 1.0 - cos(w)) - atan2(s * sin(w), 1.0 - (s * cos(w)));
+    }
+
+    for (uint32_t i = 0; i < Samples; i++)
+    {
+      double v = 0.0;
+
+      for (uint8_t c = 0; c < 3U; c++)
+      {
+        v += (amp[c] / gain[c]) * cos((2.0 * PI * (double)((bin[c] * (int64_t)i) % FftSize) / FftSize) - phase[c]);
+      }
+      pAxis[axis][i * NUM_AXES] = (float)(v / G_CONV);
+    }
+  }
+}
+
+/**
+  * @brief  Monotonic time stamp
+  * @return Time in ns
+  */
+static double Now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+  * @brief  Add a latency sample
+  * @param  pStats pointer to the statistics
+  * @param  Value latency in ns
+  * @return none
+  */
+static void Stats_Add(LatencyStats_t *pStats, double Value)
+{
+  pStats->Sum += Value;
+  pStats->Num++;
+
+  if (Value < pStats->Min)
+  {
+    pStats->Min = Value;
+  }
+
+  if (Value > pStats->Max)
+  {
+    pStats->Max = Value;
+  }
+}
+
+/**
+  * @brief  Gaussian noise sample (xorshift32 and Box-Muller), reproducible across runs
+  * @return Noise sample with unit variance
+  */
+static float Noise_Gauss(void)
+{
+  float u1, u2;
+
+  RandState ^= RandState << 13;
+  RandState ^= RandState >> 17;
+  RandState ^= RandState << 5;
+  u1 = ((float)(RandState >> 8) + 1.0f) / 16777217.0f;
+
+  RandState ^= RandState << 13;
+  RandState ^= RandState >> 17;
+  RandState ^= RandState << 5;
+  u2 = (float)(RandState >> 8) / 16777216.0f;
+
+  return sqrtf(-2.0f * logf(u1)) * cosf(2.0f * PI * u2);
+}
+
+/**
+  * @brief  Uniform random sample (xorshift32), reproducible across runs
+  * @return Sample in [-1, 1)
+  */
+static float Rand_Uniform(void)
+{
+  RandState ^= RandState << 13;
+  RandState ^= RandState >> 17;
+  RandState ^= RandState << 5;
+
+  return ((float)(RandState >> 8) / 8388608.0f) - 1.0f;
+}
+
+/**
+  * @brief  Synthetic vibration of a rotating machine with a damaged bearing, in mg
+  * @param  pSamples pointer to the output samples
+  * @param  Samples number of samples to generate
+  * @param  FirstIndex index of the first sample since the beginning of the run
+  * @param  Odr sampling frequency in Hz
+  * @return none
+  *
+  * @details More details
+  * Unbalance at the shaft frequency and its 2nd harmonic, bearing impacts ringing
+  * a structural resonance at the fault repetition rate, gravity on Z and noise.
+  */
+static void Signal_Generate(SensorVal_f_t *pSamples, uint16_t Samples, uint32_t FirstIndex, float Odr)
+{
+  for (uint16_t i = 0; i < Samples; i++)
+  {
+    double t = (double)(FirstIndex + i) / Odr;
+    double tImpact = fmod(t, 1.0 / BEARING_FAULT_FREQ);
+    float shaft = (float)sin(2.0 * PI * SHAFT_FREQ * t);
+    float shaft2 = (float)sin(4.0 * PI * SHAFT_FREQ * t + 0.7);
+    float impact = (float)(exp(-RESONANCE_DAMPING * tImpact) * sin(2.0 * PI * RESONANCE_FREQ * tImpact));
+
+    pSamples[i].AXIS_X = (120.0f * shaft) + (35.0f * shaft2) + (60.0f * impact) + (4.0f * Noise_Gauss());
+    pSamples[i].AXIS_Y = (80.0f * shaft) + (20.0f * shaft2) + (25.0f * impact) + (4.0f * Noise_Gauss());
+    pSamples[i].AXIS_Z = 1000.0f + (15.0f * shaft) + (40.0f * impact) + (4.0f * Noise_Gauss());
+  }
+}
+
+/**
+  * @brief  Check the block time domain processing against the per-sample one
+  * @param  CircSize circular buffer size for each axis, up to CIRC_BUFFER_SIZE_MAX
+  * @param  Odr sampling frequency in Hz
+  * @retval 0 in case of success, 1 otherwise
+  *
+  * @details More details
+  * For each time domain type, the same samples are processed with MotionSP_accDelOffset,
+  * MotionSP_CreateAccCircBuffer and MotionSP_TimeDomainProcess for each sample, then with
+  * MotionSP_TimeDomainProcessBlock on blocks of random size. As for a continuous stream,
+  * the samples after the circular buffer wrap start the next block, and the filters are
+  * restarted in the middle of the run. The time domain
+  * results after each block and the final circular buffer have to be equal to the per-sample
+  * ones. Both paths are then timed TD_CHECK_TIMING_RUNS times without the checks, and the
+  * fastest block run must not take more cycles than the fastest per-sample run.
+  */
+static uint8_t Check_TimeDomainBlock(uint16_t CircSize, float Odr)
+{
+  static const Td_Type_t TdTypes[] = {TD_SPEED, TD_ACCELERO, TD_BOTH_TAU};
+  static const char *const TdNames[] = {"speed", "accelero", "both"};
+  uint32_t samples = (TD_CHECK_CIRC_ROUNDS * (uint32_t)CircSize) + BENCH_FIFO_SAMPLES + 7U;
+  SensorVal_f_t *pSamples = (SensorVal_f_t *)malloc(samples * sizeof(SensorVal_f_t));
+  sAcceleroParam_t *pRef = (sAcceleroParam_t *)malloc(samples * sizeof(sAcceleroParam_t));
+  sAccAxesCircBufferData_t *pRefCirc = (sAccAxesCircBufferData_t *)malloc(sizeof(sAccAxesCircBufferData_t));
+  uint32_t savedRand = RandState;
+  uint8_t failed = 0;
+
+  if ((pSamples == NULL) || (pRef == NULL) || (pRefCirc == NULL))
+  {
+    printf("Time domain check: out of memory\n");
+    free(pSamples);
+    free(pRef);
+    free(pRefCirc);
+    return 1;
+  }
+
+  Signal_Generate(pSamples, (uint16_t)samples, 0, Odr);
+  RandState = savedRand;
+
+  for (uint8_t t = 0; t < (uint8_t)(sizeof(TdTypes) / sizeof(TdTypes[0])); t++)
+  {
+    uint16_t refIdPos;
+    uint32_t mismatches = 0;
+    uint32_t blocks = 0;
+    double refCycles = 0.0;
+    double blockCycles = 0.0;
+    uint8_t slower;
+
+    /* Reference: per-sample processing, as the application before the block API */
+    Legacy_Reset(CircSize, Odr, TdTypes[t]);
+    (void)Td_RunPerSample(pSamples, samples, TdTypes[t], pRef);
+    memcpy(pRefCirc, &AccCircBuffer.Data, sizeof(sAccAxesCircBufferData_t));
+    refIdPos = AccCircBuffer.IdPos;
+
+    /* Block processing, with the unprocessed tail carried to the next block */
+    Legacy_Reset(CircSize, Odr, TdTypes[t]);
+    (void)Td_RunBlock(pSamples, samples, TdTypes[t], pRef, &blocks, &mismatches);
+
+    if ((AccCircBuffer.IdPos != refIdPos) || (memcmp(&AccCircBuffer.Data, pRefCirc, sizeof(sAccAxesCircBufferData_t)) != 0))
+    {
+      mismatches++;
+    }
+
+    /* Timing: the fastest of several runs of each path, interleaved to share the host conditions */
+    for (uint32_t r = 0; r < TD_CHECK_TIMING_RUNS; r++)
+    {
+      double cycles;
+
+      Legacy_Reset(CircSize, Odr, TdTypes[t]);
+      cycles = Td_RunPerSample(pSamples, samples, TdTypes[t], NULL);
+      if ((r == 0U) || (cycles < refCycles))
+      {
+        refCycles = cycles;
+      }
+
+      Legacy_Reset(CircSize, Odr, TdTypes[t]);
+      cycles = Td_RunBlock(pSamples, samples, TdTypes[t], NULL, NULL, NULL);
+      if ((r == 0U) || (cycles < blockCycles))
+      {
+        blockCycles = cycles;
+      }
+    }
+    slower = (blockCycles > refCycles) ? 1U : 0U;
+
+    printf("Time domain %-8s block vs per-sample: %lu blocks, %lu mismatches, %.1f vs %.1f %s/sample %s\n",
+           TdNames[t], (unsigned long)blocks, (unsigned long)mismatches, blockCycles / samples, refCycles / samples,
+           BENCH_CYCLES_UNIT, ((mismatches == 0U) && (slower == 0U)) ? "PASS" : "FAIL");
+
+    if (slower != 0U)
+    {
+      printf("  The block path is slower than the per-sample path\n");
+    }
+
+    if ((mismatches != 0U) || (slower != 0U))
+    {
+      failed = 1;
+    }
+  }
+
+  free(pSamples);
+  free(pRef);
+  free(pRefCirc);
+
+  return failed;
+}
+
+/**
+  * @brief  Per-sample time domain processing of the global MotionSP API
+  * @param  pSamples pointer to the samples in mg
+  * @param  Samples number of samples
+  * @param  TdType time domain analysis type
+  * @param  pRef pointer to the time domain results after each sample, NULL for a timed run
+  * @return Processing time
+  */
+static double Td_RunPerSample(const SensorVal_f_t *pSamples, uint32_t Samples, Td_Type_t TdType, sAcceleroParam_t *pRef)
+{
+  SensorVal_f_t noDc;
+  SensorVal_f_t in;
+  double t0 = BENCH_CYCLES();
+
+  for (uint32_t i = 0; i < Samples; i++)
+  {
+    uint8_t restart = ((i == 0U) || (i == TD_CHECK_RESTART_POS)) ? 1U : 0U;
+
+    in = pSamples[i];
+    MotionSP_accDelOffset(&noDc, &in, DC_SMOOTH, restart);
+    MotionSP_CreateAccCircBuffer(&AccCircBuffer, noDc);
+    AccCircBuffer.Ovf = 0;
+    MotionSP_TimeDomainProcess(&sTimeDomain, TdType, restart);
+    if (pRef != NULL)
+    {
+      pRef[i] = sTimeDomain;
+    }
+  }
+
+  return BENCH_CYCLES() - t0;
+}
+
+/**
+  * @brief  Block time domain processing of the global MotionSP API, on blocks of random size
+  * @param  pSamples pointer to the samples in mg
+  * @param  Samples number of samples
+  * @param  TdType time domain analysis type
+  * @param  pRef pointer to the per-sample results to be compared after each block, NULL for a timed run
+  * @param  pBlocks pointer to the number of blocks, used with pRef
+  * @param  pMismatches pointer to the number of mismatches, used with pRef
+  * @return Processing time
+  */
+static double Td_RunBlock(const SensorVal_f_t *pSamples, uint32_t Samples, Td_Type_t TdType, const sAcceleroParam_t *pRef,
+                          uint32_t *pBlocks, uint32_t *pMismatches)
+{
+  uint32_t blockRand = 0x9E3779B9U;
+  uint32_t next = 0;
+  double t0 = BENCH_CYCLES();
+
+  while (next < Samples)
+  {
+    uint16_t n;
+    uint16_t processed;
+    uint8_t restart = ((next == 0U) || (next == TD_CHECK_RESTART_POS)) ? 1U : 0U;
+
+    blockRand ^= blockRand << 13;
+    blockRand ^= blockRand >> 17;
+    blockRand ^= blockRand << 5;
+    n = (uint16_t)(1U + (blockRand % BENCH_FIFO_SAMPLES));
+
+    if ((next < TD_CHECK_RESTART_POS) && ((next + n) > TD_CHECK_RESTART_POS))
+    {
+      n = (uint16_t)(TD_CHECK_RESTART_POS - next);
+    }
+    if ((next + n) > Samples)
+    {
+      n = (uint16_t)(Samples - next);
+    }
+
+    processed = MotionSP_TimeDomainProcessBlock(&sTimeDomain, &AccCircBuffer, &pSamples[next], n, TdType, restart);
+    AccCircBuffer.Ovf = 0;
+
+    if ((processed == 0U) || (processed > n))
+    {
+      if (pMismatches != NULL)
+      {
+        (*pMismatches)++;
+      }
+      break;
+    }
+
+    next += processed;
+
+    if (pRef != NULL)
+    {
+      (*pBlocks)++;
+      if (memcmp(&sTimeDomain, &pRef[next - 1U], sizeof(sAcceleroParam_t)) != 0)
+      {
+        (*pMismatches)++;
+      }
+    }
+  }
+
+  return BENCH_CYCLES() - t0;
+}
+
+/**
+  * @brief  Reset the circular buffer and the results of the global MotionSP API
+  * @param  CircSize circular buffer size for each axis
+  * @param  Odr sampling frequency in Hz
+  * @param  TdType time domain analysis type
+  * @return none
+  */
+static void Legacy_Reset(uint16_t CircSize, float Odr, Td_Type_t TdType)
+{
+  memset((void *)&AccCircBuffer, 0, sizeof(AccCircBuffer));
+  memset((void *)&sTimeDomain, 0, sizeof(sTimeDomain));
+  AccCircBuffer.Size = CircSize;
+  MotionSP_Parameters.td_type = (uint16_t)TdType;
+  MotionSP_Parameters.tau = TAU_DEFAULT;
+  AcceleroODR.Frequency = Odr;
+  AcceleroODR.Period = 1.0f / Odr;
+  AcceleroODR.Tau = expf(-(1000.0f * AcceleroODR.Period) / MotionSP_Parameters.tau);
+}
+
+/**
+  * @brief  Print the command line help
+  * @param  pName program name
+  * @return none
+  */
+static void Print_Usage(const char *pName)
+{
+  printf("Usage: %s [fft_size %u..%u] [frames] [overlap %u..%u %%] [envelope 0/1]\n", pName,
+         FFT_SIZE_256, FFT_SIZE_MAX, FFT_OVL_MIN, FFT_OVL_MAX);
+}